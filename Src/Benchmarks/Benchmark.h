@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * Minimal timing for the benchmarks in this directory: each case runs a number of times and reports
+ * its fastest run, which filters out the scheduler and cache warm up.
+ */
+namespace Benchmark
+{
+    constexpr int32_t DefaultNumRuns = 30;
+
+    inline volatile char Sink = 0;
+
+    /** Runs Body NumRuns times and prints the fastest run, in total and per item. Returns it in milliseconds. */
+    template <typename BodyType>
+    double Run(const char* Name, int64_t NumItems, BodyType Body, int32_t NumRuns = DefaultNumRuns)
+    {
+        double BestMilliseconds = 1.e30;
+        for (int32_t Run = 0; Run < NumRuns; ++Run)
+        {
+            const auto Start = std::chrono::steady_clock::now();
+            Body();
+            const std::chrono::duration<double, std::milli> Elapsed = std::chrono::steady_clock::now() - Start;
+            BestMilliseconds = Elapsed.count() < BestMilliseconds ? Elapsed.count() : BestMilliseconds;
+        }
+
+        std::printf("%-40s %10.3f ms %10.2f ns / item\n", Name, BestMilliseconds, BestMilliseconds * 1.e6 / (double)NumItems);
+        return BestMilliseconds;
+    }
+
+    /** Keeps a result alive so the compiler cannot drop the work that produced it. */
+    template <typename ValueType>
+    void DoNotOptimize(const ValueType& Value)
+    {
+        Sink = *reinterpret_cast<const volatile char*>(&Value);
+    }
+}
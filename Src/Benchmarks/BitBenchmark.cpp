@@ -0,0 +1,194 @@
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+#include "Base/RandomStream.h"
+#include "Benchmark.h"
+
+#include <vector>
+
+/**
+ * FMath bit operations against the portable versions they replaced, kept below as the reference, and
+ * the bitset helpers against testing one bit at a time. Without popcnt enabled (-mpopcnt, /arch:AVX)
+ * CountBits compiles to the same SWAR code as the reference.
+ */
+
+namespace
+{
+    constexpr int32_t NumValues = 1 << 22;
+
+    constexpr int32_t NumWords = 1 << 20;
+
+    namespace Reference
+    {
+        uint32_t FloorLog2(uint32_t Value)
+        {
+            uint32_t Position = 0;
+            if (Value >= 1u << 16) { Value >>= 16; Position += 16; }
+            if (Value >= 1u << 8) { Value >>= 8; Position += 8; }
+            if (Value >= 1u << 4) { Value >>= 4; Position += 4; }
+            if (Value >= 1u << 2) { Value >>= 2; Position += 2; }
+            if (Value >= 1u << 1) { Position += 1; }
+            return Value == 0 ? 0 : Position;
+        }
+
+        uint32_t CountLeadingZeros(uint32_t Value)
+        {
+            return Value == 0 ? 32 : 31 - FloorLog2(Value);
+        }
+
+        uint32_t CountTrailingZeros(uint32_t Value)
+        {
+            if (Value == 0)
+            {
+                return 32;
+            }
+
+            uint32_t Result = 0;
+            while ((Value & 1) == 0)
+            {
+                Value >>= 1;
+                ++Result;
+            }
+            return Result;
+        }
+
+        int32_t CountBits(uint64_t Bits)
+        {
+            Bits -= (Bits >> 1) & 0x5555555555555555ull;
+            Bits = (Bits & 0x3333333333333333ull) + ((Bits >> 2) & 0x3333333333333333ull);
+            Bits = (Bits + (Bits >> 4)) & 0x0f0f0f0f0f0f0f0full;
+            return (int32_t)((Bits * 0x0101010101010101ull) >> 56);
+        }
+
+        bool IsBitSet(const uint64_t* Words, int64_t Bit)
+        {
+            return (Words[Bit / 64] >> (Bit % 64)) & 1;
+        }
+
+        int64_t FindFirstSetBit(const uint64_t* Words, int32_t NumWords, int64_t StartBit)
+        {
+            for (int64_t Bit = StartBit; Bit < (int64_t)NumWords * 64; ++Bit)
+            {
+                if (IsBitSet(Words, Bit))
+                {
+                    return Bit;
+                }
+            }
+            return -1;
+        }
+    }
+
+    /** Runs Function over every value and returns the sum of its results, which keeps the calls alive. */
+    template <typename FunctionType>
+    uint64_t SumOver(const std::vector<uint32_t>& Values, FunctionType Function)
+    {
+        uint64_t Sum = 0;
+        for (const uint32_t Value : Values)
+        {
+            Sum += Function(Value);
+        }
+        return Sum;
+    }
+
+    /** Times Function and ReferenceFunction over Values and checks that they agree. */
+    template <typename FunctionType, typename ReferenceFunctionType>
+    void Compare(const char* Name, const std::vector<uint32_t>& Values, FunctionType Function, ReferenceFunctionType ReferenceFunction)
+    {
+        uint64_t Sum = 0, ReferenceSum = 0;
+        const std::string ReferenceName = std::string(Name) + " reference";
+        Benchmark::Run(ReferenceName.c_str(), (int64_t)Values.size(), [&]() { ReferenceSum = SumOver(Values, ReferenceFunction); });
+        Benchmark::Run(Name, (int64_t)Values.size(), [&]() { Sum = SumOver(Values, Function); });
+        if (Sum != ReferenceSum)
+        {
+            std::printf("%s disagrees with the reference\n", Name);
+        }
+    }
+
+    void BenchmarkWordFunctions(FRandomStream& Stream)
+    {
+        std::printf("\nWord functions, %d values\n", NumValues);
+
+        // Shifted so the highest and lowest set bits spread over every position, and never zero
+        std::vector<uint32_t> HighValues(NumValues), LowValues(NumValues);
+        for (int32_t Index = 0; Index < NumValues; ++Index)
+        {
+            HighValues[Index] = (Stream.GetUnsignedInt() | 0x80000000u) >> (Stream.GetUnsignedInt() % 32);
+            LowValues[Index] = (Stream.GetUnsignedInt() | 1u) << (Stream.GetUnsignedInt() % 32);
+        }
+
+        Compare("FloorLog2", HighValues, [](uint32_t Value) { return FMath::FloorLog2(Value); }, [](uint32_t Value) { return Reference::FloorLog2(Value); });
+        Compare("CountLeadingZeros", HighValues, [](uint32_t Value) { return FMath::CountLeadingZeros(Value); }, [](uint32_t Value) { return Reference::CountLeadingZeros(Value); });
+        Compare("CountTrailingZeros", LowValues, [](uint32_t Value) { return FMath::CountTrailingZeros(Value); }, [](uint32_t Value) { return Reference::CountTrailingZeros(Value); });
+        Compare("CountBits", LowValues, [](uint32_t Value) { return FMath::CountBits(Value); }, [](uint32_t Value) { return Reference::CountBits(Value); });
+    }
+
+    void BenchmarkBitsets(FRandomStream& Stream)
+    {
+        std::printf("\nBitsets, %d words\n", NumWords);
+
+        // About one bit in 64 set, the density of a visibility mask or a mostly free allocator
+        std::vector<uint64_t> Words(NumWords);
+        for (uint64_t& Word : Words)
+        {
+            Word = Stream.GetUnsignedInt64() & Stream.GetUnsignedInt64() & Stream.GetUnsignedInt64() & Stream.GetUnsignedInt64() & Stream.GetUnsignedInt64() & Stream.GetUnsignedInt64();
+        }
+
+        int64_t NumSetBits = 0, ReferenceNumSetBits = 0;
+        Benchmark::Run("CountBits reference", NumWords, [&]()
+        {
+            ReferenceNumSetBits = 0;
+            for (const uint64_t Word : Words)
+            {
+                ReferenceNumSetBits += Reference::CountBits(Word);
+            }
+        });
+        Benchmark::Run("CountBits over words", NumWords, [&]() { NumSetBits = FMath::CountBits(Words.data(), NumWords); });
+
+        int64_t BitSum = 0, ReferenceBitSum = 0;
+        Benchmark::Run("ForEachSetBit reference", NumWords, [&]()
+        {
+            ReferenceBitSum = 0;
+            for (int64_t Bit = 0; Bit < (int64_t)NumWords * 64; ++Bit)
+            {
+                ReferenceBitSum += Reference::IsBitSet(Words.data(), Bit) ? Bit : 0;
+            }
+        }, 5);
+        Benchmark::Run("ForEachSetBit", NumWords, [&]()
+        {
+            BitSum = 0;
+            FMath::ForEachSetBit(Words.data(), NumWords, [&BitSum](int64_t Bit) { BitSum += Bit; });
+        });
+
+        // Walks the set bits the way an allocator looks for its next candidate
+        int64_t FoundSum = 0, ReferenceFoundSum = 0;
+        Benchmark::Run("FindFirstSetBit reference walk", NumWords, [&]()
+        {
+            ReferenceFoundSum = 0;
+            for (int64_t Bit = Reference::FindFirstSetBit(Words.data(), NumWords, 0); Bit >= 0; Bit = Reference::FindFirstSetBit(Words.data(), NumWords, Bit + 1))
+            {
+                ReferenceFoundSum += Bit;
+            }
+        }, 5);
+        Benchmark::Run("FindFirstSetBit walk", NumWords, [&]()
+        {
+            FoundSum = 0;
+            for (int64_t Bit = FMath::FindFirstSetBit(Words.data(), NumWords, 0); Bit >= 0; Bit = FMath::FindFirstSetBit(Words.data(), NumWords, Bit + 1))
+            {
+                FoundSum += Bit;
+            }
+        });
+
+        if (NumSetBits != ReferenceNumSetBits || BitSum != ReferenceBitSum || FoundSum != ReferenceFoundSum || BitSum != FoundSum)
+        {
+            std::printf("Bitset helpers disagree with the reference\n");
+        }
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0xB175);
+
+    BenchmarkWordFunctions(Stream);
+    BenchmarkBitsets(Stream);
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+#include "Base/RandomStream.h"
+#include "Render/SwizzledTexture.h"
+#include "Benchmark.h"
+
+#include <vector>
+
+/**
+ * Row-major against FSwizzledTexture tiles for bilinear sampling along rotated walks. The row-major
+ * sampler below repeats the FSwizzledTexture::SampleBilinear math with only the texel index changed, so
+ * the difference between the two is the storage layout. A scalar row-major sampler is the baseline.
+ */
+
+namespace
+{
+    constexpr int32_t TextureSize = 2048;
+
+    // Samples per walk in each direction, every sample steps two texels, the access pattern of a
+    // minified or distant surface
+    constexpr int32_t NumSamplesPerAxis = 1024;
+    constexpr float TexelsPerSample = 2.0f;
+
+    /** Row-major level 0 of a texture, wrap addressing. */
+    class FRowMajorTexture
+    {
+    public:
+        FRowMajorTexture(const uint32_t* InTexels, int32_t InWidth, int32_t InHeight)
+            : Texels(InTexels, InTexels + (size_t)InWidth * InHeight), Width(InWidth), Height(InHeight)
+        {
+        }
+
+        FColorWide SampleBilinear(const FFloatWide& U, const FFloatWide& V) const
+        {
+            const FFloatWide WideWidth((float)Width);
+            const FFloatWide WideHeight((float)Height);
+            const FFloatWide Half(0.5f);
+            const FFloatWide One(1.0f);
+            const FFloatWide X = Sanitize(FFloatWide::MulAdd(U, WideWidth, -Half));
+            const FFloatWide Y = Sanitize(FFloatWide::MulAdd(V, WideHeight, -Half));
+            const FFloatWide FloorX = X.Floor();
+            const FFloatWide FloorY = Y.Floor();
+            const FFloatWide FractionX = X - FloorX;
+            const FFloatWide FractionY = Y - FloorY;
+
+            const FFloatWide InvWidth = One / WideWidth;
+            const FFloatWide InvHeight = One / WideHeight;
+            const FIntWide X0 = Wrap(FloorX, WideWidth, InvWidth).TruncToInt();
+            const FIntWide X1 = Wrap(FloorX + One, WideWidth, InvWidth).TruncToInt();
+            const FIntWide Row0 = (Wrap(FloorY, WideHeight, InvHeight) * WideWidth).TruncToInt();
+            const FIntWide Row1 = (Wrap(FloorY + One, WideHeight, InvHeight) * WideWidth).TruncToInt();
+
+            const int32_t* Base = (const int32_t*)Texels.data();
+            const FIntWide Texel00 = FIntWide::Gather(Base, Row0 + X0);
+            const FIntWide Texel10 = FIntWide::Gather(Base, Row0 + X1);
+            const FIntWide Texel01 = FIntWide::Gather(Base, Row1 + X0);
+            const FIntWide Texel11 = FIntWide::Gather(Base, Row1 + X1);
+
+            FFloatWide Channels[4];
+            const FFloatWide Scale(1.0f / 255.0f);
+            for (int32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                const FFloatWide C00 = GetChannel(Texel00, Channel);
+                const FFloatWide C01 = GetChannel(Texel01, Channel);
+                const FFloatWide Top = FFloatWide::MulAdd(GetChannel(Texel10, Channel) - C00, FractionX, C00);
+                const FFloatWide Bottom = FFloatWide::MulAdd(GetChannel(Texel11, Channel) - C01, FractionX, C01);
+                Channels[Channel] = FFloatWide::MulAdd(Bottom - Top, FractionY, Top) * Scale;
+            }
+            return { Channels[0], Channels[1], Channels[2], Channels[3] };
+        }
+
+        /** One channel of one sample at a time. */
+        float SampleBilinearScalar(float U, float V, int32_t Channel) const
+        {
+            const float X = U * Width - 0.5f;
+            const float Y = V * Height - 0.5f;
+            const float FloorX = FMath::FloorToFloat(X);
+            const float FloorY = FMath::FloorToFloat(Y);
+            const float FractionX = X - FloorX;
+            const float FractionY = Y - FloorY;
+
+            const int32_t X0 = WrapScalar((int32_t)FloorX, Width);
+            const int32_t X1 = WrapScalar((int32_t)FloorX + 1, Width);
+            const int32_t Y0 = WrapScalar((int32_t)FloorY, Height);
+            const int32_t Y1 = WrapScalar((int32_t)FloorY + 1, Height);
+
+            const auto GetTexelChannel = [&](int32_t TexelX, int32_t TexelY)
+            {
+                return (float)((Texels[(size_t)TexelY * Width + TexelX] >> (Channel * 8)) & 0xFF);
+            };
+            const float Top = FMath::Lerp(GetTexelChannel(X0, Y0), GetTexelChannel(X1, Y0), FractionX);
+            const float Bottom = FMath::Lerp(GetTexelChannel(X0, Y1), GetTexelChannel(X1, Y1), FractionX);
+            return FMath::Lerp(Top, Bottom, FractionY) * (1.0f / 255.0f);
+        }
+
+    private:
+        static FFloatWide Sanitize(const FFloatWide& Coordinate)
+        {
+            const FFloatWide Limit(8388608.0f);
+            return FFloatWide::Select(FFloatWide::Abs(Coordinate) <= FFloatWide(FLT_MAX), FFloatWide::Clamp(Coordinate, -Limit, Limit), FFloatWide(0.0f));
+        }
+
+        static FFloatWide Wrap(const FFloatWide& Coordinate, const FFloatWide& Size, const FFloatWide& InvSize)
+        {
+            const FFloatWide Wrapped = Coordinate - (Coordinate * InvSize).Floor() * Size;
+            const FFloatWide Zero(0.0f);
+            return FFloatWide::Select(Wrapped < Zero, Wrapped + Size, FFloatWide::Select(Wrapped >= Size, Wrapped - Size, Wrapped));
+        }
+
+        static int32_t WrapScalar(int32_t Coordinate, int32_t Size)
+        {
+            const int32_t Wrapped = Coordinate % Size;
+            return Wrapped < 0 ? Wrapped + Size : Wrapped;
+        }
+
+        static FFloatWide GetChannel(const FIntWide& Texels, int32_t Channel)
+        {
+            return (Texels.ShiftRightLogical(Channel * 8) & FIntWide(0xFF)).ToFloat();
+        }
+
+    private:
+        std::vector<uint32_t> Texels;
+        int32_t Width;
+        int32_t Height;
+    };
+
+    void BenchmarkWalk(const char* Name, float Angle, const FSwizzledTexture& SwizzledTexture, const FRowMajorTexture& RowMajorTexture)
+    {
+        constexpr int32_t NumSamples = NumSamplesPerAxis * NumSamplesPerAxis;
+        std::printf("\n%s walk, %d samples\n", Name, NumSamples);
+
+        // Sample coordinates along rows of a grid rotated by Angle, computed up front so only the sampling is timed
+        std::vector<float> U(NumSamples), V(NumSamples);
+        const float Cos = FMath::Cos(Angle);
+        const float Sin = FMath::Sin(Angle);
+        const float Step = TexelsPerSample / TextureSize;
+        for (int32_t Y = 0; Y < NumSamplesPerAxis; ++Y)
+        {
+            for (int32_t X = 0; X < NumSamplesPerAxis; ++X)
+            {
+                U[(size_t)Y * NumSamplesPerAxis + X] = (Cos * X - Sin * Y) * Step;
+                V[(size_t)Y * NumSamplesPerAxis + X] = (Sin * X + Cos * Y) * Step;
+            }
+        }
+
+        FFloatWide Sum(0.0f), RowMajorSum(0.0f);
+        float ScalarSum = 0.0f;
+        Benchmark::Run("Row-major scalar", NumSamples, [&]()
+        {
+            ScalarSum = 0.0f;
+            for (int32_t Index = 0; Index < NumSamples; ++Index)
+            {
+                for (int32_t Channel = 0; Channel < 4; ++Channel)
+                {
+                    ScalarSum += RowMajorTexture.SampleBilinearScalar(U[Index], V[Index], Channel);
+                }
+            }
+        }, 5);
+        Benchmark::Run("Row-major wide", NumSamples, [&]()
+        {
+            RowMajorSum = FFloatWide(0.0f);
+            for (int32_t Index = 0; Index < NumSamples; Index += FFloatWide::Lanes)
+            {
+                const FColorWide Color = RowMajorTexture.SampleBilinear(FFloatWide::Load(&U[Index]), FFloatWide::Load(&V[Index]));
+                RowMajorSum += Color.R + Color.G + Color.B + Color.A;
+            }
+        });
+        Benchmark::Run("FSwizzledTexture::SampleBilinear", NumSamples, [&]()
+        {
+            Sum = FFloatWide(0.0f);
+            for (int32_t Index = 0; Index < NumSamples; Index += FFloatWide::Lanes)
+            {
+                const FColorWide Color = SwizzledTexture.SampleBilinear(FFloatWide::Load(&U[Index]), FFloatWide::Load(&V[Index]), 0);
+                Sum += Color.R + Color.G + Color.B + Color.A;
+            }
+        });
+
+        Benchmark::DoNotOptimize(ScalarSum);
+        Benchmark::DoNotOptimize(RowMajorSum);
+        Benchmark::DoNotOptimize(Sum);
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0x5E16);
+
+    std::printf("FFloatWide::Lanes = %d, %dx%d texture\n", FFloatWide::Lanes, TextureSize, TextureSize);
+
+    std::vector<uint32_t> Texels((size_t)TextureSize * TextureSize);
+    for (uint32_t& Texel : Texels)
+    {
+        Texel = Stream.GetUnsignedInt();
+    }
+
+    FSwizzledTexture SwizzledTexture;
+    SwizzledTexture.Initialize(Texels.data(), TextureSize, TextureSize, false);
+    const FRowMajorTexture RowMajorTexture(Texels.data(), TextureSize, TextureSize);
+
+    BenchmarkWalk("Axis aligned", 0.0f, SwizzledTexture, RowMajorTexture);
+    BenchmarkWalk("Rotated 45 degrees", PI / 4.0f, SwizzledTexture, RowMajorTexture);
+    BenchmarkWalk("Rotated 90 degrees", PI / 2.0f, SwizzledTexture, RowMajorTexture);
+    return 0;
+}
@@ -0,0 +1,256 @@
+#include "CoreMinimal.h"
+#include "Base/Transform.h"
+#include "Base/RandomStream.h"
+#include "Benchmark.h"
+
+#include "glm/gtc/matrix_inverse.hpp"
+
+#include <cstring>
+#include <vector>
+
+/**
+ * FTransform batch functions and ComposeHierarchy against the glm code they replace: mat4 products
+ * down the hierarchy and glm quaternion / vector transforms, and against the scalar FTransform loops.
+ */
+
+namespace
+{
+    constexpr int32_t NumTransforms = 100000;
+
+    // Children per node of the breadth first hierarchy
+    constexpr int32_t BranchingFactor = 4;
+
+    // Nodes per chain of the depth first hierarchy, each chain hangs off a random earlier node
+    constexpr int32_t ChainLength = 50;
+
+    /** glm counterpart of FTransform */
+    struct FGlmTransform
+    {
+        glm::quat Rotation;
+        glm::vec3 Translation;
+        glm::vec3 Scale3D;
+    };
+
+    FTransform MakeRandomTransform(FRandomStream& Stream)
+    {
+        const FQuat Rotation(Stream.GetUnitVector(), Stream.FRandRange(-PI, PI));
+        const MVector Translation(Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-1.0f, 1.0f));
+        return FTransform(Rotation, Translation, MVector(Stream.FRandRange(0.9f, 1.1f)));
+    }
+
+    /** The request behind ComposeHierarchy and the batch functions targets 3x over glm. */
+    constexpr double TargetSpeedup = 3.0;
+
+    void PrintSpeedup(const char* Name, const char* BaselineName, double BaselineMilliseconds, double Milliseconds)
+    {
+        const double Speedup = BaselineMilliseconds / Milliseconds;
+        std::printf("%s speedup over %s: %.2fx (target %.0fx, %s)\n", Name, BaselineName, Speedup, TargetSpeedup, Speedup >= TargetSpeedup ? "met" : "missed");
+    }
+
+    float GetMaxTranslationError(const std::vector<FTransform>& A, const std::vector<FTransform>& B)
+    {
+        float MaxError = 0.0f;
+        for (size_t Index = 0; Index < A.size(); ++Index)
+        {
+            MaxError = FMath::Max(MaxError, (A[Index].Translation - B[Index].Translation).Size());
+        }
+        return MaxError;
+    }
+
+    void BenchmarkHierarchy(const char* Name, const std::vector<FTransform>& LocalTransforms, const std::vector<int32_t>& ParentIndices)
+    {
+        std::printf("\n%s hierarchy, %d transforms\n", Name, NumTransforms);
+
+        std::vector<glm::mat4> GlmLocalMatrices(NumTransforms), GlmWorldMatrices(NumTransforms);
+        std::vector<FGlmTransform> GlmLocalTransforms(NumTransforms), GlmWorldTransforms(NumTransforms);
+        for (int32_t Index = 0; Index < NumTransforms; ++Index)
+        {
+            const FTransform& Local = LocalTransforms[Index];
+            GlmLocalMatrices[Index] = Local.ToMatrixWithScale();
+            GlmLocalTransforms[Index] = { Local.Rotation, Local.Translation, Local.Scale3D };
+        }
+
+        const double GlmMatrixMilliseconds = Benchmark::Run("glm mat4", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                const int32_t Parent = ParentIndices[Index];
+                GlmWorldMatrices[Index] = Parent >= 0 ? GlmWorldMatrices[Parent] * GlmLocalMatrices[Index] : GlmLocalMatrices[Index];
+            }
+        });
+        Benchmark::DoNotOptimize(GlmWorldMatrices.back());
+
+        const double GlmTransformMilliseconds = Benchmark::Run("glm quat / vec3", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                const int32_t Parent = ParentIndices[Index];
+                if (Parent < 0)
+                {
+                    GlmWorldTransforms[Index] = GlmLocalTransforms[Index];
+                    continue;
+                }
+
+                const FGlmTransform& ParentWorld = GlmWorldTransforms[Parent];
+                const FGlmTransform& Local = GlmLocalTransforms[Index];
+                GlmWorldTransforms[Index] = { ParentWorld.Rotation * Local.Rotation, ParentWorld.Rotation * (ParentWorld.Scale3D * Local.Translation) + ParentWorld.Translation, ParentWorld.Scale3D * Local.Scale3D };
+            }
+        });
+        Benchmark::DoNotOptimize(GlmWorldTransforms.back());
+
+        std::vector<FTransform> ScalarWorldTransforms(NumTransforms);
+        Benchmark::Run("FTransform scalar loop", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                const int32_t Parent = ParentIndices[Index];
+                ScalarWorldTransforms[Index] = Parent >= 0 ? LocalTransforms[Index] * ScalarWorldTransforms[Parent] : LocalTransforms[Index];
+            }
+        });
+
+        std::vector<FTransform> WorldTransforms(NumTransforms);
+        const double ComposeMilliseconds = Benchmark::Run("FTransform::ComposeHierarchy", NumTransforms, [&]()
+        {
+            FTransform::ComposeHierarchy(LocalTransforms.data(), ParentIndices.data(), NumTransforms, WorldTransforms.data());
+        });
+
+        // Reading the local transforms and writing the world transforms once, what no composition can beat
+        std::vector<FTransform> CopiedTransforms(NumTransforms);
+        const double CopyMilliseconds = Benchmark::Run("Copy, the memory traffic floor", NumTransforms, [&]()
+        {
+            std::memcpy(CopiedTransforms.data(), LocalTransforms.data(), NumTransforms * sizeof(FTransform));
+        });
+        Benchmark::DoNotOptimize(CopiedTransforms.back());
+
+        PrintSpeedup("ComposeHierarchy", "glm mat4", GlmMatrixMilliseconds, ComposeMilliseconds);
+        PrintSpeedup("ComposeHierarchy", "glm quat / vec3", GlmTransformMilliseconds, ComposeMilliseconds);
+        PrintSpeedup("Copy", "glm mat4", GlmMatrixMilliseconds, CopyMilliseconds);
+        std::printf("ComposeHierarchy max translation error against the scalar loop: %g\n", GetMaxTranslationError(WorldTransforms, ScalarWorldTransforms));
+    }
+
+    void BenchmarkBatches(FRandomStream& Stream)
+    {
+        std::printf("\nBatch functions, %d transforms\n", NumTransforms);
+
+        std::vector<FTransform> A(NumTransforms), B(NumTransforms), Results(NumTransforms);
+        std::vector<FMatrix> Matrices(NumTransforms);
+        std::vector<glm::mat4> GlmA(NumTransforms), GlmB(NumTransforms), GlmResults(NumTransforms);
+        for (int32_t Index = 0; Index < NumTransforms; ++Index)
+        {
+            A[Index] = MakeRandomTransform(Stream);
+            B[Index] = MakeRandomTransform(Stream);
+            GlmA[Index] = A[Index].ToMatrixWithScale();
+            GlmB[Index] = B[Index].ToMatrixWithScale();
+        }
+
+        const double GlmMultiplyMilliseconds = Benchmark::Run("glm mat4 multiply", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                GlmResults[Index] = GlmB[Index] * GlmA[Index];
+            }
+        });
+        Benchmark::DoNotOptimize(GlmResults.back());
+
+        Benchmark::Run("FTransform multiply", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                Results[Index] = A[Index] * B[Index];
+            }
+        });
+        Benchmark::DoNotOptimize(Results.back());
+
+        const double MultiplyBatchMilliseconds = Benchmark::Run("FTransform::MultiplyBatch", NumTransforms, [&]()
+        {
+            FTransform::MultiplyBatch(A.data(), B.data(), NumTransforms, Results.data());
+        });
+
+        const double GlmInverseMilliseconds = Benchmark::Run("glm inverse", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                GlmResults[Index] = glm::inverse(GlmA[Index]);
+            }
+        });
+        Benchmark::DoNotOptimize(GlmResults.back());
+
+        Benchmark::Run("FMatrix::Inverse", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                Matrices[Index] = FMatrix(GlmA[Index]).Inverse();
+            }
+        });
+        Benchmark::DoNotOptimize(Matrices.back());
+
+        Benchmark::Run("FMatrix::InverseAffine", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                Matrices[Index] = FMatrix(GlmA[Index]).InverseAffine();
+            }
+        });
+        Benchmark::DoNotOptimize(Matrices.back());
+
+        Benchmark::Run("FTransform inverse", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                Results[Index] = A[Index].Inverse();
+            }
+        });
+        Benchmark::DoNotOptimize(Results.back());
+
+        const double InverseBatchMilliseconds = Benchmark::Run("FTransform::InverseBatch", NumTransforms, [&]()
+        {
+            FTransform::InverseBatch(A.data(), NumTransforms, Results.data());
+        });
+
+        Benchmark::Run("FTransform::ToMatrixWithScale", NumTransforms, [&]()
+        {
+            for (int32_t Index = 0; Index < NumTransforms; ++Index)
+            {
+                Matrices[Index] = A[Index].ToMatrixWithScale();
+            }
+        });
+        Benchmark::DoNotOptimize(Matrices.back());
+
+        Benchmark::Run("FTransform::ToMatrixBatch", NumTransforms, [&]()
+        {
+            FTransform::ToMatrixBatch(A.data(), NumTransforms, Matrices.data());
+        });
+
+        PrintSpeedup("MultiplyBatch", "glm mat4 multiply", GlmMultiplyMilliseconds, MultiplyBatchMilliseconds);
+        PrintSpeedup("InverseBatch", "glm inverse", GlmInverseMilliseconds, InverseBatchMilliseconds);
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0x7A25);
+
+    std::printf("FFloatWide::Lanes = %d\n", FFloatWide::Lanes);
+
+    std::vector<FTransform> LocalTransforms(NumTransforms);
+    for (FTransform& Local : LocalTransforms)
+    {
+        Local = MakeRandomTransform(Stream);
+    }
+
+    std::vector<int32_t> ParentIndices(NumTransforms);
+    for (int32_t Index = 0; Index < NumTransforms; ++Index)
+    {
+        ParentIndices[Index] = Index == 0 ? -1 : (Index - 1) / BranchingFactor;
+    }
+    BenchmarkHierarchy("Breadth first", LocalTransforms, ParentIndices);
+
+    for (int32_t Index = 0; Index < NumTransforms; ++Index)
+    {
+        ParentIndices[Index] = Index == 0 ? -1 : (Index % ChainLength == 0 ? (int32_t)(Stream.GetFraction() * Index) : Index - 1);
+    }
+    BenchmarkHierarchy("Depth first", LocalTransforms, ParentIndices);
+
+    BenchmarkBatches(Stream);
+    return 0;
+}
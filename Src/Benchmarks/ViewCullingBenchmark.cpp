@@ -0,0 +1,94 @@
+#include "CoreMinimal.h"
+#include "Async/JobSystem.h"
+#include "Base/RandomStream.h"
+#include "Render/ViewCulling.h"
+#include "Benchmark.h"
+
+#include <vector>
+
+/**
+ * FViewCulling against a loop over FFrustum::IntersectBox, on the calling thread only so the
+ * difference is the vectorization. One view, then shadow cascades culled in one pass.
+ */
+
+namespace
+{
+    constexpr int32_t NumBoxes = 250000;
+    constexpr int32_t NumCascades = 4;
+}
+
+int main()
+{
+    FRandomStream Stream(0xC013);
+    FJobSystem::Get().Init(0);
+
+    std::printf("FFloatWide::Lanes = %d, %d boxes\n", FFloatWide::Lanes, NumBoxes);
+
+    std::vector<float> CenterX(NumBoxes), CenterY(NumBoxes), CenterZ(NumBoxes), ExtentX(NumBoxes), ExtentY(NumBoxes), ExtentZ(NumBoxes);
+    for (int32_t Index = 0; Index < NumBoxes; ++Index)
+    {
+        CenterX[Index] = Stream.FRandRange(-500.0f, 500.0f);
+        CenterY[Index] = Stream.FRandRange(-500.0f, 500.0f);
+        CenterZ[Index] = Stream.FRandRange(-50.0f, 50.0f);
+        ExtentX[Index] = Stream.FRandRange(0.5f, 5.0f);
+        ExtentY[Index] = Stream.FRandRange(0.5f, 5.0f);
+        ExtentZ[Index] = Stream.FRandRange(0.5f, 5.0f);
+    }
+    const FBoxBoundsSoA Bounds = { CenterX.data(), CenterY.data(), CenterZ.data(), ExtentX.data(), ExtentY.data(), ExtentZ.data(), NumBoxes };
+
+    // Cascades share the camera and split its depth range
+    FFrustum Cascades[NumCascades];
+    for (int32_t Cascade = 0; Cascade < NumCascades; ++Cascade)
+    {
+        Cascades[Cascade] = FFrustum::MakePerspective(MVector(0.0f, 0.0f, 10.0f), MVector(1.0f, 0.3f, -0.1f), MVector(0.0f, 0.0f, 1.0f), 0.8f, 16.0f / 9.0f, 0.1f + 100.0f * Cascade, 100.0f * (Cascade + 1));
+    }
+
+    std::vector<int32_t> ScalarIndices(NumBoxes);
+    int32_t NumScalarVisible = 0;
+    Benchmark::Run("FFrustum::IntersectBox loop", NumBoxes, [&]()
+    {
+        NumScalarVisible = 0;
+        for (int32_t Index = 0; Index < NumBoxes; ++Index)
+        {
+            ScalarIndices[NumScalarVisible] = Index;
+            NumScalarVisible += Cascades[0].IntersectBox(MVector(CenterX[Index], CenterY[Index], CenterZ[Index]), MVector(ExtentX[Index], ExtentY[Index], ExtentZ[Index])) ? 1 : 0;
+        }
+    });
+    Benchmark::DoNotOptimize(ScalarIndices[0]);
+
+    std::vector<std::vector<int32_t>> VisibleIndices(NumCascades, std::vector<int32_t>(NumBoxes));
+    FViewCullingStats Stats[NumCascades];
+    Benchmark::Run("FViewCulling::CullBoxes", NumBoxes, [&]()
+    {
+        Stats[0] = FViewCulling::CullBoxes(Cascades[0], Bounds, VisibleIndices[0].data());
+    });
+
+    int32_t* Outputs[NumCascades];
+    for (int32_t Cascade = 0; Cascade < NumCascades; ++Cascade)
+    {
+        Outputs[Cascade] = VisibleIndices[Cascade].data();
+    }
+    Benchmark::Run("FFrustum::IntersectBox loop, 4 cascades", NumBoxes, [&]()
+    {
+        NumScalarVisible = 0;
+        for (int32_t Cascade = 0; Cascade < NumCascades; ++Cascade)
+        {
+            for (int32_t Index = 0; Index < NumBoxes; ++Index)
+            {
+                ScalarIndices[NumScalarVisible] = Index;
+                NumScalarVisible += Cascades[Cascade].IntersectBox(MVector(CenterX[Index], CenterY[Index], CenterZ[Index]), MVector(ExtentX[Index], ExtentY[Index], ExtentZ[Index])) ? 1 : 0;
+            }
+            NumScalarVisible = 0;
+        }
+    });
+    Benchmark::DoNotOptimize(ScalarIndices[0]);
+
+    Benchmark::Run("FViewCulling::CullBoxes, 4 cascades", NumBoxes, [&]()
+    {
+        FViewCulling::CullBoxes(Cascades, NumCascades, Bounds, Outputs, Stats);
+    });
+
+    std::printf("%d boxes visible in the first cascade\n", Stats[0].NumVisible);
+    FJobSystem::Get().Shutdown();
+    return 0;
+}
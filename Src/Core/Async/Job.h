@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/** Number of unfinished jobs of a group. Jobs decrement it when done, FJobSystem::Wait() waits for zero. */
+struct FJobCounter
+{
+    std::atomic<int32_t> Value{ 0 };
+
+    bool IsDone() const
+    {
+        return Value.load(std::memory_order_acquire) == 0;
+    }
+};
+
+/** Job entry point, invoked with the job's data pointer and index range. */
+typedef void (*FJobFunction)(void* Data, int32_t Begin, int32_t End);
+
+/** A unit of work. Jobs are plain values, the data they point at must outlive them. */
+struct FJob
+{
+    FJobFunction Function = nullptr;
+    void* Data = nullptr;
+    int32_t Begin = 0;
+    int32_t End = 0;
+
+    // Decremented when the job finished, may be null
+    FJobCounter* Counter = nullptr;
+
+    // The job is not started before this counter reached zero, may be null
+    const FJobCounter* Dependency = nullptr;
+};
@@ -0,0 +1,288 @@
+#include "JobSystem.h"
+#include "Profiler/CpuProfiler.h"
+
+namespace
+{
+    // Index of the worker running on this thread, -1 on threads not owned by the job system
+    thread_local int32_t CurrentWorkerIndex = -1;
+
+    // Spins before an idle worker goes to sleep
+    constexpr int32_t IdleSpinCount = 64;
+}
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem JobSystem;
+    return JobSystem;
+}
+
+FJobSystem::FJobSystem()
+    : NumPendingJobs(0)
+    , NumSleepingWorkers(0)
+    , bRunning(false)
+{
+    Init();
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Init(int32_t NumWorkers)
+{
+    Shutdown();
+
+    if (NumWorkers < 0)
+    {
+        // The thread calling Wait() helps, so one hardware thread is left for it
+        const int32_t NumHardwareThreads = (int32_t)std::thread::hardware_concurrency();
+        NumWorkers = NumHardwareThreads > 1 ? NumHardwareThreads - 1 : 0;
+    }
+
+    Queues.clear();
+    for (int32_t WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+    {
+        Queues.push_back(std::make_unique<FWorkStealingQueue>());
+    }
+
+    bRunning = true;
+    for (int32_t WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+    {
+        Workers.emplace_back(&FJobSystem::WorkerMain, this, WorkerIndex);
+    }
+}
+
+void FJobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> Lock(SleepMutex);
+        bRunning = false;
+    }
+    SleepCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+    Workers.clear();
+}
+
+int32_t FJobSystem::GetNumThreads() const
+{
+    return (int32_t)Workers.size() + 1;
+}
+
+void FJobSystem::Run(const FJob& Job)
+{
+    Run(&Job, 1);
+}
+
+void FJobSystem::Run(const FJob* Jobs, int32_t NumJobs)
+{
+    if (NumJobs <= 0)
+    {
+        return;
+    }
+
+    // Count all jobs up front, so a waiter never sees zero while some are still being queued
+    for (int32_t Index = 0; Index < NumJobs; ++Index)
+    {
+        if (Jobs[Index].Counter != nullptr)
+        {
+            Jobs[Index].Counter->Value.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (Workers.empty())
+    {
+        // Jobs whose dependency is pending are deferred, every completed job may have released some of them
+        bool bExecuted = false;
+        for (int32_t Index = 0; Index < NumJobs; ++Index)
+        {
+            bExecuted |= Execute(Jobs[Index]);
+        }
+
+        while (bExecuted)
+        {
+            bExecuted = RunDeferredJobs();
+        }
+        return;
+    }
+
+    const int32_t WorkerIndex = CurrentWorkerIndex;
+    if (WorkerIndex < 0)
+    {
+        PushShared(Jobs, NumJobs);
+    }
+    else
+    {
+        FWorkStealingQueue& Queue = *Queues[WorkerIndex];
+        for (int32_t Index = 0; Index < NumJobs; ++Index)
+        {
+            if (!Queue.Push(Jobs[Index]))
+            {
+                PushShared(Jobs + Index, NumJobs - Index);
+                break;
+            }
+        }
+    }
+
+    NumPendingJobs += NumJobs;
+    WakeWorkers(NumJobs);
+}
+
+void FJobSystem::Wait(const FJobCounter& Counter)
+{
+    FJob Job;
+    while (!Counter.IsDone())
+    {
+        if (FindJob(Job))
+        {
+            Execute(Job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void FJobSystem::WorkerMain(int32_t WorkerIndex)
+{
+    CurrentWorkerIndex = WorkerIndex;
+    FCpuProfiler::Get().SetThreadName("JobWorker " + std::to_string(WorkerIndex));
+
+    FJob Job;
+    int32_t NumIdleSpins = 0;
+
+    while (bRunning)
+    {
+        if (FindJob(Job))
+        {
+            Execute(Job);
+            NumIdleSpins = 0;
+            continue;
+        }
+
+        if (++NumIdleSpins < IdleSpinCount)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> Lock(SleepMutex);
+        ++NumSleepingWorkers;
+        SleepCondition.wait(Lock, [this]() { return !bRunning || NumPendingJobs > 0; });
+        --NumSleepingWorkers;
+        NumIdleSpins = 0;
+    }
+
+    CurrentWorkerIndex = -1;
+}
+
+bool FJobSystem::FindJob(FJob& OutJob)
+{
+    const int32_t WorkerIndex = CurrentWorkerIndex;
+    bool bFound = WorkerIndex >= 0 && Queues[WorkerIndex]->Pop(OutJob);
+
+    if (!bFound && NumPendingJobs.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> Lock(SharedMutex);
+        if (!SharedQueue.empty())
+        {
+            OutJob = SharedQueue.front();
+            SharedQueue.pop_front();
+            bFound = true;
+        }
+    }
+
+    // Start stealing next to ourselves, so thieves spread over the victims
+    const int32_t NumQueues = (int32_t)Queues.size();
+    for (int32_t Offset = 1; !bFound && Offset <= NumQueues; ++Offset)
+    {
+        const int32_t Victim = (WorkerIndex + Offset + NumQueues) % NumQueues;
+        if (Victim != WorkerIndex)
+        {
+            bFound = Queues[Victim]->Steal(OutJob);
+        }
+    }
+
+    if (bFound)
+    {
+        NumPendingJobs.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return bFound;
+}
+
+bool FJobSystem::Execute(const FJob& Job)
+{
+    if (Job.Dependency != nullptr && !Job.Dependency->IsDone())
+    {
+        // Not ready yet, move it behind everything queued so far
+        PushShared(&Job, 1);
+        ++NumPendingJobs;
+        WakeWorkers(1);
+        return false;
+    }
+
+    {
+        SCOPED_CPU_TIMER("Job");
+        Job.Function(Job.Data, Job.Begin, Job.End);
+    }
+
+    if (Job.Counter != nullptr)
+    {
+        Job.Counter->Value.fetch_sub(1, std::memory_order_release);
+    }
+    return true;
+}
+
+bool FJobSystem::RunDeferredJobs()
+{
+    int32_t NumDeferredJobs;
+    {
+        std::lock_guard<std::mutex> Lock(SharedMutex);
+        NumDeferredJobs = (int32_t)SharedQueue.size();
+    }
+
+    // One pass over the jobs deferred so far, the ones still not ready go back to the queue
+    bool bExecuted = false;
+    FJob Job;
+    for (int32_t Index = 0; Index < NumDeferredJobs && FindJob(Job); ++Index)
+    {
+        bExecuted |= Execute(Job);
+    }
+    return bExecuted;
+}
+
+void FJobSystem::PushShared(const FJob* Jobs, int32_t NumJobs)
+{
+    std::lock_guard<std::mutex> Lock(SharedMutex);
+    SharedQueue.insert(SharedQueue.end(), Jobs, Jobs + NumJobs);
+}
+
+void FJobSystem::WakeWorkers(int32_t NumJobs)
+{
+    // Sequentially consistent with the sleeper's increment and predicate check, one of both sees the other
+    if (NumSleepingWorkers == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(SleepMutex);
+    }
+
+    if (NumJobs == 1)
+    {
+        SleepCondition.notify_one();
+    }
+    else
+    {
+        SleepCondition.notify_all();
+    }
+}
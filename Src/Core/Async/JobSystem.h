@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Job.h"
+#include "WorkStealingQueue.h"
+
+/**
+ * Work-stealing job scheduler with one worker per hardware thread.
+ * Jobs spawned on a worker go to its own deque, jobs from any other thread go to a shared queue.
+ * Idle workers steal from each other, and threads blocked in Wait() run jobs instead of sleeping.
+ */
+class CORE_API FJobSystem
+{
+public:
+    static FJobSystem& Get();
+
+    ~FJobSystem();
+
+    /** (Re)starts with NumWorkers background workers, a negative count uses one per hardware thread but the caller's. */
+    void Init(int32_t NumWorkers = -1);
+
+    /** Joins the workers, pending jobs are not run. Must be called before the module unloads. */
+    void Shutdown();
+
+    /** Number of threads executing jobs concurrently: the workers plus the thread waiting on them. */
+    int32_t GetNumThreads() const;
+
+    void Run(const FJob& Job);
+    void Run(const FJob* Jobs, int32_t NumJobs);
+
+    /** Runs jobs on the calling thread until the counter reached zero. */
+    void Wait(const FJobCounter& Counter);
+
+    /** Calls Body(Begin, End) over [0, Num) split in batches of at least MinBatchSize, returns when all are done. */
+    template<typename TBody>
+    void ParallelForRange(int32_t Num, const TBody& Body, int32_t MinBatchSize = 1)
+    {
+        if (Num <= 0)
+        {
+            return;
+        }
+
+        MinBatchSize = MinBatchSize > 0 ? MinBatchSize : 1;
+        int32_t NumBatches = (Num + MinBatchSize - 1) / MinBatchSize;
+        NumBatches = NumBatches < GetNumThreads() * 4 ? NumBatches : GetNumThreads() * 4;
+        NumBatches = NumBatches < MaxParallelForBatches ? NumBatches : MaxParallelForBatches;
+
+        if (NumBatches <= 1 || Workers.empty())
+        {
+            Body(0, Num);
+            return;
+        }
+
+        FJobCounter Counter;
+        FJob Jobs[MaxParallelForBatches];
+        for (int32_t Batch = 0; Batch < NumBatches; ++Batch)
+        {
+            Jobs[Batch].Function = &InvokeRange<TBody>;
+            Jobs[Batch].Data = const_cast<TBody*>(&Body);
+            Jobs[Batch].Begin = (int32_t)((int64_t)Num * Batch / NumBatches);
+            Jobs[Batch].End = (int32_t)((int64_t)Num * (Batch + 1) / NumBatches);
+            Jobs[Batch].Counter = &Counter;
+        }
+
+        // The calling thread takes the first batch itself
+        Run(Jobs + 1, NumBatches - 1);
+        Body(Jobs[0].Begin, Jobs[0].End);
+        Wait(Counter);
+    }
+
+    /** Calls Body(Index) for every index in [0, Num), returns when all are done. */
+    template<typename TBody>
+    void ParallelFor(int32_t Num, const TBody& Body, int32_t MinBatchSize = 1)
+    {
+        ParallelForRange(Num, [&Body](int32_t Begin, int32_t End)
+            {
+                for (int32_t Index = Begin; Index < End; ++Index)
+                {
+                    Body(Index);
+                }
+            }, MinBatchSize);
+    }
+
+private:
+    static constexpr int32_t MaxParallelForBatches = 256;
+
+    template<typename TBody>
+    static void InvokeRange(void* Data, int32_t Begin, int32_t End)
+    {
+        (*static_cast<const TBody*>(Data))(Begin, End);
+    }
+
+    FJobSystem();
+
+    void WorkerMain(int32_t WorkerIndex);
+
+    bool FindJob(FJob& OutJob);
+
+    /** Runs the job, or defers it to the shared queue if its dependency is pending. Returns false if deferred. */
+    bool Execute(const FJob& Job);
+
+    /** Without workers, runs the deferred jobs whose dependency completed. Returns false if none was ready. */
+    bool RunDeferredJobs();
+
+    void PushShared(const FJob* Jobs, int32_t NumJobs);
+    void WakeWorkers(int32_t NumJobs);
+
+private:
+    std::vector<std::unique_ptr<FWorkStealingQueue>> Queues;
+    std::vector<std::thread> Workers;
+
+    std::mutex SharedMutex;
+    std::deque<FJob> SharedQueue;
+
+    std::mutex SleepMutex;
+    std::condition_variable SleepCondition;
+    std::atomic<int32_t> NumPendingJobs;
+    std::atomic<int32_t> NumSleepingWorkers;
+    std::atomic<bool> bRunning;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Lock-free single producer / single consumer triple buffer.
+ * The producer always owns one buffer and the consumer another, the third one is swapped between them,
+ * so neither side ever waits: the producer overwrites frames the consumer did not pick up in time,
+ * the consumer keeps its buffer until a newer one was published.
+ */
+template<typename T>
+class TTripleBuffer
+{
+public:
+    TTripleBuffer()
+        : WriteIndex(0)
+        , ReadIndex(1)
+        , Middle(2)
+    {
+    }
+
+    /** Drops any published buffer and makes InWriteIndex the producer's buffer. Neither side may be active. */
+    void Reset(uint32_t InWriteIndex)
+    {
+        WriteIndex = (uint8_t)(InWriteIndex % 3);
+        ReadIndex = (uint8_t)((InWriteIndex + 1) % 3);
+        Middle.store((uint8_t)((InWriteIndex + 2) % 3), std::memory_order_release);
+    }
+
+    TTripleBuffer(const TTripleBuffer&) = delete;
+    TTripleBuffer& operator=(const TTripleBuffer&) = delete;
+
+    /** Producer side, the buffer to fill before calling Publish(). */
+    T& GetWriteBuffer()
+    {
+        return Buffers[WriteIndex];
+    }
+
+    uint32_t GetWriteIndex() const
+    {
+        return WriteIndex;
+    }
+
+    /**
+     * Producer side, hands the write buffer over to the consumer and takes back the spare one.
+     * @return false if the previously published buffer was overwritten before the consumer read it.
+     */
+    bool Publish()
+    {
+        const uint8_t Previous = Middle.exchange(WriteIndex | DirtyBit, std::memory_order_acq_rel);
+        WriteIndex = Previous & IndexMask;
+        return (Previous & DirtyBit) == 0;
+    }
+
+    /** Consumer side, the most recent buffer acquired by Update(). */
+    const T& GetReadBuffer() const
+    {
+        return Buffers[ReadIndex];
+    }
+
+    uint32_t GetReadIndex() const
+    {
+        return ReadIndex;
+    }
+
+    /**
+     * Consumer side, swaps in the most recently published buffer.
+     * @return true if a new buffer was acquired.
+     */
+    bool Update()
+    {
+        if (!HasPending())
+        {
+            return false;
+        }
+
+        const uint8_t Previous = Middle.exchange(ReadIndex, std::memory_order_acq_rel);
+        ReadIndex = Previous & IndexMask;
+        return true;
+    }
+
+    bool HasPending() const
+    {
+        return (Middle.load(std::memory_order_acquire) & DirtyBit) != 0;
+    }
+
+private:
+    static constexpr uint8_t IndexMask = 0x3;
+    static constexpr uint8_t DirtyBit = 0x4;
+
+    T Buffers[3];
+
+    alignas(64) uint8_t WriteIndex;
+    alignas(64) uint8_t ReadIndex;
+    alignas(64) std::atomic<uint8_t> Middle;
+};
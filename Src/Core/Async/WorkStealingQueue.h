@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+#include "Job.h"
+
+/**
+ * Fixed capacity Chase-Lev work-stealing deque of jobs.
+ * The owning worker pushes and pops at the bottom, any other thread steals from the top.
+ * Slots are made of relaxed atomics: a thief may read a slot the owner is about to reuse,
+ * but then its compare-exchange on Top fails and the torn copy is discarded.
+ */
+class FWorkStealingQueue
+{
+public:
+    static constexpr int64_t Capacity = 4096;
+
+    FWorkStealingQueue()
+        : Top(0)
+        , Bottom(0)
+        , Slots(new FSlot[Capacity])
+    {
+    }
+
+    FWorkStealingQueue(const FWorkStealingQueue&) = delete;
+    FWorkStealingQueue& operator=(const FWorkStealingQueue&) = delete;
+
+    /** Owner only. @return false if the deque is full. */
+    bool Push(const FJob& Job)
+    {
+        const int64_t B = Bottom.load(std::memory_order_relaxed);
+        const int64_t T = Top.load(std::memory_order_acquire);
+        if (B - T >= Capacity)
+        {
+            return false;
+        }
+
+        Slots[B & (Capacity - 1)].Store(Job);
+        Bottom.store(B + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Owner only, takes the most recently pushed job. */
+    bool Pop(FJob& OutJob)
+    {
+        const int64_t B = Bottom.load(std::memory_order_relaxed) - 1;
+        Bottom.store(B, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t T = Top.load(std::memory_order_relaxed);
+
+        if (T > B)
+        {
+            Bottom.store(B + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        Slots[B & (Capacity - 1)].Load(OutJob);
+        if (T == B)
+        {
+            // Last job, race the thieves for it
+            const bool bWon = Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            Bottom.store(B + 1, std::memory_order_relaxed);
+            return bWon;
+        }
+
+        return true;
+    }
+
+    /** Any thread, takes the oldest job. */
+    bool Steal(FJob& OutJob)
+    {
+        int64_t T = Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t B = Bottom.load(std::memory_order_acquire);
+
+        if (T >= B)
+        {
+            return false;
+        }
+
+        Slots[T & (Capacity - 1)].Load(OutJob);
+        return Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    bool IsEmpty() const
+    {
+        return Top.load(std::memory_order_relaxed) >= Bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct FSlot
+    {
+        std::atomic<FJobFunction> Function{ nullptr };
+        std::atomic<void*> Data{ nullptr };
+        std::atomic<uint64_t> Range{ 0 };
+        std::atomic<FJobCounter*> Counter{ nullptr };
+        std::atomic<const FJobCounter*> Dependency{ nullptr };
+
+        void Store(const FJob& Job)
+        {
+            Function.store(Job.Function, std::memory_order_relaxed);
+            Data.store(Job.Data, std::memory_order_relaxed);
+            Range.store((uint64_t)(uint32_t)Job.Begin | ((uint64_t)(uint32_t)Job.End << 32), std::memory_order_relaxed);
+            Counter.store(Job.Counter, std::memory_order_relaxed);
+            Dependency.store(Job.Dependency, std::memory_order_relaxed);
+        }
+
+        void Load(FJob& Job) const
+        {
+            Job.Function = Function.load(std::memory_order_relaxed);
+            Job.Data = Data.load(std::memory_order_relaxed);
+            const uint64_t PackedRange = Range.load(std::memory_order_relaxed);
+            Job.Begin = (int32_t)(uint32_t)PackedRange;
+            Job.End = (int32_t)(uint32_t)(PackedRange >> 32);
+            Job.Counter = Counter.load(std::memory_order_relaxed);
+            Job.Dependency = Dependency.load(std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<int64_t> Top;
+    alignas(64) std::atomic<int64_t> Bottom;
+    std::unique_ptr<FSlot[]> Slots;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Vector.h"
+
+/**
+ * Axis aligned bounding box. A default constructed box is invalid (empty), adding a point or a
+ * valid box to it makes it valid.
+ */
+struct FBox
+{
+    MVector Min;
+    MVector Max;
+    bool IsValid;
+
+    constexpr FBox()
+        : Min(0.0f), Max(0.0f), IsValid(false)
+    {
+    }
+
+    constexpr FBox(const MVector& InMin, const MVector& InMax)
+        : Min(InMin), Max(InMax), IsValid(true)
+    {
+    }
+
+    /** Bounds of an array of points. */
+    FBox(const MVector* Points, int32_t NumPoints)
+        : FBox()
+    {
+        for (int32_t Index = 0; Index < NumPoints; ++Index)
+        {
+            *this += Points[Index];
+        }
+    }
+
+    static FBox BuildAABB(const MVector& Origin, const MVector& Extent)
+    {
+        return FBox(Origin - Extent, Origin + Extent);
+    }
+
+    FBox& operator+=(const MVector& Point)
+    {
+        if (IsValid)
+        {
+            Min = Min.ComponentMin(Point);
+            Max = Max.ComponentMax(Point);
+        }
+        else
+        {
+            Min = Max = Point;
+            IsValid = true;
+        }
+        return *this;
+    }
+
+    FBox& operator+=(const FBox& Other)
+    {
+        if (IsValid && Other.IsValid)
+        {
+            Min = Min.ComponentMin(Other.Min);
+            Max = Max.ComponentMax(Other.Max);
+        }
+        else if (Other.IsValid)
+        {
+            *this = Other;
+        }
+        return *this;
+    }
+
+    FBox operator+(const MVector& Point) const { return FBox(*this) += Point; }
+    FBox operator+(const FBox& Other) const { return FBox(*this) += Other; }
+
+    bool operator==(const FBox& Other) const { return Min == Other.Min && Max == Other.Max; }
+    bool operator!=(const FBox& Other) const { return !(*this == Other); }
+
+    MVector GetCenter() const { return (Min + Max) * 0.5f; }
+    MVector GetExtent() const { return (Max - Min) * 0.5f; }
+    MVector GetSize() const { return Max - Min; }
+
+    float GetVolume() const
+    {
+        const MVector Size = GetSize();
+        return Size.x * Size.y * Size.z;
+    }
+
+    /** Half of the surface area, the usual SAH cost metric. */
+    float GetHalfSurfaceArea() const
+    {
+        const MVector Size = GetSize();
+        return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+    }
+
+    FBox ExpandBy(float W) const
+    {
+        return FBox(Min - MVector(W), Max + MVector(W));
+    }
+
+    FBox ShiftBy(const MVector& Offset) const
+    {
+        return FBox(Min + Offset, Max + Offset);
+    }
+
+    /** Touching boxes intersect. */
+    bool Intersect(const FBox& Other) const
+    {
+        return Min.x <= Other.Max.x && Other.Min.x <= Max.x
+            && Min.y <= Other.Max.y && Other.Min.y <= Max.y
+            && Min.z <= Other.Max.z && Other.Min.z <= Max.z;
+    }
+
+    /** Overlapping region, invalid if the boxes don't intersect. */
+    FBox Overlap(const FBox& Other) const
+    {
+        if (!Intersect(Other))
+        {
+            return FBox();
+        }
+        return FBox(Min.ComponentMax(Other.Min), Max.ComponentMin(Other.Max));
+    }
+
+    bool IsInside(const MVector& Point) const
+    {
+        return Point.x > Min.x && Point.x < Max.x && Point.y > Min.y && Point.y < Max.y && Point.z > Min.z && Point.z < Max.z;
+    }
+
+    bool IsInsideOrOn(const MVector& Point) const
+    {
+        return Point.x >= Min.x && Point.x <= Max.x && Point.y >= Min.y && Point.y <= Max.y && Point.z >= Min.z && Point.z <= Max.z;
+    }
+
+    /** Other lies completely inside this box. */
+    bool IsInside(const FBox& Other) const
+    {
+        return IsInside(Other.Min) && IsInside(Other.Max);
+    }
+
+    MVector GetClosestPointTo(const MVector& Point) const
+    {
+        return Point.ComponentMax(Min).ComponentMin(Max);
+    }
+
+    float ComputeSquaredDistanceToPoint(const MVector& Point) const
+    {
+        return (GetClosestPointTo(Point) - Point).SizeSquared();
+    }
+
+    std::string ToString() const
+    {
+        return "IsValid=" + std::string(IsValid ? "true" : "false") + ", Min=(" + Min.ToString() + "), Max=(" + Max.ToString() + ")";
+    }
+};
@@ -1,6 +1,11 @@
 #include "Color.h"
 
-FColor::FColor(float Red, float Green, float Blue)
+#include "Base/MathUtil.h"
+#include "Base/SimdKernels.h"
+
+#include "Base/ColorWide.inl"
+
+FColor::FColor(float R, float G, float B)
     : R(R)
     , G(G)
     , B(B)
@@ -24,9 +29,9 @@ FColor::FColor(float R, float G, float B, bool Normalize)
 {
     if (Normalize)
     {
-        R /= 255.0f;
-        G /= 255.0f;
-        B /= 255.0f;
+        this->R /= 255.0f;
+        this->G /= 255.0f;
+        this->B /= 255.0f;
     }
 }
 
@@ -50,6 +55,42 @@ FColor FColor::operator*(const FColor& Color) const
     return FColor(R * Color.R, G * Color.G, B * Color.B, A);
 }
 
+FHsvColor FColor::ToHsv() const
+{
+    const float Max = FMath::Max3(R, G, B);
+    const float Delta = Max - FMath::Min3(R, G, B);
+    if (Delta <= 0.0f)
+    {
+        return FHsvColor(0.0f, 0.0f, Max);
+    }
+
+    float Hue;
+    if (Max == R)
+    {
+        Hue = (G - B) / Delta;
+    }
+    else if (Max == G)
+    {
+        Hue = (B - R) / Delta + 2.0f;
+    }
+    else
+    {
+        Hue = (R - G) / Delta + 4.0f;
+    }
+    Hue *= 60.0f;
+    return FHsvColor(Hue < 0.0f ? Hue + 360.0f : Hue, Delta / Max, Max);
+}
+
+FColor FColor::ToLinear() const
+{
+    return FColor(SRGBToLinearScalar(R), SRGBToLinearScalar(G), SRGBToLinearScalar(B), A);
+}
+
+FColor FColor::ToSRGB() const
+{
+    return FColor(LinearToSRGBScalar(R), LinearToSRGBScalar(G), LinearToSRGBScalar(B), A);
+}
+
 std::string FColor::ToString() const
 {
     return "(" + std::to_string(R) + ", " + std::to_string(G) + ", " + std::to_string(B) + ")";
@@ -71,4 +112,82 @@ FHsvColor::FHsvColor(float Hue, float Saturation, float Value)
 {
 }
 
+FColor FHsvColor::ToRgb() const
+{
+    const float Sector = (Hue - floorf(Hue / 360.0f) * 360.0f) / 60.0f;
+    auto Channel = [&](float N)
+    {
+        float K = N + Sector;
+        K = K >= 6.0f ? K - 6.0f : K;
+        return Value - Value * Saturation * FMath::Clamp(FMath::Min(K, 4.0f - K), 0.0f, 1.0f);
+    };
+    return FColor(Channel(5.0f), Channel(3.0f), Channel(1.0f), 1.0f);
+}
+
+void FColor::SRGBToLinear(const FColor* Colors, int32_t NumColors, FColor* OutColors)
+{
+    static const TSimdKernel<void(const FColor*, int32_t, FColor*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(SRGBToLinear);
+    Kernel(Colors, NumColors, OutColors);
+}
+
+void FColor::LinearToSRGB(const FColor* Colors, int32_t NumColors, FColor* OutColors)
+{
+    static const TSimdKernel<void(const FColor*, int32_t, FColor*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(LinearToSRGB);
+    Kernel(Colors, NumColors, OutColors);
+}
+
+void FColor::RgbToHsv(const FColor* Colors, int32_t NumColors, FHsvColor* OutColors)
+{
+    static const TSimdKernel<void(const FColor*, int32_t, FHsvColor*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(RgbToHsv);
+    Kernel(Colors, NumColors, OutColors);
+}
+
+void FColor::HsvToRgb(const FHsvColor* Colors, int32_t NumColors, FColor* OutColors)
+{
+    static const TSimdKernel<void(const FHsvColor*, int32_t, FColor*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(HsvToRgb);
+    Kernel(Colors, NumColors, OutColors);
+}
+
+void FColor::Premultiply(const FColor* Colors, int32_t NumColors, FColor* OutColors)
+{
+    static const TSimdKernel<void(const FColor*, int32_t, FColor*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Premultiply);
+    Kernel(Colors, NumColors, OutColors);
+}
+
+void FColor::PackRGBA8(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked)
+{
+    static const TSimdKernel<void(const FColor*, int32_t, uint32_t*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(PackRGBA8);
+    Kernel(Colors, NumColors, OutPacked);
+}
+
+void FColor::PackRGB10A2(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked)
+{
+    static const TSimdKernel<void(const FColor*, int32_t, uint32_t*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(PackRGB10A2);
+    Kernel(Colors, NumColors, OutPacked);
+}
+
+void FColor::UnpackRGBA8(const uint32_t* Packed, int32_t NumColors, FColor* OutColors, bool bSRGB)
+{
+    static const TSimdKernel<void(const uint32_t*, int32_t, FColor*, bool)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(UnpackRGBA8);
+    Kernel(Packed, NumColors, OutColors, bSRGB);
+}
+
+void FColor::UnpackRGB10A2(const uint32_t* Packed, int32_t NumColors, FColor* OutColors)
+{
+    static const TSimdKernel<void(const uint32_t*, int32_t, FColor*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(UnpackRGB10A2);
+    Kernel(Packed, NumColors, OutColors);
+}
+
+void FColor::SRGBToLinear(const float* Values, int32_t NumValues, float* OutValues)
+{
+    static const TSimdKernel<void(const float*, int32_t, float*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(SRGBToLinear);
+    Kernel(Values, NumValues, OutValues);
+}
+
+void FColor::LinearToSRGB(const float* Values, int32_t NumValues, float* OutValues)
+{
+    static const TSimdKernel<void(const float*, int32_t, float*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(LinearToSRGB);
+    Kernel(Values, NumValues, OutValues);
+}
+
 FColor FColor::BlackColor = FColor(0, 0, 0, 1.0f);
@@ -1,12 +1,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Base/VectorWide.h"
 
+class FColor;
+
+/** Hue in degrees [0, 360), saturation and value in [0, 1]. */
 class CORE_API FHsvColor
 {
 public:
     FHsvColor(float Hue, float Saturation, float Value);
 
+    FColor ToRgb() const;
+
 public:
     float Hue, Saturation, Value;
 };
@@ -25,10 +31,229 @@ public:
     FColor operator*(float N) const;
     FColor operator*(const FColor& Color) const;
 
+    FHsvColor ToHsv() const;
+    FColor ToLinear() const;
+    FColor ToSRGB() const;
+
     std::string ToString() const;
 
+    /**
+     * Array kernels, FFloatWide::Lanes colors per step. Outputs may alias inputs of the same type.
+     * Alpha is linear and passes through the sRGB and HSV conversions, HSV to RGB sets it to 1.
+     * Packing clamps to [0, 1] and rounds to nearest, RGBA8 keeps red in the lowest byte and
+     * RGB10A2 has 10 bits per color channel from the lowest bits up and 2 bits of alpha on top.
+     */
+    static void SRGBToLinear(const FColor* Colors, int32_t NumColors, FColor* OutColors);
+    static void LinearToSRGB(const FColor* Colors, int32_t NumColors, FColor* OutColors);
+    static void RgbToHsv(const FColor* Colors, int32_t NumColors, FHsvColor* OutColors);
+    static void HsvToRgb(const FHsvColor* Colors, int32_t NumColors, FColor* OutColors);
+    static void Premultiply(const FColor* Colors, int32_t NumColors, FColor* OutColors);
+    static void PackRGBA8(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked);
+    static void PackRGB10A2(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked);
+    /** bSRGB decodes the color channels to linear through a table on the way. */
+    static void UnpackRGBA8(const uint32_t* Packed, int32_t NumColors, FColor* OutColors, bool bSRGB = false);
+    static void UnpackRGB10A2(const uint32_t* Packed, int32_t NumColors, FColor* OutColors);
+
+    /** Transfer functions over one channel stream, for planar (structure of arrays) images. */
+    static void SRGBToLinear(const float* Values, int32_t NumValues, float* OutValues);
+    static void LinearToSRGB(const float* Values, int32_t NumValues, float* OutValues);
+
     static FColor BlackColor;
 
 public:
     float R, G, B, A;
 };
+
+// Compiled per SIMD tier like the wide types it holds, see VectorWide.h
+inline namespace MIKASA_SIMD_NAMESPACE
+{
+
+/**
+ * FFloatWide::Lanes colors in structure of arrays layout, lane N of every channel forms color N.
+ * Loads and stores transpose from and to interleaved FColor arrays, the kernels below are the ones
+ * behind the FColor array functions, for callers that keep their channels in separate streams.
+ */
+struct CORE_API FColorWide
+{
+    static constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    FFloatWide R, G, B, A;
+
+    FColorWide()
+    {
+    }
+
+    FColorWide(const FFloatWide& InR, const FFloatWide& InG, const FFloatWide& InB, const FFloatWide& InA)
+        : R(InR), G(InG), B(InB), A(InA)
+    {
+    }
+
+    /** Loads Lanes colors from separate channel streams. */
+    static FColorWide Load(const float* InR, const float* InG, const float* InB, const float* InA)
+    {
+        return FColorWide(FFloatWide::Load(InR), FFloatWide::Load(InG), FFloatWide::Load(InB), FFloatWide::Load(InA));
+    }
+
+    void Store(float* OutR, float* OutG, float* OutB, float* OutA) const
+    {
+        R.Store(OutR);
+        G.Store(OutG);
+        B.Store(OutB);
+        A.Store(OutA);
+    }
+
+    /** Loads up to Lanes colors from an FColor array, missing lanes repeat the last color. */
+    static FColorWide Load(const FColor* Colors, int32_t Num = Lanes)
+    {
+        static_assert(sizeof(FColor) == 4 * sizeof(float), "FColor must be four packed floats");
+
+        if (Num < Lanes)
+        {
+            alignas(32) float Buffer[Lanes * 4];
+            for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+            {
+                std::memcpy(Buffer + Lane * 4, &Colors[Lane < Num ? Lane : Num - 1], sizeof(FColor));
+            }
+            return LoadInterleaved(Buffer);
+        }
+        return LoadInterleaved(&Colors[0].R);
+    }
+
+    /** Stores the first Num lanes to an FColor array. */
+    void Store(FColor* Colors, int32_t Num = Lanes) const
+    {
+        if (Num < Lanes)
+        {
+            alignas(32) float Buffer[Lanes * 4];
+            StoreInterleaved(Buffer);
+            std::memcpy(Colors, Buffer, Num * sizeof(FColor));
+            return;
+        }
+        StoreInterleaved(&Colors[0].R);
+    }
+
+    FColor GetLane(int32_t Lane) const
+    {
+        return FColor(R.GetLane(Lane), G.GetLane(Lane), B.GetLane(Lane), A.GetLane(Lane));
+    }
+
+    /** sRGB transfer functions of one channel, the piecewise curves through precise FMath::Pow, within 5 ulp of them. */
+    static FFloatWide SRGBToLinear(const FFloatWide& Value);
+    static FFloatWide LinearToSRGB(const FFloatWide& Value);
+
+    FColorWide ToLinear() const { return FColorWide(SRGBToLinear(R), SRGBToLinear(G), SRGBToLinear(B), A); }
+    FColorWide ToSRGB() const { return FColorWide(LinearToSRGB(R), LinearToSRGB(G), LinearToSRGB(B), A); }
+    FColorWide Premultiply() const { return FColorWide(R * A, G * A, B * A, A); }
+
+    /** Hue, saturation and value in R, G and B, alpha is kept. */
+    FColorWide RgbToHsv() const;
+    /** Inverse of RgbToHsv, any hue is wrapped to [0, 360). */
+    FColorWide HsvToRgb() const;
+
+    FIntWide PackRGBA8() const;
+    FIntWide PackRGB10A2() const;
+    static FColorWide UnpackRGBA8(const FIntWide& Packed);
+    static FColorWide UnpackRGB10A2(const FIntWide& Packed);
+
+private:
+    /** Lanes RGBA quads, transposed to one register per channel. */
+    static FColorWide LoadInterleaved(const float* Values)
+    {
+        FColorWide Result;
+#if MIKASA_SIMD_AVX
+        // Colors N and N + 4 share a register, the 4x4 transpose then runs in both 128 bit halves at once
+        const __m256 Row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Values)), _mm_loadu_ps(Values + 16), 1);
+        const __m256 Row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Values + 4)), _mm_loadu_ps(Values + 20), 1);
+        const __m256 Row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Values + 8)), _mm_loadu_ps(Values + 24), 1);
+        const __m256 Row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Values + 12)), _mm_loadu_ps(Values + 28), 1);
+        Transpose(Row0, Row1, Row2, Row3, Result.R.Value, Result.G.Value, Result.B.Value, Result.A.Value);
+#elif MIKASA_SIMD_SSE2
+        __m128 Row0 = _mm_loadu_ps(Values);
+        __m128 Row1 = _mm_loadu_ps(Values + 4);
+        __m128 Row2 = _mm_loadu_ps(Values + 8);
+        __m128 Row3 = _mm_loadu_ps(Values + 12);
+        _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+        Result.R.Value = Row0;
+        Result.G.Value = Row1;
+        Result.B.Value = Row2;
+        Result.A.Value = Row3;
+#elif MIKASA_SIMD_NEON
+        const float32x4x4_t Channels = vld4q_f32(Values);
+        Result.R.Value = Channels.val[0];
+        Result.G.Value = Channels.val[1];
+        Result.B.Value = Channels.val[2];
+        Result.A.Value = Channels.val[3];
+#else
+        float Channels[4][Lanes];
+        for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+        {
+            for (int32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                Channels[Channel][Lane] = Values[Lane * 4 + Channel];
+            }
+        }
+        Result = Load(Channels[0], Channels[1], Channels[2], Channels[3]);
+#endif
+        return Result;
+    }
+
+    void StoreInterleaved(float* Values) const
+    {
+#if MIKASA_SIMD_AVX
+        __m256 Row0, Row1, Row2, Row3;
+        Transpose(R.Value, G.Value, B.Value, A.Value, Row0, Row1, Row2, Row3);
+        _mm_storeu_ps(Values, _mm256_castps256_ps128(Row0));
+        _mm_storeu_ps(Values + 4, _mm256_castps256_ps128(Row1));
+        _mm_storeu_ps(Values + 8, _mm256_castps256_ps128(Row2));
+        _mm_storeu_ps(Values + 12, _mm256_castps256_ps128(Row3));
+        _mm_storeu_ps(Values + 16, _mm256_extractf128_ps(Row0, 1));
+        _mm_storeu_ps(Values + 20, _mm256_extractf128_ps(Row1, 1));
+        _mm_storeu_ps(Values + 24, _mm256_extractf128_ps(Row2, 1));
+        _mm_storeu_ps(Values + 28, _mm256_extractf128_ps(Row3, 1));
+#elif MIKASA_SIMD_SSE2
+        __m128 Row0 = R.Value;
+        __m128 Row1 = G.Value;
+        __m128 Row2 = B.Value;
+        __m128 Row3 = A.Value;
+        _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+        _mm_storeu_ps(Values, Row0);
+        _mm_storeu_ps(Values + 4, Row1);
+        _mm_storeu_ps(Values + 8, Row2);
+        _mm_storeu_ps(Values + 12, Row3);
+#elif MIKASA_SIMD_NEON
+        float32x4x4_t Channels;
+        Channels.val[0] = R.Value;
+        Channels.val[1] = G.Value;
+        Channels.val[2] = B.Value;
+        Channels.val[3] = A.Value;
+        vst4q_f32(Values, Channels);
+#else
+        float Channels[4][Lanes];
+        Store(Channels[0], Channels[1], Channels[2], Channels[3]);
+        for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+        {
+            for (int32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                Values[Lane * 4 + Channel] = Channels[Channel][Lane];
+            }
+        }
+#endif
+    }
+
+#if MIKASA_SIMD_AVX
+    /** 4x4 transposes of both 128 bit halves. */
+    static void Transpose(const __m256& In0, const __m256& In1, const __m256& In2, const __m256& In3, __m256& Out0, __m256& Out1, __m256& Out2, __m256& Out3)
+    {
+        const __m256 Low01 = _mm256_unpacklo_ps(In0, In1);
+        const __m256 Low23 = _mm256_unpacklo_ps(In2, In3);
+        const __m256 High01 = _mm256_unpackhi_ps(In0, In1);
+        const __m256 High23 = _mm256_unpackhi_ps(In2, In3);
+        Out0 = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(1, 0, 1, 0));
+        Out1 = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(3, 2, 3, 2));
+        Out2 = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(1, 0, 1, 0));
+        Out3 = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+#endif
+};
+
+} // namespace MIKASA_SIMD_NAMESPACE
@@ -0,0 +1,301 @@
+// FColorWide and the FColor array kernels built on it, included by Color.cpp for the build's baseline and by
+// the files of higher SIMD tiers, see SimdKernels.h.
+
+#include <cstring>
+
+namespace
+{
+    float SRGBToLinearScalar(float Value)
+    {
+        return Value <= 0.04045f ? Value / 12.92f : powf((Value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float LinearToSRGBScalar(float Value)
+    {
+        return Value <= 0.0031308f ? Value * 12.92f : 1.055f * powf(Value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    /** Lanes used by the next step with NumLeft colors left, inline helpers of other headers are avoided here. */
+    int32_t GetNumLanes(int32_t NumLeft)
+    {
+        return NumLeft < FColorWide::Lanes ? NumLeft : FColorWide::Lanes;
+    }
+
+    /** Runs a wide kernel over FColor arrays, the tail repeats the last color. */
+    template <typename KernelType>
+    void ForEachColorWide(const FColor* Colors, int32_t NumColors, FColor* OutColors, KernelType Kernel)
+    {
+        for (int32_t Index = 0; Index < NumColors; Index += FColorWide::Lanes)
+        {
+            const int32_t Num = GetNumLanes(NumColors - Index);
+            Kernel(FColorWide::Load(Colors + Index, Num)).Store(OutColors + Index, Num);
+        }
+    }
+
+    /** Runs a wide kernel over float channel streams. */
+    template <typename KernelType>
+    void ForEachValueWide(const float* Values, int32_t NumValues, float* OutValues, KernelType Kernel)
+    {
+        int32_t Index = 0;
+        for (; Index + FFloatWide::Lanes <= NumValues; Index += FFloatWide::Lanes)
+        {
+            Kernel(FFloatWide::Load(Values + Index)).Store(OutValues + Index);
+        }
+
+        if (Index < NumValues)
+        {
+            Kernel(FFloatWide::LoadPartial(Values + Index, NumValues - Index)).StorePartial(OutValues + Index, NumValues - Index);
+        }
+    }
+
+    /** Packs FColor arrays, Kernel maps an FColorWide to FIntWide. */
+    template <typename KernelType>
+    void PackColorsWide(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked, KernelType Kernel)
+    {
+        for (int32_t Index = 0; Index < NumColors; Index += FColorWide::Lanes)
+        {
+            const int32_t Num = GetNumLanes(NumColors - Index);
+            const FIntWide Packed = Kernel(FColorWide::Load(Colors + Index, Num));
+            if (Num == FColorWide::Lanes)
+            {
+                Packed.Store((int32_t*)(OutPacked + Index));
+            }
+            else
+            {
+                alignas(32) int32_t Buffer[FColorWide::Lanes];
+                Packed.Store(Buffer);
+                std::memcpy(OutPacked + Index, Buffer, Num * sizeof(uint32_t));
+            }
+        }
+    }
+
+    /** Unpacks to FColor arrays, Kernel maps an FIntWide to FColorWide. The tail is padded with zeros. */
+    template <typename KernelType>
+    void UnpackColorsWide(const uint32_t* Packed, int32_t NumColors, FColor* OutColors, KernelType Kernel)
+    {
+        for (int32_t Index = 0; Index < NumColors; Index += FColorWide::Lanes)
+        {
+            const int32_t Num = GetNumLanes(NumColors - Index);
+            if (Num == FColorWide::Lanes)
+            {
+                Kernel(FIntWide::Load((const int32_t*)(Packed + Index))).Store(OutColors + Index);
+            }
+            else
+            {
+                alignas(32) int32_t Buffer[FColorWide::Lanes] = {};
+                std::memcpy(Buffer, Packed + Index, Num * sizeof(uint32_t));
+                Kernel(FIntWide::Load(Buffer)).Store(OutColors + Index, Num);
+            }
+        }
+    }
+
+    /** Quantizes Value clamped to [0, 1] to [0, Scale], rounding to nearest. */
+    FIntWide Quantize(const FFloatWide& Value, float Scale)
+    {
+        return FFloatWide::MulAdd(FFloatWide::Clamp(Value, FFloatWide(0.0f), FFloatWide(1.0f)), FFloatWide(Scale), FFloatWide(0.5f)).TruncToInt();
+    }
+
+    /** Bits [Shift, Shift + log2(Mask + 1)) of Packed, back in [0, 1]. */
+    FFloatWide Dequantize(const FIntWide& Packed, int32_t Shift, int32_t Mask)
+    {
+        return (Packed.ShiftRightLogical(Shift) & FIntWide(Mask)).ToFloat() * FFloatWide(1.0f / (float)Mask);
+    }
+
+    /** Linear value of every 8 bit sRGB code, as float bits so that the kernels can gather them. */
+    const int32_t* GetSRGBToLinearTable()
+    {
+        struct FTable
+        {
+            int32_t Values[256];
+
+            FTable()
+            {
+                for (int32_t Code = 0; Code < 256; ++Code)
+                {
+                    const float Value = SRGBToLinearScalar((float)Code / 255.0f);
+                    std::memcpy(&Values[Code], &Value, sizeof(float));
+                }
+            }
+        };
+
+        static const FTable Table;
+        return Table.Values;
+    }
+}
+
+FFloatWide FColorWide::SRGBToLinear(const FFloatWide& Value)
+{
+    const FFloatWide Threshold(0.04045f);
+    const FFloatWide Curve = FMath::Pow((FFloatWide::Max(Value, Threshold) + FFloatWide(0.055f)) * FFloatWide(1.0f / 1.055f), FFloatWide(2.4f));
+    return FFloatWide::Select(Value <= Threshold, Value * FFloatWide(1.0f / 12.92f), Curve);
+}
+
+FFloatWide FColorWide::LinearToSRGB(const FFloatWide& Value)
+{
+    const FFloatWide Threshold(0.0031308f);
+    const FFloatWide Curve = FFloatWide::MulAdd(FMath::Pow(FFloatWide::Max(Value, Threshold), FFloatWide(1.0f / 2.4f)), FFloatWide(1.055f), FFloatWide(-0.055f));
+    return FFloatWide::Select(Value <= Threshold, Value * FFloatWide(12.92f), Curve);
+}
+
+FColorWide FColorWide::RgbToHsv() const
+{
+    const FFloatWide Max = FFloatWide::Max(FFloatWide::Max(R, G), B);
+    const FFloatWide Delta = Max - FFloatWide::Min(FFloatWide::Min(R, G), B);
+    const FFloatWide Zero(0.0f);
+    const FMaskWide bChromatic = Delta > Zero;
+    const FFloatWide InvDelta = FFloatWide::Select(bChromatic, FFloatWide(1.0f) / Delta, Zero);
+
+    // Same branch order as FColor::ToHsv, red wins ties
+    const FMaskWide bMaxR = Max == R;
+    const FMaskWide bMaxG = Max == G;
+    FFloatWide Sector = FFloatWide::Select(bMaxG, (B - R) * InvDelta + FFloatWide(2.0f), (R - G) * InvDelta + FFloatWide(4.0f));
+    Sector = FFloatWide::Select(bMaxR, (G - B) * InvDelta, Sector);
+
+    FFloatWide Hue = FFloatWide::Select(bChromatic, Sector * FFloatWide(60.0f), Zero);
+    Hue = FFloatWide::Select(Hue < Zero, Hue + FFloatWide(360.0f), Hue);
+    const FFloatWide Saturation = FFloatWide::Select(bChromatic, Delta / Max, Zero);
+    return FColorWide(Hue, Saturation, Max, A);
+}
+
+FColorWide FColorWide::HsvToRgb() const
+{
+    const FFloatWide Full(360.0f);
+    const FFloatWide Sector = (R - (R * FFloatWide(1.0f / 360.0f)).Floor() * Full) * FFloatWide(1.0f / 60.0f);
+    const FFloatWide Chroma = B * G;
+    auto Channel = [&](float N)
+    {
+        FFloatWide K = Sector + FFloatWide(N);
+        K = FFloatWide::Select(K >= FFloatWide(6.0f), K - FFloatWide(6.0f), K);
+        return B - Chroma * FFloatWide::Clamp(FFloatWide::Min(K, FFloatWide(4.0f) - K), FFloatWide(0.0f), FFloatWide(1.0f));
+    };
+    return FColorWide(Channel(5.0f), Channel(3.0f), Channel(1.0f), A);
+}
+
+FIntWide FColorWide::PackRGBA8() const
+{
+    return Quantize(R, 255.0f) | Quantize(G, 255.0f).ShiftLeft(8) | Quantize(B, 255.0f).ShiftLeft(16) | Quantize(A, 255.0f).ShiftLeft(24);
+}
+
+FIntWide FColorWide::PackRGB10A2() const
+{
+    return Quantize(R, 1023.0f) | Quantize(G, 1023.0f).ShiftLeft(10) | Quantize(B, 1023.0f).ShiftLeft(20) | Quantize(A, 3.0f).ShiftLeft(30);
+}
+
+FColorWide FColorWide::UnpackRGBA8(const FIntWide& Packed)
+{
+    return FColorWide(Dequantize(Packed, 0, 0xFF), Dequantize(Packed, 8, 0xFF), Dequantize(Packed, 16, 0xFF), Dequantize(Packed, 24, 0xFF));
+}
+
+FColorWide FColorWide::UnpackRGB10A2(const FIntWide& Packed)
+{
+    return FColorWide(Dequantize(Packed, 0, 0x3FF), Dequantize(Packed, 10, 0x3FF), Dequantize(Packed, 20, 0x3FF), Dequantize(Packed, 30, 0x3));
+}
+
+inline namespace MIKASA_SIMD_NAMESPACE
+{
+    namespace SimdKernels
+    {
+        void SRGBToLinear(const FColor* Colors, int32_t NumColors, FColor* OutColors)
+        {
+            ForEachColorWide(Colors, NumColors, OutColors, [](const FColorWide& Color) { return Color.ToLinear(); });
+        }
+
+        void LinearToSRGB(const FColor* Colors, int32_t NumColors, FColor* OutColors)
+        {
+            ForEachColorWide(Colors, NumColors, OutColors, [](const FColorWide& Color) { return Color.ToSRGB(); });
+        }
+
+        void RgbToHsv(const FColor* Colors, int32_t NumColors, FHsvColor* OutColors)
+        {
+            for (int32_t Index = 0; Index < NumColors; Index += FColorWide::Lanes)
+            {
+                const int32_t Num = GetNumLanes(NumColors - Index);
+                const FColorWide Hsv = FColorWide::Load(Colors + Index, Num).RgbToHsv();
+
+                alignas(32) float Hue[FColorWide::Lanes];
+                alignas(32) float Saturation[FColorWide::Lanes];
+                alignas(32) float Value[FColorWide::Lanes];
+                Hsv.R.Store(Hue);
+                Hsv.G.Store(Saturation);
+                Hsv.B.Store(Value);
+                for (int32_t Lane = 0; Lane < Num; ++Lane)
+                {
+                    OutColors[Index + Lane] = FHsvColor(Hue[Lane], Saturation[Lane], Value[Lane]);
+                }
+            }
+        }
+
+        void HsvToRgb(const FHsvColor* Colors, int32_t NumColors, FColor* OutColors)
+        {
+            for (int32_t Index = 0; Index < NumColors; Index += FColorWide::Lanes)
+            {
+                const int32_t Num = GetNumLanes(NumColors - Index);
+
+                // FHsvColor has no fourth channel to transpose with, deinterleave through the stack
+                alignas(32) float Hue[FColorWide::Lanes];
+                alignas(32) float Saturation[FColorWide::Lanes];
+                alignas(32) float Value[FColorWide::Lanes];
+                for (int32_t Lane = 0; Lane < FColorWide::Lanes; ++Lane)
+                {
+                    const FHsvColor& Color = Colors[Index + (Lane < Num ? Lane : Num - 1)];
+                    Hue[Lane] = Color.Hue;
+                    Saturation[Lane] = Color.Saturation;
+                    Value[Lane] = Color.Value;
+                }
+                const FColorWide Hsv(FFloatWide::Load(Hue), FFloatWide::Load(Saturation), FFloatWide::Load(Value), FFloatWide(1.0f));
+                Hsv.HsvToRgb().Store(OutColors + Index, Num);
+            }
+        }
+
+        void Premultiply(const FColor* Colors, int32_t NumColors, FColor* OutColors)
+        {
+            ForEachColorWide(Colors, NumColors, OutColors, [](const FColorWide& Color) { return Color.Premultiply(); });
+        }
+
+        void PackRGBA8(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked)
+        {
+            PackColorsWide(Colors, NumColors, OutPacked, [](const FColorWide& Color) { return Color.PackRGBA8(); });
+        }
+
+        void PackRGB10A2(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked)
+        {
+            PackColorsWide(Colors, NumColors, OutPacked, [](const FColorWide& Color) { return Color.PackRGB10A2(); });
+        }
+
+        void UnpackRGBA8(const uint32_t* Packed, int32_t NumColors, FColor* OutColors, bool bSRGB)
+        {
+            if (!bSRGB)
+            {
+                UnpackColorsWide(Packed, NumColors, OutColors, [](const FIntWide& Texels) { return FColorWide::UnpackRGBA8(Texels); });
+                return;
+            }
+
+            // 256 codes per channel, a table lookup is cheaper than the exact curve
+            const int32_t* Table = GetSRGBToLinearTable();
+            UnpackColorsWide(Packed, NumColors, OutColors, [Table](const FIntWide& Texels)
+                {
+                    const FIntWide Mask(0xFF);
+                    return FColorWide(
+                        FIntWide::Gather(Table, Texels & Mask).AsFloat(),
+                        FIntWide::Gather(Table, Texels.ShiftRightLogical(8) & Mask).AsFloat(),
+                        FIntWide::Gather(Table, Texels.ShiftRightLogical(16) & Mask).AsFloat(),
+                        Dequantize(Texels, 24, 0xFF));
+                });
+        }
+
+        void UnpackRGB10A2(const uint32_t* Packed, int32_t NumColors, FColor* OutColors)
+        {
+            UnpackColorsWide(Packed, NumColors, OutColors, [](const FIntWide& Texels) { return FColorWide::UnpackRGB10A2(Texels); });
+        }
+
+        void SRGBToLinear(const float* Values, int32_t NumValues, float* OutValues)
+        {
+            ForEachValueWide(Values, NumValues, OutValues, [](const FFloatWide& Value) { return FColorWide::SRGBToLinear(Value); });
+        }
+
+        void LinearToSRGB(const float* Values, int32_t NumValues, float* OutValues)
+        {
+            ForEachValueWide(Values, NumValues, OutValues, [](const FFloatWide& Value) { return FColorWide::LinearToSRGB(Value); });
+        }
+    }
+}
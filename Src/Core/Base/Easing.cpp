@@ -0,0 +1,247 @@
+#include "Easing.h"
+
+#include <cfloat>
+
+namespace
+{
+    constexpr int32_t NumFunctions = (int32_t)EEasingFunction::Count;
+
+    /** Requests of mixed vectors, and the same sorted by function. Kept per thread so batches do not allocate in steady state. */
+    thread_local std::vector<int32_t> MixedIndices;
+    thread_local std::vector<int32_t> SortedIndices;
+
+    /** Mirrors the In half of a curve to the second half, as the InOut functions of FMath do. */
+    template <typename InType, typename OutType>
+    FFloatWide EaseInOutWide(const FFloatWide& Alpha, InType In, OutType Out)
+    {
+        const FFloatWide Half(0.5f);
+        const FFloatWide Doubled = Alpha * FFloatWide(2.0f);
+        return FFloatWide::Select(Alpha < Half, In(Doubled) * Half, Out(Doubled - FFloatWide(1.0f)) * Half + Half);
+    }
+
+    FFloatWide EaseInWide(const FFloatWide& Alpha, const FFloatWide& Exponent, EMathAccuracy Accuracy)
+    {
+        // Pow needs positive inputs, Alpha^Exp is 0 at 0 for the positive exponents the curve is used with
+        const FFloatWide Zero(0.0f);
+        return FFloatWide::Select(Alpha > Zero, FMath::Pow(FFloatWide::Max(Alpha, FFloatWide(FLT_MIN)), Exponent, Accuracy), Zero);
+    }
+
+    FFloatWide SinInWide(const FFloatWide& Alpha, EMathAccuracy Accuracy)
+    {
+        return FFloatWide(1.0f) - FMath::Cos(Alpha * FFloatWide(HALF_PI), Accuracy);
+    }
+
+    FFloatWide SinOutWide(const FFloatWide& Alpha, EMathAccuracy Accuracy)
+    {
+        return FMath::Sin(Alpha * FFloatWide(HALF_PI), Accuracy);
+    }
+
+    FFloatWide ExpoInWide(const FFloatWide& Alpha, EMathAccuracy Accuracy)
+    {
+        const FFloatWide Zero(0.0f);
+        return FFloatWide::Select(Alpha == Zero, Zero, FMath::Exp2(FFloatWide(10.0f) * Alpha - FFloatWide(10.0f), Accuracy));
+    }
+
+    FFloatWide ExpoOutWide(const FFloatWide& Alpha, EMathAccuracy Accuracy)
+    {
+        const FFloatWide One(1.0f);
+        return FFloatWide::Select(Alpha == One, One, One - FMath::Exp2(FFloatWide(-10.0f) * Alpha, Accuracy));
+    }
+
+    FFloatWide CircularInWide(const FFloatWide& Alpha)
+    {
+        return FFloatWide(1.0f) - FFloatWide::Sqrt(FFloatWide(1.0f) - Alpha * Alpha);
+    }
+
+    FFloatWide CircularOutWide(const FFloatWide& Alpha)
+    {
+        const FFloatWide Shifted = Alpha - FFloatWide(1.0f);
+        return FFloatWide::Sqrt(FFloatWide(1.0f) - Shifted * Shifted);
+    }
+
+    FFloatWide InterpWide(EEasingFunction Function, const FFloatWide& Start, const FFloatWide& End, const FFloatWide& Alpha, const FFloatWide& Param, EMathAccuracy Accuracy)
+    {
+        return Start + FEasing::Ease(Function, Alpha, Param, Accuracy) * (End - Start);
+    }
+}
+
+float FEasing::Ease(EEasingFunction Function, float Alpha, float Param)
+{
+    switch (Function)
+    {
+    case EEasingFunction::EaseIn:
+        return FMath::InterpEaseIn(0.0f, 1.0f, Alpha, Param);
+    case EEasingFunction::EaseOut:
+        return FMath::InterpEaseOut(0.0f, 1.0f, Alpha, Param);
+    case EEasingFunction::EaseInOut:
+        return FMath::InterpEaseInOut(0.0f, 1.0f, Alpha, Param);
+    case EEasingFunction::Step:
+        return FMath::InterpStep(0.0f, 1.0f, Alpha, (int32_t)Param);
+    case EEasingFunction::SinIn:
+        return FMath::InterpSinIn(0.0f, 1.0f, Alpha);
+    case EEasingFunction::SinOut:
+        return FMath::InterpSinOut(0.0f, 1.0f, Alpha);
+    case EEasingFunction::SinInOut:
+        return FMath::InterpSinInOut(0.0f, 1.0f, Alpha);
+    case EEasingFunction::ExpoIn:
+        return FMath::InterpExpoIn(0.0f, 1.0f, Alpha);
+    case EEasingFunction::ExpoOut:
+        return FMath::InterpExpoOut(0.0f, 1.0f, Alpha);
+    case EEasingFunction::ExpoInOut:
+        return FMath::InterpExpoInOut(0.0f, 1.0f, Alpha);
+    case EEasingFunction::CircularIn:
+        return FMath::InterpCircularIn(0.0f, 1.0f, Alpha);
+    case EEasingFunction::CircularOut:
+        return FMath::InterpCircularOut(0.0f, 1.0f, Alpha);
+    case EEasingFunction::CircularInOut:
+        return FMath::InterpCircularInOut(0.0f, 1.0f, Alpha);
+    default:
+        return Alpha;
+    }
+}
+
+FFloatWide FEasing::Ease(EEasingFunction Function, const FFloatWide& Alpha, const FFloatWide& Param, EMathAccuracy Accuracy)
+{
+    const FFloatWide One(1.0f);
+    switch (Function)
+    {
+    case EEasingFunction::EaseIn:
+        return EaseInWide(Alpha, Param, Accuracy);
+    case EEasingFunction::EaseOut:
+        return One - EaseInWide(One - Alpha, Param, Accuracy);
+    case EEasingFunction::EaseInOut:
+        return EaseInOutWide(Alpha,
+            [&](const FFloatWide& Value) { return EaseInWide(Value, Param, Accuracy); },
+            [&](const FFloatWide& Value) { return One - EaseInWide(One - Value, Param, Accuracy); });
+    case EEasingFunction::Step:
+    {
+        const FFloatWide Zero(0.0f);
+        const FFloatWide Steps = Param.Floor();
+        const FFloatWide Stepped = (Alpha * Steps).Floor() / FFloatWide::Max(Steps - One, One);
+        return FFloatWide::Select((Steps <= One) | (Alpha <= Zero), Zero, FFloatWide::Select(Alpha >= One, One, Stepped));
+    }
+    case EEasingFunction::SinIn:
+        return SinInWide(Alpha, Accuracy);
+    case EEasingFunction::SinOut:
+        return SinOutWide(Alpha, Accuracy);
+    case EEasingFunction::SinInOut:
+        return EaseInOutWide(Alpha,
+            [Accuracy](const FFloatWide& Value) { return SinInWide(Value, Accuracy); },
+            [Accuracy](const FFloatWide& Value) { return SinOutWide(Value, Accuracy); });
+    case EEasingFunction::ExpoIn:
+        return ExpoInWide(Alpha, Accuracy);
+    case EEasingFunction::ExpoOut:
+        return ExpoOutWide(Alpha, Accuracy);
+    case EEasingFunction::ExpoInOut:
+        return EaseInOutWide(Alpha,
+            [Accuracy](const FFloatWide& Value) { return ExpoInWide(Value, Accuracy); },
+            [Accuracy](const FFloatWide& Value) { return ExpoOutWide(Value, Accuracy); });
+    case EEasingFunction::CircularIn:
+        return CircularInWide(Alpha);
+    case EEasingFunction::CircularOut:
+        return CircularOutWide(Alpha);
+    case EEasingFunction::CircularInOut:
+        return EaseInOutWide(Alpha, &CircularInWide, &CircularOutWide);
+    default:
+        return Alpha;
+    }
+}
+
+void FEasing::InterpBatch(const EEasingFunction* Functions, const float* Starts, const float* Ends, const float* Alphas, const float* Params, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+    constexpr int32_t Lanes = FFloatWide::Lanes;
+    const FFloatWide WideDefaultParam(DefaultParam);
+
+    // Tweens of one curve usually come in runs, vectors of them are evaluated in place and only the
+    // requests of mixed vectors go through the counting sort by function
+    std::vector<int32_t>& Mixed = MixedIndices;
+    std::vector<int32_t>& Sorted = SortedIndices;
+    Mixed.clear();
+    int32_t GroupStarts[NumFunctions + 1] = {};
+    int32_t Index = 0;
+    for (; Index + Lanes <= NumValues; Index += Lanes)
+    {
+        const EEasingFunction Function = Functions[Index];
+        bool bUniform = true;
+        for (int32_t Lane = 1; Lane < Lanes; ++Lane)
+        {
+            bUniform &= Functions[Index + Lane] == Function;
+        }
+
+        if (bUniform)
+        {
+            const FFloatWide Param = Params ? FFloatWide::Load(Params + Index) : WideDefaultParam;
+            InterpWide(Function, FFloatWide::Load(Starts + Index), FFloatWide::Load(Ends + Index), FFloatWide::Load(Alphas + Index), Param, Accuracy).Store(OutValues + Index);
+            continue;
+        }
+
+        for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+        {
+            Mixed.push_back(Index + Lane);
+            ++GroupStarts[(int32_t)Functions[Index + Lane] + 1];
+        }
+    }
+    for (; Index < NumValues; ++Index)
+    {
+        Mixed.push_back(Index);
+        ++GroupStarts[(int32_t)Functions[Index] + 1];
+    }
+
+    for (int32_t Function = 0; Function < NumFunctions; ++Function)
+    {
+        GroupStarts[Function + 1] += GroupStarts[Function];
+    }
+
+    Sorted.resize(Mixed.size());
+    int32_t GroupEnds[NumFunctions];
+    std::copy(GroupStarts, GroupStarts + NumFunctions, GroupEnds);
+    for (const int32_t MixedIndex : Mixed)
+    {
+        Sorted[GroupEnds[(int32_t)Functions[MixedIndex]]++] = MixedIndex;
+    }
+
+    for (int32_t Function = 0; Function < NumFunctions; ++Function)
+    {
+        const int32_t* Indices = Sorted.data() + GroupStarts[Function];
+        const int32_t GroupSize = GroupStarts[Function + 1] - GroupStarts[Function];
+        for (int32_t First = 0; First < GroupSize; First += Lanes)
+        {
+            const int32_t Num = FMath::Min(GroupSize - First, Lanes);
+            const int32_t* LaneIndices = Indices + First;
+
+            alignas(32) float LaneValues[4][Lanes] = {};
+            for (int32_t Lane = 0; Lane < Num; ++Lane)
+            {
+                const int32_t ValueIndex = LaneIndices[Lane];
+                LaneValues[0][Lane] = Starts[ValueIndex];
+                LaneValues[1][Lane] = Ends[ValueIndex];
+                LaneValues[2][Lane] = Alphas[ValueIndex];
+                LaneValues[3][Lane] = Params ? Params[ValueIndex] : DefaultParam;
+            }
+
+            alignas(32) float Results[Lanes];
+            InterpWide((EEasingFunction)Function, FFloatWide::Load(LaneValues[0]), FFloatWide::Load(LaneValues[1]), FFloatWide::Load(LaneValues[2]), FFloatWide::Load(LaneValues[3]), Accuracy).Store(Results);
+            for (int32_t Lane = 0; Lane < Num; ++Lane)
+            {
+                OutValues[LaneIndices[Lane]] = Results[Lane];
+            }
+        }
+    }
+}
+
+void FEasing::InterpBatch(EEasingFunction Function, const float* Starts, const float* Ends, const float* Alphas, float Param, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+    const FFloatWide WideParam(Param);
+    int32_t Index = 0;
+    for (; Index + FFloatWide::Lanes <= NumValues; Index += FFloatWide::Lanes)
+    {
+        InterpWide(Function, FFloatWide::Load(Starts + Index), FFloatWide::Load(Ends + Index), FFloatWide::Load(Alphas + Index), WideParam, Accuracy).Store(OutValues + Index);
+    }
+
+    if (Index < NumValues)
+    {
+        const int32_t Num = NumValues - Index;
+        InterpWide(Function, FFloatWide::LoadPartial(Starts + Index, Num), FFloatWide::LoadPartial(Ends + Index, Num), FFloatWide::LoadPartial(Alphas + Index, Num), WideParam, Accuracy)
+            .StorePartial(OutValues + Index, Num);
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+
+/** The easing curves of the FMath::Interp* functions. */
+enum class EEasingFunction : uint8_t
+{
+    Linear,
+    /** Curves with an exponent parameter, see FMath::InterpEaseIn. */
+    EaseIn,
+    EaseOut,
+    EaseInOut,
+    /** Parameter is the number of steps, see FMath::InterpStep. */
+    Step,
+    SinIn,
+    SinOut,
+    SinInOut,
+    ExpoIn,
+    ExpoOut,
+    ExpoInOut,
+    CircularIn,
+    CircularOut,
+    CircularInOut,
+
+    Count,
+};
+
+/**
+ * Batch evaluation of easing curves for tweens and animation curves. Vectors of requests on one curve
+ * run on FFloatWide in place, mixed ones are sorted by curve first. The batches use the Fast
+ * transcendentals of FMath by default, within about 1e-4 of the scalar FMath::Interp* functions.
+ */
+class CORE_API FEasing
+{
+public:
+    /** Parameter used when a batch has none, the exponent of the EaseIn family and the step count of Step. */
+    static constexpr float DefaultParam = 2.0f;
+
+    /** Alpha through the curve, what FMath::Interp* interpolates with. */
+    static float Ease(EEasingFunction Function, float Alpha, float Param = DefaultParam);
+    static FFloatWide Ease(EEasingFunction Function, const FFloatWide& Alpha, const FFloatWide& Param, EMathAccuracy Accuracy = EMathAccuracy::Fast);
+
+    static float Interp(EEasingFunction Function, float Start, float End, float Alpha, float Param = DefaultParam)
+    {
+        return FMath::Lerp(Start, End, Ease(Function, Alpha, Param));
+    }
+
+    /**
+     * OutValues[i] = Interp(Functions[i], Starts[i], Ends[i], Alphas[i], Params[i]), Params may be null for
+     * DefaultParam. Requests are grouped by function, OutValues must not alias the inputs.
+     */
+    static void InterpBatch(const EEasingFunction* Functions, const float* Starts, const float* Ends, const float* Alphas, const float* Params, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Fast);
+
+    /** All values on one curve, no grouping needed. OutValues may alias the inputs. */
+    static void InterpBatch(EEasingFunction Function, const float* Starts, const float* Ends, const float* Alphas, float Param, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Fast);
+};
@@ -0,0 +1,237 @@
+#include "Float16.h"
+
+#include <cstring>
+
+#include "Util/CpuInfo.h"
+
+#if MIKASA_CPU_X86
+#include <immintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#define MIKASA_F16_NEON 1
+#include <arm_neon.h>
+#endif
+
+// Single values use F16C when the whole build targets it, arrays check the CPU at runtime
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MIKASA_F16C 1
+#endif
+
+namespace
+{
+    /**
+     * Exact conversion tables. Half to float splits the half in its sign and exponent, which select an
+     * exponent and a mantissa block, and its mantissa, with denormals normalized in the mantissa table and
+     * NaNs quieted in a block of their own as F16C does.
+     * Float to half looks up a base and a shift from the float's sign and exponent, the shift rounds the
+     * mantissa (with its implicit bit) to nearest even and a carry moves on to the exponent.
+     */
+    struct FFloat16Tables
+    {
+        uint32_t Mantissas[3072];
+        uint32_t Exponents[64];
+        uint16_t Offsets[64];
+        uint16_t Bases[512];
+        uint8_t Shifts[512];
+
+        FFloat16Tables()
+        {
+            Mantissas[0] = 0;
+            for (uint32_t Index = 1; Index < 1024; ++Index)
+            {
+                uint32_t Mantissa = Index << 13;
+                uint32_t Exponent = 0;
+                while (!(Mantissa & 0x800000))
+                {
+                    Exponent -= 0x800000;
+                    Mantissa <<= 1;
+                }
+                Mantissas[Index] = (Mantissa & ~0x800000u) | (Exponent + 0x38800000);
+            }
+            for (uint32_t Index = 1024; Index < 2048; ++Index)
+            {
+                Mantissas[Index] = 0x38000000 + ((Index - 1024) << 13);
+                Mantissas[Index + 1024] = Mantissas[Index] | (Index > 1024 ? 0x400000 : 0);
+            }
+
+            for (uint32_t Index = 0; Index < 32; ++Index)
+            {
+                Exponents[Index] = Index == 31 ? 0x47800000 : Index << 23;
+                Exponents[Index + 32] = 0x80000000 | Exponents[Index];
+                Offsets[Index] = Offsets[Index + 32] = Index == 0 ? 0 : (Index == 31 ? 2048 : 1024);
+            }
+
+            for (uint32_t Index = 0; Index < 256; ++Index)
+            {
+                uint16_t Base;
+                uint32_t Shift;
+                if (Index < 113)
+                {
+                    // Half denormals, and zero once the shift drops every bit
+                    Base = 0;
+                    Shift = Index > 95 ? 126 - Index : 31;
+                }
+                else if (Index < 143)
+                {
+                    // The implicit bit adds one to the exponent
+                    Base = (uint16_t)((Index - 113) << 10);
+                    Shift = 13;
+                }
+                else
+                {
+                    Base = 0x7C00;
+                    Shift = 31;
+                }
+                Bases[Index] = Base;
+                Bases[Index | 0x100] = Base | 0x8000;
+                Shifts[Index] = Shifts[Index | 0x100] = (uint8_t)Shift;
+            }
+        }
+    };
+
+    const FFloat16Tables& GetTables()
+    {
+        static const FFloat16Tables Tables;
+        return Tables;
+    }
+
+    uint16_t FloatToHalf(float Value, const FFloat16Tables& Tables)
+    {
+        uint32_t Bits;
+        std::memcpy(&Bits, &Value, sizeof(float));
+
+        if ((Bits & 0x7FFFFFFF) > 0x7F800000)
+        {
+            // Quiet NaN keeping the sign and the top of the payload, like F16C
+            return (uint16_t)(((Bits >> 16) & 0x8000) | 0x7E00 | ((Bits >> 13) & 0x3FF));
+        }
+
+        const uint32_t Index = Bits >> 23;
+        const uint32_t Shift = Tables.Shifts[Index];
+        const uint32_t Mantissa = (Bits & 0x7FFFFF) | 0x800000;
+        return (uint16_t)(Tables.Bases[Index] + ((Mantissa + (1u << (Shift - 1)) - 1 + ((Mantissa >> Shift) & 1)) >> Shift));
+    }
+
+    float HalfToFloat(uint16_t Half, const FFloat16Tables& Tables)
+    {
+        const uint32_t Exponent = Half >> 10;
+        const uint32_t Bits = Tables.Mantissas[Tables.Offsets[Exponent] + (Half & 0x3FF)] + Tables.Exponents[Exponent];
+
+        float Value;
+        std::memcpy(&Value, &Bits, sizeof(float));
+        return Value;
+    }
+
+    void FromFloatsTable(const float* Values, int32_t NumValues, FFloat16* OutValues)
+    {
+        const FFloat16Tables& Tables = GetTables();
+        for (int32_t Index = 0; Index < NumValues; ++Index)
+        {
+            OutValues[Index].Encoded = FloatToHalf(Values[Index], Tables);
+        }
+    }
+
+    void ToFloatsTable(const FFloat16* Values, int32_t NumValues, float* OutValues)
+    {
+        const FFloat16Tables& Tables = GetTables();
+        for (int32_t Index = 0; Index < NumValues; ++Index)
+        {
+            OutValues[Index] = HalfToFloat(Values[Index].Encoded, Tables);
+        }
+    }
+
+#if MIKASA_CPU_X86
+    MIKASA_TARGET("avx,f16c") void FromFloatsF16C(const float* Values, int32_t NumValues, FFloat16* OutValues)
+    {
+        int32_t Index = 0;
+        for (; Index + 8 <= NumValues; Index += 8)
+        {
+            _mm_storeu_si128((__m128i*)(OutValues + Index), _mm256_cvtps_ph(_mm256_loadu_ps(Values + Index), _MM_FROUND_TO_NEAREST_INT));
+        }
+        for (; Index < NumValues; ++Index)
+        {
+            OutValues[Index].Encoded = _cvtss_sh(Values[Index], _MM_FROUND_TO_NEAREST_INT);
+        }
+    }
+
+    MIKASA_TARGET("avx,f16c") void ToFloatsF16C(const FFloat16* Values, int32_t NumValues, float* OutValues)
+    {
+        int32_t Index = 0;
+        for (; Index + 8 <= NumValues; Index += 8)
+        {
+            _mm256_storeu_ps(OutValues + Index, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(Values + Index))));
+        }
+        for (; Index < NumValues; ++Index)
+        {
+            OutValues[Index] = _cvtsh_ss(Values[Index].Encoded);
+        }
+    }
+#endif
+
+#if MIKASA_F16_NEON
+    void FromFloatsNEON(const float* Values, int32_t NumValues, FFloat16* OutValues)
+    {
+        int32_t Index = 0;
+        for (; Index + 4 <= NumValues; Index += 4)
+        {
+            vst1_u16(&OutValues[Index].Encoded, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(Values + Index))));
+        }
+        FromFloatsTable(Values + Index, NumValues - Index, OutValues + Index);
+    }
+
+    void ToFloatsNEON(const FFloat16* Values, int32_t NumValues, float* OutValues)
+    {
+        int32_t Index = 0;
+        for (; Index + 4 <= NumValues; Index += 4)
+        {
+            vst1q_f32(OutValues + Index, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&Values[Index].Encoded))));
+        }
+        ToFloatsTable(Values + Index, NumValues - Index, OutValues + Index);
+    }
+#endif
+}
+
+FFloat16::FFloat16(float Value)
+{
+#if MIKASA_F16C
+    Encoded = _cvtss_sh(Value, _MM_FROUND_TO_NEAREST_INT);
+#else
+    Encoded = FloatToHalf(Value, GetTables());
+#endif
+}
+
+float FFloat16::GetFloat() const
+{
+#if MIKASA_F16C
+    return _cvtsh_ss(Encoded);
+#else
+    return HalfToFloat(Encoded, GetTables());
+#endif
+}
+
+void FFloat16::FromFloats(const float* Values, int32_t NumValues, FFloat16* OutValues)
+{
+    static const TSimdKernel<void(const float*, int32_t, FFloat16*)> Kernel =
+    {
+        { ESimdTier::Scalar, &FromFloatsTable },
+#if MIKASA_CPU_X86
+        { ESimdTier::AVX2, &FromFloatsF16C },
+#elif MIKASA_F16_NEON
+        { ESimdTier::NEON, &FromFloatsNEON },
+#endif
+    };
+    Kernel(Values, NumValues, OutValues);
+}
+
+void FFloat16::ToFloats(const FFloat16* Values, int32_t NumValues, float* OutValues)
+{
+    static const TSimdKernel<void(const FFloat16*, int32_t, float*)> Kernel =
+    {
+        { ESimdTier::Scalar, &ToFloatsTable },
+#if MIKASA_CPU_X86
+        { ESimdTier::AVX2, &ToFloatsF16C },
+#elif MIKASA_F16_NEON
+        { ESimdTier::NEON, &ToFloatsNEON },
+#endif
+    };
+    Kernel(Values, NumValues, OutValues);
+}
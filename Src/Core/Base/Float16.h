@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * IEEE 754 half precision float: 1 sign bit, 5 exponent bits and 10 mantissa bits, finite up to 65504.
+ * Conversions from float round to nearest even, overflow to infinity and keep NaNs, which is what
+ * F16C and GPUs do, so data converted here and on the device is bit identical. Use the array
+ * converters for attribute buffers and images, they run on F16C or NEON when the CPU has them (see
+ * FCpuInfo) and on exact lookup tables otherwise.
+ */
+struct CORE_API FFloat16
+{
+    uint16_t Encoded;
+
+    constexpr FFloat16()
+        : Encoded(0)
+    {
+    }
+
+    FFloat16(float Value);
+
+    static constexpr FFloat16 FromBits(uint16_t Bits)
+    {
+        FFloat16 Result;
+        Result.Encoded = Bits;
+        return Result;
+    }
+
+    float GetFloat() const;
+
+    operator float() const { return GetFloat(); }
+
+    FFloat16& operator=(float Value)
+    {
+        *this = FFloat16(Value);
+        return *this;
+    }
+
+    constexpr bool IsNaN() const { return (Encoded & 0x7FFF) > 0x7C00; }
+    constexpr bool IsInfinity() const { return (Encoded & 0x7FFF) == 0x7C00; }
+    constexpr bool IsNegative() const { return (Encoded & 0x8000) != 0; }
+
+    /** Converts NumValues floats, Values and OutValues must not overlap. */
+    static void FromFloats(const float* Values, int32_t NumValues, FFloat16* OutValues);
+    static void ToFloats(const FFloat16* Values, int32_t NumValues, float* OutValues);
+
+    static constexpr float MaxValue = 65504.0f;
+};
+
+static_assert(sizeof(FFloat16) == 2, "FFloat16 must be 16 bits");
@@ -1,4 +1,11 @@
 #include "MathUtil.h"
+
+#include "Async/JobSystem.h"
+#include "Base/Sampling.h"
+#include "Base/SimdKernels.h"
+#include "Profiler/CpuProfiler.h"
+
+#include "Base/MathUtilWide.inl"
 //
 //float FMath::Fmod(float X, float Y)
 //{
@@ -27,50 +34,50 @@
 //}
 //
 //
-//float FMath::Atan2(float Y, float X)
-//{
-//	//return atan2f(Y,X);
-//	// atan2f occasionally returns NaN with perfectly valid input (possibly due to a compiler or library bug).
-//	// We are replacing it with a minimax approximation with a max relative error of 7.15255737e-007 compared to the C library function.
-//	// On PC this has been measured to be 2x faster than the std C version.
-//
-//	const float absX = FMath::Abs(X);
-//	const float absY = FMath::Abs(Y);
-//	const bool yAbsBigger = (absY > absX);
-//	float t0 = yAbsBigger ? absY : absX; // Max(absY, absX)
-//	float t1 = yAbsBigger ? absX : absY; // Min(absX, absY)
-//
-//	if (t0 == 0.f)
-//		return 0.f;
-//
-//	float t3 = t1 / t0;
-//	float t4 = t3 * t3;
-//
-//	static const float c[7] = {
-//		+7.2128853633444123e-03f,
-//		-3.5059680836411644e-02f,
-//		+8.1675882859940430e-02f,
-//		-1.3374657325451267e-01f,
-//		+1.9856563505717162e-01f,
-//		-3.3324998579202170e-01f,
-//		+1.0f
-//	};
-//
-//	t0 = c[0];
-//	t0 = t0 * t4 + c[1];
-//	t0 = t0 * t4 + c[2];
-//	t0 = t0 * t4 + c[3];
-//	t0 = t0 * t4 + c[4];
-//	t0 = t0 * t4 + c[5];
-//	t0 = t0 * t4 + c[6];
-//	t3 = t0 * t3;
-//
-//	t3 = yAbsBigger ? (0.5f * PI) - t3 : t3;
-//	t3 = (X < 0.0f) ? PI - t3 : t3;
-//	t3 = (Y < 0.0f) ? -t3 : t3;
-//
-//	return t3;
-//}
+float FMath::Atan2(float Y, float X)
+{
+	//return atan2f(Y,X);
+	// atan2f occasionally returns NaN with perfectly valid input (possibly due to a compiler or library bug).
+	// We are replacing it with a minimax approximation with a max relative error of 7.15255737e-007 compared to the C library function.
+	// On PC this has been measured to be 2x faster than the std C version.
+
+	const float absX = FMath::Abs(X);
+	const float absY = FMath::Abs(Y);
+	const bool yAbsBigger = (absY > absX);
+	float t0 = yAbsBigger ? absY : absX; // Max(absY, absX)
+	float t1 = yAbsBigger ? absX : absY; // Min(absX, absY)
+
+	if (t0 == 0.f)
+		return 0.f;
+
+	float t3 = t1 / t0;
+	float t4 = t3 * t3;
+
+	static const float c[7] = {
+		+7.2128853633444123e-03f,
+		-3.5059680836411644e-02f,
+		+8.1675882859940430e-02f,
+		-1.3374657325451267e-01f,
+		+1.9856563505717162e-01f,
+		-3.3324998579202170e-01f,
+		+1.0f
+	};
+
+	t0 = c[0];
+	t0 = t0 * t4 + c[1];
+	t0 = t0 * t4 + c[2];
+	t0 = t0 * t4 + c[3];
+	t0 = t0 * t4 + c[4];
+	t0 = t0 * t4 + c[5];
+	t0 = t0 * t4 + c[6];
+	t3 = t0 * t3;
+
+	t3 = yAbsBigger ? (0.5f * PI) - t3 : t3;
+	t3 = (X < 0.0f) ? PI - t3 : t3;
+	t3 = (Y < 0.0f) ? -t3 : t3;
+
+	return t3;
+}
 //
 //void FMath::FmodReportError(float X, float Y)
 //{
@@ -79,22 +86,1202 @@
 //		//ensureMsgf(Y != 0, TEXT("FMath::FMod(X=%f, Y=%f) : Y is zero, this is invalid and would result in NaN!"), X, Y);
 //	}
 //}
-//
-//inline MVector FMath::VRand()
-//{
-//	MVector Result;
-//
-//	float L;
-//
-//	do
-//	{
-//		// Check random vectors in the unit sphere so result is statistically uniform.
-//		Result.x = FRand() * 2.f - 1.f;
-//		Result.y = FRand() * 2.f - 1.f;
-//		Result.z = FRand() * 2.f - 1.f;
-//		Length
-//		L = Result.SizeSquared();
-//	} while (L > 1.0f || L < KINDA_SMALL_NUMBER);
-//
-//	return Result * (1.0f / Sqrt(L));
-//}
+
+MVector FMath::VRandCone(MVector const& Dir, float ConeHalfAngleRad)
+{
+	if (ConeHalfAngleRad > 0.f)
+	{
+		// Uniform over the spherical cap: the cosine of the angle to the axis is uniform in [cos(HalfAngle), 1]
+		const float CosTheta = Lerp(1.f, Cos(ConeHalfAngleRad), FRand());
+		const float SinTheta = Sqrt(Max(0.f, 1.f - CosTheta * CosTheta));
+		const float Phi = 2.f * PI * FRand();
+
+		const MVector Axis = Dir.GetSafeNormal();
+		MVector AxisY, AxisZ;
+		Axis.FindBestAxisVectors(AxisY, AxisZ);
+
+		return (Axis * CosTheta + AxisY * (SinTheta * Cos(Phi)) + AxisZ * (SinTheta * Sin(Phi))).GetSafeNormal();
+	}
+	else
+	{
+		return Dir.GetSafeNormal();
+	}
+}
+
+MVector FMath::VRandCone(MVector const& Dir, float HorizontalConeHalfAngleRad, float VerticalConeHalfAngleRad)
+{
+	if (VerticalConeHalfAngleRad > 0.f && HorizontalConeHalfAngleRad > 0.f)
+	{
+		const float Phi = 2.f * PI * FRand();
+
+		// Half angle of the elliptical cone in the direction of Phi
+		float ConeHalfAngleRad = Square(Cos(Phi) / VerticalConeHalfAngleRad) + Square(Sin(Phi) / HorizontalConeHalfAngleRad);
+		ConeHalfAngleRad = Sqrt(1.f / ConeHalfAngleRad);
+
+		const float CosTheta = Lerp(1.f, Cos(ConeHalfAngleRad), FRand());
+		const float SinTheta = Sqrt(Max(0.f, 1.f - CosTheta * CosTheta));
+
+		// Vertical limit applies around world Z, horizontal limit around world Y
+		const MVector Axis = Dir.GetSafeNormal();
+		MVector AxisUp = (MVector::UpVector - Axis * (MVector::UpVector | Axis)).GetSafeNormal();
+		if (AxisUp.IsZero())
+		{
+			MVector Unused;
+			Axis.FindBestAxisVectors(AxisUp, Unused);
+		}
+		const MVector AxisRight = AxisUp ^ Axis;
+
+		return (Axis * CosTheta + AxisUp * (SinTheta * Cos(Phi)) + AxisRight * (SinTheta * Sin(Phi))).GetSafeNormal();
+	}
+	else
+	{
+		return Dir.GetSafeNormal();
+	}
+}
+
+MVector2D FMath::RandPointInCircle(float CircleRadius)
+{
+	return FSampling::ConcentricDisk(MVector2D(FRand(), FRand())) * CircleRadius;
+}
+
+MVector FMath::RandPointInBox(const FBox& Box)
+{
+	return MVector(FRandRange(Box.Min.x, Box.Max.x), FRandRange(Box.Min.y, Box.Max.y), FRandRange(Box.Min.z, Box.Max.z));
+}
+
+MVector FMath::GetReflectionVector(const MVector& Direction, const MVector& SurfaceNormal)
+{
+	const MVector SafeNormal = SurfaceNormal.GetSafeNormal();
+
+	return Direction - 2 * (Direction | SafeNormal) * SafeNormal;
+}
+
+bool FMath::GetDotDistance(MVector2D& OutDotDist, const MVector& Direction, const MVector& AxisX, const MVector& AxisY, const MVector& AxisZ)
+{
+	const MVector NormalDir = Direction.GetSafeNormal();
+
+	// Find projected point (on AxisX and AxisY, remove AxisZ component)
+	const MVector NoZProjDir = (NormalDir - (NormalDir | AxisZ) * AxisZ).GetSafeNormal();
+
+	// Figure out if projection is on right or left.
+	const float AzimuthSign = ((NoZProjDir | AxisY) < 0.f) ? -1.f : 1.f;
+
+	OutDotDist.y = NormalDir | AxisZ;
+	const float DirDotX = NoZProjDir | AxisX;
+	OutDotDist.x = AzimuthSign * FMath::Abs(DirDotX);
+
+	return (DirDotX >= 0.f);
+}
+
+MVector2D FMath::GetAzimuthAndElevation(const MVector& Direction, const MVector& AxisX, const MVector& AxisY, const MVector& AxisZ)
+{
+	const MVector NormalDir = Direction.GetSafeNormal();
+	// Find projected point (on AxisX and AxisY, remove AxisZ component)
+	const MVector NoZProjDir = (NormalDir - (NormalDir | AxisZ) * AxisZ).GetSafeNormal();
+	// Figure out if projection is on right or left.
+	const float AzimuthSign = ((NoZProjDir | AxisY) < 0.f) ? -1.f : 1.f;
+	const float ElevationSin = NormalDir | AxisZ;
+	const float AzimuthCos = NoZProjDir | AxisX;
+
+	// Convert to Angles in Radian.
+	return MVector2D(FMath::Acos(AzimuthCos) * AzimuthSign, FMath::Asin(ElevationSin));
+}
+
+MVector FMath::VInterpConstantTo(const MVector& Current, const MVector& Target, float DeltaTime, float InterpSpeed)
+{
+	const MVector Delta = Target - Current;
+	const float DeltaM = Delta.Size();
+	const float MaxStep = InterpSpeed * DeltaTime;
+
+	if (DeltaM > MaxStep)
+	{
+		if (MaxStep > 0.f)
+		{
+			const MVector DeltaN = Delta / DeltaM;
+			return Current + DeltaN * MaxStep;
+		}
+		else
+		{
+			return Current;
+		}
+	}
+
+	return Target;
+}
+
+MVector FMath::VInterpTo(const MVector& Current, const MVector& Target, float DeltaTime, float InterpSpeed)
+{
+	// If no interp speed, jump to target value
+	if (InterpSpeed <= 0.f)
+	{
+		return Target;
+	}
+
+	// Distance to reach
+	const MVector Dist = Target - Current;
+
+	// If distance is too small, just set the desired location
+	if (Dist.SizeSquared() < KINDA_SMALL_NUMBER)
+	{
+		return Target;
+	}
+
+	// Delta Move, Clamp so we do not over shoot.
+	const MVector DeltaMove = Dist * FMath::Clamp<float>(DeltaTime * InterpSpeed, 0.f, 1.f);
+
+	return Current + DeltaMove;
+}
+
+void FMath::VInterpTo(MVector* Current, const MVector* Target, int32_t NumVectors, float DeltaTime, float InterpSpeed)
+{
+	int32_t Index = 0;
+	for (; Index + MVectorWide::Lanes <= NumVectors; Index += MVectorWide::Lanes)
+	{
+		VInterpTo(MVectorWide::Load(Current + Index), MVectorWide::Load(Target + Index), DeltaTime, InterpSpeed).Store(Current + Index);
+	}
+
+	for (; Index < NumVectors; ++Index)
+	{
+		Current[Index] = VInterpTo(Current[Index], Target[Index], DeltaTime, InterpSpeed);
+	}
+}
+
+MVector2D FMath::Vector2DInterpConstantTo(const MVector2D& Current, const MVector2D& Target, float DeltaTime, float InterpSpeed)
+{
+	const MVector2D Delta = Target - Current;
+	const float DeltaM = Delta.Size();
+	const float MaxStep = InterpSpeed * DeltaTime;
+
+	if (DeltaM > MaxStep)
+	{
+		if (MaxStep > 0.f)
+		{
+			const MVector2D DeltaN = Delta / DeltaM;
+			return Current + DeltaN * MaxStep;
+		}
+		else
+		{
+			return Current;
+		}
+	}
+
+	return Target;
+}
+
+MVector2D FMath::Vector2DInterpTo(const MVector2D& Current, const MVector2D& Target, float DeltaTime, float InterpSpeed)
+{
+	if (InterpSpeed <= 0.f)
+	{
+		return Target;
+	}
+
+	const MVector2D Dist = Target - Current;
+	if (Dist.SizeSquared() < KINDA_SMALL_NUMBER)
+	{
+		return Target;
+	}
+
+	const MVector2D DeltaMove = Dist * FMath::Clamp<float>(DeltaTime * InterpSpeed, 0.f, 1.f);
+	return Current + DeltaMove;
+}
+
+bool FMath::SphereConeIntersection(const MVector& SphereCenter, float SphereRadius, const MVector& ConeAxis, float ConeAngleSin, float ConeAngleCos)
+{
+	/**
+	 * from http://www.geometrictools.com/Documentation/IntersectionSphereCone.pdf
+	 * (Copyright c 1998-2008. All Rights Reserved.) http://www.geometrictools.com (boost license)
+	 */
+
+	// the following code assumes the cone tip is at 0,0,0 (means the SphereCenter is relative to the cone tip)
+
+	const MVector U = ConeAxis * (-SphereRadius / ConeAngleSin);
+	const MVector D = SphereCenter - U;
+	float DSqr = D | D;
+	float E = ConeAxis | D;
+
+	if (E > 0 && E * E >= DSqr * FMath::Square(ConeAngleCos))
+	{
+		DSqr = SphereCenter | SphereCenter;
+		E = -ConeAxis | SphereCenter;
+		if (E > 0 && E * E >= DSqr * FMath::Square(ConeAngleSin))
+		{
+			return DSqr <= FMath::Square(SphereRadius);
+		}
+		else
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+MVector FMath::ClosestPointOnLine(const MVector& LineStart, const MVector& LineEnd, const MVector& Point)
+{
+	// Solve to find alpha along line that is closest point
+	// Weisstein, Eric W. "Point-Line Distance--3-Dimensional." From MathWorld--A Switchram Web Resource. http://mathworld.wolfram.com/Point-LineDistance3-Dimensional.html 
+	const float A = (LineStart - Point) | (LineEnd - LineStart);
+	const float B = (LineEnd - LineStart).SizeSquared();
+	// This should be robust to B == 0 (resulting in NaN) because clamp should return 1.
+	const float T = FMath::Clamp<float>(-A / B, 0.f, 1.f);
+
+	// Generate closest point
+	MVector ClosestPoint = LineStart + (T * (LineEnd - LineStart));
+
+	return ClosestPoint;
+}
+
+MVector FMath::ClosestPointOnInfiniteLine(const MVector& LineStart, const MVector& LineEnd, const MVector& Point)
+{
+	const float A = (LineStart - Point) | (LineEnd - LineStart);
+	const float B = (LineEnd - LineStart).SizeSquared();
+	if (B < SMALL_NUMBER)
+	{
+		return LineStart;
+	}
+	const float T = -A / B;
+
+	// Generate closest point
+	const MVector ClosestPoint = LineStart + (T * (LineEnd - LineStart));
+	return ClosestPoint;
+}
+
+float FMath::PointDistToLine(const MVector& Point, const MVector& Direction, const MVector& Origin, MVector& OutClosestPoint)
+{
+	const MVector SafeDir = Direction.GetSafeNormal();
+	OutClosestPoint = Origin + (SafeDir * ((Point - Origin) | SafeDir));
+	return (OutClosestPoint - Point).Size();
+}
+
+float FMath::PointDistToLine(const MVector& Point, const MVector& Direction, const MVector& Origin)
+{
+	const MVector SafeDir = Direction.GetSafeNormal();
+	const MVector OutClosestPoint = Origin + (SafeDir * ((Point - Origin) | SafeDir));
+	return (OutClosestPoint - Point).Size();
+}
+
+MVector FMath::ClosestPointOnSegment(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint)
+{
+	const MVector Segment = EndPoint - StartPoint;
+	const MVector VectToPoint = Point - StartPoint;
+
+	// See if closest point is before StartPoint
+	const float Dot1 = VectToPoint | Segment;
+	if (Dot1 <= 0)
+	{
+		return StartPoint;
+	}
+
+	// See if closest point is beyond EndPoint
+	const float Dot2 = Segment | Segment;
+	if (Dot2 <= Dot1)
+	{
+		return EndPoint;
+	}
+
+	// Closest Point is within segment
+	return StartPoint + Segment * (Dot1 / Dot2);
+}
+
+void FMath::ClosestPointOnSegment(const MVector* Points, int32_t NumPoints, const MVector& StartPoint, const MVector& EndPoint, MVector* OutClosestPoints)
+{
+	const MVectorWide WideStartPoint(StartPoint);
+	const MVectorWide WideEndPoint(EndPoint);
+
+	int32_t Index = 0;
+	for (; Index + MVectorWide::Lanes <= NumPoints; Index += MVectorWide::Lanes)
+	{
+		ClosestPointOnSegment(MVectorWide::Load(Points + Index), WideStartPoint, WideEndPoint).Store(OutClosestPoints + Index);
+	}
+
+	for (; Index < NumPoints; ++Index)
+	{
+		OutClosestPoints[Index] = ClosestPointOnSegment(Points[Index], StartPoint, EndPoint);
+	}
+}
+
+MVector2D FMath::ClosestPointOnSegment2D(const MVector2D& Point, const MVector2D& StartPoint, const MVector2D& EndPoint)
+{
+	const MVector2D Segment = EndPoint - StartPoint;
+	const MVector2D VectToPoint = Point - StartPoint;
+
+	// See if closest point is before StartPoint
+	const float Dot1 = VectToPoint | Segment;
+	if (Dot1 <= 0)
+	{
+		return StartPoint;
+	}
+
+	// See if closest point is beyond EndPoint
+	const float Dot2 = Segment | Segment;
+	if (Dot2 <= Dot1)
+	{
+		return EndPoint;
+	}
+
+	// Closest Point is within segment
+	return StartPoint + Segment * (Dot1 / Dot2);
+}
+
+float FMath::PointDistToSegment(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint)
+{
+	const MVector ClosestPoint = ClosestPointOnSegment(Point, StartPoint, EndPoint);
+	return (Point - ClosestPoint).Size();
+}
+
+float FMath::PointDistToSegmentSquared(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint)
+{
+	const MVector ClosestPoint = ClosestPointOnSegment(Point, StartPoint, EndPoint);
+	return (Point - ClosestPoint).SizeSquared();
+}
+
+void FMath::PointDistToSegmentSquared(const MVector* Points, int32_t NumPoints, const MVector& StartPoint, const MVector& EndPoint, float* OutDistancesSquared)
+{
+	const MVectorWide WideStartPoint(StartPoint);
+	const MVectorWide WideEndPoint(EndPoint);
+
+	int32_t Index = 0;
+	for (; Index + MVectorWide::Lanes <= NumPoints; Index += MVectorWide::Lanes)
+	{
+		PointDistToSegmentSquared(MVectorWide::Load(Points + Index), WideStartPoint, WideEndPoint).Store(OutDistancesSquared + Index);
+	}
+
+	for (; Index < NumPoints; ++Index)
+	{
+		OutDistancesSquared[Index] = PointDistToSegmentSquared(Points[Index], StartPoint, EndPoint);
+	}
+}
+
+void FMath::SegmentDistToSegment(MVector A1, MVector B1, MVector A2, MVector B2, MVector& OutP1, MVector& OutP2)
+{
+	// Based on "Distance between segments" from Real-Time Collision Detection, section 5.1.9
+	const MVector S1 = B1 - A1;
+	const MVector S2 = B2 - A2;
+	const MVector S3 = A1 - A2;
+
+	const float Dot11 = S1 | S1;
+	const float Dot22 = S2 | S2;
+	const float Dot12 = S1 | S2;
+	const float Dot13 = S1 | S3;
+	const float Dot23 = S2 | S3;
+
+	// Numerators and denominators of the segment parameters
+	const float D = Dot11 * Dot22 - Dot12 * Dot12;
+	float D1 = D;
+	float D2 = D;
+	float N1;
+	float N2;
+
+	if (D < KINDA_SMALL_NUMBER)
+	{
+		// The segments are parallel, pick the start of the first one
+		N1 = 0.f;
+		D1 = 1.f;
+		N2 = Dot23;
+		D2 = Dot22;
+	}
+	else
+	{
+		N1 = (Dot12 * Dot23 - Dot22 * Dot13);
+		N2 = (Dot11 * Dot23 - Dot12 * Dot13);
+
+		if (N1 < 0.f)
+		{
+			// Closest point on the first segment is its start
+			N1 = 0.f;
+			N2 = Dot23;
+			D2 = Dot22;
+		}
+		else if (N1 > D1)
+		{
+			// Closest point on the first segment is its end
+			N1 = D1;
+			N2 = Dot23 + Dot12;
+			D2 = Dot22;
+		}
+	}
+
+	if (N2 < 0.f)
+	{
+		// Closest point on the second segment is its start
+		N2 = 0.f;
+
+		if (-Dot13 < 0.f)
+		{
+			N1 = 0.f;
+		}
+		else if (-Dot13 > Dot11)
+		{
+			N1 = D1;
+		}
+		else
+		{
+			N1 = -Dot13;
+			D1 = Dot11;
+		}
+	}
+	else if (N2 > D2)
+	{
+		// Closest point on the second segment is its end
+		N2 = D2;
+
+		if ((-Dot13 + Dot12) < 0.f)
+		{
+			N1 = 0.f;
+		}
+		else if ((-Dot13 + Dot12) > Dot11)
+		{
+			N1 = D1;
+		}
+		else
+		{
+			N1 = (-Dot13 + Dot12);
+			D1 = Dot11;
+		}
+	}
+
+	const float T1 = (FMath::Abs(N1) < KINDA_SMALL_NUMBER ? 0.f : N1 / D1);
+	const float T2 = (FMath::Abs(N2) < KINDA_SMALL_NUMBER ? 0.f : N2 / D2);
+
+	OutP1 = A1 + T1 * S1;
+	OutP2 = A2 + T2 * S2;
+}
+
+void FMath::SegmentDistToSegmentSafe(MVector A1, MVector B1, MVector A2, MVector B2, MVector& OutP1, MVector& OutP2)
+{
+	const bool bFirstIsPoint = (B1 - A1).SizeSquared() < SMALL_NUMBER;
+	const bool bSecondIsPoint = (B2 - A2).SizeSquared() < SMALL_NUMBER;
+
+	if (bFirstIsPoint && bSecondIsPoint)
+	{
+		OutP1 = A1;
+		OutP2 = A2;
+	}
+	else if (bFirstIsPoint)
+	{
+		OutP1 = A1;
+		OutP2 = ClosestPointOnSegment(A1, A2, B2);
+	}
+	else if (bSecondIsPoint)
+	{
+		OutP1 = ClosestPointOnSegment(A2, A1, B1);
+		OutP2 = A2;
+	}
+	else
+	{
+		SegmentDistToSegment(A1, B1, A2, B2, OutP1, OutP2);
+	}
+}
+
+bool FMath::SegmentIntersection2D(const MVector& SegmentStartA, const MVector& SegmentEndA, const MVector& SegmentStartB, const MVector& SegmentEndB, MVector& out_IntersectionPoint)
+{
+	const MVector VectorA = SegmentEndA - SegmentStartA;
+	const MVector VectorB = SegmentEndB - SegmentStartB;
+
+	const float S = (-VectorA.y * (SegmentStartA.x - SegmentStartB.x) + VectorA.x * (SegmentStartA.y - SegmentStartB.y)) / (-VectorB.x * VectorA.y + VectorA.x * VectorB.y);
+	const float T = (VectorB.x * (SegmentStartA.y - SegmentStartB.y) - VectorB.y * (SegmentStartA.x - SegmentStartB.x)) / (-VectorB.x * VectorA.y + VectorA.x * VectorB.y);
+
+	const bool bIntersects = (S >= 0 && S <= 1 && T >= 0 && T <= 1);
+
+	if (bIntersects)
+	{
+		out_IntersectionPoint.x = SegmentStartA.x + (T * VectorA.x);
+		out_IntersectionPoint.y = SegmentStartA.y + (T * VectorA.y);
+		out_IntersectionPoint.z = SegmentStartA.z + (T * VectorA.z);
+	}
+
+	return bIntersects;
+}
+
+bool FMath::PlaneAABBIntersection(const FPlane& P, const FBox& AABB)
+{
+	return PlaneAABBRelativePosition(P, AABB) == 0;
+}
+
+int32_t FMath::PlaneAABBRelativePosition(const FPlane& P, const FBox& AABB)
+{
+	// Center and extent form: the box's projected radius on the normal against the center's distance
+	const MVector Center = AABB.GetCenter();
+	const MVector Extent = AABB.GetExtent();
+	const float Distance = P.PlaneDot(Center);
+	const float Radius = (Extent | P.GetAbs());
+
+	if (Distance + Radius < 0.0f)
+	{
+		return -1;
+	}
+	else if (Distance - Radius > 0.0f)
+	{
+		return 1;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+bool FMath::SegmentTriangleIntersection(const MVector& StartPoint, const MVector& EndPoint, const MVector& A, const MVector& B, const MVector& C, MVector& OutIntersectPoint, MVector& OutTriangleNormal)
+{
+	float Time;
+	if (!SegmentTriangleIntersection(StartPoint, EndPoint, A, B, C, Time))
+	{
+		return false;
+	}
+
+	OutIntersectPoint = StartPoint + (EndPoint - StartPoint) * Time;
+	OutTriangleNormal = ((B - A) ^ (C - A)).GetSafeNormal();
+	return true;
+}
+
+bool FMath::SegmentTriangleIntersection(const MVector& StartPoint, const MVector& EndPoint, const MVector& A, const MVector& B, const MVector& C, float& OutTime)
+{
+	const MVector Direction = EndPoint - StartPoint;
+	const MVector EdgeAB = B - A;
+	const MVector EdgeAC = C - A;
+
+	// Zero for segments parallel to the triangle plane and for degenerate triangles
+	const MVector P = Direction ^ EdgeAC;
+	const float Determinant = EdgeAB | P;
+	if (Abs(Determinant) < SMALL_NUMBER * (EdgeAB.SizeSquared() + EdgeAC.SizeSquared()) * Direction.Size())
+	{
+		return false;
+	}
+
+	const float InvDeterminant = 1.0f / Determinant;
+	const MVector ToStart = StartPoint - A;
+	const float U = (ToStart | P) * InvDeterminant;
+	if (U < 0.0f || U > 1.0f)
+	{
+		return false;
+	}
+
+	const MVector Q = ToStart ^ EdgeAB;
+	const float V = (Direction | Q) * InvDeterminant;
+	if (V < 0.0f || U + V > 1.0f)
+	{
+		return false;
+	}
+
+	const float Time = (EdgeAC | Q) * InvDeterminant;
+	if (Time < 0.0f || Time > 1.0f)
+	{
+		return false;
+	}
+
+	OutTime = Time;
+	return true;
+}
+
+MVector FMath::ClosestPointOnTriangleToPoint(const MVector& Point, const MVector& A, const MVector& B, const MVector& C)
+{
+	// Voronoi region test from Real-Time Collision Detection, section 5.1.5
+	const MVector AB = B - A;
+	const MVector AC = C - A;
+	const MVector AP = Point - A;
+
+	const float D1 = AB | AP;
+	const float D2 = AC | AP;
+	if (D1 <= 0.f && D2 <= 0.f)
+	{
+		return A;
+	}
+
+	const MVector BP = Point - B;
+	const float D3 = AB | BP;
+	const float D4 = AC | BP;
+	if (D3 >= 0.f && D4 <= D3)
+	{
+		return B;
+	}
+
+	const float VC = D1 * D4 - D3 * D2;
+	if (VC <= 0.f && D1 >= 0.f && D3 <= 0.f)
+	{
+		return A + AB * (D1 / (D1 - D3));
+	}
+
+	const MVector CP = Point - C;
+	const float D5 = AB | CP;
+	const float D6 = AC | CP;
+	if (D6 >= 0.f && D5 <= D6)
+	{
+		return C;
+	}
+
+	const float VB = D5 * D2 - D1 * D6;
+	if (VB <= 0.f && D2 >= 0.f && D6 <= 0.f)
+	{
+		return A + AC * (D2 / (D2 - D6));
+	}
+
+	const float VA = D3 * D6 - D5 * D4;
+	if (VA <= 0.f && (D4 - D3) >= 0.f && (D5 - D6) >= 0.f)
+	{
+		return B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6)));
+	}
+
+	// Inside the face region
+	const float Denom = 1.f / (VA + VB + VC);
+	return A + AB * (VB * Denom) + AC * (VC * Denom);
+}
+
+void FMath::SphereDistToLine(MVector SphereOrigin, float SphereRadius, MVector LineOrigin, MVector LineDir, MVector& OutClosestPoint)
+{
+	const float A = LineDir | LineDir;
+	const float B = 2.f * (LineDir | (LineOrigin - SphereOrigin));
+	const float C = (SphereOrigin | SphereOrigin) + (LineOrigin | LineOrigin) - 2.f * (SphereOrigin | LineOrigin) - Square(SphereRadius);
+	const float D = Square(B) - 4.f * A * C;
+
+	if (D <= KINDA_SMALL_NUMBER)
+	{
+		// line is not intersecting sphere (or is tangent at one point if D == 0 )
+		const MVector PointOnLine = LineOrigin + (-B / (2.f * A)) * LineDir;
+		OutClosestPoint = SphereOrigin + (PointOnLine - SphereOrigin).GetSafeNormal() * SphereRadius;
+	}
+	else
+	{
+		// Line intersecting sphere in 2 points. Pick closest to line origin.
+		const float E = Sqrt(D);
+		const float T1 = (-B + E) / (2.f * A);
+		const float T2 = (-B - E) / (2.f * A);
+		const float T = Abs(T1) < Abs(T2) ? T1 : T2;
+
+		OutClosestPoint = LineOrigin + T * LineDir;
+	}
+}
+
+bool FMath::GetDistanceWithinConeSegment(MVector Point, MVector ConeStartPoint, MVector ConeLine, float RadiusAtStart, float RadiusAtEnd, float& PercentageOut)
+{
+	PercentageOut = 0.f;
+
+	const float ConeLengthSqr = ConeLine.SizeSquared();
+	if (ConeLengthSqr < SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// -- First we'll check if the point is within the length of the cone
+	const float Time = ((Point - ConeStartPoint) | ConeLine) / ConeLengthSqr;
+	if (Time < 0.f || Time > 1.f)
+	{
+		return false;
+	}
+
+	// -- Then compare its distance to the center line with the radius of the cone at that point
+	const MVector PointOnCenterLine = ConeStartPoint + ConeLine * Time;
+	const float DistToCenterLine = (Point - PointOnCenterLine).Size();
+	const float ConeRadius = Lerp(RadiusAtStart, RadiusAtEnd, Time);
+
+	if (DistToCenterLine > ConeRadius)
+	{
+		return false;
+	}
+
+	PercentageOut = ConeRadius > 0.f ? (ConeRadius - DistToCenterLine) / ConeRadius : 1.f;
+	return true;
+}
+
+MVector FMath::GetBaryCentric2D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C)
+{
+	const float Denominator = (B.y - C.y) * (A.x - C.x) + (C.x - B.x) * (A.y - C.y);
+	const float a = ((B.y - C.y) * (Point.x - C.x) + (C.x - B.x) * (Point.y - C.y)) / Denominator;
+	const float b = ((C.y - A.y) * (Point.x - C.x) + (A.x - C.x) * (Point.y - C.y)) / Denominator;
+
+	return MVector(a, b, 1.0f - a - b);
+}
+
+MVector FMath::ComputeBaryCentric2D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C)
+{
+	// Compute the normal of the triangle
+	const MVector TriNorm = (B - A) ^ (C - A);
+	const MVector N = TriNorm.GetSafeNormal();
+
+	// Compute twice area of triangle ABC
+	const float AreaABCInv = 1.0f / (N | TriNorm);
+
+	// Compute a contribution
+	const float AreaPBC = N | ((B - Point) ^ (C - Point));
+	const float a = AreaPBC * AreaABCInv;
+
+	// Compute b contribution
+	const float AreaPCA = N | ((C - Point) ^ (A - Point));
+	const float b = AreaPCA * AreaABCInv;
+
+	// Compute c contribution
+	return MVector(a, b, 1.0f - a - b);
+}
+
+MVector4 FMath::ComputeBaryCentric3D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C, const MVector& D)
+{
+	// Solve Point - A = b * (B - A) + c * (C - A) + d * (D - A) with Cramer's rule
+	const MVector V1 = B - A;
+	const MVector V2 = C - A;
+	const MVector V3 = D - A;
+	const MVector P = Point - A;
+
+	const float Determinant = V1 | (V2 ^ V3);
+	const float InvDeterminant = 1.0f / Determinant;
+
+	const float b = (P | (V2 ^ V3)) * InvDeterminant;
+	const float c = (V1 | (P ^ V3)) * InvDeterminant;
+	const float d = (V1 | (V2 ^ P)) * InvDeterminant;
+
+	return MVector4(1.0f - b - c - d, b, c, d);
+}
+
+int64_t FMath::CountBits(const uint64_t* Words, int32_t NumWords)
+{
+	// Independent accumulators so that the popcnt latency overlaps
+	int64_t Counts[4] = { 0, 0, 0, 0 };
+	int32_t WordIndex = 0;
+	for (; WordIndex + 4 <= NumWords; WordIndex += 4)
+	{
+		Counts[0] += CountBits(Words[WordIndex + 0]);
+		Counts[1] += CountBits(Words[WordIndex + 1]);
+		Counts[2] += CountBits(Words[WordIndex + 2]);
+		Counts[3] += CountBits(Words[WordIndex + 3]);
+	}
+
+	for (; WordIndex < NumWords; ++WordIndex)
+	{
+		Counts[0] += CountBits(Words[WordIndex]);
+	}
+	return Counts[0] + Counts[1] + Counts[2] + Counts[3];
+}
+
+int64_t FMath::FindFirstSetBit(const uint64_t* Words, int32_t NumWords, int64_t StartBit)
+{
+	StartBit = Max<int64_t>(StartBit, 0);
+	int64_t WordIndex = StartBit / 64;
+	if (WordIndex >= NumWords)
+	{
+		return -1;
+	}
+
+	// Mask off the bits below StartBit in the first word
+	uint64_t Word = Words[WordIndex] & (~0ull << (StartBit % 64));
+	while (Word == 0)
+	{
+		if (++WordIndex == NumWords)
+		{
+			return -1;
+		}
+		Word = Words[WordIndex];
+	}
+	return WordIndex * 64 + (int64_t)CountTrailingZeros64(Word);
+}
+
+int64_t FMath::FindFirstClearBit(const uint64_t* Words, int32_t NumWords, int64_t StartBit)
+{
+	StartBit = Max<int64_t>(StartBit, 0);
+	int64_t WordIndex = StartBit / 64;
+	if (WordIndex >= NumWords)
+	{
+		return -1;
+	}
+
+	uint64_t Word = ~Words[WordIndex] & (~0ull << (StartBit % 64));
+	while (Word == 0)
+	{
+		if (++WordIndex == NumWords)
+		{
+			return -1;
+		}
+		Word = ~Words[WordIndex];
+	}
+	return WordIndex * 64 + (int64_t)CountTrailingZeros64(Word);
+}
+
+void FMath::Sin(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Sin);
+	Kernel(Values, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Cos(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Cos);
+	Kernel(Values, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Exp(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Exp);
+	Kernel(Values, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Exp2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Exp2);
+	Kernel(Values, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Log2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Log2);
+	Kernel(Values, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Sqrt(const float* Values, int32_t NumValues, float* OutValues)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Sqrt);
+	Kernel(Values, NumValues, OutValues);
+}
+
+void FMath::InvSqrt(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(InvSqrt);
+	Kernel(Values, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Pow(const float* Bases, const float* Exponents, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, const float*, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Pow);
+	Kernel(Bases, Exponents, NumValues, OutValues, Accuracy);
+}
+
+void FMath::Pow(const float* Bases, float Exponent, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+{
+	static const TSimdKernel<void(const float*, float, int32_t, float*, EMathAccuracy)> Kernel = MIKASA_SIMD_KERNEL_VARIANTS(Pow);
+	Kernel(Bases, Exponent, NumValues, OutValues, Accuracy);
+}
+
+namespace
+{
+	/** Ken Perlin's reference permutation, repeated so that hashes of neighboring cells never wrap. int32_t for gathers. */
+	const int32_t PerlinPermutation[512] =
+	{
+		151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+		140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+		247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+		57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+		74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+		60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+		65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+		200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+		52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+		207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+		119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+		129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+		218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+		81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+		184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+		222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180,
+		151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+		140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+		247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+		57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+		74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+		60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+		65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+		200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+		52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+		207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+		119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+		129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+		218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+		81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+		184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+		222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180,
+	};
+
+	/** Shifts applied to the octaves after the first one, so that their lattice points do not line up. */
+	const MVector OctaveOffset(19.1f, 33.7f, 7.9f);
+
+	/** Empirical peak of the 3D noise with its 12 gradients is about 1.036, this brings it within [-1, 1]. */
+	constexpr float PerlinScale3D = 0.965f;
+
+	float PerlinFade(float T)
+	{
+		return T * T * T * (T * (T * 6.0f - 15.0f) + 10.0f);
+	}
+
+	FFloatWide PerlinFade(const FFloatWide& T)
+	{
+		return T * T * T * (T * (T * FFloatWide(6.0f) - FFloatWide(15.0f)) + FFloatWide(10.0f));
+	}
+
+	float PerlinLerp(float T, float A, float B)
+	{
+		return A + T * (B - A);
+	}
+
+	FFloatWide PerlinLerp(const FFloatWide& T, const FFloatWide& A, const FFloatWide& B)
+	{
+		return A + T * (B - A);
+	}
+
+	/** Gradients of length 1/8 to 1, the result is within [-0.5, 0.5] before scaling. */
+	float PerlinGrad1D(int32_t Hash, float X)
+	{
+		const float Gradient = (float)(1 + (Hash & 7)) * 0.125f;
+		return (Hash & 8) ? -Gradient * X : Gradient * X;
+	}
+
+	/** Eight gradients of length sqrt(2), diagonals and axes, which bounds the noise by 1. */
+	float PerlinGrad2D(int32_t Hash, float X, float Y)
+	{
+		if (Hash & 4)
+		{
+			const float Axis = ((Hash & 1) ? X : Y) * UE_SQRT_2;
+			return (Hash & 2) ? -Axis : Axis;
+		}
+		return ((Hash & 1) ? -X : X) + ((Hash & 2) ? -Y : Y);
+	}
+
+	/** The 12 cube edge directions of improved noise, 4 of them twice. */
+	float PerlinGrad3D(int32_t Hash, float X, float Y, float Z)
+	{
+		const int32_t H = Hash & 15;
+		const float U = H < 8 ? X : Y;
+		const float V = H < 4 ? Y : (H == 12 || H == 14 ? X : Z);
+		return ((H & 1) ? -U : U) + ((H & 2) ? -V : V);
+	}
+
+	/** Value with its sign flipped where Bit of Hash is set. */
+	FFloatWide FlipSign(const FFloatWide& Value, const FIntWide& Hash, int32_t Bit)
+	{
+		return (Value.AsInt() ^ (Hash & FIntWide(1 << Bit)).ShiftLeft(31 - Bit)).AsFloat();
+	}
+
+	FFloatWide PerlinGrad2D(const FIntWide& Hash, const FFloatWide& X, const FFloatWide& Y)
+	{
+		const FMaskWide bAxis = (Hash & FIntWide(4)) == FIntWide(4);
+		const FMaskWide bX = (Hash & FIntWide(1)) == FIntWide(1);
+		const FFloatWide Axis = FlipSign(FFloatWide::Select(bX, X, Y) * FFloatWide(UE_SQRT_2), Hash, 1);
+		const FFloatWide Diagonal = FlipSign(X, Hash, 0) + FlipSign(Y, Hash, 1);
+		return FFloatWide::Select(bAxis, Axis, Diagonal);
+	}
+
+	FFloatWide PerlinGrad3D(const FIntWide& Hash, const FFloatWide& X, const FFloatWide& Y, const FFloatWide& Z)
+	{
+		const FIntWide H = Hash & FIntWide(15);
+		const FFloatWide U = FFloatWide::Select(H < FIntWide(8), X, Y);
+		const FMaskWide bVX = (H == FIntWide(12)) | (H == FIntWide(14));
+		const FFloatWide V = FFloatWide::Select(H < FIntWide(4), Y, FFloatWide::Select(bVX, X, Z));
+		return FlipSign(U, H, 0) + FlipSign(V, H, 1);
+	}
+
+	/** Lattice cell of Value wrapped to the permutation and the offset in it. */
+	int32_t PerlinCell(float Value, float& OutFraction)
+	{
+		const float Floor = floorf(Value);
+		OutFraction = Value - Floor;
+		return (int32_t)Floor & 255;
+	}
+
+	FIntWide PerlinCell(const FFloatWide& Value, FFloatWide& OutFraction)
+	{
+		const FFloatWide Floor = Value.Floor();
+		OutFraction = Value - Floor;
+		return Floor.TruncToInt() & FIntWide(255);
+	}
+
+	FIntWide Permute(const FIntWide& Index)
+	{
+		return FIntWide::Gather(PerlinPermutation, Index);
+	}
+
+	/** Octave loop shared by the 2D and 3D fractals, Noise(Frequency, Offset) samples one octave. */
+	template <typename NoiseType>
+	FFloatWide ComposeOctaves(const FNoiseFractalSettings& Settings, NoiseType Noise)
+	{
+		const int32_t NumOctaves = FMath::Max(Settings.NumOctaves, 1);
+		FFloatWide Sum(0.0f);
+		float Amplitude = 1.0f;
+		float Frequency = 1.0f;
+		float AmplitudeSum = 0.0f;
+		for (int32_t Octave = 0; Octave < NumOctaves; ++Octave)
+		{
+			const FFloatWide Value = Noise(Frequency, OctaveOffset * (float)Octave);
+			if (Settings.Type == ENoiseFractal::Ridged)
+			{
+				const FFloatWide Ridge = FFloatWide(1.0f) - FFloatWide::Abs(Value);
+				Sum = Sum + Ridge * Ridge * FFloatWide(Amplitude);
+			}
+			else
+			{
+				Sum = Sum + Value * FFloatWide(Amplitude);
+			}
+			AmplitudeSum += Amplitude;
+			Amplitude *= Settings.Gain;
+			Frequency *= Settings.Lacunarity;
+		}
+		return Sum * FFloatWide(1.0f / AmplitudeSum);
+	}
+
+	/** Lane indices as floats, to step grid coordinates. */
+	FFloatWide GetLaneOffsets()
+	{
+		alignas(32) float Offsets[FFloatWide::Lanes];
+		for (int32_t Lane = 0; Lane < FFloatWide::Lanes; ++Lane)
+		{
+			Offsets[Lane] = (float)Lane;
+		}
+		return FFloatWide::Load(Offsets);
+	}
+
+	/** Writes the first Num lanes of Values to Out. */
+	void StoreRow(const FFloatWide& Values, float* Out, int32_t Num)
+	{
+		if (Num == FFloatWide::Lanes)
+		{
+			Values.Store(Out);
+		}
+		else
+		{
+			Values.StorePartial(Out, Num);
+		}
+	}
+}
+
+float FMath::PerlinNoise1D(float Value)
+{
+	float Fraction;
+	const int32_t Cell = PerlinCell(Value, Fraction);
+	const float Result = PerlinLerp(PerlinFade(Fraction), PerlinGrad1D(PerlinPermutation[Cell], Fraction), PerlinGrad1D(PerlinPermutation[Cell + 1], Fraction - 1.0f));
+	return Result * 2.0f;
+}
+
+float FMath::PerlinNoise2D(const MVector2D& Location)
+{
+	float X, Y;
+	const int32_t CellX = PerlinCell(Location.x, X);
+	const int32_t CellY = PerlinCell(Location.y, Y);
+	const float U = PerlinFade(X);
+	const float V = PerlinFade(Y);
+
+	const int32_t A = PerlinPermutation[CellX] + CellY;
+	const int32_t B = PerlinPermutation[CellX + 1] + CellY;
+	const float Bottom = PerlinLerp(U, PerlinGrad2D(PerlinPermutation[A], X, Y), PerlinGrad2D(PerlinPermutation[B], X - 1.0f, Y));
+	const float Top = PerlinLerp(U, PerlinGrad2D(PerlinPermutation[A + 1], X, Y - 1.0f), PerlinGrad2D(PerlinPermutation[B + 1], X - 1.0f, Y - 1.0f));
+	return PerlinLerp(V, Bottom, Top);
+}
+
+float FMath::PerlinNoise3D(const MVector& Location)
+{
+	float X, Y, Z;
+	const int32_t CellX = PerlinCell(Location.x, X);
+	const int32_t CellY = PerlinCell(Location.y, Y);
+	const int32_t CellZ = PerlinCell(Location.z, Z);
+	const float U = PerlinFade(X);
+	const float V = PerlinFade(Y);
+	const float W = PerlinFade(Z);
+
+	const int32_t A = PerlinPermutation[CellX] + CellY;
+	const int32_t AA = PerlinPermutation[A] + CellZ;
+	const int32_t AB = PerlinPermutation[A + 1] + CellZ;
+	const int32_t B = PerlinPermutation[CellX + 1] + CellY;
+	const int32_t BA = PerlinPermutation[B] + CellZ;
+	const int32_t BB = PerlinPermutation[B + 1] + CellZ;
+
+	const float Near = PerlinLerp(V,
+		PerlinLerp(U, PerlinGrad3D(PerlinPermutation[AA], X, Y, Z), PerlinGrad3D(PerlinPermutation[BA], X - 1.0f, Y, Z)),
+		PerlinLerp(U, PerlinGrad3D(PerlinPermutation[AB], X, Y - 1.0f, Z), PerlinGrad3D(PerlinPermutation[BB], X - 1.0f, Y - 1.0f, Z)));
+	const float Far = PerlinLerp(V,
+		PerlinLerp(U, PerlinGrad3D(PerlinPermutation[AA + 1], X, Y, Z - 1.0f), PerlinGrad3D(PerlinPermutation[BA + 1], X - 1.0f, Y, Z - 1.0f)),
+		PerlinLerp(U, PerlinGrad3D(PerlinPermutation[AB + 1], X, Y - 1.0f, Z - 1.0f), PerlinGrad3D(PerlinPermutation[BB + 1], X - 1.0f, Y - 1.0f, Z - 1.0f)));
+	return PerlinLerp(W, Near, Far) * PerlinScale3D;
+}
+
+FFloatWide FMath::PerlinNoise2D(const FFloatWide& InX, const FFloatWide& InY)
+{
+	FFloatWide X, Y;
+	const FIntWide CellX = PerlinCell(InX, X);
+	const FIntWide CellY = PerlinCell(InY, Y);
+	const FFloatWide U = PerlinFade(X);
+	const FFloatWide V = PerlinFade(Y);
+	const FFloatWide One(1.0f);
+
+	const FIntWide A = Permute(CellX) + CellY;
+	const FIntWide B = Permute(CellX + FIntWide(1)) + CellY;
+	const FFloatWide Bottom = PerlinLerp(U, PerlinGrad2D(Permute(A), X, Y), PerlinGrad2D(Permute(B), X - One, Y));
+	const FFloatWide Top = PerlinLerp(U, PerlinGrad2D(Permute(A + FIntWide(1)), X, Y - One), PerlinGrad2D(Permute(B + FIntWide(1)), X - One, Y - One));
+	return PerlinLerp(V, Bottom, Top);
+}
+
+FFloatWide FMath::PerlinNoise3D(const MVectorWide& Location)
+{
+	FFloatWide X, Y, Z;
+	const FIntWide CellX = PerlinCell(Location.x, X);
+	const FIntWide CellY = PerlinCell(Location.y, Y);
+	const FIntWide CellZ = PerlinCell(Location.z, Z);
+	const FFloatWide U = PerlinFade(X);
+	const FFloatWide V = PerlinFade(Y);
+	const FFloatWide W = PerlinFade(Z);
+	const FFloatWide One(1.0f);
+	const FIntWide IntOne(1);
+
+	const FIntWide A = Permute(CellX) + CellY;
+	const FIntWide AA = Permute(A) + CellZ;
+	const FIntWide AB = Permute(A + IntOne) + CellZ;
+	const FIntWide B = Permute(CellX + IntOne) + CellY;
+	const FIntWide BA = Permute(B) + CellZ;
+	const FIntWide BB = Permute(B + IntOne) + CellZ;
+
+	const FFloatWide Near = PerlinLerp(V,
+		PerlinLerp(U, PerlinGrad3D(Permute(AA), X, Y, Z), PerlinGrad3D(Permute(BA), X - One, Y, Z)),
+		PerlinLerp(U, PerlinGrad3D(Permute(AB), X, Y - One, Z), PerlinGrad3D(Permute(BB), X - One, Y - One, Z)));
+	const FFloatWide Far = PerlinLerp(V,
+		PerlinLerp(U, PerlinGrad3D(Permute(AA + IntOne), X, Y, Z - One), PerlinGrad3D(Permute(BA + IntOne), X - One, Y, Z - One)),
+		PerlinLerp(U, PerlinGrad3D(Permute(AB + IntOne), X, Y - One, Z - One), PerlinGrad3D(Permute(BB + IntOne), X - One, Y - One, Z - One)));
+	return PerlinLerp(W, Near, Far) * FFloatWide(PerlinScale3D);
+}
+
+FFloatWide FMath::FractalNoise2D(const FFloatWide& X, const FFloatWide& Y, const FNoiseFractalSettings& Settings)
+{
+	return ComposeOctaves(Settings, [&](float Frequency, const MVector& Offset)
+		{
+			return PerlinNoise2D(X * FFloatWide(Frequency) + FFloatWide(Offset.x), Y * FFloatWide(Frequency) + FFloatWide(Offset.y));
+		});
+}
+
+FFloatWide FMath::FractalNoise3D(const MVectorWide& Location, const FNoiseFractalSettings& Settings)
+{
+	return ComposeOctaves(Settings, [&](float Frequency, const MVector& Offset)
+		{
+			return PerlinNoise3D(Location * Frequency + MVectorWide(Offset));
+		});
+}
+
+void FMath::NoiseGrid2D(float* OutValues, int32_t SizeX, int32_t SizeY, const MVector2D& Origin, const MVector2D& Spacing, const FNoiseFractalSettings& Settings)
+{
+	SCOPED_CPU_TIMER("FMath::NoiseGrid2D");
+
+	const FFloatWide LaneOffsets = GetLaneOffsets();
+	FJobSystem::Get().ParallelForRange(SizeY, [&](int32_t Begin, int32_t End)
+		{
+			for (int32_t Y = Begin; Y < End; ++Y)
+			{
+				const FFloatWide WideY(Origin.y + (float)Y * Spacing.y);
+				float* Row = OutValues + (size_t)Y * SizeX;
+				for (int32_t X = 0; X < SizeX; X += FFloatWide::Lanes)
+				{
+					const FFloatWide WideX = FFloatWide(Origin.x) + (FFloatWide((float)X) + LaneOffsets) * FFloatWide(Spacing.x);
+					StoreRow(FractalNoise2D(WideX, WideY, Settings), Row + X, FMath::Min(SizeX - X, FFloatWide::Lanes));
+				}
+			}
+		}, FMath::Max(1024 / FMath::Max(SizeX, 1), 1));
+}
+
+void FMath::NoiseGrid3D(float* OutValues, int32_t SizeX, int32_t SizeY, int32_t SizeZ, const MVector& Origin, const MVector& Spacing, const FNoiseFractalSettings& Settings)
+{
+	SCOPED_CPU_TIMER("FMath::NoiseGrid3D");
+
+	const FFloatWide LaneOffsets = GetLaneOffsets();
+	FJobSystem::Get().ParallelForRange(SizeY * SizeZ, [&](int32_t Begin, int32_t End)
+		{
+			for (int32_t RowIndex = Begin; RowIndex < End; ++RowIndex)
+			{
+				const int32_t Y = RowIndex % SizeY;
+				const int32_t Z = RowIndex / SizeY;
+				const FFloatWide WideY(Origin.y + (float)Y * Spacing.y);
+				const FFloatWide WideZ(Origin.z + (float)Z * Spacing.z);
+				float* Row = OutValues + (size_t)RowIndex * SizeX;
+				for (int32_t X = 0; X < SizeX; X += FFloatWide::Lanes)
+				{
+					const FFloatWide WideX = FFloatWide(Origin.x) + (FFloatWide((float)X) + LaneOffsets) * FFloatWide(Spacing.x);
+					StoreRow(FractalNoise3D(MVectorWide(WideX, WideY, WideZ), Settings), Row + X, FMath::Min(SizeX - X, FFloatWide::Lanes));
+				}
+			}
+		}, FMath::Max(1024 / FMath::Max(SizeX, 1), 1));
+}
@@ -1,6 +1,24 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Base/Vector.h"
+#include "Base/VectorWide.h"
+#include "Base/Box.h"
+#include "Base/Plane.h"
+#include "Base/Sphere.h"
+#include "Base/RandomStream.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Lets constexpr functions take a runtime only intrinsic path. Without compiler support the portable
+// constexpr path is used everywhere, which is correct but slower
+#if (defined(__GNUC__) && __GNUC__ >= 9) || (defined(__clang__) && __clang_major__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define MIKASA_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define MIKASA_IS_CONSTANT_EVALUATED() true
+#endif
 /*-----------------------------------------------------------------------------
 	Floating point constants.
 -----------------------------------------------------------------------------*/
@@ -64,6 +82,35 @@
 	Global functions.
 -----------------------------------------------------------------------------*/
 
+/** Accuracy tier of the vectorized transcendental functions in FMath. */
+enum class EMathAccuracy : uint8_t
+{
+	/** Shorter polynomials, about 1e-4 relative error, assumes inputs in the documented domain. */
+	Fast,
+	/** Within 2 ulp of the correctly rounded result (Pow within 1), special inputs fall back to libm. */
+	Precise,
+};
+
+/** How FMath::FractalNoise combines octaves of Perlin noise. */
+enum class ENoiseFractal : uint8_t
+{
+	/** Fractal Brownian motion: octaves of halving amplitude summed, in [-1, 1]. */
+	FBm,
+	/** Squared inverted absolute octaves, sharp crests at the noise zero crossings, in [0, 1]. */
+	Ridged,
+};
+
+/** Octave composition of the fractal and grid noise functions of FMath. One octave of FBm is plain Perlin noise. */
+struct FNoiseFractalSettings
+{
+	ENoiseFractal Type = ENoiseFractal::FBm;
+	int32_t NumOctaves = 1;
+	/** Frequency multiplier from one octave to the next. */
+	float Lacunarity = 2.0f;
+	/** Amplitude multiplier from one octave to the next. */
+	float Gain = 0.5f;
+};
+
 /**
  * Structure for all math helper functions
  */
@@ -234,7 +281,7 @@ struct CORE_API FMath
 	// Returns e^Value
 	static  float Exp(float Value) { return expf(Value); }
 	// Returns 2^Value
-	static  float Exp2(float Value) { return powf(2.f, Value); /*exp2f(Value);*/ }
+	static  float Exp2(float Value) { return exp2f(Value); }
 	static  float Loge(float Value) { return logf(Value); }
 	static  float LogX(float Base, float Value) { return Loge(Value) / Loge(Base); }
 	// 1.0 / Loge(2) = 1.4426950f
@@ -258,7 +305,7 @@ struct CORE_API FMath
 	static  float Acos(float Value) { return acosf((Value < -1.f) ? -1.f : ((Value < 1.f) ? Value : 1.f)); }
 	static  float Tan(float Value) { return tanf(Value); }
 	static  float Atan(float Value) { return atanf(Value); }
-	//static  float Atan2(float Y, float X);
+	static  float Atan2(float Y, float X);
 	static  float Sqrt(float Value) { return sqrtf(Value); }
 	static  float Pow(float A, float B) { return powf(A, B); }
 
@@ -274,6 +321,33 @@ struct CORE_API FMath
 		return InvSqrt(F);
 	}
 
+	/**
+	 * Vectorized transcendentals for FFloatWide::Lanes values at once. Precise keeps the libm special cases
+	 * (NaN, infinities, out of range inputs) by falling back to libm for those lanes. Fast skips those checks:
+	 * Sin/Cos expect |Value| <= 8192, Log2/InvSqrt/Pow expect positive normal inputs. Sin/Cos errors are
+	 * absolute (about 1e-7 Precise) once the argument leaves [-Pi, Pi], like any reduction short of Payne-Hanek.
+	 */
+	static FFloatWide Sin(const FFloatWide& Value, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static FFloatWide Cos(const FFloatWide& Value, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static FFloatWide Exp(const FFloatWide& Value, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static FFloatWide Exp2(const FFloatWide& Value, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static FFloatWide Log2(const FFloatWide& Value, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static FFloatWide InvSqrt(const FFloatWide& Value, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static FFloatWide Sqrt(const FFloatWide& Value) { return FFloatWide::Sqrt(Value); }
+	/** Precise computes e^(B * ln(A)) in double-float arithmetic and rounds once, Fast is Exp2(B * Log2(A)). */
+	static FFloatWide Pow(const FFloatWide& A, const FFloatWide& B, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+
+	/** Batch versions of the functions above, OutValues may alias Values. */
+	static void Sin(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Cos(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Exp(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Exp2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Log2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Sqrt(const float* Values, int32_t NumValues, float* OutValues);
+	static void InvSqrt(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Pow(const float* Bases, const float* Exponents, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+	static void Pow(const float* Bases, float Exponent, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy = EMathAccuracy::Precise);
+
 	/** Return true if value is NaN (not a number). */
 	static  bool IsNaN(float A)
 	{
@@ -304,14 +378,14 @@ struct CORE_API FMath
 		return ((*(uint64_t*)&A) >= (uint64_t)0x8000000000000000); // Detects sign bit.
 	}
 
-	/** Returns a random integer between 0 and RAND_MAX, inclusive */
-	static  int32_t Rand() { return rand(); }
+	/** Returns a random integer between 0 and RAND_MAX, inclusive. Draws from the calling thread's FRandomStream. */
+	static  int32_t Rand() { return (int32_t)(FRandomStream::GetThreadStream().GetUnsignedInt() % ((uint32_t)RAND_MAX + 1)); }
 
-	/** Seeds global random number functions Rand() and FRand() */
-	static void RandInit(int32_t Seed) { srand(Seed); }
+	/** Seeds global random number functions Rand() and FRand() on every thread */
+	static void RandInit(int32_t Seed) { FRandomStream::SetThreadStreamSeed((uint64_t)(uint32_t)Seed); }
 
-	/** Returns a random float between 0 and 1, inclusive. */
-	static float FRand() { return Rand() / (float)RAND_MAX; }
+	/** Returns a random float in [0, 1). */
+	static float FRand() { return FRandomStream::GetThreadStream().GetFraction(); }
 
 	///** Seeds future calls to SRand() */
 	//static void SRandInit(int32_t Seed);
@@ -329,70 +403,32 @@ struct CORE_API FMath
 	 * @param Value		The value to compute the log of
 	 * @return			Log2 of Value. 0 if Value is 0.
 	 */
-	static  uint32_t FloorLog2(uint32_t Value)
-	{
-		/*		// reference implementation
-				// 1500ms on test data
-				uint32_t Bit = 32;
-				for (; Bit > 0;)
-				{
-					Bit--;
-					if (Value & (1<<Bit))
-					{
-						break;
-					}
-				}
-				return Bit;
-		*/
-		// same output as reference
-
-		// see http://codinggorilla.domemtech.com/?p=81 or http://en.wikipedia.org/wiki/Binary_logarithm but modified to return 0 for a input value of 0
-		// 686ms on test data
-		uint32_t pos = 0;
-		if (Value >= 1 << 16) { Value >>= 16; pos += 16; }
-		if (Value >= 1 << 8) { Value >>= 8; pos += 8; }
-		if (Value >= 1 << 4) { Value >>= 4; pos += 4; }
-		if (Value >= 1 << 2) { Value >>= 2; pos += 2; }
-		if (Value >= 1 << 1) { pos += 1; }
-		return (Value == 0) ? 0 : pos;
-
-		// even faster would be method3 but it can introduce more cache misses and it would need to store the table somewhere
-		// 304ms in test data
-		/*int LogTable256[256];
-
-		void prep()
+	static constexpr uint32_t FloorLog2(uint32_t Value)
+	{
+		if (Value == 0)
 		{
-			LogTable256[0] = LogTable256[1] = 0;
-			for (int i = 2; i < 256; i++)
-			{
-				LogTable256[i] = 1 + LogTable256[i / 2];
-			}
-			LogTable256[0] = -1; // if you want log(0) to return -1
+			return 0;
 		}
-
-		int _ method3(uint32_t v)
+#if defined(__GNUC__) || defined(__clang__)
+		return 31 - (uint32_t)__builtin_clz(Value);
+#else
+#if defined(_MSC_VER)
+		if (!MIKASA_IS_CONSTANT_EVALUATED())
 		{
-			int r;     // r will be lg(v)
-			uint32_t tt; // temporaries
-
-			if ((tt = v >> 24) != 0)
-			{
-				r = (24 + LogTable256[tt]);
-			}
-			else if ((tt = v >> 16) != 0)
-			{
-				r = (16 + LogTable256[tt]);
-			}
-			else if ((tt = v >> 8 ) != 0)
-			{
-				r = (8 + LogTable256[tt]);
-			}
-			else
-			{
-				r = LogTable256[v];
-			}
-			return r;
-		}*/
+			unsigned long Index = 0;
+			_BitScanReverse(&Index, Value);
+			return (uint32_t)Index;
+		}
+#endif
+		// see http://en.wikipedia.org/wiki/Binary_logarithm
+		uint32_t pos = 0;
+		if (Value >= 1u << 16) { Value >>= 16; pos += 16; }
+		if (Value >= 1u << 8) { Value >>= 8; pos += 8; }
+		if (Value >= 1u << 4) { Value >>= 4; pos += 4; }
+		if (Value >= 1u << 2) { Value >>= 2; pos += 2; }
+		if (Value >= 1u << 1) { pos += 1; }
+		return pos;
+#endif
 	}
 
 	/**
@@ -402,8 +438,23 @@ struct CORE_API FMath
 	 * @param Value		The value to compute the log of
 	 * @return			Log2 of Value. 0 if Value is 0.
 	 */
-	static  uint64_t FloorLog2_64(uint64_t Value)
+	static constexpr uint64_t FloorLog2_64(uint64_t Value)
 	{
+		if (Value == 0)
+		{
+			return 0;
+		}
+#if defined(__GNUC__) || defined(__clang__)
+		return 63 - (uint64_t)__builtin_clzll(Value);
+#else
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+		if (!MIKASA_IS_CONSTANT_EVALUATED())
+		{
+			unsigned long Index = 0;
+			_BitScanReverse64(&Index, Value);
+			return (uint64_t)Index;
+		}
+#endif
 		uint64_t pos = 0;
 		if (Value >= 1ull << 32) { Value >>= 32; pos += 32; }
 		if (Value >= 1ull << 16) { Value >>= 16; pos += 16; }
@@ -411,7 +462,8 @@ struct CORE_API FMath
 		if (Value >= 1ull << 4) { Value >>= 4; pos += 4; }
 		if (Value >= 1ull << 2) { Value >>= 2; pos += 2; }
 		if (Value >= 1ull << 1) { pos += 1; }
-		return (Value == 0) ? 0 : pos;
+		return pos;
+#endif
 	}
 
 	/**
@@ -421,7 +473,7 @@ struct CORE_API FMath
 	 *
 	 * @return the number of zeros before the first "on" bit
 	 */
-	static  uint32_t CountLeadingZeros(uint32_t Value)
+	static constexpr uint32_t CountLeadingZeros(uint32_t Value)
 	{
 		if (Value == 0) return 32;
 		return 31 - FloorLog2(Value);
@@ -434,7 +486,7 @@ struct CORE_API FMath
 	 *
 	 * @return the number of zeros before the first "on" bit
 	 */
-	static  uint64_t CountLeadingZeros64(uint64_t Value)
+	static constexpr uint64_t CountLeadingZeros64(uint64_t Value)
 	{
 		if (Value == 0) return 64;
 		return 63 - FloorLog2_64(Value);
@@ -447,19 +499,26 @@ struct CORE_API FMath
 	 *
 	 * @return the number of zeros after the last "on" bit
 	 */
-	static  uint32_t CountTrailingZeros(uint32_t Value)
+	static constexpr uint32_t CountTrailingZeros(uint32_t Value)
 	{
 		if (Value == 0)
 		{
 			return 32;
 		}
-		uint32_t Result = 0;
-		while ((Value & 1) == 0)
+#if defined(__GNUC__) || defined(__clang__)
+		return (uint32_t)__builtin_ctz(Value);
+#else
+#if defined(_MSC_VER)
+		if (!MIKASA_IS_CONSTANT_EVALUATED())
 		{
-			Value >>= 1;
-			++Result;
+			unsigned long Index = 0;
+			_BitScanForward(&Index, Value);
+			return (uint32_t)Index;
 		}
-		return Result;
+#endif
+		// Isolate the lowest set bit
+		return FloorLog2(Value & (~Value + 1));
+#endif
 	}
 
 	/**
@@ -469,44 +528,48 @@ struct CORE_API FMath
 	 *
 	 * @return the number of zeros after the last "on" bit
 	 */
-	static  uint64_t CountTrailingZeros64(uint64_t Value)
+	static constexpr uint64_t CountTrailingZeros64(uint64_t Value)
 	{
 		if (Value == 0)
 		{
 			return 64;
 		}
-		uint64_t Result = 0;
-		while ((Value & 1) == 0)
+#if defined(__GNUC__) || defined(__clang__)
+		return (uint64_t)__builtin_ctzll(Value);
+#else
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+		if (!MIKASA_IS_CONSTANT_EVALUATED())
 		{
-			Value >>= 1;
-			++Result;
+			unsigned long Index = 0;
+			_BitScanForward64(&Index, Value);
+			return (uint64_t)Index;
 		}
-		return Result;
+#endif
+		return FloorLog2_64(Value & (~Value + 1));
+#endif
 	}
 
 	/**
 	 * Returns smallest N such that (1<<N)>=Arg.
 	 * Note: CeilLogTwo(0)=0 because (1<<0)=1 >= 0.
 	 */
-	static  uint32_t CeilLogTwo(uint32_t Arg)
+	static constexpr uint32_t CeilLogTwo(uint32_t Arg)
 	{
-		int32_t Bitmask = ((int32_t)(CountLeadingZeros(Arg) << 26)) >> 31;
-		return (32 - CountLeadingZeros(Arg - 1)) & (~Bitmask);
+		return Arg <= 1 ? 0 : 32 - CountLeadingZeros(Arg - 1);
 	}
 
-	static  uint64_t CeilLogTwo64(uint64_t Arg)
+	static constexpr uint64_t CeilLogTwo64(uint64_t Arg)
 	{
-		int64_t Bitmask = ((int64_t)(CountLeadingZeros64(Arg) << 57)) >> 63;
-		return (64 - CountLeadingZeros64(Arg - 1)) & (~Bitmask);
+		return Arg <= 1 ? 0 : 64 - CountLeadingZeros64(Arg - 1);
 	}
 
 	/** @return Rounds the given number up to the next highest power of two. */
-	static  uint32_t RoundUpToPowerOfTwo(uint32_t Arg)
+	static constexpr uint32_t RoundUpToPowerOfTwo(uint32_t Arg)
 	{
-		return 1 << CeilLogTwo(Arg);
+		return 1u << CeilLogTwo(Arg);
 	}
 
-	static  uint64_t RoundUpToPowerOfTwo64(uint64_t V)
+	static constexpr uint64_t RoundUpToPowerOfTwo64(uint64_t V)
 	{
 		return uint64_t(1) << CeilLogTwo64(V);
 	}
@@ -621,13 +684,50 @@ struct CORE_API FMath
 		return (A <= B) ? A : B;
 	}
 
-	static  int32_t CountBits(uint64_t Bits)
+	static constexpr int32_t CountBits(uint64_t Bits)
 	{
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__POPCNT__)
+		return __builtin_popcountll(Bits);
+#else
+#if defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+		// Every AVX capable CPU has popcnt, without /arch:AVX it could be missing
+		if (!MIKASA_IS_CONSTANT_EVALUATED())
+		{
+			return (int32_t)__popcnt64(Bits);
+		}
+#endif
 		// https://en.wikipedia.org/wiki/Hamming_weight
 		Bits -= (Bits >> 1) & 0x5555555555555555ull;
 		Bits = (Bits & 0x3333333333333333ull) + ((Bits >> 2) & 0x3333333333333333ull);
 		Bits = (Bits + (Bits >> 4)) & 0x0f0f0f0f0f0f0f0full;
-		return (Bits * 0x0101010101010101) >> 56;
+		return (int32_t)((Bits * 0x0101010101010101ull) >> 56);
+#endif
+	}
+
+	/**
+	 * Bitset helpers over arrays of 64 bit words, bit N lives in Words[N / 64] at position N % 64.
+	 */
+
+	/** @return the number of set bits in the first NumWords words. */
+	static int64_t CountBits(const uint64_t* Words, int32_t NumWords);
+
+	/** @return the index of the first set bit at or after StartBit, or -1 if there is none. */
+	static int64_t FindFirstSetBit(const uint64_t* Words, int32_t NumWords, int64_t StartBit = 0);
+
+	/** @return the index of the first clear bit at or after StartBit, or -1 if there is none. */
+	static int64_t FindFirstClearBit(const uint64_t* Words, int32_t NumWords, int64_t StartBit = 0);
+
+	/** Calls Function(BitIndex) for every set bit in ascending order. */
+	template <typename FunctionType>
+	static void ForEachSetBit(const uint64_t* Words, int32_t NumWords, FunctionType&& Function)
+	{
+		for (int32_t WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			for (uint64_t Word = Words[WordIndex]; Word != 0; Word &= Word - 1)
+			{
+				Function((int64_t)WordIndex * 64 + (int64_t)CountTrailingZeros64(Word));
+			}
+		}
 	}
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -640,34 +740,30 @@ private:
 	///** Error reporting for Fmod. Not inlined to avoid compilation issues and avoid all the checks and error reporting at all callsites. */
 	//static void FmodReportError(float X, float Y);
 
-	// Random Number Functions
+public:
+
+	// Random Number Functions, all of them draw from the calling thread's FRandomStream
 
 	/** Helper function for rand implementations. Returns a random number in [0..A) */
 	static int32_t RandHelper(int32_t A)
 	{
-		// Note that on some platforms RAND_MAX is a large number so we cannot do ((rand()/(RAND_MAX+1)) * A)
-		// or else we may include the upper bound results, which should be excluded.
-		return A > 0 ? Min(TruncToInt(FRand() * A), A - 1) : 0;
+		return A > 0 ? (int32_t)FRandomStream::GetThreadStream().RandHelper((uint32_t)A) : 0;
 	}
 
 	static  int64_t RandHelper64(int64_t A)
 	{
-		// Note that on some platforms RAND_MAX is a large number so we cannot do ((rand()/(RAND_MAX+1)) * A)
-		// or else we may include the upper bound results, which should be excluded.
-		return A > 0 ? Min<int64_t>(TruncToInt(FRand() * A), A - 1) : 0;
+		return A > 0 ? (int64_t)FRandomStream::GetThreadStream().RandHelper64((uint64_t)A) : 0;
 	}
 
 	/** Helper function for rand implementations. Returns a random number >= Min and <= Max */
 	static  int32_t RandRange(int32_t Min, int32_t Max)
 	{
-		const int32_t Range = (Max - Min) + 1;
-		return Min + RandHelper(Range);
+		return FRandomStream::GetThreadStream().RandRange(Min, Max);
 	}
 
 	static  int64_t RandRange(int64_t Min, int64_t Max)
 	{
-		const int64_t Range = (Max - Min) + 1;
-		return Min + RandHelper64(Range);
+		return FRandomStream::GetThreadStream().RandRange(Min, Max);
 	}
 
 	/** Util to generate a random number in a range. Overloaded to distinguish from int32_t version, where passing a float is typically a mistake. */
@@ -685,340 +781,343 @@ private:
 	/** Util to generate a random boolean. */
 	static  bool RandBool()
 	{
-		return (RandRange(0, 1) == 1) ? true : false;
+		return FRandomStream::GetThreadStream().RandBool();
 	}
 
-//	/** Return a uniformly distributed random unit length vector = point on the unit sphere surface. */
-//	static MVector VRand();
+	/** Return a uniformly distributed random unit length vector = point on the unit sphere surface. */
+	static MVector VRand();
 
-//	/**
-//	 * Returns a random unit vector, uniformly distributed, within the specified cone
-//	 * ConeHalfAngleRad is the half-angle of cone, in radians.  Returns a normalized vector.
-//	 */
-//	static CORE_API MVector VRandCone(MVector const& Dir, float ConeHalfAngleRad);
-//
-//	/**
-//	 * This is a version of VRandCone that handles "squished" cones, i.e. with different angle limits in the Y and Z axes.
-//	 * Assumes world Y and Z, although this could be extended to handle arbitrary rotations.
-//	 */
-//	static CORE_API MVector VRandCone(MVector const& Dir, float HorizontalConeHalfAngleRad, float VerticalConeHalfAngleRad);
-//
-//	/** Returns a random point, uniformly distributed, within the specified radius */
-//	static CORE_API MVector2D RandPointInCircle(float CircleRadius);
-//
-//	/** Returns a random point within the passed in bounding box */
-//	static CORE_API MVector RandPointInBox(const FBox& Box);
+	/**
+	 * Returns a random unit vector, uniformly distributed, within the specified cone
+	 * ConeHalfAngleRad is the half-angle of cone, in radians.  Returns a normalized vector.
+	 */
+	static MVector VRandCone(MVector const& Dir, float ConeHalfAngleRad);
+
+	/**
+	 * This is a version of VRandCone that handles "squished" cones, i.e. with different angle limits in the Y and Z axes.
+	 * Assumes world Y and Z, although this could be extended to handle arbitrary rotations.
+	 */
+	static MVector VRandCone(MVector const& Dir, float HorizontalConeHalfAngleRad, float VerticalConeHalfAngleRad);
+
+	/** Returns a random point, uniformly distributed, within the specified radius */
+	static MVector2D RandPointInCircle(float CircleRadius);
+
+	/** Returns a random point within the passed in bounding box */
+	static MVector RandPointInBox(const FBox& Box);
+
+	/**
+	 * Given a direction vector and a surface normal, returns the vector reflected across the surface normal.
+	 * Produces a result like shining a laser at a mirror!
+	 *
+	 * @param Direction Direction vector the ray is coming from.
+	 * @param SurfaceNormal A normal of the surface the ray should be reflected on.
+	 *
+	 * @returns Reflected vector.
+	 */
+	static MVector GetReflectionVector(const MVector& Direction, const MVector& SurfaceNormal);
+
+	/** GetReflectionVector for MVectorWide::Lanes directions at once. */
+	static MVectorWide GetReflectionVector(const MVectorWide& Direction, const MVectorWide& SurfaceNormal);
+
+	// Predicates
+
+	/** Checks if value is within a range, exclusive on MaxValue) */
+	template< class U >
+	static  bool IsWithin(const U& TestValue, const U& MinValue, const U& MaxValue)
+	{
+		return ((TestValue >= MinValue) && (TestValue < MaxValue));
+	}
+
+	/** Checks if value is within a range, inclusive on MaxValue) */
+	template< class U >
+	static  bool IsWithinInclusive(const U& TestValue, const U& MinValue, const U& MaxValue)
+	{
+		return ((TestValue >= MinValue) && (TestValue <= MaxValue));
+	}
+
+	/**
+	 *	Checks if two floating point numbers are nearly equal.
+	 *	@param A				First number to compare
+	 *	@param B				Second number to compare
+	 *	@param ErrorTolerance	Maximum allowed difference for considering them as 'nearly equal'
+	 *	@return					true if A and B are nearly equal
+	 */
+	static  bool IsNearlyEqual(float A, float B, float ErrorTolerance = SMALL_NUMBER)
+	{
+		return Abs<float>(A - B) <= ErrorTolerance;
+	}
+
+	/**
+	 *	Checks if two floating point numbers are nearly equal.
+	 *	@param A				First number to compare
+	 *	@param B				Second number to compare
+	 *	@param ErrorTolerance	Maximum allowed difference for considering them as 'nearly equal'
+	 *	@return					true if A and B are nearly equal
+	 */
+	static  bool IsNearlyEqual(double A, double B, double ErrorTolerance = SMALL_NUMBER)
+	{
+		return Abs<double>(A - B) <= ErrorTolerance;
+	}
+
+	/**
+	 *	Checks if a floating point number is nearly zero.
+	 *	@param Value			Number to compare
+	 *	@param ErrorTolerance	Maximum allowed difference for considering Value as 'nearly zero'
+	 *	@return					true if Value is nearly zero
+	 */
+	static  bool IsNearlyZero(float Value, float ErrorTolerance = SMALL_NUMBER)
+	{
+		return Abs<float>(Value) <= ErrorTolerance;
+	}
+
+	/**
+	 *	Checks if a floating point number is nearly zero.
+	 *	@param Value			Number to compare
+	 *	@param ErrorTolerance	Maximum allowed difference for considering Value as 'nearly zero'
+	 *	@return					true if Value is nearly zero
+	 */
+	static  bool IsNearlyZero(double Value, double ErrorTolerance = SMALL_NUMBER)
+	{
+		return Abs<double>(Value) <= ErrorTolerance;
+	}
+
+private:
+	template<typename FloatType, typename IntegralType, IntegralType SignedBit>
+	static inline bool TIsNearlyEqualByULP(FloatType A, FloatType B, int32_t MaxUlps)
+	{
+		// Any comparison with NaN always fails.
+		if (FMath::IsNaN(A) || FMath::IsNaN(B))
+		{
+			return false;
+		}
+
+		// If either number is infinite, then ignore ULP and do a simple equality test. 
+		// The rationale being that two infinities, of the same sign, should compare the same 
+		// no matter the ULP, but FLT_MAX and Inf should not, even if they're neighbors in
+		// their bit representation.
+		if (!FMath::IsFinite(A) || !FMath::IsFinite(B))
+		{
+			return A == B;
+		}
+
+		// Convert the integer representation of the float from sign + magnitude to
+		// a signed number representation where 0 is 1 << 31. This allows us to compare
+		// ULP differences around zero values.
+		auto FloatToSignedNumber = [](IntegralType V) {
+			if (V & SignedBit)
+			{
+				return ~V + 1;
+			}
+			else
+			{
+				return SignedBit | V;
+			}
+		};
+
+		union FFloatToInt { FloatType F; IntegralType I; };
+		FFloatToInt FloatA;
+		FFloatToInt FloatB;
+
+		FloatA.F = A;
+		FloatB.F = B;
+
+		IntegralType SNA = FloatToSignedNumber(FloatA.I);
+		IntegralType SNB = FloatToSignedNumber(FloatB.I);
+		IntegralType Distance = (SNA >= SNB) ? (SNA - SNB) : (SNB - SNA);
+		return Distance <= IntegralType(MaxUlps);
+	}
+
+public:
+
+	/**
+	 *	Check if two floating point numbers are nearly equal to within specific number of
+	 *	units of last place (ULP). A single ULP difference between two floating point numbers
+	 *	means that they have an adjacent representation and that no other floating point number
+	 *	can be constructed to fit between them. This enables making consistent comparisons
+	 *	based on representational distance between floating point numbers, regardless of
+	 *	their magnitude.
+	 *
+	 *	Use when the two numbers vary greatly in range. Otherwise, if absolute tolerance is
+	 *	required, use IsNearlyEqual instead.
+	 *
+	 *	Note: Since IEEE 754 floating point operations are guaranteed to be exact to 0.5 ULP,
+	 *	a value of 4 ought to be sufficient for all but the most complex float operations.
+	 *
+	 *	@param A				First number to compare
+	 *	@param B				Second number to compare
+	 *	@param MaxUlps          The maximum ULP distance by which neighboring floating point
+	 *	                        numbers are allowed to differ.
+	 *	@return					true if the two values are nearly equal.
+	 */
+	static  bool IsNearlyEqualByULP(float A, float B, int32_t MaxUlps = 4)
+	{
+		return TIsNearlyEqualByULP<float, uint32_t, uint32_t(1U << 31)>(A, B, MaxUlps);
+	}
+
+	/**
+	 *	Check if two floating point numbers are nearly equal to within specific number of
+	 *	units of last place (ULP). A single ULP difference between two floating point numbers
+	 *	means that they have an adjacent representation and that no other floating point number
+	 *	can be constructed to fit between them. This enables making consistent comparisons
+	 *	based on representational distance between floating point numbers, regardless of
+	 *	their magnitude.
+	 *
+	 *	Note: Since IEEE 754 floating point operations are guaranteed to be exact to 0.5 ULP,
+	 *	a value of 4 ought to be sufficient for all but the most complex float operations.
+	 *
+	 *	@param A				First number to compare
+	 *	@param B				Second number to compare
+	 *	@param MaxUlps          The maximum ULP distance by which neighboring floating point
+	 *	                        numbers are allowed to differ.
+	 *	@return					true if the two values are nearly equal.
+	 */
+	static  bool IsNearlyEqualByULP(double A, double B, int32_t MaxUlps = 4)
+	{
+		return TIsNearlyEqualByULP<double, uint64_t, uint64_t(1ULL << 63)>(A, B, MaxUlps);
+	}
+
+	/**
+	 *	Checks whether a number is a power of two.
+	 *	@param Value	Number to check
+	 *	@return			true if Value is a power of two
+	 */
+	template <typename T>
+	static  bool IsPowerOfTwo(T Value)
+	{
+		return ((Value & (Value - 1)) == (T)0);
+	}
+
+
+	// Math Operations
+
+	/** Returns highest of 3 values */
+	template< class T >
+	static  T Max3(const T A, const T B, const T C)
+	{
+		return Max(Max(A, B), C);
+	}
+
+	/** Returns lowest of 3 values */
+	template< class T >
+	static  T Min3(const T A, const T B, const T C)
+	{
+		return Min(Min(A, B), C);
+	}
+
+	/** Multiples value by itself */
+	template< class T >
+	static  T Square(const T A)
+	{
+		return A * A;
+	}
+
+	/** Clamps X to be between Min and Max, inclusive */
+	template< class T >
+	static  T Clamp(const T X, const T Min, const T Max)
+	{
+		return X < Min ? Min : X < Max ? X : Max;
+	}
+
+	/** Snaps a value to the nearest grid multiple */
+	static  float GridSnap(float Location, float Grid)
+	{
+		if (Grid == 0.f)	return Location;
+		else
+		{
+			return FloorToFloat((Location + 0.5f * Grid) / Grid) * Grid;
+		}
+	}
+
+	/** Snaps a value to the nearest grid multiple */
+	static  double GridSnap(double Location, double Grid)
+	{
+		if (Grid == 0.0)	return Location;
+		else
+		{
+			return FloorToDouble((Location + 0.5 * Grid) / Grid) * Grid;
+		}
+	}
+
+	/** Divides two integers and rounds up */
+	template <class T>
+	static  T DivideAndRoundUp(T Dividend, T Divisor)
+	{
+		return (Dividend + Divisor - 1) / Divisor;
+	}
+
+	/** Divides two integers and rounds down */
+	template <class T>
+	static  T DivideAndRoundDown(T Dividend, T Divisor)
+	{
+		return Dividend / Divisor;
+	}
+
+	/** Divides two integers and rounds to nearest */
+	template <class T>
+	static  T DivideAndRoundNearest(T Dividend, T Divisor)
+	{
+		return (Dividend >= 0)
+			? (Dividend + Divisor / 2) / Divisor
+			: (Dividend - Divisor / 2 + 1) / Divisor;
+	}
 //
 //	/**
-//	 * Given a direction vector and a surface normal, returns the vector reflected across the surface normal.
-//	 * Produces a result like shining a laser at a mirror!
+//	 * Computes the base 2 logarithm of the specified value
 //	 *
-//	 * @param Direction Direction vector the ray is coming from.
-//	 * @param SurfaceNormal A normal of the surface the ray should be reflected on.
+//	 * @param Value the value to perform the log on
 //	 *
-//	 * @returns Reflected vector.
-//	 */
-//	static CORE_API MVector GetReflectionVector(const MVector& Direction, const MVector& SurfaceNormal);
-//
-//	// Predicates
-//
-//	/** Checks if value is within a range, exclusive on MaxValue) */
-//	template< class U >
-//	static  bool IsWithin(const U& TestValue, const U& MinValue, const U& MaxValue)
-//	{
-//		return ((TestValue >= MinValue) && (TestValue < MaxValue));
-//	}
-//
-//	/** Checks if value is within a range, inclusive on MaxValue) */
-//	template< class U >
-//	static  bool IsWithinInclusive(const U& TestValue, const U& MinValue, const U& MaxValue)
-//	{
-//		return ((TestValue >= MinValue) && (TestValue <= MaxValue));
-//	}
-//
-//	/**
-//	 *	Checks if two floating point numbers are nearly equal.
-//	 *	@param A				First number to compare
-//	 *	@param B				Second number to compare
-//	 *	@param ErrorTolerance	Maximum allowed difference for considering them as 'nearly equal'
-//	 *	@return					true if A and B are nearly equal
-//	 */
-//	static  bool IsNearlyEqual(float A, float B, float ErrorTolerance = SMALL_NUMBER)
-//	{
-//		return Abs<float>(A - B) <= ErrorTolerance;
-//	}
-//
-//	/**
-//	 *	Checks if two floating point numbers are nearly equal.
-//	 *	@param A				First number to compare
-//	 *	@param B				Second number to compare
-//	 *	@param ErrorTolerance	Maximum allowed difference for considering them as 'nearly equal'
-//	 *	@return					true if A and B are nearly equal
-//	 */
-//	static  bool IsNearlyEqual(double A, double B, double ErrorTolerance = SMALL_NUMBER)
-//	{
-//		return Abs<double>(A - B) <= ErrorTolerance;
-//	}
-//
-//	/**
-//	 *	Checks if a floating point number is nearly zero.
-//	 *	@param Value			Number to compare
-//	 *	@param ErrorTolerance	Maximum allowed difference for considering Value as 'nearly zero'
-//	 *	@return					true if Value is nearly zero
+//	 * @return the base 2 log of the value
 //	 */
-//	static  bool IsNearlyZero(float Value, float ErrorTolerance = SMALL_NUMBER)
+//	static  float Log2(float Value)
 //	{
-//		return Abs<float>(Value) <= ErrorTolerance;
+//		// Cached value for fast conversions
+//		static const float LogToLog2 = 1.f / Loge(2.f);
+//		// Do the platform specific log and convert using the cached value
+//		return Loge(Value) * LogToLog2;
 //	}
 //
 //	/**
-//	 *	Checks if a floating point number is nearly zero.
-//	 *	@param Value			Number to compare
-//	 *	@param ErrorTolerance	Maximum allowed difference for considering Value as 'nearly zero'
-//	 *	@return					true if Value is nearly zero
-//	 */
-//	static  bool IsNearlyZero(double Value, double ErrorTolerance = SMALL_NUMBER)
-//	{
-//		return Abs<double>(Value) <= ErrorTolerance;
-//	}
-//
-//private:
-//	template<typename FloatType, typename IntegralType, IntegralType SignedBit>
-//	static inline bool TIsNearlyEqualByULP(FloatType A, FloatType B, int32_t MaxUlps)
+//	* Computes the sine and cosine of a scalar value.
+//	*
+//	* @param ScalarSin	Pointer to where the Sin result should be stored
+//	* @param ScalarCos	Pointer to where the Cos result should be stored
+//	* @param Value  input angles
+//	*/
+//	static  void SinCos(float* ScalarSin, float* ScalarCos, float  Value)
 //	{
-//		// Any comparison with NaN always fails.
-//		if (FMath::IsNaN(A) || FMath::IsNaN(B))
+//		// Map Value to y in [-pi,pi], x = 2*pi*quotient + remainder.
+//		float quotient = (INV_PI * 0.5f) * Value;
+//		if (Value >= 0.0f)
+//		{
+//			quotient = (float)((int)(quotient + 0.5f));
+//		}
+//		else
 //		{
-//			return false;
+//			quotient = (float)((int)(quotient - 0.5f));
 //		}
+//		float y = Value - (2.0f * PI) * quotient;
 //
-//		// If either number is infinite, then ignore ULP and do a simple equality test. 
-//		// The rationale being that two infinities, of the same sign, should compare the same 
-//		// no matter the ULP, but FLT_MAX and Inf should not, even if they're neighbors in
-//		// their bit representation.
-//		if (!FMath::IsFinite(A) || !FMath::IsFinite(B))
+//		// Map y to [-pi/2,pi/2] with sin(y) = sin(Value).
+//		float sign;
+//		if (y > HALF_PI)
+//		{
+//			y = PI - y;
+//			sign = -1.0f;
+//		}
+//		else if (y < -HALF_PI)
+//		{
+//			y = -PI - y;
+//			sign = -1.0f;
+//		}
+//		else
 //		{
-//			return A == B;
+//			sign = +1.0f;
 //		}
 //
-//		// Convert the integer representation of the float from sign + magnitude to
-//		// a signed number representation where 0 is 1 << 31. This allows us to compare
-//		// ULP differences around zero values.
-//		auto FloatToSignedNumber = [](IntegralType V) {
-//			if (V & SignedBit)
-//			{
-//				return ~V + 1;
-//			}
-//			else
-//			{
-//				return SignedBit | V;
-//			}
-//		};
-//
-//		union FFloatToInt { FloatType F; IntegralType I; };
-//		FFloatToInt FloatA;
-//		FFloatToInt FloatB;
-//
-//		FloatA.F = A;
-//		FloatB.F = B;
-//
-//		IntegralType SNA = FloatToSignedNumber(FloatA.I);
-//		IntegralType SNB = FloatToSignedNumber(FloatB.I);
-//		IntegralType Distance = (SNA >= SNB) ? (SNA - SNB) : (SNB - SNA);
-//		return Distance <= IntegralType(MaxUlps);
-//	}
+//		float y2 = y * y;
 //
-//public:
-//
-//	/**
-//	 *	Check if two floating point numbers are nearly equal to within specific number of
-//	 *	units of last place (ULP). A single ULP difference between two floating point numbers
-//	 *	means that they have an adjacent representation and that no other floating point number
-//	 *	can be constructed to fit between them. This enables making consistent comparisons
-//	 *	based on representational distance between floating point numbers, regardless of
-//	 *	their magnitude.
-//	 *
-//	 *	Use when the two numbers vary greatly in range. Otherwise, if absolute tolerance is
-//	 *	required, use IsNearlyEqual instead.
-//	 *
-//	 *	Note: Since IEEE 754 floating point operations are guaranteed to be exact to 0.5 ULP,
-//	 *	a value of 4 ought to be sufficient for all but the most complex float operations.
-//	 *
-//	 *	@param A				First number to compare
-//	 *	@param B				Second number to compare
-//	 *	@param MaxUlps          The maximum ULP distance by which neighboring floating point
-//	 *	                        numbers are allowed to differ.
-//	 *	@return					true if the two values are nearly equal.
-//	 */
-//	static  bool IsNearlyEqualByULP(float A, float B, int32_t MaxUlps = 4)
-//	{
-//		return TIsNearlyEqualByULP<float, uint32_t, uint32_t(1U << 31)>(A, B, MaxUlps);
-//	}
-//
-//	/**
-//	 *	Check if two floating point numbers are nearly equal to within specific number of
-//	 *	units of last place (ULP). A single ULP difference between two floating point numbers
-//	 *	means that they have an adjacent representation and that no other floating point number
-//	 *	can be constructed to fit between them. This enables making consistent comparisons
-//	 *	based on representational distance between floating point numbers, regardless of
-//	 *	their magnitude.
-//	 *
-//	 *	Note: Since IEEE 754 floating point operations are guaranteed to be exact to 0.5 ULP,
-//	 *	a value of 4 ought to be sufficient for all but the most complex float operations.
-//	 *
-//	 *	@param A				First number to compare
-//	 *	@param B				Second number to compare
-//	 *	@param MaxUlps          The maximum ULP distance by which neighboring floating point
-//	 *	                        numbers are allowed to differ.
-//	 *	@return					true if the two values are nearly equal.
-//	 */
-//	static  bool IsNearlyEqualByULP(double A, double B, int32_t MaxUlps = 4)
-//	{
-//		return TIsNearlyEqualByULP<double, uint64_t, uint64_t(1ULL << 63)>(A, B, MaxUlps);
-//	}
-//
-//	/**
-//	 *	Checks whether a number is a power of two.
-//	 *	@param Value	Number to check
-//	 *	@return			true if Value is a power of two
-//	 */
-//	template <typename T>
-//	static  bool IsPowerOfTwo(T Value)
-//	{
-//		return ((Value & (Value - 1)) == (T)0);
-//	}
-//
-//
-//	// Math Operations
-//
-//	/** Returns highest of 3 values */
-//	template< class T >
-//	static  T Max3(const T A, const T B, const T C)
-//	{
-//		return Max(Max(A, B), C);
-//	}
-//
-//	/** Returns lowest of 3 values */
-//	template< class T >
-//	static  T Min3(const T A, const T B, const T C)
-//	{
-//		return Min(Min(A, B), C);
-//	}
-//
-//	/** Multiples value by itself */
-//	template< class T >
-//	static  T Square(const T A)
-//	{
-//		return A * A;
-//	}
-//
-//	/** Clamps X to be between Min and Max, inclusive */
-//	template< class T >
-//	static  T Clamp(const T X, const T Min, const T Max)
-//	{
-//		return X < Min ? Min : X < Max ? X : Max;
-//	}
-//
-//	/** Snaps a value to the nearest grid multiple */
-//	static  float GridSnap(float Location, float Grid)
-//	{
-//		if (Grid == 0.f)	return Location;
-//		else
-//		{
-//			return FloorToFloat((Location + 0.5f * Grid) / Grid) * Grid;
-//		}
-//	}
-//
-//	/** Snaps a value to the nearest grid multiple */
-//	static  double GridSnap(double Location, double Grid)
-//	{
-//		if (Grid == 0.0)	return Location;
-//		else
-//		{
-//			return FloorToDouble((Location + 0.5 * Grid) / Grid) * Grid;
-//		}
-//	}
-//
-//	/** Divides two integers and rounds up */
-//	template <class T>
-//	static  T DivideAndRoundUp(T Dividend, T Divisor)
-//	{
-//		return (Dividend + Divisor - 1) / Divisor;
-//	}
-//
-//	/** Divides two integers and rounds down */
-//	template <class T>
-//	static  T DivideAndRoundDown(T Dividend, T Divisor)
-//	{
-//		return Dividend / Divisor;
-//	}
-//
-//	/** Divides two integers and rounds to nearest */
-//	template <class T>
-//	static  T DivideAndRoundNearest(T Dividend, T Divisor)
-//	{
-//		return (Dividend >= 0)
-//			? (Dividend + Divisor / 2) / Divisor
-//			: (Dividend - Divisor / 2 + 1) / Divisor;
-//	}
-//
-//	/**
-//	 * Computes the base 2 logarithm of the specified value
-//	 *
-//	 * @param Value the value to perform the log on
-//	 *
-//	 * @return the base 2 log of the value
-//	 */
-//	static  float Log2(float Value)
-//	{
-//		// Cached value for fast conversions
-//		static const float LogToLog2 = 1.f / Loge(2.f);
-//		// Do the platform specific log and convert using the cached value
-//		return Loge(Value) * LogToLog2;
-//	}
-//
-//	/**
-//	* Computes the sine and cosine of a scalar value.
-//	*
-//	* @param ScalarSin	Pointer to where the Sin result should be stored
-//	* @param ScalarCos	Pointer to where the Cos result should be stored
-//	* @param Value  input angles
-//	*/
-//	static  void SinCos(float* ScalarSin, float* ScalarCos, float  Value)
-//	{
-//		// Map Value to y in [-pi,pi], x = 2*pi*quotient + remainder.
-//		float quotient = (INV_PI * 0.5f) * Value;
-//		if (Value >= 0.0f)
-//		{
-//			quotient = (float)((int)(quotient + 0.5f));
-//		}
-//		else
-//		{
-//			quotient = (float)((int)(quotient - 0.5f));
-//		}
-//		float y = Value - (2.0f * PI) * quotient;
-//
-//		// Map y to [-pi/2,pi/2] with sin(y) = sin(Value).
-//		float sign;
-//		if (y > HALF_PI)
-//		{
-//			y = PI - y;
-//			sign = -1.0f;
-//		}
-//		else if (y < -HALF_PI)
-//		{
-//			y = -PI - y;
-//			sign = -1.0f;
-//		}
-//		else
-//		{
-//			sign = +1.0f;
-//		}
-//
-//		float y2 = y * y;
-//
-//		// 11-degree minimax approximation
-//		*ScalarSin = (((((-2.3889859e-08f * y2 + 2.7525562e-06f) * y2 - 0.00019840874f) * y2 + 0.0083333310f) * y2 - 0.16666667f) * y2 + 1.0f) * y;
+//		// 11-degree minimax approximation
+//		*ScalarSin = (((((-2.3889859e-08f * y2 + 2.7525562e-06f) * y2 - 0.00019840874f) * y2 + 0.0083333310f) * y2 - 0.16666667f) * y2 + 1.0f) * y;
 //
 //		// 10-degree minimax approximation
 //		float p = ((((-2.6051615e-07f * y2 + 2.4760495e-05f) * y2 - 0.0013888378f) * y2 + 0.041666638f) * y2 - 0.5f) * y2 + 1.0f;
@@ -1058,29 +1157,29 @@ private:
 //#undef FASTASIN_HALF_PI
 //
 //
-//	// Conversion Functions
-//
-//	/**
-//	 * Converts radians to degrees.
-//	 * @param	RadVal			Value in radians.
-//	 * @return					Value in degrees.
-//	 */
-//	template<class T>
-//	static  auto RadiansToDegrees(T const& RadVal) -> decltype(RadVal* (180.f / PI))
-//	{
-//		return RadVal * (180.f / PI);
-//	}
-//
-//	/**
-//	 * Converts degrees to radians.
-//	 * @param	DegVal			Value in degrees.
-//	 * @return					Value in radians.
-//	 */
-//	template<class T>
-//	static  auto DegreesToRadians(T const& DegVal) -> decltype(DegVal* (PI / 180.f))
-//	{
-//		return DegVal * (PI / 180.f);
-//	}
+	// Conversion Functions
+
+	/**
+	 * Converts radians to degrees.
+	 * @param	RadVal			Value in radians.
+	 * @return					Value in degrees.
+	 */
+	template<class T>
+	static  auto RadiansToDegrees(T const& RadVal) -> decltype(RadVal* (180.f / PI))
+	{
+		return RadVal * (180.f / PI);
+	}
+
+	/**
+	 * Converts degrees to radians.
+	 * @param	DegVal			Value in degrees.
+	 * @return					Value in radians.
+	 */
+	template<class T>
+	static  auto DegreesToRadians(T const& DegVal) -> decltype(DegVal* (PI / 180.f))
+	{
+		return DegVal * (PI / 180.f);
+	}
 //
 //	/**
 //	 * Clamps an arbitrary angle to be between the given angles.  Will clamp to nearest boundary.
@@ -1091,51 +1190,51 @@ private:
 //	 */
 //	static float CORE_API ClampAngle(float AngleDegrees, float MinAngleDegrees, float MaxAngleDegrees);
 //
-//	/** Find the smallest angle between two headings (in degrees) */
-//	static float FindDeltaAngleDegrees(float A1, float A2)
-//	{
-//		// Find the difference
-//		float Delta = A2 - A1;
-//
-//		// If change is larger than 180
-//		if (Delta > 180.0f)
-//		{
-//			// Flip to negative equivalent
-//			Delta = Delta - 360.0f;
-//		}
-//		else if (Delta < -180.0f)
-//		{
-//			// Otherwise, if change is smaller than -180
-//			// Flip to positive equivalent
-//			Delta = Delta + 360.0f;
-//		}
-//
-//		// Return delta in [-180,180] range
-//		return Delta;
-//	}
-//
-//	/** Find the smallest angle between two headings (in radians) */
-//	static float FindDeltaAngleRadians(float A1, float A2)
-//	{
-//		// Find the difference
-//		float Delta = A2 - A1;
-//
-//		// If change is larger than PI
-//		if (Delta > PI)
-//		{
-//			// Flip to negative equivalent
-//			Delta = Delta - (PI * 2.0f);
-//		}
-//		else if (Delta < -PI)
-//		{
-//			// Otherwise, if change is smaller than -PI
-//			// Flip to positive equivalent
-//			Delta = Delta + (PI * 2.0f);
-//		}
-//
-//		// Return delta in [-PI,PI] range
-//		return Delta;
-//	}
+	/** Find the smallest angle between two headings (in degrees) */
+	static float FindDeltaAngleDegrees(float A1, float A2)
+	{
+		// Find the difference
+		float Delta = A2 - A1;
+
+		// If change is larger than 180
+		if (Delta > 180.0f)
+		{
+			// Flip to negative equivalent
+			Delta = Delta - 360.0f;
+		}
+		else if (Delta < -180.0f)
+		{
+			// Otherwise, if change is smaller than -180
+			// Flip to positive equivalent
+			Delta = Delta + 360.0f;
+		}
+
+		// Return delta in [-180,180] range
+		return Delta;
+	}
+
+	/** Find the smallest angle between two headings (in radians) */
+	static float FindDeltaAngleRadians(float A1, float A2)
+	{
+		// Find the difference
+		float Delta = A2 - A1;
+
+		// If change is larger than PI
+		if (Delta > PI)
+		{
+			// Flip to negative equivalent
+			Delta = Delta - (PI * 2.0f);
+		}
+		else if (Delta < -PI)
+		{
+			// Otherwise, if change is smaller than -PI
+			// Flip to positive equivalent
+			Delta = Delta + (PI * 2.0f);
+		}
+
+		// Return delta in [-PI,PI] range
+		return Delta;
+	}
 //
 //	UE_DEPRECATED(4.12, "Please use FindDeltaAngleRadians(float A1, float A2) instead of FindDeltaAngle(float A1, float A2).")
 //		static float FindDeltaAngle(float A1, float A2)
@@ -1143,37 +1242,37 @@ private:
 //		return FindDeltaAngleRadians(A1, A2);
 //	}
 //
-//	/** Given a heading which may be outside the +/- PI range, 'unwind' it back into that range. */
-//	static float UnwindRadians(float A)
-//	{
-//		while (A > PI)
-//		{
-//			A -= ((float)PI * 2.0f);
-//		}
-//
-//		while (A < -PI)
-//		{
-//			A += ((float)PI * 2.0f);
-//		}
-//
-//		return A;
-//	}
-//
-//	/** Utility to ensure angle is between +/- 180 degrees by unwinding. */
-//	static float UnwindDegrees(float A)
-//	{
-//		while (A > 180.f)
-//		{
-//			A -= 360.f;
-//		}
-//
-//		while (A < -180.f)
-//		{
-//			A += 360.f;
-//		}
-//
-//		return A;
-//	}
+	/** Given a heading which may be outside the +/- PI range, 'unwind' it back into that range. */
+	static float UnwindRadians(float A)
+	{
+		while (A > PI)
+		{
+			A -= ((float)PI * 2.0f);
+		}
+
+		while (A < -PI)
+		{
+			A += ((float)PI * 2.0f);
+		}
+
+		return A;
+	}
+
+	/** Utility to ensure angle is between +/- 180 degrees by unwinding. */
+	static float UnwindDegrees(float A)
+	{
+		while (A > 180.f)
+		{
+			A -= 360.f;
+		}
+
+		while (A < -180.f)
+		{
+			A += 360.f;
+		}
+
+		return A;
+	}
 //
 //	/**
 //	 * Given two angles in degrees, 'wind' the rotation in Angle1 so that it avoids >180 degree flips.
@@ -1193,324 +1292,324 @@ private:
 //	 */
 //	static CORE_API float FixedTurn(float InCurrent, float InDesired, float InDeltaRate);
 //
-//	/** Converts given Cartesian coordinate pair to Polar coordinate system. */
-//	static  void CartesianToPolar(const float X, const float Y, float& OutRad, float& OutAng)
-//	{
-//		OutRad = Sqrt(Square(X) + Square(Y));
-//		OutAng = Atan2(Y, X);
-//	}
-//	/** Converts given Cartesian coordinate pair to Polar coordinate system. */
-//	static  void CartesianToPolar(const MVector2D InCart, MVector2D& OutPolar);
-//
-//	/** Converts given Polar coordinate pair to Cartesian coordinate system. */
-//	static  void PolarToCartesian(const float Rad, const float Ang, float& OutX, float& OutY)
-//	{
-//		OutX = Rad * Cos(Ang);
-//		OutY = Rad * Sin(Ang);
-//	}
-//	/** Converts given Polar coordinate pair to Cartesian coordinate system. */
-//	static  void PolarToCartesian(const MVector2D InPolar, MVector2D& OutCart);
-//
-//	/**
-//	 * Calculates the dotted distance of vector 'Direction' to coordinate system O(AxisX,AxisY,AxisZ).
-//	 *
-//	 * Orientation: (consider 'O' the first person view of the player, and 'Direction' a vector pointing to an enemy)
-//	 * - positive azimuth means enemy is on the right of crosshair. (negative means left).
-//	 * - positive elevation means enemy is on top of crosshair, negative means below.
-//	 *
-//	 * @Note: 'Azimuth' (.X) sign is changed to represent left/right and not front/behind. front/behind is the funtion's return value.
-//	 *
-//	 * @param	OutDotDist	.X = 'Direction' dot AxisX relative to plane (AxisX,AxisZ). (== Cos(Azimuth))
-//	 *						.Y = 'Direction' dot AxisX relative to plane (AxisX,AxisY). (== Sin(Elevation))
-//	 * @param	Direction	direction of target.
-//	 * @param	AxisX		X component of reference system.
-//	 * @param	AxisY		Y component of reference system.
-//	 * @param	AxisZ		Z component of reference system.
-//	 *
-//	 * @return	true if 'Direction' is facing AxisX (Direction dot AxisX >= 0.f)
-//	 */
-//	static CORE_API bool GetDotDistance(MVector2D& OutDotDist, const MVector& Direction, const MVector& AxisX, const MVector& AxisY, const MVector& AxisZ);
-//
-//	/**
-//	 * Returns Azimuth and Elevation of vector 'Direction' in coordinate system O(AxisX,AxisY,AxisZ).
-//	 *
-//	 * Orientation: (consider 'O' the first person view of the player, and 'Direction' a vector pointing to an enemy)
-//	 * - positive azimuth means enemy is on the right of crosshair. (negative means left).
-//	 * - positive elevation means enemy is on top of crosshair, negative means below.
-//	 *
-//	 * @param	Direction		Direction of target.
-//	 * @param	AxisX			X component of reference system.
-//	 * @param	AxisY			Y component of reference system.
-//	 * @param	AxisZ			Z component of reference system.
-//	 *
-//	 * @return	MVector2D	X = Azimuth angle (in radians) (-PI, +PI)
-//	 *						Y = Elevation angle (in radians) (-PI/2, +PI/2)
-//	 */
-//	static CORE_API MVector2D GetAzimuthAndElevation(const MVector& Direction, const MVector& AxisX, const MVector& AxisY, const MVector& AxisZ);
-//
-//	// Interpolation Functions
-//
-//	/** Calculates the percentage along a line from MinValue to MaxValue that Value is. */
-//	template<typename T>
-//	static  typename TEnableIf<TIsFloatingPoint<T>::Value, T>::Type GetRangePct(T MinValue, T MaxValue, T Value)
-//	{
-//		// Avoid Divide by Zero.
-//		// But also if our range is a point, output whether Value is before or after.
-//		const T Divisor = MaxValue - MinValue;
-//		if (FMath::IsNearlyZero(Divisor))
-//		{
-//			return (Value >= MaxValue) ? (T)1 : (T)0;
-//		}
-//
-//		return (Value - MinValue) / Divisor;
-//	}
-//
-//	/** Same as above, but taking a 2d vector as the range. */
-//	static float GetRangePct(MVector2D const& Range, float Value);
-//
-//	/** Basically a Vector2d version of Lerp. */
-//	static float GetRangeValue(MVector2D const& Range, float Pct);
-//
-//	/** For the given Value clamped to the [Input:Range] inclusive, returns the corresponding percentage in [Output:Range] Inclusive. */
-//	static  float GetMappedRangeValueClamped(const MVector2D& InputRange, const MVector2D& OutputRange, const float Value)
-//	{
-//		const float ClampedPct = Clamp<float>(GetRangePct(InputRange, Value), 0.f, 1.f);
-//		return GetRangeValue(OutputRange, ClampedPct);
-//	}
-//
-//	/** Transform the given Value relative to the input range to the Output Range. */
-//	static  float GetMappedRangeValueUnclamped(const MVector2D& InputRange, const MVector2D& OutputRange, const float Value)
-//	{
-//		return GetRangeValue(OutputRange, GetRangePct(InputRange, Value));
-//	}
-//
-//	template<class T>
-//	static  double GetRangePct(TRange<T> const& Range, T Value)
-//	{
-//		return GetRangePct(Range.GetLowerBoundValue(), Range.GetUpperBoundValue(), Value);
-//	}
-//
-//	template<class T>
-//	static  T GetRangeValue(TRange<T> const& Range, T Pct)
-//	{
-//		return FMath::Lerp<T>(Range.GetLowerBoundValue(), Range.GetUpperBoundValue(), Pct);
-//	}
-//
-//	template<class T>
-//	static  T GetMappedRangeValueClamped(const TRange<T>& InputRange, const TRange<T>& OutputRange, const T Value)
-//	{
-//		const T ClampedPct = FMath::Clamp<T>(GetRangePct(InputRange, Value), 0, 1);
-//		return GetRangeValue(OutputRange, ClampedPct);
-//	}
-//
-//	/** Performs a linear interpolation between two values, Alpha ranges from 0-1 */
-//	template< class T, class U >
-//	static _DEBUGGABLE T Lerp(const T& A, const T& B, const U& Alpha)
-//	{
-//		return (T)(A + Alpha * (B - A));
-//	}
-//
-//	/** Performs a linear interpolation between two values, Alpha ranges from 0-1. Handles full numeric range of T */
-//	template< class T >
-//	static _DEBUGGABLE T LerpStable(const T& A, const T& B, double Alpha)
-//	{
-//		return (T)((A * (1.0 - Alpha)) + (B * Alpha));
-//	}
-//
-//	/** Performs a linear interpolation between two values, Alpha ranges from 0-1. Handles full numeric range of T */
-//	template< class T >
-//	static _DEBUGGABLE T LerpStable(const T& A, const T& B, float Alpha)
-//	{
-//		return (T)((A * (1.0f - Alpha)) + (B * Alpha));
-//	}
-//
-//	/** Performs a 2D linear interpolation between four values values, FracX, FracY ranges from 0-1 */
-//	template< class T, class U >
-//	static _DEBUGGABLE T BiLerp(const T& P00, const T& P10, const T& P01, const T& P11, const U& FracX, const U& FracY)
-//	{
-//		return Lerp(
-//			Lerp(P00, P10, FracX),
-//			Lerp(P01, P11, FracX),
-//			FracY
-//		);
-//	}
-//
-//	/**
-//	 * Performs a cubic interpolation
-//	 *
-//	 * @param  P - end points
-//	 * @param  T - tangent directions at end points
-//	 * @param  Alpha - distance along spline
-//	 *
-//	 * @return  Interpolated value
-//	 */
-//	template< class T, class U >
-//	static _DEBUGGABLE T CubicInterp(const T& P0, const T& T0, const T& P1, const T& T1, const U& A)
-//	{
-//		const float A2 = A * A;
-//		const float A3 = A2 * A;
-//
-//		return (T)(((2 * A3) - (3 * A2) + 1) * P0) + ((A3 - (2 * A2) + A) * T0) + ((A3 - A2) * T1) + (((-2 * A3) + (3 * A2)) * P1);
-//	}
-//
-//	/**
-//	 * Performs a first derivative cubic interpolation
-//	 *
-//	 * @param  P - end points
-//	 * @param  T - tangent directions at end points
-//	 * @param  Alpha - distance along spline
-//	 *
-//	 * @return  Interpolated value
-//	 */
-//	template< class T, class U >
-//	static _DEBUGGABLE T CubicInterpDerivative(const T& P0, const T& T0, const T& P1, const T& T1, const U& A)
-//	{
-//		T a = 6.f * P0 + 3.f * T0 + 3.f * T1 - 6.f * P1;
-//		T b = -6.f * P0 - 4.f * T0 - 2.f * T1 + 6.f * P1;
-//		T c = T0;
-//
-//		const float A2 = A * A;
-//
-//		return (a * A2) + (b * A) + c;
-//	}
-//
-//	/**
-//	 * Performs a second derivative cubic interpolation
-//	 *
-//	 * @param  P - end points
-//	 * @param  T - tangent directions at end points
-//	 * @param  Alpha - distance along spline
-//	 *
-//	 * @return  Interpolated value
-//	 */
-//	template< class T, class U >
-//	static _DEBUGGABLE T CubicInterpSecondDerivative(const T& P0, const T& T0, const T& P1, const T& T1, const U& A)
-//	{
-//		T a = 12.f * P0 + 6.f * T0 + 6.f * T1 - 12.f * P1;
-//		T b = -6.f * P0 - 4.f * T0 - 2.f * T1 + 6.f * P1;
-//
-//		return (a * A) + b;
-//	}
-//
-//	/** Interpolate between A and B, applying an ease in function.  Exp controls the degree of the curve. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpEaseIn(const T& A, const T& B, float Alpha, float Exp)
-//	{
-//		float const ModifiedAlpha = Pow(Alpha, Exp);
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
-//
-//	/** Interpolate between A and B, applying an ease out function.  Exp controls the degree of the curve. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpEaseOut(const T& A, const T& B, float Alpha, float Exp)
-//	{
-//		float const ModifiedAlpha = 1.f - Pow(1.f - Alpha, Exp);
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
-//
-//	/** Interpolate between A and B, applying an ease in/out function.  Exp controls the degree of the curve. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpEaseInOut(const T& A, const T& B, float Alpha, float Exp)
-//	{
-//		return Lerp<T>(A, B, (Alpha < 0.5f) ?
-//			InterpEaseIn(0.f, 1.f, Alpha * 2.f, Exp) * 0.5f :
-//			InterpEaseOut(0.f, 1.f, Alpha * 2.f - 1.f, Exp) * 0.5f + 0.5f);
-//	}
-//
-//	/** Interpolation between A and B, applying a step function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpStep(const T& A, const T& B, float Alpha, int32_t Steps)
-//	{
-//		if (Steps <= 1 || Alpha <= 0)
-//		{
-//			return A;
-//		}
-//		else if (Alpha >= 1)
-//		{
-//			return B;
-//		}
-//
-//		const float StepsAsFloat = static_cast<float>(Steps);
-//		const float NumIntervals = StepsAsFloat - 1.f;
-//		float const ModifiedAlpha = FloorToFloat(Alpha * StepsAsFloat) / NumIntervals;
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
-//
-//	/** Interpolation between A and B, applying a sinusoidal in function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpSinIn(const T& A, const T& B, float Alpha)
-//	{
-//		float const ModifiedAlpha = -1.f * Cos(Alpha * HALF_PI) + 1.f;
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
-//
-//	/** Interpolation between A and B, applying a sinusoidal out function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpSinOut(const T& A, const T& B, float Alpha)
-//	{
-//		float const ModifiedAlpha = Sin(Alpha * HALF_PI);
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
-//
-//	/** Interpolation between A and B, applying a sinusoidal in/out function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpSinInOut(const T& A, const T& B, float Alpha)
-//	{
-//		return Lerp<T>(A, B, (Alpha < 0.5f) ?
-//			InterpSinIn(0.f, 1.f, Alpha * 2.f) * 0.5f :
-//			InterpSinOut(0.f, 1.f, Alpha * 2.f - 1.f) * 0.5f + 0.5f);
-//	}
-//
-//	/** Interpolation between A and B, applying an exponential in function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpExpoIn(const T& A, const T& B, float Alpha)
-//	{
-//		float const ModifiedAlpha = (Alpha == 0.f) ? 0.f : Pow(2.f, 10.f * (Alpha - 1.f));
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
+	/** Converts given Cartesian coordinate pair to Polar coordinate system. */
+	static  void CartesianToPolar(const float X, const float Y, float& OutRad, float& OutAng)
+	{
+		OutRad = Sqrt(Square(X) + Square(Y));
+		OutAng = Atan2(Y, X);
+	}
+	/** Converts given Cartesian coordinate pair to Polar coordinate system. */
+	static  void CartesianToPolar(const MVector2D InCart, MVector2D& OutPolar);
+
+	/** Converts given Polar coordinate pair to Cartesian coordinate system. */
+	static  void PolarToCartesian(const float Rad, const float Ang, float& OutX, float& OutY)
+	{
+		OutX = Rad * Cos(Ang);
+		OutY = Rad * Sin(Ang);
+	}
+	/** Converts given Polar coordinate pair to Cartesian coordinate system. */
+	static  void PolarToCartesian(const MVector2D InPolar, MVector2D& OutCart);
+
+	/**
+	 * Calculates the dotted distance of vector 'Direction' to coordinate system O(AxisX,AxisY,AxisZ).
+	 *
+	 * Orientation: (consider 'O' the first person view of the player, and 'Direction' a vector pointing to an enemy)
+	 * - positive azimuth means enemy is on the right of crosshair. (negative means left).
+	 * - positive elevation means enemy is on top of crosshair, negative means below.
+	 *
+	 * @Note: 'Azimuth' (.X) sign is changed to represent left/right and not front/behind. front/behind is the funtion's return value.
+	 *
+	 * @param	OutDotDist	.X = 'Direction' dot AxisX relative to plane (AxisX,AxisZ). (== Cos(Azimuth))
+	 *						.Y = 'Direction' dot AxisX relative to plane (AxisX,AxisY). (== Sin(Elevation))
+	 * @param	Direction	direction of target.
+	 * @param	AxisX		X component of reference system.
+	 * @param	AxisY		Y component of reference system.
+	 * @param	AxisZ		Z component of reference system.
+	 *
+	 * @return	true if 'Direction' is facing AxisX (Direction dot AxisX >= 0.f)
+	 */
+	static bool GetDotDistance(MVector2D& OutDotDist, const MVector& Direction, const MVector& AxisX, const MVector& AxisY, const MVector& AxisZ);
+
+	/**
+	 * Returns Azimuth and Elevation of vector 'Direction' in coordinate system O(AxisX,AxisY,AxisZ).
+	 *
+	 * Orientation: (consider 'O' the first person view of the player, and 'Direction' a vector pointing to an enemy)
+	 * - positive azimuth means enemy is on the right of crosshair. (negative means left).
+	 * - positive elevation means enemy is on top of crosshair, negative means below.
+	 *
+	 * @param	Direction		Direction of target.
+	 * @param	AxisX			X component of reference system.
+	 * @param	AxisY			Y component of reference system.
+	 * @param	AxisZ			Z component of reference system.
+	 *
+	 * @return	MVector2D	X = Azimuth angle (in radians) (-PI, +PI)
+	 *						Y = Elevation angle (in radians) (-PI/2, +PI/2)
+	 */
+	static MVector2D GetAzimuthAndElevation(const MVector& Direction, const MVector& AxisX, const MVector& AxisY, const MVector& AxisZ);
 //
-//	/** Interpolation between A and B, applying an exponential out function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpExpoOut(const T& A, const T& B, float Alpha)
-//	{
-//		float const ModifiedAlpha = (Alpha == 1.f) ? 1.f : -Pow(2.f, -10.f * Alpha) + 1.f;
-//		return Lerp<T>(A, B, ModifiedAlpha);
-//	}
+	// Interpolation Functions
+
+	/** Calculates the percentage along a line from MinValue to MaxValue that Value is. */
+	template<typename T>
+	static  typename std::enable_if<std::is_floating_point<T>::value, T>::type GetRangePct(T MinValue, T MaxValue, T Value)
+	{
+		// Avoid Divide by Zero.
+		// But also if our range is a point, output whether Value is before or after.
+		const T Divisor = MaxValue - MinValue;
+		if (FMath::IsNearlyZero(Divisor))
+		{
+			return (Value >= MaxValue) ? (T)1 : (T)0;
+		}
+
+		return (Value - MinValue) / Divisor;
+	}
+
+	/** Same as above, but taking a 2d vector as the range. */
+	static float GetRangePct(MVector2D const& Range, float Value);
+
+	/** Basically a Vector2d version of Lerp. */
+	static float GetRangeValue(MVector2D const& Range, float Pct);
+
+	/** For the given Value clamped to the [Input:Range] inclusive, returns the corresponding percentage in [Output:Range] Inclusive. */
+	static  float GetMappedRangeValueClamped(const MVector2D& InputRange, const MVector2D& OutputRange, const float Value)
+	{
+		const float ClampedPct = Clamp<float>(GetRangePct(InputRange, Value), 0.f, 1.f);
+		return GetRangeValue(OutputRange, ClampedPct);
+	}
+
+	/** Transform the given Value relative to the input range to the Output Range. */
+	static  float GetMappedRangeValueUnclamped(const MVector2D& InputRange, const MVector2D& OutputRange, const float Value)
+	{
+		return GetRangeValue(OutputRange, GetRangePct(InputRange, Value));
+	}
 //
-//	/** Interpolation between A and B, applying an exponential in/out function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpExpoInOut(const T& A, const T& B, float Alpha)
+//	template<class T>
+//	static  double GetRangePct(TRange<T> const& Range, T Value)
 //	{
-//		return Lerp<T>(A, B, (Alpha < 0.5f) ?
-//			InterpExpoIn(0.f, 1.f, Alpha * 2.f) * 0.5f :
-//			InterpExpoOut(0.f, 1.f, Alpha * 2.f - 1.f) * 0.5f + 0.5f);
+//		return GetRangePct(Range.GetLowerBoundValue(), Range.GetUpperBoundValue(), Value);
 //	}
 //
-//	/** Interpolation between A and B, applying a circular in function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpCircularIn(const T& A, const T& B, float Alpha)
+//	template<class T>
+//	static  T GetRangeValue(TRange<T> const& Range, T Pct)
 //	{
-//		float const ModifiedAlpha = -1.f * (Sqrt(1.f - Alpha * Alpha) - 1.f);
-//		return Lerp<T>(A, B, ModifiedAlpha);
+//		return FMath::Lerp<T>(Range.GetLowerBoundValue(), Range.GetUpperBoundValue(), Pct);
 //	}
 //
-//	/** Interpolation between A and B, applying a circular out function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpCircularOut(const T& A, const T& B, float Alpha)
+//	template<class T>
+//	static  T GetMappedRangeValueClamped(const TRange<T>& InputRange, const TRange<T>& OutputRange, const T Value)
 //	{
-//		Alpha -= 1.f;
-//		float const ModifiedAlpha = Sqrt(1.f - Alpha * Alpha);
-//		return Lerp<T>(A, B, ModifiedAlpha);
+//		const T ClampedPct = FMath::Clamp<T>(GetRangePct(InputRange, Value), 0, 1);
+//		return GetRangeValue(OutputRange, ClampedPct);
 //	}
 //
-//	/** Interpolation between A and B, applying a circular in/out function. */
-//	template< class T >
-//	static _DEBUGGABLE T InterpCircularInOut(const T& A, const T& B, float Alpha)
-//	{
-//		return Lerp<T>(A, B, (Alpha < 0.5f) ?
-//			InterpCircularIn(0.f, 1.f, Alpha * 2.f) * 0.5f :
-//			InterpCircularOut(0.f, 1.f, Alpha * 2.f - 1.f) * 0.5f + 0.5f);
-//	}
+	/** Performs a linear interpolation between two values, Alpha ranges from 0-1 */
+	template< class T, class U >
+	static T Lerp(const T& A, const T& B, const U& Alpha)
+	{
+		return (T)(A + Alpha * (B - A));
+	}
+
+	/** Performs a linear interpolation between two values, Alpha ranges from 0-1. Handles full numeric range of T */
+	template< class T >
+	static T LerpStable(const T& A, const T& B, double Alpha)
+	{
+		return (T)((A * (1.0 - Alpha)) + (B * Alpha));
+	}
+
+	/** Performs a linear interpolation between two values, Alpha ranges from 0-1. Handles full numeric range of T */
+	template< class T >
+	static T LerpStable(const T& A, const T& B, float Alpha)
+	{
+		return (T)((A * (1.0f - Alpha)) + (B * Alpha));
+	}
+
+	/** Performs a 2D linear interpolation between four values values, FracX, FracY ranges from 0-1 */
+	template< class T, class U >
+	static T BiLerp(const T& P00, const T& P10, const T& P01, const T& P11, const U& FracX, const U& FracY)
+	{
+		return Lerp(
+			Lerp(P00, P10, FracX),
+			Lerp(P01, P11, FracX),
+			FracY
+		);
+	}
+
+	/**
+	 * Performs a cubic interpolation
+	 *
+	 * @param  P - end points
+	 * @param  T - tangent directions at end points
+	 * @param  Alpha - distance along spline
+	 *
+	 * @return  Interpolated value
+	 */
+	template< class T, class U >
+	static T CubicInterp(const T& P0, const T& T0, const T& P1, const T& T1, const U& A)
+	{
+		const float A2 = A * A;
+		const float A3 = A2 * A;
+
+		return (T)(((2 * A3) - (3 * A2) + 1) * P0) + ((A3 - (2 * A2) + A) * T0) + ((A3 - A2) * T1) + (((-2 * A3) + (3 * A2)) * P1);
+	}
+
+	/**
+	 * Performs a first derivative cubic interpolation
+	 *
+	 * @param  P - end points
+	 * @param  T - tangent directions at end points
+	 * @param  Alpha - distance along spline
+	 *
+	 * @return  Interpolated value
+	 */
+	template< class T, class U >
+	static T CubicInterpDerivative(const T& P0, const T& T0, const T& P1, const T& T1, const U& A)
+	{
+		T a = 6.f * P0 + 3.f * T0 + 3.f * T1 - 6.f * P1;
+		T b = -6.f * P0 - 4.f * T0 - 2.f * T1 + 6.f * P1;
+		T c = T0;
+
+		const float A2 = A * A;
+
+		return (a * A2) + (b * A) + c;
+	}
+
+	/**
+	 * Performs a second derivative cubic interpolation
+	 *
+	 * @param  P - end points
+	 * @param  T - tangent directions at end points
+	 * @param  Alpha - distance along spline
+	 *
+	 * @return  Interpolated value
+	 */
+	template< class T, class U >
+	static T CubicInterpSecondDerivative(const T& P0, const T& T0, const T& P1, const T& T1, const U& A)
+	{
+		T a = 12.f * P0 + 6.f * T0 + 6.f * T1 - 12.f * P1;
+		T b = -6.f * P0 - 4.f * T0 - 2.f * T1 + 6.f * P1;
+
+		return (a * A) + b;
+	}
+
+	/** Interpolate between A and B, applying an ease in function.  Exp controls the degree of the curve. */
+	template< class T >
+	static T InterpEaseIn(const T& A, const T& B, float Alpha, float Exp)
+	{
+		float const ModifiedAlpha = Pow(Alpha, Exp);
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolate between A and B, applying an ease out function.  Exp controls the degree of the curve. */
+	template< class T >
+	static T InterpEaseOut(const T& A, const T& B, float Alpha, float Exp)
+	{
+		float const ModifiedAlpha = 1.f - Pow(1.f - Alpha, Exp);
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolate between A and B, applying an ease in/out function.  Exp controls the degree of the curve. */
+	template< class T >
+	static T InterpEaseInOut(const T& A, const T& B, float Alpha, float Exp)
+	{
+		return Lerp<T>(A, B, (Alpha < 0.5f) ?
+			InterpEaseIn(0.f, 1.f, Alpha * 2.f, Exp) * 0.5f :
+			InterpEaseOut(0.f, 1.f, Alpha * 2.f - 1.f, Exp) * 0.5f + 0.5f);
+	}
+
+	/** Interpolation between A and B, applying a step function. */
+	template< class T >
+	static T InterpStep(const T& A, const T& B, float Alpha, int32_t Steps)
+	{
+		if (Steps <= 1 || Alpha <= 0)
+		{
+			return A;
+		}
+		else if (Alpha >= 1)
+		{
+			return B;
+		}
+
+		const float StepsAsFloat = static_cast<float>(Steps);
+		const float NumIntervals = StepsAsFloat - 1.f;
+		float const ModifiedAlpha = FloorToFloat(Alpha * StepsAsFloat) / NumIntervals;
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying a sinusoidal in function. */
+	template< class T >
+	static T InterpSinIn(const T& A, const T& B, float Alpha)
+	{
+		float const ModifiedAlpha = -1.f * Cos(Alpha * HALF_PI) + 1.f;
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying a sinusoidal out function. */
+	template< class T >
+	static T InterpSinOut(const T& A, const T& B, float Alpha)
+	{
+		float const ModifiedAlpha = Sin(Alpha * HALF_PI);
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying a sinusoidal in/out function. */
+	template< class T >
+	static T InterpSinInOut(const T& A, const T& B, float Alpha)
+	{
+		return Lerp<T>(A, B, (Alpha < 0.5f) ?
+			InterpSinIn(0.f, 1.f, Alpha * 2.f) * 0.5f :
+			InterpSinOut(0.f, 1.f, Alpha * 2.f - 1.f) * 0.5f + 0.5f);
+	}
+
+	/** Interpolation between A and B, applying an exponential in function. */
+	template< class T >
+	static T InterpExpoIn(const T& A, const T& B, float Alpha)
+	{
+		float const ModifiedAlpha = (Alpha == 0.f) ? 0.f : Pow(2.f, 10.f * (Alpha - 1.f));
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying an exponential out function. */
+	template< class T >
+	static T InterpExpoOut(const T& A, const T& B, float Alpha)
+	{
+		float const ModifiedAlpha = (Alpha == 1.f) ? 1.f : -Pow(2.f, -10.f * Alpha) + 1.f;
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying an exponential in/out function. */
+	template< class T >
+	static T InterpExpoInOut(const T& A, const T& B, float Alpha)
+	{
+		return Lerp<T>(A, B, (Alpha < 0.5f) ?
+			InterpExpoIn(0.f, 1.f, Alpha * 2.f) * 0.5f :
+			InterpExpoOut(0.f, 1.f, Alpha * 2.f - 1.f) * 0.5f + 0.5f);
+	}
+
+	/** Interpolation between A and B, applying a circular in function. */
+	template< class T >
+	static T InterpCircularIn(const T& A, const T& B, float Alpha)
+	{
+		float const ModifiedAlpha = -1.f * (Sqrt(1.f - Alpha * Alpha) - 1.f);
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying a circular out function. */
+	template< class T >
+	static T InterpCircularOut(const T& A, const T& B, float Alpha)
+	{
+		Alpha -= 1.f;
+		float const ModifiedAlpha = Sqrt(1.f - Alpha * Alpha);
+		return Lerp<T>(A, B, ModifiedAlpha);
+	}
+
+	/** Interpolation between A and B, applying a circular in/out function. */
+	template< class T >
+	static T InterpCircularInOut(const T& A, const T& B, float Alpha)
+	{
+		return Lerp<T>(A, B, (Alpha < 0.5f) ?
+			InterpCircularIn(0.f, 1.f, Alpha * 2.f) * 0.5f :
+			InterpCircularOut(0.f, 1.f, Alpha * 2.f - 1.f) * 0.5f + 0.5f);
+	}
 //
 //	// Rotator specific interpolation
 //	template< class U > static FRotator Lerp(const FRotator& A, const FRotator& B, const U& Alpha);
@@ -1527,84 +1626,90 @@ private:
 //	 */
 //	template< class U > static FQuat CubicInterp(const FQuat& P0, const FQuat& T0, const FQuat& P1, const FQuat& T1, const U& A);
 //
-//	/*
-//	 *	Cubic Catmull-Rom Spline interpolation. Based on http://www.cemyuksel.com/research/catmullrom_param/catmullrom.pdf
-//	 *	Curves are guaranteed to pass through the control points and are easily chained together.
-//	 *	Equation supports abitrary parameterization. eg. Uniform=0,1,2,3 ; chordal= |Pn - Pn-1| ; centripetal = |Pn - Pn-1|^0.5
-//	 *	P0 - The control point preceding the interpolation range.
-//	 *	P1 - The control point starting the interpolation range.
-//	 *	P2 - The control point ending the interpolation range.
-//	 *	P3 - The control point following the interpolation range.
-//	 *	T0-3 - The interpolation parameters for the corresponding control points.
-//	 *	T - The interpolation factor in the range 0 to 1. 0 returns P1. 1 returns P2.
-//	 */
-//	template< class U >
-//	static _DEBUGGABLE U CubicCRSplineInterp(const U& P0, const U& P1, const U& P2, const U& P3, const float T0, const float T1, const float T2, const float T3, const float T)
-//	{
-//		//Based on http://www.cemyuksel.com/research/catmullrom_param/catmullrom.pdf 
-//		float InvT1MinusT0 = 1.0f / (T1 - T0);
-//		U L01 = (P0 * ((T1 - T) * InvT1MinusT0)) + (P1 * ((T - T0) * InvT1MinusT0));
-//		float InvT2MinusT1 = 1.0f / (T2 - T1);
-//		U L12 = (P1 * ((T2 - T) * InvT2MinusT1)) + (P2 * ((T - T1) * InvT2MinusT1));
-//		float InvT3MinusT2 = 1.0f / (T3 - T2);
-//		U L23 = (P2 * ((T3 - T) * InvT3MinusT2)) + (P3 * ((T - T2) * InvT3MinusT2));
-//
-//		float InvT2MinusT0 = 1.0f / (T2 - T0);
-//		U L012 = (L01 * ((T2 - T) * InvT2MinusT0)) + (L12 * ((T - T0) * InvT2MinusT0));
-//		float InvT3MinusT1 = 1.0f / (T3 - T1);
-//		U L123 = (L12 * ((T3 - T) * InvT3MinusT1)) + (L23 * ((T - T1) * InvT3MinusT1));
-//
-//		return  ((L012 * ((T2 - T) * InvT2MinusT1)) + (L123 * ((T - T1) * InvT2MinusT1)));
-//	}
-//
-//	/* Same as CubicCRSplineInterp but with additional saftey checks. If the checks fail P1 is returned. **/
-//	template< class U >
-//	static _DEBUGGABLE U CubicCRSplineInterpSafe(const U& P0, const U& P1, const U& P2, const U& P3, const float T0, const float T1, const float T2, const float T3, const float T)
-//	{
-//		//Based on http://www.cemyuksel.com/research/catmullrom_param/catmullrom.pdf 
-//		float T1MinusT0 = (T1 - T0);
-//		float T2MinusT1 = (T2 - T1);
-//		float T3MinusT2 = (T3 - T2);
-//		float T2MinusT0 = (T2 - T0);
-//		float T3MinusT1 = (T3 - T1);
-//		if (FMath::IsNearlyZero(T1MinusT0) || FMath::IsNearlyZero(T2MinusT1) || FMath::IsNearlyZero(T3MinusT2) || FMath::IsNearlyZero(T2MinusT0) || FMath::IsNearlyZero(T3MinusT1))
-//		{
-//			//There's going to be a divide by zero here so just bail out and return P1
-//			return P1;
-//		}
-//
-//		float InvT1MinusT0 = 1.0f / T1MinusT0;
-//		U L01 = (P0 * ((T1 - T) * InvT1MinusT0)) + (P1 * ((T - T0) * InvT1MinusT0));
-//		float InvT2MinusT1 = 1.0f / T2MinusT1;
-//		U L12 = (P1 * ((T2 - T) * InvT2MinusT1)) + (P2 * ((T - T1) * InvT2MinusT1));
-//		float InvT3MinusT2 = 1.0f / T3MinusT2;
-//		U L23 = (P2 * ((T3 - T) * InvT3MinusT2)) + (P3 * ((T - T2) * InvT3MinusT2));
-//
-//		float InvT2MinusT0 = 1.0f / T2MinusT0;
-//		U L012 = (L01 * ((T2 - T) * InvT2MinusT0)) + (L12 * ((T - T0) * InvT2MinusT0));
-//		float InvT3MinusT1 = 1.0f / T3MinusT1;
-//		U L123 = (L12 * ((T3 - T) * InvT3MinusT1)) + (L23 * ((T - T1) * InvT3MinusT1));
-//
-//		return  ((L012 * ((T2 - T) * InvT2MinusT1)) + (L123 * ((T - T1) * InvT2MinusT1)));
-//	}
-//
+	/*
+	 *	Cubic Catmull-Rom Spline interpolation. Based on http://www.cemyuksel.com/research/catmullrom_param/catmullrom.pdf
+	 *	Curves are guaranteed to pass through the control points and are easily chained together.
+	 *	Equation supports abitrary parameterization. eg. Uniform=0,1,2,3 ; chordal= |Pn - Pn-1| ; centripetal = |Pn - Pn-1|^0.5
+	 *	P0 - The control point preceding the interpolation range.
+	 *	P1 - The control point starting the interpolation range.
+	 *	P2 - The control point ending the interpolation range.
+	 *	P3 - The control point following the interpolation range.
+	 *	T0-3 - The interpolation parameters for the corresponding control points.
+	 *	T - The interpolation factor in the range 0 to 1. 0 returns P1. 1 returns P2.
+	 */
+	template< class U >
+	static U CubicCRSplineInterp(const U& P0, const U& P1, const U& P2, const U& P3, const float T0, const float T1, const float T2, const float T3, const float T)
+	{
+		//Based on http://www.cemyuksel.com/research/catmullrom_param/catmullrom.pdf 
+		float InvT1MinusT0 = 1.0f / (T1 - T0);
+		U L01 = (P0 * ((T1 - T) * InvT1MinusT0)) + (P1 * ((T - T0) * InvT1MinusT0));
+		float InvT2MinusT1 = 1.0f / (T2 - T1);
+		U L12 = (P1 * ((T2 - T) * InvT2MinusT1)) + (P2 * ((T - T1) * InvT2MinusT1));
+		float InvT3MinusT2 = 1.0f / (T3 - T2);
+		U L23 = (P2 * ((T3 - T) * InvT3MinusT2)) + (P3 * ((T - T2) * InvT3MinusT2));
+
+		float InvT2MinusT0 = 1.0f / (T2 - T0);
+		U L012 = (L01 * ((T2 - T) * InvT2MinusT0)) + (L12 * ((T - T0) * InvT2MinusT0));
+		float InvT3MinusT1 = 1.0f / (T3 - T1);
+		U L123 = (L12 * ((T3 - T) * InvT3MinusT1)) + (L23 * ((T - T1) * InvT3MinusT1));
+
+		return  ((L012 * ((T2 - T) * InvT2MinusT1)) + (L123 * ((T - T1) * InvT2MinusT1)));
+	}
+
+	/* Same as CubicCRSplineInterp but with additional saftey checks. If the checks fail P1 is returned. **/
+	template< class U >
+	static U CubicCRSplineInterpSafe(const U& P0, const U& P1, const U& P2, const U& P3, const float T0, const float T1, const float T2, const float T3, const float T)
+	{
+		//Based on http://www.cemyuksel.com/research/catmullrom_param/catmullrom.pdf 
+		float T1MinusT0 = (T1 - T0);
+		float T2MinusT1 = (T2 - T1);
+		float T3MinusT2 = (T3 - T2);
+		float T2MinusT0 = (T2 - T0);
+		float T3MinusT1 = (T3 - T1);
+		if (FMath::IsNearlyZero(T1MinusT0) || FMath::IsNearlyZero(T2MinusT1) || FMath::IsNearlyZero(T3MinusT2) || FMath::IsNearlyZero(T2MinusT0) || FMath::IsNearlyZero(T3MinusT1))
+		{
+			//There's going to be a divide by zero here so just bail out and return P1
+			return P1;
+		}
+
+		float InvT1MinusT0 = 1.0f / T1MinusT0;
+		U L01 = (P0 * ((T1 - T) * InvT1MinusT0)) + (P1 * ((T - T0) * InvT1MinusT0));
+		float InvT2MinusT1 = 1.0f / T2MinusT1;
+		U L12 = (P1 * ((T2 - T) * InvT2MinusT1)) + (P2 * ((T - T1) * InvT2MinusT1));
+		float InvT3MinusT2 = 1.0f / T3MinusT2;
+		U L23 = (P2 * ((T3 - T) * InvT3MinusT2)) + (P3 * ((T - T2) * InvT3MinusT2));
+
+		float InvT2MinusT0 = 1.0f / T2MinusT0;
+		U L012 = (L01 * ((T2 - T) * InvT2MinusT0)) + (L12 * ((T - T0) * InvT2MinusT0));
+		float InvT3MinusT1 = 1.0f / T3MinusT1;
+		U L123 = (L12 * ((T3 - T) * InvT3MinusT1)) + (L23 * ((T - T1) * InvT3MinusT1));
+
+		return  ((L012 * ((T2 - T) * InvT2MinusT1)) + (L123 * ((T - T1) * InvT2MinusT1)));
+	}
+
 //
 //	// Special-case interpolation
 //
 //	/** Interpolate a normal vector Current to Target, by interpolating the angle between those vectors with constant step. */
 //	static CORE_API MVector VInterpNormalRotationTo(const MVector& Current, const MVector& Target, float DeltaTime, float RotationSpeedDegrees);
 //
-//	/** Interpolate vector from Current to Target with constant step */
-//	static CORE_API MVector VInterpConstantTo(const MVector& Current, const MVector& Target, float DeltaTime, float InterpSpeed);
-//
-//	/** Interpolate vector from Current to Target. Scaled by distance to Target, so it has a strong start speed and ease out. */
-//	static CORE_API MVector VInterpTo(const MVector& Current, const MVector& Target, float DeltaTime, float InterpSpeed);
-//
-//	/** Interpolate vector2D from Current to Target with constant step */
-//	static CORE_API MVector2D Vector2DInterpConstantTo(const MVector2D& Current, const MVector2D& Target, float DeltaTime, float InterpSpeed);
-//
-//	/** Interpolate vector2D from Current to Target. Scaled by distance to Target, so it has a strong start speed and ease out. */
-//	static CORE_API MVector2D Vector2DInterpTo(const MVector2D& Current, const MVector2D& Target, float DeltaTime, float InterpSpeed);
+	/** Interpolate vector from Current to Target with constant step */
+	static MVector VInterpConstantTo(const MVector& Current, const MVector& Target, float DeltaTime, float InterpSpeed);
+
+	/** Interpolate vector from Current to Target. Scaled by distance to Target, so it has a strong start speed and ease out. */
+	static MVector VInterpTo(const MVector& Current, const MVector& Target, float DeltaTime, float InterpSpeed);
+
+	/** VInterpTo for MVectorWide::Lanes vectors at once. */
+	static MVectorWide VInterpTo(const MVectorWide& Current, const MVectorWide& Target, float DeltaTime, float InterpSpeed);
+
+	/** Applies VInterpTo to NumVectors vectors in place. */
+	static void VInterpTo(MVector* Current, const MVector* Target, int32_t NumVectors, float DeltaTime, float InterpSpeed);
+
+	/** Interpolate vector2D from Current to Target with constant step */
+	static MVector2D Vector2DInterpConstantTo(const MVector2D& Current, const MVector2D& Target, float DeltaTime, float InterpSpeed);
+
+	/** Interpolate vector2D from Current to Target. Scaled by distance to Target, so it has a strong start speed and ease out. */
+	static MVector2D Vector2DInterpTo(const MVector2D& Current, const MVector2D& Target, float DeltaTime, float InterpSpeed);
 //
 //	/** Interpolate rotator from Current to Target with constant step */
 //	static CORE_API FRotator RInterpConstantTo(const FRotator& Current, const FRotator& Target, float DeltaTime, float InterpSpeed);
@@ -1655,19 +1760,22 @@ private:
 //	 */
 //	static MVector RayPlaneIntersection(const MVector& RayOrigin, const MVector& RayDirection, const FPlane& Plane);
 //
-//	/**
-//	 * Find the intersection of a line and an offset plane. Assumes that the
-//	 * line and plane do indeed intersect; you must make sure they're not
-//	 * parallel before calling.
-//	 *
-//	 * @param Point1 the first point defining the line
-//	 * @param Point2 the second point defining the line
-//	 * @param PlaneOrigin the origin of the plane
-//	 * @param PlaneNormal the normal of the plane
-//	 *
-//	 * @return The point of intersection between the line and the plane.
-//	 */
-//	static MVector LinePlaneIntersection(const MVector& Point1, const MVector& Point2, const MVector& PlaneOrigin, const MVector& PlaneNormal);
+	/**
+	 * Find the intersection of a line and an offset plane. Assumes that the
+	 * line and plane do indeed intersect; you must make sure they're not
+	 * parallel before calling.
+	 *
+	 * @param Point1 the first point defining the line
+	 * @param Point2 the second point defining the line
+	 * @param PlaneOrigin the origin of the plane
+	 * @param PlaneNormal the normal of the plane
+	 *
+	 * @return The point of intersection between the line and the plane.
+	 */
+	static MVector LinePlaneIntersection(const MVector& Point1, const MVector& Point2, const MVector& PlaneOrigin, const MVector& PlaneNormal);
+
+	/** LinePlaneIntersection for MVectorWide::Lanes lines at once. */
+	static MVectorWide LinePlaneIntersection(const MVectorWide& Point1, const MVectorWide& Point2, const MVectorWide& PlaneOrigin, const MVectorWide& PlaneNormal);
 //
 //	/**
 //	 * Find the intersection of a line and a plane. Assumes that the line and
@@ -1695,166 +1803,178 @@ private:
 //	// @return Minimal bounding sphere encompassing given cone
 //	static FSphere ComputeBoundingSphereForCone(MVector const& ConeOrigin, MVector const& ConeDirection, float ConeRadius, float CosConeAngle, float SinConeAngle);
 //
-//	/**
-//	 * Determine if a plane and an AABB intersect
-//	 * @param P - the plane to test
-//	 * @param AABB - the axis aligned bounding box to test
-//	 * @return if collision occurs
-//	 */
-//	static CORE_API bool PlaneAABBIntersection(const FPlane& P, const FBox& AABB);
-//
-//	/**
-//	 * Determine the position of an AABB relative to a plane:
-//	 * completely above (in the direction of the normal of the plane), completely below or intersects it
-//	 * @param P - the plane to test
-//	 * @param AABB - the axis aligned bounding box to test
-//	 * @return -1 if below, 1 if above, 0 if intersects
-//	 */
-//	static CORE_API int32_t PlaneAABBRelativePosition(const FPlane& P, const FBox& AABB);
-//
-//	/**
-//	 * Performs a sphere vs box intersection test using Arvo's algorithm:
-//	 *
-//	 *	for each i in (x, y, z)
-//	 *		if (SphereCenter(i) < BoxMin(i)) d2 += (SphereCenter(i) - BoxMin(i)) ^ 2
-//	 *		else if (SphereCenter(i) > BoxMax(i)) d2 += (SphereCenter(i) - BoxMax(i)) ^ 2
-//	 *
-//	 * @param Sphere the center of the sphere being tested against the AABB
-//	 * @param RadiusSquared the size of the sphere being tested
-//	 * @param AABB the box being tested against
-//	 *
-//	 * @return Whether the sphere/box intersect or not.
-//	 */
-//	static bool SphereAABBIntersection(const MVector& SphereCenter, const float RadiusSquared, const FBox& AABB);
-//
-//	/**
-//	 * Converts a sphere into a point plus radius squared for the test above
-//	 */
-//	static bool SphereAABBIntersection(const FSphere& Sphere, const FBox& AABB);
-//
-//	/** Determines whether a point is inside a box. */
-//	static bool PointBoxIntersection(const MVector& Point, const FBox& Box);
-//
-//	/** Determines whether a line intersects a box. */
-//	static bool LineBoxIntersection(const FBox& Box, const MVector& Start, const MVector& End, const MVector& Direction);
-//
-//	/** Determines whether a line intersects a box. This overload avoids the need to do the reciprocal every time. */
-//	static bool LineBoxIntersection(const FBox& Box, const MVector& Start, const MVector& End, const MVector& Direction, const MVector& OneOverDirection);
-//
+	/**
+	 * Determine if a plane and an AABB intersect
+	 * @param P - the plane to test
+	 * @param AABB - the axis aligned bounding box to test
+	 * @return if collision occurs
+	 */
+	static bool PlaneAABBIntersection(const FPlane& P, const FBox& AABB);
+
+	/**
+	 * Determine the position of an AABB relative to a plane:
+	 * completely above (in the direction of the normal of the plane), completely below or intersects it
+	 * @param P - the plane to test
+	 * @param AABB - the axis aligned bounding box to test
+	 * @return -1 if below, 1 if above, 0 if intersects
+	 */
+	static int32_t PlaneAABBRelativePosition(const FPlane& P, const FBox& AABB);
+
+	/**
+	 * Performs a sphere vs box intersection test using Arvo's algorithm:
+	 *
+	 *	for each i in (x, y, z)
+	 *		if (SphereCenter(i) < BoxMin(i)) d2 += (SphereCenter(i) - BoxMin(i)) ^ 2
+	 *		else if (SphereCenter(i) > BoxMax(i)) d2 += (SphereCenter(i) - BoxMax(i)) ^ 2
+	 *
+	 * @param Sphere the center of the sphere being tested against the AABB
+	 * @param RadiusSquared the size of the sphere being tested
+	 * @param AABB the box being tested against
+	 *
+	 * @return Whether the sphere/box intersect or not.
+	 */
+	static bool SphereAABBIntersection(const MVector& SphereCenter, const float RadiusSquared, const FBox& AABB);
+
+	/**
+	 * Converts a sphere into a point plus radius squared for the test above
+	 */
+	static bool SphereAABBIntersection(const FSphere& Sphere, const FBox& AABB);
+
+	/** Determines whether a point is inside a box. */
+	static bool PointBoxIntersection(const MVector& Point, const FBox& Box);
+
+	/** Determines whether a line intersects a box. */
+	static bool LineBoxIntersection(const FBox& Box, const MVector& Start, const MVector& End, const MVector& Direction);
+
+	/** Determines whether a line intersects a box. This overload avoids the need to do the reciprocal every time. */
+	static bool LineBoxIntersection(const FBox& Box, const MVector& Start, const MVector& End, const MVector& Direction, const MVector& OneOverDirection);
+
 //	/* Swept-Box vs Box test */
 //	static CORE_API bool LineExtentBoxIntersection(const FBox& inBox, const MVector& Start, const MVector& End, const MVector& Extent, MVector& HitLocation, MVector& HitNormal, float& HitTime);
 //
-//	/** Determines whether a line intersects a sphere. */
-//	static bool LineSphereIntersection(const MVector& Start, const MVector& Dir, float Length, const MVector& Origin, float Radius);
-//
-//	/**
-//	 * Assumes the cone tip is at 0,0,0 (means the SphereCenter is relative to the cone tip)
-//	 * @return true: cone and sphere do intersect, false otherwise
-//	 */
-//	static CORE_API bool SphereConeIntersection(const MVector& SphereCenter, float SphereRadius, const MVector& ConeAxis, float ConeAngleSin, float ConeAngleCos);
-//
-//	/** Find the point on the line segment from LineStart to LineEnd which is closest to Point */
-//	static CORE_API MVector ClosestPointOnLine(const MVector& LineStart, const MVector& LineEnd, const MVector& Point);
-//
-//	/** Find the point on the infinite line between two points (LineStart, LineEnd) which is closest to Point */
-//	static CORE_API MVector ClosestPointOnInfiniteLine(const MVector& LineStart, const MVector& LineEnd, const MVector& Point);
-//
-//	/** Compute intersection point of three planes. Return 1 if valid, 0 if infinite. */
-//	static bool IntersectPlanes3(MVector& I, const FPlane& P1, const FPlane& P2, const FPlane& P3);
-//
-//	/**
-//	 * Compute intersection point and direction of line joining two planes.
-//	 * Return 1 if valid, 0 if infinite.
-//	 */
-//	static bool IntersectPlanes2(MVector& I, MVector& D, const FPlane& P1, const FPlane& P2);
-//
-//	/**
-//	 * Calculates the distance of a given Point in world space to a given line,
-//	 * defined by the vector couple (Origin, Direction).
-//	 *
-//	 * @param	Point				Point to check distance to line
-//	 * @param	Direction			Vector indicating the direction of the line. Not required to be normalized.
-//	 * @param	Origin				Point of reference used to calculate distance
-//	 * @param	OutClosestPoint	optional point that represents the closest point projected onto Axis
-//	 *
-//	 * @return	distance of Point from line defined by (Origin, Direction)
-//	 */
-//	static CORE_API float PointDistToLine(const MVector& Point, const MVector& Direction, const MVector& Origin, MVector& OutClosestPoint);
-//	static CORE_API float PointDistToLine(const MVector& Point, const MVector& Direction, const MVector& Origin);
-//
-//	/**
-//	 * Returns closest point on a segment to a given point.
-//	 * The idea is to project point on line formed by segment.
-//	 * Then we see if the closest point on the line is outside of segment or inside.
-//	 *
-//	 * @param	Point			point for which we find the closest point on the segment
-//	 * @param	StartPoint		StartPoint of segment
-//	 * @param	EndPoint		EndPoint of segment
-//	 *
-//	 * @return	point on the segment defined by (StartPoint, EndPoint) that is closest to Point.
-//	 */
-//	static CORE_API MVector ClosestPointOnSegment(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint);
-//
-//	/**
-//	* MVector2D version of ClosestPointOnSegment.
-//	* Returns closest point on a segment to a given 2D point.
-//	* The idea is to project point on line formed by segment.
-//	* Then we see if the closest point on the line is outside of segment or inside.
-//	*
-//	* @param	Point			point for which we find the closest point on the segment
-//	* @param	StartPoint		StartPoint of segment
-//	* @param	EndPoint		EndPoint of segment
-//	*
-//	* @return	point on the segment defined by (StartPoint, EndPoint) that is closest to Point.
-//	*/
-//	static CORE_API MVector2D ClosestPointOnSegment2D(const MVector2D& Point, const MVector2D& StartPoint, const MVector2D& EndPoint);
-//
-//	/**
-//	 * Returns distance from a point to the closest point on a segment.
-//	 *
-//	 * @param	Point			point to check distance for
-//	 * @param	StartPoint		StartPoint of segment
-//	 * @param	EndPoint		EndPoint of segment
-//	 *
-//	 * @return	closest distance from Point to segment defined by (StartPoint, EndPoint).
-//	 */
-//	static CORE_API float PointDistToSegment(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint);
+	/** Determines whether a line intersects a sphere. */
+	static bool LineSphereIntersection(const MVector& Start, const MVector& Dir, float Length, const MVector& Origin, float Radius);
+
+	/**
+	 * Assumes the cone tip is at 0,0,0 (means the SphereCenter is relative to the cone tip)
+	 * @return true: cone and sphere do intersect, false otherwise
+	 */
+	static bool SphereConeIntersection(const MVector& SphereCenter, float SphereRadius, const MVector& ConeAxis, float ConeAngleSin, float ConeAngleCos);
+
+	/** Find the point on the line segment from LineStart to LineEnd which is closest to Point */
+	static MVector ClosestPointOnLine(const MVector& LineStart, const MVector& LineEnd, const MVector& Point);
+
+	/** Find the point on the infinite line between two points (LineStart, LineEnd) which is closest to Point */
+	static MVector ClosestPointOnInfiniteLine(const MVector& LineStart, const MVector& LineEnd, const MVector& Point);
 //
-//	/**
-//	 * Returns square of the distance from a point to the closest point on a segment.
-//	 *
-//	 * @param	Point			point to check distance for
-//	 * @param	StartPoint		StartPoint of segment
-//	 * @param	EndPoint		EndPoint of segment
-//	 *
-//	 * @return	square of the closest distance from Point to segment defined by (StartPoint, EndPoint).
-//	 */
-//	static CORE_API float PointDistToSegmentSquared(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint);
+//	/** Compute intersection point of three planes. Return 1 if valid, 0 if infinite. */
+//	static bool IntersectPlanes3(MVector& I, const FPlane& P1, const FPlane& P2, const FPlane& P3);
 //
 //	/**
-//	 * Find closest points between 2 segments.
-//	 *
-//	 * If either segment may have a length of 0, use SegmentDistToSegmentSafe instance.
-//	 *
-//	 * @param	(A1, B1)	defines the first segment.
-//	 * @param	(A2, B2)	defines the second segment.
-//	 * @param	OutP1		Closest point on segment 1 to segment 2.
-//	 * @param	OutP2		Closest point on segment 2 to segment 1.
+//	 * Compute intersection point and direction of line joining two planes.
+//	 * Return 1 if valid, 0 if infinite.
 //	 */
-//	static CORE_API void SegmentDistToSegment(MVector A1, MVector B1, MVector A2, MVector B2, MVector& OutP1, MVector& OutP2);
+//	static bool IntersectPlanes2(MVector& I, MVector& D, const FPlane& P1, const FPlane& P2);
 //
-//	/**
-//	 * Find closest points between 2 segments.
-//	 *
-//	 * This is the safe version, and will check both segments' lengths.
-//	 * Use this if either (or both) of the segments lengths may be 0.
-//	 *
-//	 * @param	(A1, B1)	defines the first segment.
-//	 * @param	(A2, B2)	defines the second segment.
-//	 * @param	OutP1		Closest point on segment 1 to segment 2.
-//	 * @param	OutP2		Closest point on segment 2 to segment 1.
-//	 */
-//	static CORE_API void SegmentDistToSegmentSafe(MVector A1, MVector B1, MVector A2, MVector B2, MVector& OutP1, MVector& OutP2);
+	/**
+	 * Calculates the distance of a given Point in world space to a given line,
+	 * defined by the vector couple (Origin, Direction).
+	 *
+	 * @param	Point				Point to check distance to line
+	 * @param	Direction			Vector indicating the direction of the line. Not required to be normalized.
+	 * @param	Origin				Point of reference used to calculate distance
+	 * @param	OutClosestPoint	optional point that represents the closest point projected onto Axis
+	 *
+	 * @return	distance of Point from line defined by (Origin, Direction)
+	 */
+	static float PointDistToLine(const MVector& Point, const MVector& Direction, const MVector& Origin, MVector& OutClosestPoint);
+	static float PointDistToLine(const MVector& Point, const MVector& Direction, const MVector& Origin);
+
+	/**
+	 * Returns closest point on a segment to a given point.
+	 * The idea is to project point on line formed by segment.
+	 * Then we see if the closest point on the line is outside of segment or inside.
+	 *
+	 * @param	Point			point for which we find the closest point on the segment
+	 * @param	StartPoint		StartPoint of segment
+	 * @param	EndPoint		EndPoint of segment
+	 *
+	 * @return	point on the segment defined by (StartPoint, EndPoint) that is closest to Point.
+	 */
+	static MVector ClosestPointOnSegment(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint);
+
+	/**
+	* MVector2D version of ClosestPointOnSegment.
+	* Returns closest point on a segment to a given 2D point.
+	* The idea is to project point on line formed by segment.
+	* Then we see if the closest point on the line is outside of segment or inside.
+	*
+	* @param	Point			point for which we find the closest point on the segment
+	* @param	StartPoint		StartPoint of segment
+	* @param	EndPoint		EndPoint of segment
+	*
+	* @return	point on the segment defined by (StartPoint, EndPoint) that is closest to Point.
+	*/
+	static MVector2D ClosestPointOnSegment2D(const MVector2D& Point, const MVector2D& StartPoint, const MVector2D& EndPoint);
+
+	/**
+	 * Returns distance from a point to the closest point on a segment.
+	 *
+	 * @param	Point			point to check distance for
+	 * @param	StartPoint		StartPoint of segment
+	 * @param	EndPoint		EndPoint of segment
+	 *
+	 * @return	closest distance from Point to segment defined by (StartPoint, EndPoint).
+	 */
+	static float PointDistToSegment(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint);
+
+	/**
+	 * Returns square of the distance from a point to the closest point on a segment.
+	 *
+	 * @param	Point			point to check distance for
+	 * @param	StartPoint		StartPoint of segment
+	 * @param	EndPoint		EndPoint of segment
+	 *
+	 * @return	square of the closest distance from Point to segment defined by (StartPoint, EndPoint).
+	 */
+	static float PointDistToSegmentSquared(const MVector& Point, const MVector& StartPoint, const MVector& EndPoint);
+
+	/** ClosestPointOnSegment for MVectorWide::Lanes points at once. */
+	static MVectorWide ClosestPointOnSegment(const MVectorWide& Point, const MVectorWide& StartPoint, const MVectorWide& EndPoint);
+
+	/** PointDistToSegmentSquared for MVectorWide::Lanes points at once. */
+	static FFloatWide PointDistToSegmentSquared(const MVectorWide& Point, const MVectorWide& StartPoint, const MVectorWide& EndPoint);
+
+	/** Finds the closest point on one segment for each of NumPoints points. */
+	static void ClosestPointOnSegment(const MVector* Points, int32_t NumPoints, const MVector& StartPoint, const MVector& EndPoint, MVector* OutClosestPoints);
+
+	/** Computes the squared distance to one segment for each of NumPoints points. */
+	static void PointDistToSegmentSquared(const MVector* Points, int32_t NumPoints, const MVector& StartPoint, const MVector& EndPoint, float* OutDistancesSquared);
+
+	/**
+	 * Find closest points between 2 segments.
+	 *
+	 * If either segment may have a length of 0, use SegmentDistToSegmentSafe instance.
+	 *
+	 * @param	(A1, B1)	defines the first segment.
+	 * @param	(A2, B2)	defines the second segment.
+	 * @param	OutP1		Closest point on segment 1 to segment 2.
+	 * @param	OutP2		Closest point on segment 2 to segment 1.
+	 */
+	static void SegmentDistToSegment(MVector A1, MVector B1, MVector A2, MVector B2, MVector& OutP1, MVector& OutP2);
+
+	/**
+	 * Find closest points between 2 segments.
+	 *
+	 * This is the safe version, and will check both segments' lengths.
+	 * Use this if either (or both) of the segments lengths may be 0.
+	 *
+	 * @param	(A1, B1)	defines the first segment.
+	 * @param	(A2, B2)	defines the second segment.
+	 * @param	OutP1		Closest point on segment 1 to segment 2.
+	 * @param	OutP2		Closest point on segment 2 to segment 1.
+	 */
+	static void SegmentDistToSegmentSafe(MVector A1, MVector B1, MVector A2, MVector B2, MVector& OutP1, MVector& OutP2);
 //
 //	/**
 //	 * returns the time (t) of the intersection of the passed segment and a plane (could be <0 or >1)
@@ -1877,42 +1997,49 @@ private:
 //	static CORE_API bool SegmentPlaneIntersection(const MVector& StartPoint, const MVector& EndPoint, const FPlane& Plane, MVector& out_IntersectionPoint);
 //
 //
-//	/**
-//	* Returns true if there is an intersection between the segment specified by StartPoint and Endpoint, and
-//	* the Triangle defined by A, B and C. If there is an intersection, the point is placed in out_IntersectionPoint
-//	* @param StartPoint - start point of segment
-//	* @param EndPoint   - end point of segment
-//	* @param A, B, C	- points defining the triangle
-//	* @param OutIntersectPoint - out var for the point on the segment that intersects the triangle (if any)
-//	* @param OutNormal - out var for the triangle normal
-//	* @return true if intersection occurred
-//	*/
-//	static CORE_API bool SegmentTriangleIntersection(const MVector& StartPoint, const MVector& EndPoint, const MVector& A, const MVector& B, const MVector& C, MVector& OutIntersectPoint, MVector& OutTriangleNormal);
-//
-//	/**
-//	 * Returns true if there is an intersection between the segment specified by SegmentStartA and SegmentEndA, and
-//	 * the segment specified by SegmentStartB and SegmentEndB, in 2D space. If there is an intersection, the point is placed in out_IntersectionPoint
-//	 * @param SegmentStartA - start point of first segment
-//	 * @param SegmentEndA   - end point of first segment
-//	 * @param SegmentStartB - start point of second segment
-//	 * @param SegmentEndB   - end point of second segment
-//	 * @param out_IntersectionPoint - out var for the intersection point (if any)
-//	 * @return true if intersection occurred
-//	 */
-//	static CORE_API bool SegmentIntersection2D(const MVector& SegmentStartA, const MVector& SegmentEndA, const MVector& SegmentStartB, const MVector& SegmentEndB, MVector& out_IntersectionPoint);
-//
-//
-//	/**
-//	 * Returns closest point on a triangle to a point.
-//	 * The idea is to identify the halfplanes that the point is
-//	 * in relative to each triangle segment "plane"
-//	 *
-//	 * @param	Point			point to check distance for
-//	 * @param	A,B,C			counter clockwise ordering of points defining a triangle
-//	 *
-//	 * @return	Point on triangle ABC closest to given point
-//	 */
-//	static CORE_API MVector ClosestPointOnTriangleToPoint(const MVector& Point, const MVector& A, const MVector& B, const MVector& C);
+	/**
+	* Returns true if there is an intersection between the segment specified by StartPoint and Endpoint, and
+	* the Triangle defined by A, B and C. If there is an intersection, the point is placed in out_IntersectionPoint
+	* @param StartPoint - start point of segment
+	* @param EndPoint   - end point of segment
+	* @param A, B, C	- points defining the triangle
+	* @param OutIntersectPoint - out var for the point on the segment that intersects the triangle (if any)
+	* @param OutNormal - out var for the triangle normal, unit length and facing (B - A) ^ (C - A)
+	* @return true if intersection occurred
+	*/
+	static bool SegmentTriangleIntersection(const MVector& StartPoint, const MVector& EndPoint, const MVector& A, const MVector& B, const MVector& C, MVector& OutIntersectPoint, MVector& OutTriangleNormal);
+
+	/**
+	* Segment/triangle test that only reports where along the segment the hit is (Moller-Trumbore).
+	* @param OutTime - out var for the hit position as a fraction of the segment, in [0, 1]
+	* @return true if intersection occurred, both faces of the triangle count
+	*/
+	static bool SegmentTriangleIntersection(const MVector& StartPoint, const MVector& EndPoint, const MVector& A, const MVector& B, const MVector& C, float& OutTime);
+
+	/**
+	 * Returns true if there is an intersection between the segment specified by SegmentStartA and SegmentEndA, and
+	 * the segment specified by SegmentStartB and SegmentEndB, in 2D space. If there is an intersection, the point is placed in out_IntersectionPoint
+	 * @param SegmentStartA - start point of first segment
+	 * @param SegmentEndA   - end point of first segment
+	 * @param SegmentStartB - start point of second segment
+	 * @param SegmentEndB   - end point of second segment
+	 * @param out_IntersectionPoint - out var for the intersection point (if any)
+	 * @return true if intersection occurred
+	 */
+	static bool SegmentIntersection2D(const MVector& SegmentStartA, const MVector& SegmentEndA, const MVector& SegmentStartB, const MVector& SegmentEndB, MVector& out_IntersectionPoint);
+
+
+	/**
+	 * Returns closest point on a triangle to a point.
+	 * The idea is to identify the halfplanes that the point is
+	 * in relative to each triangle segment "plane"
+	 *
+	 * @param	Point			point to check distance for
+	 * @param	A,B,C			counter clockwise ordering of points defining a triangle
+	 *
+	 * @return	Point on triangle ABC closest to given point
+	 */
+	static MVector ClosestPointOnTriangleToPoint(const MVector& Point, const MVector& A, const MVector& B, const MVector& C);
 //
 //	/**
 //	 * Returns closest point on a tetrahedron to a point.
@@ -1926,30 +2053,30 @@ private:
 //	 */
 //	static CORE_API MVector ClosestPointOnTetrahedronToPoint(const MVector& Point, const MVector& A, const MVector& B, const MVector& C, const MVector& D);
 //
-//	/**
-//	 * Find closest point on a Sphere to a Line.
-//	 * When line intersects		Sphere, then closest point to LineOrigin is returned.
-//	 * @param SphereOrigin		Origin of Sphere
-//	 * @param SphereRadius		Radius of Sphere
-//	 * @param LineOrigin		Origin of line
-//	 * @param LineDir			Direction of line. Needs to be normalized!!
-//	 * @param OutClosestPoint	Closest point on sphere to given line.
-//	 */
-//	static CORE_API void SphereDistToLine(MVector SphereOrigin, float SphereRadius, MVector LineOrigin, MVector LineDir, MVector& OutClosestPoint);
-//
-//	/**
-//	 * Calculates whether a Point is within a cone segment, and also what percentage within the cone (100% is along the center line, whereas 0% is along the edge)
-//	 *
-//	 * @param Point - The Point in question
-//	 * @param ConeStartPoint - the beginning of the cone (with the smallest radius)
-//	 * @param ConeLine - the line out from the start point that ends at the largest radius point of the cone
-//	 * @param radiusAtStart - the radius at the ConeStartPoint (0 for a 'proper' cone)
-//	 * @param radiusAtEnd - the largest radius of the cone
-//	 * @param percentageOut - output variable the holds how much within the cone the point is (1 = on center line, 0 = on exact edge or outside cone).
-//	 *
-//	 * @return true if the point is within the cone, false otherwise.
-//	 */
-//	static CORE_API bool GetDistanceWithinConeSegment(MVector Point, MVector ConeStartPoint, MVector ConeLine, float RadiusAtStart, float RadiusAtEnd, float& PercentageOut);
+	/**
+	 * Find closest point on a Sphere to a Line.
+	 * When line intersects		Sphere, then closest point to LineOrigin is returned.
+	 * @param SphereOrigin		Origin of Sphere
+	 * @param SphereRadius		Radius of Sphere
+	 * @param LineOrigin		Origin of line
+	 * @param LineDir			Direction of line. Needs to be normalized!!
+	 * @param OutClosestPoint	Closest point on sphere to given line.
+	 */
+	static void SphereDistToLine(MVector SphereOrigin, float SphereRadius, MVector LineOrigin, MVector LineDir, MVector& OutClosestPoint);
+
+	/**
+	 * Calculates whether a Point is within a cone segment, and also what percentage within the cone (100% is along the center line, whereas 0% is along the edge)
+	 *
+	 * @param Point - The Point in question
+	 * @param ConeStartPoint - the beginning of the cone (with the smallest radius)
+	 * @param ConeLine - the line out from the start point that ends at the largest radius point of the cone
+	 * @param radiusAtStart - the radius at the ConeStartPoint (0 for a 'proper' cone)
+	 * @param radiusAtEnd - the largest radius of the cone
+	 * @param percentageOut - output variable the holds how much within the cone the point is (1 = on center line, 0 = on exact edge or outside cone).
+	 *
+	 * @return true if the point is within the cone, false otherwise.
+	 */
+	static bool GetDistanceWithinConeSegment(MVector Point, MVector ConeStartPoint, MVector ConeLine, float RadiusAtStart, float RadiusAtEnd, float& PercentageOut);
 //
 //	/**
 //	 * Determines whether a given set of points are coplanar, with a tolerance. Any three points or less are always coplanar.
@@ -2091,37 +2218,37 @@ private:
 //	 */
 //	static CORE_API bool Eval(std::string Str, float& OutValue);
 //
-//	/**
-//	 * Computes the barycentric coordinates for a given point in a triangle - simpler version
-//	 *
-//	 * @param	Point			point to convert to barycentric coordinates (in plane of ABC)
-//	 * @param	A,B,C			three non-colinear points defining a triangle in CCW
-//	 *
-//	 * @return Vector containing the three weights a,b,c such that Point = a*A + b*B + c*C
-//	 *							                                or Point = A + b*(B-A) + c*(C-A) = (1-b-c)*A + b*B + c*C
-//	 */
-//	static CORE_API MVector GetBaryCentric2D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C);
-//
-//	/**
-//	 * Computes the barycentric coordinates for a given point in a triangle
-//	 *
-//	 * @param	Point			point to convert to barycentric coordinates (in plane of ABC)
-//	 * @param	A,B,C			three non-collinear points defining a triangle in CCW
-//	 *
-//	 * @return Vector containing the three weights a,b,c such that Point = a*A + b*B + c*C
-//	 *							                               or Point = A + b*(B-A) + c*(C-A) = (1-b-c)*A + b*B + c*C
-//	 */
-//	static CORE_API MVector ComputeBaryCentric2D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C);
-//
-//	/**
-//	 * Computes the barycentric coordinates for a given point on a tetrahedron (3D)
-//	 *
-//	 * @param	Point			point to convert to barycentric coordinates
-//	 * @param	A,B,C,D			four points defining a tetrahedron
-//	 *
-//	 * @return Vector containing the four weights a,b,c,d such that Point = a*A + b*B + c*C + d*D
-//	 */
-//	static CORE_API MVector4 ComputeBaryCentric3D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C, const MVector& D);
+	/**
+	 * Computes the barycentric coordinates for a given point in a triangle - simpler version
+	 *
+	 * @param	Point			point to convert to barycentric coordinates (in plane of ABC)
+	 * @param	A,B,C			three non-colinear points defining a triangle in CCW
+	 *
+	 * @return Vector containing the three weights a,b,c such that Point = a*A + b*B + c*C
+	 *							                                or Point = A + b*(B-A) + c*(C-A) = (1-b-c)*A + b*B + c*C
+	 */
+	static MVector GetBaryCentric2D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C);
+
+	/**
+	 * Computes the barycentric coordinates for a given point in a triangle
+	 *
+	 * @param	Point			point to convert to barycentric coordinates (in plane of ABC)
+	 * @param	A,B,C			three non-collinear points defining a triangle in CCW
+	 *
+	 * @return Vector containing the three weights a,b,c such that Point = a*A + b*B + c*C
+	 *							                               or Point = A + b*(B-A) + c*(C-A) = (1-b-c)*A + b*B + c*C
+	 */
+	static MVector ComputeBaryCentric2D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C);
+
+	/**
+	 * Computes the barycentric coordinates for a given point on a tetrahedron (3D)
+	 *
+	 * @param	Point			point to convert to barycentric coordinates
+	 * @param	A,B,C,D			four points defining a tetrahedron
+	 *
+	 * @return Vector containing the four weights a,b,c,d such that Point = a*A + b*B + c*C + d*D
+	 */
+	static MVector4 ComputeBaryCentric3D(const MVector& Point, const MVector& A, const MVector& B, const MVector& C, const MVector& D);
 //
 //	/** 32 bit values where BitFlag[x] == (1<<x) */
 //	static CORE_API const uint32_t BitFlag[32];
@@ -2230,33 +2357,52 @@ private:
 //		return CurrentGcd == 0 ? 0 : (a / CurrentGcd) * b;
 //	}
 //
-//	/**
-//	 * Generates a 1D Perlin noise from the given value.  Returns a continuous random value between -1.0 and 1.0.
-//	 *
-//	 * @param	Value	The input value that Perlin noise will be generated from.  This is usually a steadily incrementing time value.
-//	 *
-//	 * @return	Perlin noise in the range of -1.0 to 1.0
-//	 */
-//	static CORE_API float PerlinNoise1D(float Value);
-//
-//	/**
-//	* Generates a 1D Perlin noise sample at the given location.  Returns a continuous random value between -1.0 and 1.0.
-//	*
-//	* @param	Location	Where to sample
-//	*
-//	* @return	Perlin noise in the range of -1.0 to 1.0
-//	*/
-//	static CORE_API float PerlinNoise2D(const MVector2D& Location);
-//
-//
-//	/**
-//	* Generates a 3D Perlin noise sample at the given location.  Returns a continuous random value between -1.0 and 1.0.
-//	*
-//	* @param	Location	Where to sample
-//	*
-//	* @return	Perlin noise in the range of -1.0 to 1.0
-//	*/
-//	static CORE_API float PerlinNoise3D(const MVector& Location);
+	/**
+	 * Generates a 1D Perlin noise from the given value.  Returns a continuous random value between -1.0 and 1.0.
+	 *
+	 * @param	Value	The input value that Perlin noise will be generated from.  This is usually a steadily incrementing time value.
+	 *
+	 * @return	Perlin noise in the range of -1.0 to 1.0
+	 */
+	static float PerlinNoise1D(float Value);
+
+	/**
+	* Generates a 2D Perlin noise sample at the given location.  Returns a continuous random value between -1.0 and 1.0.
+	*
+	* @param	Location	Where to sample
+	*
+	* @return	Perlin noise in the range of -1.0 to 1.0
+	*/
+	static float PerlinNoise2D(const MVector2D& Location);
+
+
+	/**
+	* Generates a 3D Perlin noise sample at the given location.  Returns a continuous random value between -1.0 and 1.0.
+	*
+	* @param	Location	Where to sample
+	*
+	* @return	Perlin noise in the range of -1.0 to 1.0
+	*/
+	static float PerlinNoise3D(const MVector& Location);
+
+	/** PerlinNoise2D for FFloatWide::Lanes locations at once, matches the scalar version up to rounding. */
+	static FFloatWide PerlinNoise2D(const FFloatWide& X, const FFloatWide& Y);
+
+	/** PerlinNoise3D for MVectorWide::Lanes locations at once, matches the scalar version up to rounding. */
+	static FFloatWide PerlinNoise3D(const MVectorWide& Location);
+
+	/** Octaves of Perlin noise composed as Settings says, each octave shifted so the lattice points do not line up. */
+	static FFloatWide FractalNoise2D(const FFloatWide& X, const FFloatWide& Y, const FNoiseFractalSettings& Settings);
+	static FFloatWide FractalNoise3D(const MVectorWide& Location, const FNoiseFractalSettings& Settings);
+
+	/**
+	 * Samples FractalNoise2D on a SizeX x SizeY lattice starting at Origin, X varying fastest in OutValues.
+	 * Rows are split across the job system and evaluated FFloatWide::Lanes samples at a time.
+	 */
+	static void NoiseGrid2D(float* OutValues, int32_t SizeX, int32_t SizeY, const MVector2D& Origin, const MVector2D& Spacing, const FNoiseFractalSettings& Settings = FNoiseFractalSettings());
+
+	/** NoiseGrid2D for a SizeX x SizeY x SizeZ lattice, X then Y varying fastest. */
+	static void NoiseGrid3D(float* OutValues, int32_t SizeX, int32_t SizeY, int32_t SizeZ, const MVector& Origin, const MVector& Spacing, const FNoiseFractalSettings& Settings = FNoiseFractalSettings());
 //
 //	/**
 //	 * Calculates the new value in a weighted moving average series using the previous value and the weight
@@ -2302,11 +2448,189 @@ private:
 //	}
 };
 
-/** Float specialization */
-template<>
-float FMath::Abs(const float A)
+inline MVector FMath::VRand()
+{
+	return FRandomStream::GetThreadStream().GetUnitVector();
+}
+
+inline void FMath::CartesianToPolar(const MVector2D InCart, MVector2D& OutPolar)
+{
+	OutPolar.x = Sqrt(Square(InCart.x) + Square(InCart.y));
+	OutPolar.y = Atan2(InCart.y, InCart.x);
+}
+
+inline void FMath::PolarToCartesian(const MVector2D InPolar, MVector2D& OutCart)
+{
+	OutCart.x = InPolar.x * Cos(InPolar.y);
+	OutCart.y = InPolar.x * Sin(InPolar.y);
+}
+
+inline float FMath::GetRangePct(MVector2D const& Range, float Value)
+{
+	return GetRangePct(Range.x, Range.y, Value);
+}
+
+inline float FMath::GetRangeValue(MVector2D const& Range, float Pct)
+{
+	return Lerp(Range.x, Range.y, Pct);
+}
+
+inline MVector FMath::LinePlaneIntersection(const MVector& Point1, const MVector& Point2, const MVector& PlaneOrigin, const MVector& PlaneNormal)
+{
+	return Point1 + (Point2 - Point1) * (((PlaneOrigin - Point1) | PlaneNormal) / ((Point2 - Point1) | PlaneNormal));
+}
+
+inline MVectorWide FMath::LinePlaneIntersection(const MVectorWide& Point1, const MVectorWide& Point2, const MVectorWide& PlaneOrigin, const MVectorWide& PlaneNormal)
+{
+	const MVectorWide Line = Point2 - Point1;
+	return Point1 + Line * (((PlaneOrigin - Point1) | PlaneNormal) / (Line | PlaneNormal));
+}
+
+inline bool FMath::SphereAABBIntersection(const MVector& SphereCenter, const float RadiusSquared, const FBox& AABB)
+{
+	// Accumulates the distance as we iterate axis
+	float DistSquared = 0.f;
+	for (int32_t Axis = 0; Axis < 3; ++Axis)
+	{
+		if (SphereCenter[Axis] < AABB.Min[Axis])
+		{
+			DistSquared += Square(SphereCenter[Axis] - AABB.Min[Axis]);
+		}
+		else if (SphereCenter[Axis] > AABB.Max[Axis])
+		{
+			DistSquared += Square(SphereCenter[Axis] - AABB.Max[Axis]);
+		}
+	}
+	// If the distance is less than or equal to the radius, they intersect
+	return DistSquared <= RadiusSquared;
+}
+
+inline bool FMath::SphereAABBIntersection(const FSphere& Sphere, const FBox& AABB)
+{
+	return SphereAABBIntersection(Sphere.Center, Square(Sphere.W), AABB);
+}
+
+inline bool FMath::PointBoxIntersection(const MVector& Point, const FBox& Box)
+{
+	return Point.x >= Box.Min.x && Point.x <= Box.Max.x &&
+		Point.y >= Box.Min.y && Point.y <= Box.Max.y &&
+		Point.z >= Box.Min.z && Point.z <= Box.Max.z;
+}
+
+inline bool FMath::LineBoxIntersection(const FBox& Box, const MVector& Start, const MVector& End, const MVector& Direction)
+{
+	return LineBoxIntersection(Box, Start, End, Direction, MVector(1.0f / Direction.x, 1.0f / Direction.y, 1.0f / Direction.z));
+}
+
+inline bool FMath::LineBoxIntersection(const FBox& Box, const MVector& Start, const MVector& End, const MVector& Direction, const MVector& OneOverDirection)
+{
+	MVector Time(0.0f);
+	bool bStartIsOutside = false;
+
+	for (int32_t Axis = 0; Axis < 3; ++Axis)
+	{
+		if (Start[Axis] < Box.Min[Axis])
+		{
+			bStartIsOutside = true;
+			if (End[Axis] >= Box.Min[Axis])
+			{
+				Time[Axis] = (Box.Min[Axis] - Start[Axis]) * OneOverDirection[Axis];
+			}
+			else
+			{
+				return false;
+			}
+		}
+		else if (Start[Axis] > Box.Max[Axis])
+		{
+			bStartIsOutside = true;
+			if (End[Axis] <= Box.Max[Axis])
+			{
+				Time[Axis] = (Box.Max[Axis] - Start[Axis]) * OneOverDirection[Axis];
+			}
+			else
+			{
+				return false;
+			}
+		}
+	}
+
+	if (!bStartIsOutside)
+	{
+		return true;
+	}
+
+	// The latest slab entry is where the line enters the box, if it enters at all
+	const float MaxTime = Max3(Time.x, Time.y, Time.z);
+	if (MaxTime >= 0.0f && MaxTime <= 1.0f)
+	{
+		const MVector Hit = Start + Direction * MaxTime;
+		const float BoxSideThreshold = 0.1f;
+		return Hit.x > Box.Min.x - BoxSideThreshold && Hit.x < Box.Max.x + BoxSideThreshold &&
+			Hit.y > Box.Min.y - BoxSideThreshold && Hit.y < Box.Max.y + BoxSideThreshold &&
+			Hit.z > Box.Min.z - BoxSideThreshold && Hit.z < Box.Max.z + BoxSideThreshold;
+	}
+	return false;
+}
+
+inline bool FMath::LineSphereIntersection(const MVector& Start, const MVector& Dir, float Length, const MVector& Origin, float Radius)
+{
+	const MVector EO = Start - Origin;
+	const float V = (Dir | (Origin - Start));
+	const float Disc = Radius * Radius - ((EO | EO) - V * V);
+
+	if (Disc >= 0)
+	{
+		const float Time = (V - Sqrt(Disc)) / Length;
+
+		if (Time >= 0 && Time <= 1)
+		{
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	else
+	{
+		return false;
+	}
+}
+
+inline MVectorWide FMath::ClosestPointOnSegment(const MVectorWide& Point, const MVectorWide& StartPoint, const MVectorWide& EndPoint)
+{
+	const MVectorWide Segment = EndPoint - StartPoint;
+	const FFloatWide Dot1 = (Point - StartPoint) | Segment;
+	const FFloatWide Dot2 = Segment | Segment;
+
+	// Same branches as the scalar version, evaluated per lane. Dot2 is only zero when Dot1 is too, the clamp takes care of that lane.
+	const FFloatWide Time = FFloatWide::Clamp(Dot1 / FFloatWide::Max(Dot2, FFloatWide(SMALL_NUMBER)), FFloatWide(0.0f), FFloatWide(1.0f));
+	return StartPoint + Segment * Time;
+}
+
+inline FFloatWide FMath::PointDistToSegmentSquared(const MVectorWide& Point, const MVectorWide& StartPoint, const MVectorWide& EndPoint)
 {
-	return fabsf(A);
+	return (Point - ClosestPointOnSegment(Point, StartPoint, EndPoint)).SizeSquared();
 }
 
+inline MVectorWide FMath::VInterpTo(const MVectorWide& Current, const MVectorWide& Target, float DeltaTime, float InterpSpeed)
+{
+	// If no interp speed, jump to target value
+	if (InterpSpeed <= 0.f)
+	{
+		return Target;
+	}
+
+	const MVectorWide Dist = Target - Current;
+	const MVectorWide DeltaMove = Dist * FFloatWide(Clamp<float>(DeltaTime * InterpSpeed, 0.f, 1.f));
 
+	// Lanes that are already close snap to the target
+	return MVectorWide::Select(Dist.SizeSquared() < FFloatWide(KINDA_SMALL_NUMBER), Target, Current + DeltaMove);
+}
+
+inline MVectorWide FMath::GetReflectionVector(const MVectorWide& Direction, const MVectorWide& SurfaceNormal)
+{
+	const MVectorWide SafeNormal = SurfaceNormal.GetSafeNormal();
+	return Direction - SafeNormal * ((Direction | SafeNormal) * FFloatWide(2.f));
+}
@@ -0,0 +1,486 @@
+// Wide FMath transcendentals and the array kernels built on them, included by MathUtil.cpp for the build's
+// baseline and by the files of higher SIMD tiers, see SimdKernels.h.
+
+namespace
+{
+	// The polynomials below are the single precision ones from Cephes (sinf, cosf, expf, exp2f, logf)
+
+	constexpr float FourOverPi = 1.27323954473516f;
+	// Pi/4 split in three parts so that multiples of the first ones are exact (Cody-Waite reduction)
+	constexpr float PiOverFourA = 0.78515625f;
+	constexpr float PiOverFourB = 2.4187564849853515625e-4f;
+	constexpr float PiOverFourC = 3.77489497744594108e-8f;
+	// Octant * PiOverFourB stops being exact beyond this
+	constexpr float SinCosMaxReduced = 8192.0f;
+
+	constexpr float Log2OfE = 1.44269504088896341f;
+	constexpr float LnTwoHi = 0.693359375f;
+	constexpr float LnTwoLo = -2.12194440e-4f;
+
+	constexpr int32_t SignBit = (int32_t)0x80000000u;
+
+	/** Recomputes the lanes outside of InDomain with the scalar libm function. */
+	template <typename ScalarFunctionType>
+	FFloatWide FixupOutOfDomain(const FFloatWide& Result, const FMaskWide& InDomain, const FFloatWide& Value, ScalarFunctionType ScalarFunction)
+	{
+		const uint32_t DomainBits = InDomain.GetBits();
+		if (DomainBits == (1u << FFloatWide::Lanes) - 1)
+		{
+			return Result;
+		}
+
+		alignas(32) float ResultLanes[FFloatWide::Lanes];
+		alignas(32) float ValueLanes[FFloatWide::Lanes];
+		Result.Store(ResultLanes);
+		Value.Store(ValueLanes);
+		for (int32_t Lane = 0; Lane < FFloatWide::Lanes; ++Lane)
+		{
+			if ((DomainBits & (1u << Lane)) == 0)
+			{
+				ResultLanes[Lane] = ScalarFunction(ValueLanes[Lane]);
+			}
+		}
+		return FFloatWide::Load(ResultLanes);
+	}
+
+	/** Runs a wide kernel over a float array, the tail is padded with Fill which must be inside the kernel's fast domain. */
+	template <typename KernelType>
+	void ForEachWide(const float* Values, int32_t NumValues, float* OutValues, float Fill, KernelType Kernel)
+	{
+		int32_t Index = 0;
+		for (; Index + FFloatWide::Lanes <= NumValues; Index += FFloatWide::Lanes)
+		{
+			Kernel(FFloatWide::Load(Values + Index)).Store(OutValues + Index);
+		}
+
+		if (Index < NumValues)
+		{
+			Kernel(FFloatWide::LoadPartial(Values + Index, NumValues - Index, Fill)).StorePartial(OutValues + Index, NumValues - Index);
+		}
+	}
+
+	/** 2^Exponent for integer exponents in [-150, 128], split in two factors so that both stay normal. */
+	FFloatWide ScaleByPowerOfTwo(const FFloatWide& Value, const FIntWide& Exponent)
+	{
+		const FIntWide HalfExponent = Exponent.ShiftRightArithmetic(1);
+		const FFloatWide ScaleA = (HalfExponent + FIntWide(127)).ShiftLeft(23).AsFloat();
+		const FFloatWide ScaleB = (Exponent - HalfExponent + FIntWide(127)).ShiftLeft(23).AsFloat();
+		return Value * ScaleA * ScaleB;
+	}
+
+	/**
+	 * Unevaluated sum Hi + Lo of two floats, about 48 significant bits. The double-float arithmetic below
+	 * follows SLEEF and avoids fused multiply-adds, products are split in halves whose products are exact.
+	 */
+	struct FDoubleFloatWide
+	{
+		FFloatWide Hi;
+		FFloatWide Lo;
+	};
+
+	/** The upper 12 bits of the significand, the product of two of those is exact. */
+	FFloatWide UpperHalf(const FFloatWide& Value)
+	{
+		return (Value.AsInt() & FIntWide((int32_t)0xFFFFF000u)).AsFloat();
+	}
+
+	/** A + B exactly, whatever their magnitudes. */
+	FDoubleFloatWide TwoSum(const FFloatWide& A, const FFloatWide& B)
+	{
+		const FFloatWide Sum = A + B;
+		const FFloatWide BPart = Sum - A;
+		return { Sum, (A - (Sum - BPart)) + (B - BPart) };
+	}
+
+	FDoubleFloatWide Add(const FDoubleFloatWide& A, const FFloatWide& B)
+	{
+		const FDoubleFloatWide Sum = TwoSum(A.Hi, B);
+		return { Sum.Hi, Sum.Lo + A.Lo };
+	}
+
+	FDoubleFloatWide Add(const FDoubleFloatWide& A, const FDoubleFloatWide& B)
+	{
+		const FDoubleFloatWide Sum = TwoSum(A.Hi, B.Hi);
+		return { Sum.Hi, Sum.Lo + A.Lo + B.Lo };
+	}
+
+	/** A + B for |A| >= |B| or A == 0, cheaper than Add. */
+	FDoubleFloatWide AddOrdered(const FDoubleFloatWide& A, const FDoubleFloatWide& B)
+	{
+		const FFloatWide Sum = A.Hi + B.Hi;
+		return { Sum, A.Hi - Sum + B.Hi + A.Lo + B.Lo };
+	}
+
+	FDoubleFloatWide AddOrdered(const FFloatWide& A, const FDoubleFloatWide& B)
+	{
+		const FFloatWide Sum = A + B.Hi;
+		return { Sum, A - Sum + B.Hi + B.Lo };
+	}
+
+	/** A * B exactly (Dekker, or a single fused multiply-add where MulAdd is one). */
+	FDoubleFloatWide TwoProduct(const FFloatWide& A, const FFloatWide& B)
+	{
+		const FFloatWide Product = A * B;
+#if MIKASA_SIMD_FMA
+		return { Product, FFloatWide::MulAdd(A, B, -Product) };
+#else
+		const FFloatWide AHigh = UpperHalf(A);
+		const FFloatWide ALow = A - AHigh;
+		const FFloatWide BHigh = UpperHalf(B);
+		const FFloatWide BLow = B - BHigh;
+		return { Product, AHigh * BHigh - Product + ALow * BHigh + AHigh * BLow + ALow * BLow };
+#endif
+	}
+
+	FDoubleFloatWide Mul(const FDoubleFloatWide& A, const FFloatWide& B)
+	{
+		const FDoubleFloatWide Product = TwoProduct(A.Hi, B);
+		return { Product.Hi, Product.Lo + A.Lo * B };
+	}
+
+	FDoubleFloatWide Mul(const FDoubleFloatWide& A, const FDoubleFloatWide& B)
+	{
+		const FDoubleFloatWide Product = TwoProduct(A.Hi, B.Hi);
+		return { Product.Hi, Product.Lo + A.Hi * B.Lo + A.Lo * B.Hi };
+	}
+
+	FDoubleFloatWide Square(const FDoubleFloatWide& A)
+	{
+		const FDoubleFloatWide Product = TwoProduct(A.Hi, A.Hi);
+		return { Product.Hi, Product.Lo + A.Hi * (A.Lo + A.Lo) };
+	}
+
+	FDoubleFloatWide Div(const FDoubleFloatWide& N, const FDoubleFloatWide& D)
+	{
+		// Quotient of the high parts, corrected by the residual N - Quotient * D
+		const FFloatWide Reciprocal = FFloatWide(1.0f) / D.Hi;
+		const FFloatWide Quotient = N.Hi * Reciprocal;
+		const FDoubleFloatWide Back = TwoProduct(Quotient, D.Hi);
+		const FFloatWide Residual = N.Hi - Back.Hi - Back.Lo + N.Lo - Quotient * D.Lo;
+		return { Quotient, Residual * Reciprocal };
+	}
+
+	/** Natural logarithm of positive normal floats, to about 2^-40 relative (SLEEF logkf). */
+	FDoubleFloatWide LogDoubleFloat(const FFloatWide& Value)
+	{
+		// Value = 2^Exponent * M with M in [0.75, 1.5), then ln(M) = 2 atanh(X) with X = (M - 1) / (M + 1)
+		const FIntWide Exponent = (Value * FFloatWide(1.0f / 0.75f)).AsInt().ShiftRightLogical(23) - FIntWide(127);
+		const FFloatWide M = (Value.AsInt() - Exponent.ShiftLeft(23)).AsFloat();
+		const FDoubleFloatWide X = Div(TwoSum(FFloatWide(-1.0f), M), TwoSum(FFloatWide(1.0f), M));
+		const FDoubleFloatWide X2 = Square(X);
+
+		FFloatWide Polynomial = FFloatWide::MulAdd(FFloatWide(0.240320354700088500976562f), X2.Hi, FFloatWide(0.285112679004669189453125f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, X2.Hi, FFloatWide(0.400007992982864379882812f));
+		const FDoubleFloatWide TwoThirds = { FFloatWide(0.66666662693023681640625f), FFloatWide(3.69183861259614332084311e-9f) };
+
+		// Exponent * LnTwoHi is exact, like in the Exp reduction
+		const FFloatWide ExponentFloat = Exponent.ToFloat();
+		FDoubleFloatWide Result = TwoSum(ExponentFloat * FFloatWide(LnTwoHi), ExponentFloat * FFloatWide(LnTwoLo));
+		Result = AddOrdered(Result, FDoubleFloatWide{ X.Hi * FFloatWide(2.0f), X.Lo * FFloatWide(2.0f) });
+		return AddOrdered(Result, Mul(Mul(X2, X), Add(TwoThirds, X2.Hi * Polynomial)));
+	}
+
+	/** e^Value for a double-float exponent, the result rounded once at the end (SLEEF expkf). */
+	FFloatWide ExpDoubleFloat(const FDoubleFloatWide& Value)
+	{
+		// e^-104 rounds to 0 and e^89 overflows, the low part is meaningless once clamped
+		const FFloatWide Hi = FFloatWide::Clamp(Value.Hi, FFloatWide(-104.0f), FFloatWide(89.0f));
+		const FFloatWide Lo = FFloatWide::Select(Hi == Value.Hi, Value.Lo, FFloatWide(0.0f));
+		const FFloatWide Whole = ((Hi + Lo) * FFloatWide(Log2OfE)).Round();
+
+		FDoubleFloatWide R = Add(FDoubleFloatWide{ Hi, Lo }, Whole * FFloatWide(-0.693145751953125f));
+		R = Add(R, Whole * FFloatWide(-1.428606765330187045e-6f));
+		const FFloatWide X = R.Hi + R.Lo;
+
+		FFloatWide Polynomial = FFloatWide::MulAdd(FFloatWide(0.00136324646882712841033936f), X, FFloatWide(0.00836596917361021041870117f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, X, FFloatWide(0.0416710823774337768554688f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, X, FFloatWide(0.166665524244308471679688f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, X, FFloatWide(0.499999850988388061035156f));
+
+		// Only 1 + X needs the extra bits, the rounding error of X * X * Polynomial stays below 0.1 ulp
+		const FDoubleFloatWide Result = AddOrdered(FFloatWide(1.0f), FDoubleFloatWide{ X, FFloatWide::MulAdd(X * X, Polynomial, R.Hi - X + R.Lo) });
+		return ScaleByPowerOfTwo(Result.Hi + Result.Lo, Whole.TruncToInt());
+	}
+
+	FFloatWide SinCosWide(const FFloatWide& Value, bool bCosine, EMathAccuracy Accuracy)
+	{
+		const FFloatWide AbsValue = FFloatWide::Abs(Value);
+
+		// Octant index rounded up to even, the reduced angle lands in [-Pi/4, Pi/4]
+		const FIntWide Octant = ((AbsValue * FFloatWide(FourOverPi)).TruncToInt() + FIntWide(1)) & FIntWide(~1);
+		const FFloatWide OctantFloat = Octant.ToFloat();
+		FFloatWide X = FFloatWide::MulAdd(OctantFloat, FFloatWide(-PiOverFourA), AbsValue);
+		X = FFloatWide::MulAdd(OctantFloat, FFloatWide(-PiOverFourB), X);
+		X = FFloatWide::MulAdd(OctantFloat, FFloatWide(-PiOverFourC), X);
+
+		// Cos is Sin shifted by two octants and never takes the sign of the input
+		FIntWide Sign;
+		FIntWide Quadrant = Octant;
+		if (bCosine)
+		{
+			Quadrant = Octant - FIntWide(2);
+			Sign = ((Quadrant ^ FIntWide(-1)) & FIntWide(4)).ShiftLeft(29);
+		}
+		else
+		{
+			Sign = (Value.AsInt() & FIntWide(SignBit)) ^ (Quadrant & FIntWide(4)).ShiftLeft(29);
+		}
+		const FMaskWide UseSinPolynomial = (Quadrant & FIntWide(2)) == FIntWide(0);
+
+		const FFloatWide X2 = X * X;
+		FFloatWide SinPolynomial;
+		FFloatWide CosPolynomial;
+		if (Accuracy == EMathAccuracy::Precise)
+		{
+			SinPolynomial = FFloatWide::MulAdd(X2, FFloatWide(-1.9515295891e-4f), FFloatWide(8.3321608736e-3f));
+			SinPolynomial = FFloatWide::MulAdd(SinPolynomial, X2, FFloatWide(-1.6666654611e-1f));
+			SinPolynomial = FFloatWide::MulAdd(SinPolynomial * X2, X, X);
+
+			CosPolynomial = FFloatWide::MulAdd(X2, FFloatWide(2.443315711809948e-5f), FFloatWide(-1.388731625493765e-3f));
+			CosPolynomial = FFloatWide::MulAdd(CosPolynomial, X2, FFloatWide(4.166664568298827e-2f));
+			CosPolynomial = FFloatWide::MulAdd(CosPolynomial * X2, X2, FFloatWide::MulAdd(X2, FFloatWide(-0.5f), FFloatWide(1.0f)));
+		}
+		else
+		{
+			// Taylor series, the first dropped terms are below 4e-5 on [-Pi/4, Pi/4]
+			SinPolynomial = FFloatWide::MulAdd(X2, FFloatWide(1.0f / 120.0f), FFloatWide(-1.0f / 6.0f));
+			SinPolynomial = FFloatWide::MulAdd(SinPolynomial * X2, X, X);
+
+			CosPolynomial = FFloatWide::MulAdd(X2, FFloatWide(-1.0f / 720.0f), FFloatWide(1.0f / 24.0f));
+			CosPolynomial = FFloatWide::MulAdd(CosPolynomial, X2, FFloatWide(-0.5f));
+			CosPolynomial = FFloatWide::MulAdd(CosPolynomial, X2, FFloatWide(1.0f));
+		}
+
+		const FFloatWide Result = (FFloatWide::Select(UseSinPolynomial, SinPolynomial, CosPolynomial).AsInt() ^ Sign).AsFloat();
+		if (Accuracy == EMathAccuracy::Fast)
+		{
+			return Result;
+		}
+
+		// Also rejects NaN and infinities
+		const FMaskWide InDomain = AbsValue <= FFloatWide(SinCosMaxReduced);
+		return bCosine
+			? FixupOutOfDomain(Result, InDomain, Value, [](float Lane) { return cosf(Lane); })
+			: FixupOutOfDomain(Result, InDomain, Value, [](float Lane) { return sinf(Lane); });
+	}
+}
+
+FFloatWide FMath::Sin(const FFloatWide& Value, EMathAccuracy Accuracy)
+{
+	return SinCosWide(Value, false, Accuracy);
+}
+
+FFloatWide FMath::Cos(const FFloatWide& Value, EMathAccuracy Accuracy)
+{
+	return SinCosWide(Value, true, Accuracy);
+}
+
+FFloatWide FMath::Exp2(const FFloatWide& Value, EMathAccuracy Accuracy)
+{
+	// Anything outside of this range is 0 or infinity anyway
+	const FFloatWide X = FFloatWide::Clamp(Value, FFloatWide(-150.0f), FFloatWide(128.0f));
+	const FFloatWide Whole = X.Round();
+	const FFloatWide F = X - Whole;
+
+	FFloatWide Polynomial;
+	if (Accuracy == EMathAccuracy::Precise)
+	{
+		Polynomial = FFloatWide::MulAdd(F, FFloatWide(1.535336188319500e-4f), FFloatWide(1.339887440266574e-3f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, F, FFloatWide(9.618437357674640e-3f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, F, FFloatWide(5.550332471162809e-2f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, F, FFloatWide(2.402264791363012e-1f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, F, FFloatWide(6.931472028550421e-1f));
+	}
+	else
+	{
+		// Taylor series of 2^F, within 5e-5 relative on [-0.5, 0.5]
+		Polynomial = FFloatWide::MulAdd(F, FFloatWide(9.618129107628477e-3f), FFloatWide(5.550410866482158e-2f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, F, FFloatWide(2.402265069591007e-1f));
+		Polynomial = FFloatWide::MulAdd(Polynomial, F, FFloatWide(6.931471805599453e-1f));
+	}
+	const FFloatWide Result = ScaleByPowerOfTwo(FFloatWide::MulAdd(Polynomial, F, FFloatWide(1.0f)), Whole.TruncToInt());
+
+	if (Accuracy == EMathAccuracy::Fast)
+	{
+		return Result;
+	}
+	return FixupOutOfDomain(Result, Value == Value, Value, [](float Lane) { return exp2f(Lane); });
+}
+
+FFloatWide FMath::Exp(const FFloatWide& Value, EMathAccuracy Accuracy)
+{
+	if (Accuracy == EMathAccuracy::Fast)
+	{
+		return Exp2(Value * FFloatWide(Log2OfE), EMathAccuracy::Fast);
+	}
+
+	// e^-104 rounds to 0 and e^89 overflows
+	const FFloatWide X = FFloatWide::Clamp(Value, FFloatWide(-104.0f), FFloatWide(89.0f));
+	const FFloatWide Whole = (X * FFloatWide(Log2OfE)).Round();
+	FFloatWide R = FFloatWide::MulAdd(Whole, FFloatWide(-LnTwoHi), X);
+	R = FFloatWide::MulAdd(Whole, FFloatWide(-LnTwoLo), R);
+
+	FFloatWide Polynomial = FFloatWide::MulAdd(R, FFloatWide(1.9875691500e-4f), FFloatWide(1.3981999507e-3f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, R, FFloatWide(8.3334519073e-3f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, R, FFloatWide(4.1665795894e-2f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, R, FFloatWide(1.6666665459e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, R, FFloatWide(5.0000001201e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, R * R, R + FFloatWide(1.0f));
+
+	const FFloatWide Result = ScaleByPowerOfTwo(Polynomial, Whole.TruncToInt());
+	return FixupOutOfDomain(Result, Value == Value, Value, [](float Lane) { return expf(Lane); });
+}
+
+FFloatWide FMath::Log2(const FFloatWide& Value, EMathAccuracy Accuracy)
+{
+	// Split into exponent and mantissa in [Sqrt(0.5), Sqrt(2)), then work on M = Mantissa - 1
+	const FIntWide Bits = Value.AsInt();
+	FIntWide Exponent = Bits.ShiftRightLogical(23) - FIntWide(126);
+	FFloatWide M = ((Bits & FIntWide(0x007FFFFF)) | FIntWide(0x3F000000)).AsFloat();
+	const FMaskWide BelowHalfSqrt2 = M < FFloatWide(0.707106781186547524f);
+	Exponent = FIntWide::Select(BelowHalfSqrt2, Exponent - FIntWide(1), Exponent);
+	M = M + FFloatWide::Select(BelowHalfSqrt2, M, FFloatWide(0.0f)) - FFloatWide(1.0f);
+	const FFloatWide ExponentFloat = Exponent.ToFloat();
+
+	if (Accuracy == EMathAccuracy::Fast)
+	{
+		// ln(1 + M) = 2 atanh(S) with |S| < 0.172, so three terms of the series are enough
+		const FFloatWide S = M / (M + FFloatWide(2.0f));
+		const FFloatWide S2 = S * S;
+		FFloatWide Series = FFloatWide::MulAdd(S2, FFloatWide(2.0f / 5.0f), FFloatWide(2.0f / 3.0f));
+		Series = FFloatWide::MulAdd(Series, S2, FFloatWide(2.0f));
+		return FFloatWide::MulAdd(Series * S, FFloatWide(Log2OfE), ExponentFloat);
+	}
+
+	const FFloatWide M2 = M * M;
+	FFloatWide Polynomial = FFloatWide::MulAdd(M, FFloatWide(7.0376836292e-2f), FFloatWide(-1.1514610310e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(1.1676998740e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(-1.2420140846e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(1.4249322787e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(-1.6668057665e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(2.0000714765e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(-2.4999993993e-1f));
+	Polynomial = FFloatWide::MulAdd(Polynomial, M, FFloatWide(3.3333331174e-1f));
+	const FFloatWide Y = FFloatWide::MulAdd(M2, FFloatWide(-0.5f), Polynomial * M * M2);
+
+	// Multiply by Log2(e) as 1 + (Log2(e) - 1) to keep the leading bits exact
+	const FFloatWide Log2OfEMinusOne(0.44269504088896340736f);
+	FFloatWide Result = Y * Log2OfEMinusOne;
+	Result = FFloatWide::MulAdd(M, Log2OfEMinusOne, Result);
+	Result = Result + Y + M + ExponentFloat;
+
+	// Zero, negative, denormal, infinite and NaN inputs go through libm
+	const FMaskWide InDomain = (Bits > FIntWide(0x007FFFFF)) & (Bits < FIntWide(0x7F800000));
+	return FixupOutOfDomain(Result, InDomain, Value, [](float Lane) { return log2f(Lane); });
+}
+
+FFloatWide FMath::InvSqrt(const FFloatWide& Value, EMathAccuracy Accuracy)
+{
+	if (Accuracy == EMathAccuracy::Precise)
+	{
+		return FFloatWide(1.0f) / FFloatWide::Sqrt(Value);
+	}
+
+	// One Newton-Raphson step on the hardware estimate
+	const FFloatWide Estimate = FFloatWide::InvSqrtEst(Value);
+	const FFloatWide HalfValue = Value * FFloatWide(0.5f);
+	return Estimate * FFloatWide::MulAdd(HalfValue * Estimate, -Estimate, FFloatWide(1.5f));
+}
+
+FFloatWide FMath::Pow(const FFloatWide& A, const FFloatWide& B, EMathAccuracy Accuracy)
+{
+	if (Accuracy == EMathAccuracy::Fast)
+	{
+		return Exp2(B * Log2(A, Accuracy), Accuracy);
+	}
+
+	// The rounding error of a float logarithm is scaled by B, in double-float it stays below the final rounding
+	const FFloatWide Result = ExpDoubleFloat(Mul(LogDoubleFloat(A), B));
+
+	// Non positive, denormal or non finite bases and non finite exponents keep the libm semantics
+	const FIntWide BaseBits = A.AsInt();
+	const FMaskWide InDomain = (BaseBits > FIntWide(0x007FFFFF)) & (BaseBits < FIntWide(0x7F800000))
+		& (FFloatWide::Abs(B) < FFloatWide(INFINITY));
+	if (InDomain.AllTrue())
+	{
+		return Result;
+	}
+
+	alignas(32) float ResultLanes[FFloatWide::Lanes];
+	alignas(32) float BaseLanes[FFloatWide::Lanes];
+	alignas(32) float ExponentLanes[FFloatWide::Lanes];
+	Result.Store(ResultLanes);
+	A.Store(BaseLanes);
+	B.Store(ExponentLanes);
+	const uint32_t DomainBits = InDomain.GetBits();
+	for (int32_t Lane = 0; Lane < FFloatWide::Lanes; ++Lane)
+	{
+		if ((DomainBits & (1u << Lane)) == 0)
+		{
+			ResultLanes[Lane] = powf(BaseLanes[Lane], ExponentLanes[Lane]);
+		}
+	}
+	return FFloatWide::Load(ResultLanes);
+}
+
+inline namespace MIKASA_SIMD_NAMESPACE
+{
+	namespace SimdKernels
+	{
+		void Sin(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			ForEachWide(Values, NumValues, OutValues, 0.0f, [Accuracy](const FFloatWide& Value) { return FMath::Sin(Value, Accuracy); });
+		}
+
+		void Cos(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			ForEachWide(Values, NumValues, OutValues, 0.0f, [Accuracy](const FFloatWide& Value) { return FMath::Cos(Value, Accuracy); });
+		}
+
+		void Exp(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			ForEachWide(Values, NumValues, OutValues, 0.0f, [Accuracy](const FFloatWide& Value) { return FMath::Exp(Value, Accuracy); });
+		}
+
+		void Exp2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			ForEachWide(Values, NumValues, OutValues, 0.0f, [Accuracy](const FFloatWide& Value) { return FMath::Exp2(Value, Accuracy); });
+		}
+
+		void Log2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			ForEachWide(Values, NumValues, OutValues, 1.0f, [Accuracy](const FFloatWide& Value) { return FMath::Log2(Value, Accuracy); });
+		}
+
+		void Sqrt(const float* Values, int32_t NumValues, float* OutValues)
+		{
+			ForEachWide(Values, NumValues, OutValues, 0.0f, [](const FFloatWide& Value) { return FFloatWide::Sqrt(Value); });
+		}
+
+		void InvSqrt(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			ForEachWide(Values, NumValues, OutValues, 1.0f, [Accuracy](const FFloatWide& Value) { return FMath::InvSqrt(Value, Accuracy); });
+		}
+
+		void Pow(const float* Bases, const float* Exponents, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			int32_t Index = 0;
+			for (; Index + FFloatWide::Lanes <= NumValues; Index += FFloatWide::Lanes)
+			{
+				FMath::Pow(FFloatWide::Load(Bases + Index), FFloatWide::Load(Exponents + Index), Accuracy).Store(OutValues + Index);
+			}
+
+			if (Index < NumValues)
+			{
+				const int32_t NumTail = NumValues - Index;
+				FMath::Pow(FFloatWide::LoadPartial(Bases + Index, NumTail, 1.0f), FFloatWide::LoadPartial(Exponents + Index, NumTail, 1.0f), Accuracy).StorePartial(OutValues + Index, NumTail);
+			}
+		}
+
+		void Pow(const float* Bases, float Exponent, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy)
+		{
+			const FFloatWide WideExponent(Exponent);
+			ForEachWide(Bases, NumValues, OutValues, 1.0f, [&WideExponent, Accuracy](const FFloatWide& Value) { return FMath::Pow(Value, WideExponent, Accuracy); });
+		}
+	}
+}
@@ -0,0 +1,378 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Quat.h"
+
+/**
+ * 4x4 matrix for row vectors: points transform as P * M, M[3] holds the translation and A * B applies
+ * A first, then B. The memory layout is the one of glm::mat4 (glm's column N is row N here), so both
+ * convert by copy, but glm multiplies in the opposite order: FMatrix(A) * FMatrix(B) == FMatrix(B * A).
+ */
+struct alignas(16) FMatrix
+{
+    float M[4][4];
+
+    static const FMatrix Identity;
+
+    constexpr FMatrix()
+        : M{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } }
+    {
+    }
+
+    /** Matrix with the given axes in the first three rows and Origin as the translation. */
+    constexpr FMatrix(const MVector& InX, const MVector& InY, const MVector& InZ, const MVector& Origin)
+        : M{ { InX.x, InX.y, InX.z, 0.0f }, { InY.x, InY.y, InY.z, 0.0f }, { InZ.x, InZ.y, InZ.z, 0.0f }, { Origin.x, Origin.y, Origin.z, 1.0f } }
+    {
+    }
+
+    FMatrix(const glm::mat4& Matrix)
+    {
+        static_assert(sizeof(glm::mat4) == sizeof(M), "glm::mat4 must be 16 packed floats");
+        std::memcpy(M, &Matrix[0][0], sizeof(M));
+    }
+
+    operator glm::mat4() const
+    {
+        glm::mat4 Result;
+        std::memcpy(&Result[0][0], M, sizeof(M));
+        return Result;
+    }
+
+    /** This transform followed by Other. */
+    FMatrix operator*(const FMatrix& Other) const
+    {
+        FMatrix Result;
+#if MIKASA_SIMD_AVX || MIKASA_SIMD_SSE2
+        const __m128 Row0 = _mm_load_ps(Other.M[0]);
+        const __m128 Row1 = _mm_load_ps(Other.M[1]);
+        const __m128 Row2 = _mm_load_ps(Other.M[2]);
+        const __m128 Row3 = _mm_load_ps(Other.M[3]);
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            const __m128 Sum01 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[Row][0]), Row0), _mm_mul_ps(_mm_set1_ps(M[Row][1]), Row1));
+            const __m128 Sum23 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[Row][2]), Row2), _mm_mul_ps(_mm_set1_ps(M[Row][3]), Row3));
+            _mm_store_ps(Result.M[Row], _mm_add_ps(Sum01, Sum23));
+        }
+#elif MIKASA_SIMD_NEON
+        const float32x4_t Row0 = vld1q_f32(Other.M[0]);
+        const float32x4_t Row1 = vld1q_f32(Other.M[1]);
+        const float32x4_t Row2 = vld1q_f32(Other.M[2]);
+        const float32x4_t Row3 = vld1q_f32(Other.M[3]);
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            const float32x4_t Sum01 = vfmaq_n_f32(vmulq_n_f32(Row0, M[Row][0]), Row1, M[Row][1]);
+            const float32x4_t Sum23 = vfmaq_n_f32(vmulq_n_f32(Row2, M[Row][2]), Row3, M[Row][3]);
+            vst1q_f32(Result.M[Row], vaddq_f32(Sum01, Sum23));
+        }
+#else
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            for (int32_t Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = M[Row][0] * Other.M[0][Column] + M[Row][1] * Other.M[1][Column] + M[Row][2] * Other.M[2][Column] + M[Row][3] * Other.M[3][Column];
+            }
+        }
+#endif
+        return Result;
+    }
+
+    FMatrix& operator*=(const FMatrix& Other) { return *this = *this * Other; }
+
+    bool operator==(const FMatrix& Other) const { return std::memcmp(M, Other.M, sizeof(M)) == 0; }
+    bool operator!=(const FMatrix& Other) const { return !(*this == Other); }
+
+    bool Equals(const FMatrix& Other, float Tolerance = KINDA_SMALL_NUMBER) const
+    {
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            for (int32_t Column = 0; Column < 4; ++Column)
+            {
+                if (fabsf(M[Row][Column] - Other.M[Row][Column]) > Tolerance)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    MVector4 TransformFVector4(const MVector4& V) const
+    {
+        return MVector4(
+            V.x * M[0][0] + V.y * M[1][0] + V.z * M[2][0] + V.w * M[3][0],
+            V.x * M[0][1] + V.y * M[1][1] + V.z * M[2][1] + V.w * M[3][1],
+            V.x * M[0][2] + V.y * M[1][2] + V.z * M[2][2] + V.w * M[3][2],
+            V.x * M[0][3] + V.y * M[1][3] + V.z * M[2][3] + V.w * M[3][3]);
+    }
+
+    /** Transforms a point, ignores the projective column. */
+    MVector TransformPosition(const MVector& P) const
+    {
+        return GetScaledAxis(0) * P.x + GetScaledAxis(1) * P.y + GetScaledAxis(2) * P.z + GetOrigin();
+    }
+
+    /** Transforms a direction, without the translation. */
+    MVector TransformVector(const MVector& V) const
+    {
+        return GetScaledAxis(0) * V.x + GetScaledAxis(1) * V.y + GetScaledAxis(2) * V.z;
+    }
+
+    MVector GetScaledAxis(int32_t Axis) const { return MVector(M[Axis][0], M[Axis][1], M[Axis][2]); }
+    MVector GetOrigin() const { return MVector(M[3][0], M[3][1], M[3][2]); }
+
+    void SetOrigin(const MVector& Origin)
+    {
+        M[3][0] = Origin.x;
+        M[3][1] = Origin.y;
+        M[3][2] = Origin.z;
+    }
+
+    /** Length of every axis. */
+    MVector GetScaleVector() const
+    {
+        return MVector(GetScaledAxis(0).Size(), GetScaledAxis(1).Size(), GetScaledAxis(2).Size());
+    }
+
+    FMatrix GetTransposed() const
+    {
+        FMatrix Result;
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            for (int32_t Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = M[Column][Row];
+            }
+        }
+        return Result;
+    }
+
+    float Determinant() const
+    {
+        float Sub[6], Cof[6];
+        GetSubDeterminants(Sub, Cof);
+        return Sub[0] * Cof[5] - Sub[1] * Cof[4] + Sub[2] * Cof[3] + Sub[3] * Cof[2] - Sub[4] * Cof[1] + Sub[5] * Cof[0];
+    }
+
+    /** General inverse, singular matrices return the identity. Prefer InverseAffine for transforms. */
+    FMatrix Inverse() const
+    {
+#if MIKASA_SIMD_AVX || MIKASA_SIMD_SSE2
+        // Blockwise inversion over the four 2x2 sub-matrices, each packed row major in one register:
+        // with M = | A B |, inverse(M) = 1 / |M| * | X Y | and X = Adj(|D| A - B Adj(D) C), the others alike
+        //          | C D |                         | Z W |
+        const __m128 Row0 = _mm_load_ps(M[0]);
+        const __m128 Row1 = _mm_load_ps(M[1]);
+        const __m128 Row2 = _mm_load_ps(M[2]);
+        const __m128 Row3 = _mm_load_ps(M[3]);
+        const __m128 A = _mm_movelh_ps(Row0, Row1);
+        const __m128 B = _mm_movehl_ps(Row1, Row0);
+        const __m128 C = _mm_movelh_ps(Row2, Row3);
+        const __m128 D = _mm_movehl_ps(Row3, Row2);
+
+        // Determinants of A, B, C and D
+        const __m128 SubDets = _mm_sub_ps(
+            _mm_mul_ps(Shuffle<0, 2, 0, 2>(Row0, Row2), Shuffle<1, 3, 1, 3>(Row1, Row3)),
+            _mm_mul_ps(Shuffle<1, 3, 1, 3>(Row0, Row2), Shuffle<0, 2, 0, 2>(Row1, Row3)));
+        const __m128 DetA = Swizzle<0, 0, 0, 0>(SubDets);
+        const __m128 DetB = Swizzle<1, 1, 1, 1>(SubDets);
+        const __m128 DetC = Swizzle<2, 2, 2, 2>(SubDets);
+        const __m128 DetD = Swizzle<3, 3, 3, 3>(SubDets);
+
+        const __m128 AdjDC = Mat2AdjMul(D, C);
+        const __m128 AdjAB = Mat2AdjMul(A, B);
+        const __m128 AdjX = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, AdjDC));
+        const __m128 AdjW = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, AdjAB));
+        const __m128 AdjY = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, AdjAB));
+        const __m128 AdjZ = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, AdjDC));
+
+        // |M| = |A| |D| + |B| |C| - trace(Adj(A) B Adj(D) C)
+        __m128 Trace = _mm_mul_ps(AdjAB, Swizzle<0, 2, 1, 3>(AdjDC));
+        Trace = _mm_add_ps(Trace, Swizzle<1, 0, 3, 2>(Trace));
+        Trace = _mm_add_ps(Trace, Swizzle<2, 3, 0, 1>(Trace));
+        const __m128 Det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC)), Trace);
+        if (_mm_cvtss_f32(Det) == 0.0f)
+        {
+            return Identity;
+        }
+
+        // The adjugate of a 2x2 matrix swaps its diagonal and negates the rest, folded into the final shuffles
+        const __m128 R = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), Det);
+        const __m128 X = _mm_mul_ps(AdjX, R);
+        const __m128 Y = _mm_mul_ps(AdjY, R);
+        const __m128 Z = _mm_mul_ps(AdjZ, R);
+        const __m128 W = _mm_mul_ps(AdjW, R);
+
+        FMatrix Result;
+        _mm_store_ps(Result.M[0], Shuffle<3, 1, 3, 1>(X, Y));
+        _mm_store_ps(Result.M[1], Shuffle<2, 0, 2, 0>(X, Y));
+        _mm_store_ps(Result.M[2], Shuffle<3, 1, 3, 1>(Z, W));
+        _mm_store_ps(Result.M[3], Shuffle<2, 0, 2, 0>(Z, W));
+        return Result;
+#else
+        // Laplace expansion over 2x2 sub-determinants of the upper and lower two rows
+        float Sub[6], Cof[6];
+        GetSubDeterminants(Sub, Cof);
+        const float Det = Sub[0] * Cof[5] - Sub[1] * Cof[4] + Sub[2] * Cof[3] + Sub[3] * Cof[2] - Sub[4] * Cof[1] + Sub[5] * Cof[0];
+        if (Det == 0.0f)
+        {
+            return Identity;
+        }
+
+        const float R = 1.0f / Det;
+        FMatrix Result;
+        Result.M[0][0] = (M[1][1] * Cof[5] - M[1][2] * Cof[4] + M[1][3] * Cof[3]) * R;
+        Result.M[0][1] = (-M[0][1] * Cof[5] + M[0][2] * Cof[4] - M[0][3] * Cof[3]) * R;
+        Result.M[0][2] = (M[3][1] * Sub[5] - M[3][2] * Sub[4] + M[3][3] * Sub[3]) * R;
+        Result.M[0][3] = (-M[2][1] * Sub[5] + M[2][2] * Sub[4] - M[2][3] * Sub[3]) * R;
+        Result.M[1][0] = (-M[1][0] * Cof[5] + M[1][2] * Cof[2] - M[1][3] * Cof[1]) * R;
+        Result.M[1][1] = (M[0][0] * Cof[5] - M[0][2] * Cof[2] + M[0][3] * Cof[1]) * R;
+        Result.M[1][2] = (-M[3][0] * Sub[5] + M[3][2] * Sub[2] - M[3][3] * Sub[1]) * R;
+        Result.M[1][3] = (M[2][0] * Sub[5] - M[2][2] * Sub[2] + M[2][3] * Sub[1]) * R;
+        Result.M[2][0] = (M[1][0] * Cof[4] - M[1][1] * Cof[2] + M[1][3] * Cof[0]) * R;
+        Result.M[2][1] = (-M[0][0] * Cof[4] + M[0][1] * Cof[2] - M[0][3] * Cof[0]) * R;
+        Result.M[2][2] = (M[3][0] * Sub[4] - M[3][1] * Sub[2] + M[3][3] * Sub[0]) * R;
+        Result.M[2][3] = (-M[2][0] * Sub[4] + M[2][1] * Sub[2] - M[2][3] * Sub[0]) * R;
+        Result.M[3][0] = (-M[1][0] * Cof[3] + M[1][1] * Cof[1] - M[1][2] * Cof[0]) * R;
+        Result.M[3][1] = (M[0][0] * Cof[3] - M[0][1] * Cof[1] + M[0][2] * Cof[0]) * R;
+        Result.M[3][2] = (-M[3][0] * Sub[3] + M[3][1] * Sub[1] - M[3][2] * Sub[0]) * R;
+        Result.M[3][3] = (M[2][0] * Sub[3] - M[2][1] * Sub[1] + M[2][2] * Sub[0]) * R;
+        return Result;
+#endif
+    }
+
+    /**
+     * Inverse of a matrix whose last column is (0, 0, 0, 1), any rotation, scale, shear and translation.
+     * About half the work of Inverse, singular matrices return the identity.
+     */
+    FMatrix InverseAffine() const
+    {
+        const MVector X = GetScaledAxis(0);
+        const MVector Y = GetScaledAxis(1);
+        const MVector Z = GetScaledAxis(2);
+
+        // The columns of the inverse 3x3 are the cross products of the rows over the determinant
+        const MVector YZ = Y ^ Z;
+        const float Det = X | YZ;
+        if (Det == 0.0f)
+        {
+            return Identity;
+        }
+
+        const float R = 1.0f / Det;
+        const MVector Column0 = YZ * R;
+        const MVector Column1 = (Z ^ X) * R;
+        const MVector Column2 = (X ^ Y) * R;
+        const MVector InvX(Column0.x, Column1.x, Column2.x);
+        const MVector InvY(Column0.y, Column1.y, Column2.y);
+        const MVector InvZ(Column0.z, Column1.z, Column2.z);
+        const MVector Origin = GetOrigin();
+        return FMatrix(InvX, InvY, InvZ, -(InvX * Origin.x + InvY * Origin.y + InvZ * Origin.z));
+    }
+
+    /** Rotation of a matrix without scale, see FTransform for matrices with scale. */
+    FQuat ToQuat() const
+    {
+        const float Trace = M[0][0] + M[1][1] + M[2][2];
+        if (Trace > 0.0f)
+        {
+            const float InvS = 1.0f / sqrtf(Trace + 1.0f);
+            const float S = 0.5f * InvS;
+            return FQuat((M[1][2] - M[2][1]) * S, (M[2][0] - M[0][2]) * S, (M[0][1] - M[1][0]) * S, 0.5f / InvS);
+        }
+
+        // Build from the largest diagonal element, the trace is too small to divide by
+        int32_t I = 0;
+        I = M[1][1] > M[0][0] ? 1 : I;
+        I = M[2][2] > M[I][I] ? 2 : I;
+        const int32_t J = (I + 1) % 3;
+        const int32_t K = (J + 1) % 3;
+
+        const float InvS = 1.0f / sqrtf(M[I][I] - M[J][J] - M[K][K] + 1.0f);
+        const float S = 0.5f * InvS;
+        float Q[4];
+        Q[I] = 0.5f / InvS;
+        Q[J] = (M[I][J] + M[J][I]) * S;
+        Q[K] = (M[I][K] + M[K][I]) * S;
+        Q[3] = (M[J][K] - M[K][J]) * S;
+        return FQuat(Q[0], Q[1], Q[2], Q[3]);
+    }
+
+    static FMatrix MakeRotation(const FQuat& Q)
+    {
+        const float X2 = Q.x + Q.x, Y2 = Q.y + Q.y, Z2 = Q.z + Q.z;
+        const float XX2 = Q.x * X2, YY2 = Q.y * Y2, ZZ2 = Q.z * Z2;
+        const float XY2 = Q.x * Y2, XZ2 = Q.x * Z2, YZ2 = Q.y * Z2;
+        const float WX2 = Q.w * X2, WY2 = Q.w * Y2, WZ2 = Q.w * Z2;
+        return FMatrix(
+            MVector(1.0f - (YY2 + ZZ2), XY2 + WZ2, XZ2 - WY2),
+            MVector(XY2 - WZ2, 1.0f - (XX2 + ZZ2), YZ2 + WX2),
+            MVector(XZ2 + WY2, YZ2 - WX2, 1.0f - (XX2 + YY2)),
+            MVector::ZeroVector);
+    }
+
+    static FMatrix MakeTranslation(const MVector& Translation)
+    {
+        return FMatrix(MVector::ForwardVector, MVector::RightVector, MVector::UpVector, Translation);
+    }
+
+    static FMatrix MakeScale(const MVector& Scale)
+    {
+        return FMatrix(MVector(Scale.x, 0.0f, 0.0f), MVector(0.0f, Scale.y, 0.0f), MVector(0.0f, 0.0f, Scale.z), MVector::ZeroVector);
+    }
+
+    std::string ToString() const
+    {
+        std::string Result;
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            Result += "[" + std::to_string(M[Row][0]) + " " + std::to_string(M[Row][1]) + " " + std::to_string(M[Row][2]) + " " + std::to_string(M[Row][3]) + "] ";
+        }
+        return Result;
+    }
+
+private:
+#if MIKASA_SIMD_AVX || MIKASA_SIMD_SSE2
+    /** Lanes X, Y, Z and W of V. */
+    template <int X, int Y, int Z, int W>
+    static __m128 Swizzle(const __m128& V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    /** Lanes X and Y of A followed by lanes Z and W of B. */
+    template <int X, int Y, int Z, int W>
+    static __m128 Shuffle(const __m128& A, const __m128& B) { return _mm_shuffle_ps(A, B, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    /** Products of 2x2 matrices packed row major: A B, Adj(A) B and A Adj(B). */
+    static __m128 Mat2Mul(const __m128& A, const __m128& B)
+    {
+        return _mm_add_ps(_mm_mul_ps(A, Swizzle<0, 3, 0, 3>(B)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(A), Swizzle<2, 1, 2, 1>(B)));
+    }
+
+    static __m128 Mat2AdjMul(const __m128& A, const __m128& B)
+    {
+        return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(A), B), _mm_mul_ps(Swizzle<1, 1, 2, 2>(A), Swizzle<2, 3, 0, 1>(B)));
+    }
+
+    static __m128 Mat2MulAdj(const __m128& A, const __m128& B)
+    {
+        return _mm_sub_ps(_mm_mul_ps(A, Swizzle<3, 0, 3, 0>(B)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(A), Swizzle<2, 1, 2, 1>(B)));
+    }
+#endif
+
+    /** 2x2 determinants of the upper two rows in Sub and of the lower two rows in Cof. */
+    void GetSubDeterminants(float* Sub, float* Cof) const
+    {
+        Sub[0] = M[0][0] * M[1][1] - M[1][0] * M[0][1];
+        Sub[1] = M[0][0] * M[1][2] - M[1][0] * M[0][2];
+        Sub[2] = M[0][0] * M[1][3] - M[1][0] * M[0][3];
+        Sub[3] = M[0][1] * M[1][2] - M[1][1] * M[0][2];
+        Sub[4] = M[0][1] * M[1][3] - M[1][1] * M[0][3];
+        Sub[5] = M[0][2] * M[1][3] - M[1][2] * M[0][3];
+        Cof[0] = M[2][0] * M[3][1] - M[3][0] * M[2][1];
+        Cof[1] = M[2][0] * M[3][2] - M[3][0] * M[2][2];
+        Cof[2] = M[2][0] * M[3][3] - M[3][0] * M[2][3];
+        Cof[3] = M[2][1] * M[3][2] - M[3][1] * M[2][2];
+        Cof[4] = M[2][1] * M[3][3] - M[3][1] * M[2][3];
+        Cof[5] = M[2][2] * M[3][3] - M[3][2] * M[2][3];
+    }
+};
+
+inline const FMatrix FMatrix::Identity;
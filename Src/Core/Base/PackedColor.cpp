@@ -0,0 +1,221 @@
+#include "PackedColor.h"
+
+#include "Base/MathUtil.h"
+
+namespace
+{
+    uint32_t FloatToBits(float Value)
+    {
+        uint32_t Bits;
+        std::memcpy(&Bits, &Value, sizeof(float));
+        return Bits;
+    }
+
+    float BitsToFloat(uint32_t Bits)
+    {
+        float Value;
+        std::memcpy(&Value, &Bits, sizeof(float));
+        return Value;
+    }
+
+    /** Value >> Shift rounded to nearest, ties to even. */
+    uint32_t ShiftRightRounded(uint32_t Value, uint32_t Shift)
+    {
+        if (Shift == 0)
+        {
+            return Value;
+        }
+        if (Shift > 31)
+        {
+            return 0;
+        }
+        return (Value + (1u << (Shift - 1)) - 1 + ((Value >> Shift) & 1)) >> Shift;
+    }
+
+    /**
+     * Magnitude of Value as a float with 5 exponent bits (bias 15) and MantissaBits mantissa bits, rounded
+     * to nearest even, the sign is ignored. Overflow gives infinity, or the largest finite value with
+     * bSaturate. Infinities and NaNs are kept. With 10 mantissa bits this is the FFloat16 magnitude.
+     */
+    uint32_t FloatToSmallFloat(float Value, uint32_t MantissaBits, bool bSaturate)
+    {
+        const uint32_t Magnitude = FloatToBits(Value) & 0x7FFFFFFF;
+        const uint32_t Infinity = 31u << MantissaBits;
+        const uint32_t Shift = 23 - MantissaBits;
+        if (Magnitude >= 0x7F800000)
+        {
+            return Magnitude > 0x7F800000 ? Infinity | (1u << (MantissaBits - 1)) : Infinity;
+        }
+
+        // Exponent 113 is 2^-14, the smallest normal of the small float
+        uint32_t Result;
+        const uint32_t Exponent = Magnitude >> 23;
+        if (Exponent < 113)
+        {
+            // Denormal, float denormals are far below its smallest step and round to 0
+            const uint32_t Mantissa = (Magnitude & 0x7FFFFF) | 0x800000;
+            Result = Exponent == 0 ? 0 : ShiftRightRounded(Mantissa, Shift + 113 - Exponent);
+        }
+        else
+        {
+            // Rebiasing keeps exponent and mantissa contiguous, a rounding carry then bumps the exponent
+            Result = ShiftRightRounded(Magnitude - (112u << 23), Shift);
+        }
+        return Result >= Infinity ? (bSaturate ? Infinity - 1 : Infinity) : Result;
+    }
+
+    float SmallFloatToFloat(uint32_t Bits, uint32_t MantissaBits)
+    {
+        const uint32_t Exponent = Bits >> MantissaBits;
+        const uint32_t Mantissa = Bits & ((1u << MantissaBits) - 1);
+        if (Exponent == 0)
+        {
+            // Mantissa * 2^(-14 - MantissaBits), both factors exact
+            return (float)Mantissa * BitsToFloat((127 - 14 - MantissaBits) << 23);
+        }
+
+        const uint32_t FloatExponent = Exponent == 31 ? 255 : Exponent + 112;
+        return BitsToFloat((FloatExponent << 23) | (Mantissa << (23 - MantissaBits)));
+    }
+
+    /** Non-negative small float, negative values (and negative zero) become 0. */
+    uint32_t FloatToUnsignedSmallFloat(float Value, uint32_t MantissaBits)
+    {
+        return (FloatToBits(Value) & 0x80000000) && !(Value != Value) ? 0 : FloatToSmallFloat(Value, MantissaBits, true);
+    }
+
+    /** Converts arrays with a per color conversion. */
+    template <typename FromType, typename ToType, typename ConvertType>
+    void ConvertColors(const FromType* Colors, int32_t NumColors, ToType* OutColors, ConvertType Convert)
+    {
+        for (int32_t Index = 0; Index < NumColors; ++Index)
+        {
+            OutColors[Index] = Convert(Colors[Index]);
+        }
+    }
+}
+
+FColorRGBA8::FColorRGBA8(const FColor& Color, bool bSRGB)
+{
+    const FColor Encoded = bSRGB ? Color.ToSRGB() : Color;
+    FColor::PackRGBA8(&Encoded, 1, &Packed);
+}
+
+FColor FColorRGBA8::ToColor(bool bSRGB) const
+{
+    const FColor Color((float)GetR() / 255.0f, (float)GetG() / 255.0f, (float)GetB() / 255.0f, (float)GetA() / 255.0f);
+    return bSRGB ? Color.ToLinear() : Color;
+}
+
+void FColorRGBA8::FromColors(const FColor* Colors, int32_t NumColors, FColorRGBA8* OutColors, bool bSRGB)
+{
+    static_assert(sizeof(FColorRGBA8) == sizeof(uint32_t), "FColorRGBA8 must alias uint32_t");
+
+    uint32_t* OutPacked = &OutColors[0].Packed;
+    if (!bSRGB)
+    {
+        FColor::PackRGBA8(Colors, NumColors, OutPacked);
+        return;
+    }
+
+    for (int32_t Index = 0; Index < NumColors; Index += FColorWide::Lanes)
+    {
+        const int32_t Num = FMath::Min(NumColors - Index, FColorWide::Lanes);
+        alignas(32) int32_t Buffer[FColorWide::Lanes];
+        FColorWide::Load(Colors + Index, Num).ToSRGB().PackRGBA8().Store(Buffer);
+        std::memcpy(OutPacked + Index, Buffer, Num * sizeof(uint32_t));
+    }
+}
+
+void FColorRGBA8::ToColors(const FColorRGBA8* Colors, int32_t NumColors, FColor* OutColors, bool bSRGB)
+{
+    FColor::UnpackRGBA8(&Colors[0].Packed, NumColors, OutColors, bSRGB);
+}
+
+FColorRGB9E5::FColorRGB9E5(const FColor& Color)
+{
+    // Shared exponent encoding of EXT_texture_shared_exponent: 9 mantissa bits, exponent bias 15
+    auto ClampChannel = [](float Value)
+    {
+        return Value > 0.0f ? FMath::Min(Value, MaxValue) : 0.0f;
+    };
+    const float R = ClampChannel(Color.R);
+    const float G = ClampChannel(Color.G);
+    const float B = ClampChannel(Color.B);
+    const float MaxChannel = FMath::Max3(R, G, B);
+
+    // floor(log2(MaxChannel)) from the float exponent, at least -16 so zero and tiny values use exponent 0
+    const int32_t MaxExponent = FMath::Max((int32_t)(FloatToBits(MaxChannel) >> 23) - 127, -16);
+    int32_t Exponent = MaxExponent + 16;
+
+    // 2^(24 - Exponent) scales the channels to mantissa units, rounding may push the largest one to 512
+    if ((uint32_t)floorf(MaxChannel * BitsToFloat((uint32_t)(127 + 24 - Exponent) << 23) + 0.5f) == 512)
+    {
+        ++Exponent;
+    }
+
+    const float Scale = BitsToFloat((uint32_t)(127 + 24 - Exponent) << 23);
+    Packed = FColorRGB9E5((uint32_t)floorf(R * Scale + 0.5f), (uint32_t)floorf(G * Scale + 0.5f), (uint32_t)floorf(B * Scale + 0.5f), (uint32_t)Exponent).Packed;
+}
+
+FColor FColorRGB9E5::ToColor() const
+{
+    // 2^(Exponent - 24), Exponent - 24 stays within normal floats
+    const float Scale = BitsToFloat((127 + (Packed >> 27) - 24) << 23);
+    return FColor((float)(Packed & 0x1FF) * Scale, (float)((Packed >> 9) & 0x1FF) * Scale, (float)((Packed >> 18) & 0x1FF) * Scale, 1.0f);
+}
+
+void FColorRGB9E5::FromColors(const FColor* Colors, int32_t NumColors, FColorRGB9E5* OutColors)
+{
+    ConvertColors(Colors, NumColors, OutColors, [](const FColor& Color) { return FColorRGB9E5(Color); });
+}
+
+void FColorRGB9E5::ToColors(const FColorRGB9E5* Colors, int32_t NumColors, FColor* OutColors)
+{
+    ConvertColors(Colors, NumColors, OutColors, [](const FColorRGB9E5& Color) { return Color.ToColor(); });
+}
+
+FColorR11G11B10F::FColorR11G11B10F(const FColor& Color)
+    : Packed(FloatToUnsignedSmallFloat(Color.R, 6) | (FloatToUnsignedSmallFloat(Color.G, 6) << 11) | (FloatToUnsignedSmallFloat(Color.B, 5) << 22))
+{
+}
+
+FColor FColorR11G11B10F::ToColor() const
+{
+    return FColor(SmallFloatToFloat(Packed & 0x7FF, 6), SmallFloatToFloat((Packed >> 11) & 0x7FF, 6), SmallFloatToFloat(Packed >> 22, 5), 1.0f);
+}
+
+void FColorR11G11B10F::FromColors(const FColor* Colors, int32_t NumColors, FColorR11G11B10F* OutColors)
+{
+    ConvertColors(Colors, NumColors, OutColors, [](const FColor& Color) { return FColorR11G11B10F(Color); });
+}
+
+void FColorR11G11B10F::ToColors(const FColorR11G11B10F* Colors, int32_t NumColors, FColor* OutColors)
+{
+    ConvertColors(Colors, NumColors, OutColors, [](const FColorR11G11B10F& Color) { return Color.ToColor(); });
+}
+
+FColorRGBA16F::FColorRGBA16F(const FColor& Color)
+    : R(Color.R)
+    , G(Color.G)
+    , B(Color.B)
+    , A(Color.A)
+{
+}
+
+FColor FColorRGBA16F::ToColor() const
+{
+    return FColor(R.GetFloat(), G.GetFloat(), B.GetFloat(), A.GetFloat());
+}
+
+void FColorRGBA16F::FromColors(const FColor* Colors, int32_t NumColors, FColorRGBA16F* OutColors)
+{
+    static_assert(sizeof(FColorRGBA16F) == 4 * sizeof(FFloat16), "FColorRGBA16F must be four packed halves");
+
+    FFloat16::FromFloats(&Colors[0].R, NumColors * 4, &OutColors[0].R);
+}
+
+void FColorRGBA16F::ToColors(const FColorRGBA16F* Colors, int32_t NumColors, FColor* OutColors)
+{
+    FFloat16::ToFloats(&Colors[0].R, NumColors * 4, &OutColors[0].R);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Color.h"
+#include "Base/Float16.h"
+
+/**
+ * Compact storage formats for FColor, for vertex streams, palettes and per-instance data that do
+ * not need four floats per color. The raw constructors are constexpr so tables of packed colors can
+ * be built at compile time, conversions from FColor round to the nearest representable value.
+ */
+
+/** Four unsigned normalized bytes, red in the lowest byte. Optionally sRGB encoded. */
+struct CORE_API FColorRGBA8
+{
+    uint32_t Packed;
+
+    constexpr FColorRGBA8()
+        : Packed(0)
+    {
+    }
+
+    constexpr explicit FColorRGBA8(uint32_t InPacked)
+        : Packed(InPacked)
+    {
+    }
+
+    constexpr FColorRGBA8(uint8_t R, uint8_t G, uint8_t B, uint8_t A = 255)
+        : Packed((uint32_t)R | ((uint32_t)G << 8) | ((uint32_t)B << 16) | ((uint32_t)A << 24))
+    {
+    }
+
+    /** bSRGB encodes the linear color channels with the sRGB curve, alpha is always linear. */
+    explicit FColorRGBA8(const FColor& Color, bool bSRGB = false);
+
+    constexpr uint8_t GetR() const { return (uint8_t)(Packed & 0xFF); }
+    constexpr uint8_t GetG() const { return (uint8_t)((Packed >> 8) & 0xFF); }
+    constexpr uint8_t GetB() const { return (uint8_t)((Packed >> 16) & 0xFF); }
+    constexpr uint8_t GetA() const { return (uint8_t)(Packed >> 24); }
+
+    /** bSRGB decodes the color channels back to linear. */
+    FColor ToColor(bool bSRGB = false) const;
+
+    constexpr bool operator==(const FColorRGBA8& Other) const { return Packed == Other.Packed; }
+    constexpr bool operator!=(const FColorRGBA8& Other) const { return Packed != Other.Packed; }
+
+    static void FromColors(const FColor* Colors, int32_t NumColors, FColorRGBA8* OutColors, bool bSRGB = false);
+    static void ToColors(const FColorRGBA8* Colors, int32_t NumColors, FColor* OutColors, bool bSRGB = false);
+};
+
+/**
+ * Three 9 bit mantissas sharing a 5 bit exponent, the layout of GL_RGB9_E5 and DXGI_FORMAT_R9G9B9E5_SHAREDEXP.
+ * Unsigned HDR color in [0, 65408] without alpha, channels much darker than the brightest one lose precision.
+ */
+struct CORE_API FColorRGB9E5
+{
+    static constexpr float MaxValue = 65408.0f;
+
+    uint32_t Packed;
+
+    constexpr FColorRGB9E5()
+        : Packed(0)
+    {
+    }
+
+    constexpr explicit FColorRGB9E5(uint32_t InPacked)
+        : Packed(InPacked)
+    {
+    }
+
+    constexpr FColorRGB9E5(uint32_t RMantissa, uint32_t GMantissa, uint32_t BMantissa, uint32_t Exponent)
+        : Packed((RMantissa & 0x1FF) | ((GMantissa & 0x1FF) << 9) | ((BMantissa & 0x1FF) << 18) | (Exponent << 27))
+    {
+    }
+
+    /** Negative and NaN channels become 0, larger ones are clamped to MaxValue. Alpha is dropped. */
+    explicit FColorRGB9E5(const FColor& Color);
+
+    /** Alpha is 1. */
+    FColor ToColor() const;
+
+    constexpr bool operator==(const FColorRGB9E5& Other) const { return Packed == Other.Packed; }
+    constexpr bool operator!=(const FColorRGB9E5& Other) const { return Packed != Other.Packed; }
+
+    static void FromColors(const FColor* Colors, int32_t NumColors, FColorRGB9E5* OutColors);
+    static void ToColors(const FColorRGB9E5* Colors, int32_t NumColors, FColor* OutColors);
+};
+
+/**
+ * Unsigned floats with 5 exponent bits and 6, 6 and 5 mantissa bits, red in the lowest bits, the layout
+ * of GL_R11F_G11F_B10F and DXGI_FORMAT_R11G11B10_FLOAT. Unsigned HDR color up to 65024 without alpha.
+ */
+struct CORE_API FColorR11G11B10F
+{
+    uint32_t Packed;
+
+    constexpr FColorR11G11B10F()
+        : Packed(0)
+    {
+    }
+
+    constexpr explicit FColorR11G11B10F(uint32_t InPacked)
+        : Packed(InPacked)
+    {
+    }
+
+    /** Negative channels become 0 and finite values above the range saturate, infinities and NaNs are kept. Alpha is dropped. */
+    explicit FColorR11G11B10F(const FColor& Color);
+
+    /** Alpha is 1. */
+    FColor ToColor() const;
+
+    constexpr bool operator==(const FColorR11G11B10F& Other) const { return Packed == Other.Packed; }
+    constexpr bool operator!=(const FColorR11G11B10F& Other) const { return Packed != Other.Packed; }
+
+    static void FromColors(const FColor* Colors, int32_t NumColors, FColorR11G11B10F* OutColors);
+    static void ToColors(const FColorR11G11B10F* Colors, int32_t NumColors, FColor* OutColors);
+};
+
+/** Four FFloat16, signed HDR color with alpha. Values beyond 65504 round to infinity like the GPU does. */
+struct CORE_API FColorRGBA16F
+{
+    FFloat16 R, G, B, A;
+
+    constexpr FColorRGBA16F()
+    {
+    }
+
+    constexpr FColorRGBA16F(FFloat16 InR, FFloat16 InG, FFloat16 InB, FFloat16 InA)
+        : R(InR), G(InG), B(InB), A(InA)
+    {
+    }
+
+    explicit FColorRGBA16F(const FColor& Color);
+
+    FColor ToColor() const;
+
+    constexpr bool operator==(const FColorRGBA16F& Other) const
+    {
+        return R.Encoded == Other.R.Encoded && G.Encoded == Other.G.Encoded && B.Encoded == Other.B.Encoded && A.Encoded == Other.A.Encoded;
+    }
+    constexpr bool operator!=(const FColorRGBA16F& Other) const { return !(*this == Other); }
+
+    /** Converted as one float stream, on F16C where available. */
+    static void FromColors(const FColor* Colors, int32_t NumColors, FColorRGBA16F* OutColors);
+    static void ToColors(const FColorRGBA16F* Colors, int32_t NumColors, FColor* OutColors);
+};
+
+static_assert(sizeof(FColorRGBA8) == 4 && sizeof(FColorRGB9E5) == 4 && sizeof(FColorR11G11B10F) == 4, "Packed colors must be 32 bits");
+static_assert(sizeof(FColorRGBA16F) == 8, "FColorRGBA16F must be 64 bits");
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Vector.h"
+
+/**
+ * Plane of the points P with (X, Y, Z) | P == W. The normal (X, Y, Z) points to the front side,
+ * where PlaneDot is positive.
+ */
+struct FPlane : public MVector
+{
+    float W;
+
+    constexpr FPlane()
+        : MVector(), W(0.0f)
+    {
+    }
+
+    constexpr FPlane(float InX, float InY, float InZ, float InW)
+        : MVector(InX, InY, InZ), W(InW)
+    {
+    }
+
+    constexpr FPlane(const MVector& InNormal, float InW)
+        : MVector(InNormal), W(InW)
+    {
+    }
+
+    /** Plane through InBase facing InNormal. */
+    FPlane(const MVector& InBase, const MVector& InNormal)
+        : MVector(InNormal), W(InBase | InNormal)
+    {
+    }
+
+    /** Plane through three points, facing the side (B - A) ^ (C - A) points to. */
+    FPlane(const MVector& A, const MVector& B, const MVector& C)
+        : MVector(((B - A) ^ (C - A)).GetSafeNormal()), W(A | GetNormal())
+    {
+    }
+
+    MVector GetNormal() const { return MVector(x, y, z); }
+
+    /** Signed distance of P to the plane, scaled by the normal's length. */
+    float PlaneDot(const MVector& P) const
+    {
+        return x * P.x + y * P.y + z * P.z - W;
+    }
+
+    FPlane Flip() const
+    {
+        return FPlane(-x, -y, -z, -W);
+    }
+
+    /** Scales the normal to unit length, returns false and keeps the plane if it is too short. */
+    bool Normalize(float Tolerance = 1.e-8f)
+    {
+        const float SquareSum = SizeSquared();
+        if (SquareSum > Tolerance)
+        {
+            const float Scale = 1.0f / sqrtf(SquareSum);
+            x *= Scale;
+            y *= Scale;
+            z *= Scale;
+            W *= Scale;
+            return true;
+        }
+        return false;
+    }
+
+    std::string ToString() const
+    {
+        return MVector::ToString() + " W=" + std::to_string(W);
+    }
+};
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+
+#include "glm/gtc/quaternion.hpp"
+
+/**
+ * Rotation quaternion. Composition follows the Hamilton product like glm: A * B first rotates by B,
+ * then by A. Converts to and from glm::quat, whose constructor takes w first.
+ *
+ * Euler angles are in degrees and packed as MVector(Roll, Pitch, Yaw), rotations around X, Y and Z
+ * for MVector::ForwardVector, RightVector and UpVector.
+ */
+struct alignas(16) FQuat
+{
+    float x, y, z, w;
+
+    static const FQuat Identity;
+
+    constexpr FQuat()
+        : x(0.0f), y(0.0f), z(0.0f), w(1.0f)
+    {
+    }
+
+    constexpr FQuat(float InX, float InY, float InZ, float InW)
+        : x(InX), y(InY), z(InZ), w(InW)
+    {
+    }
+
+    /** Rotation of Angle radians around a unit length Axis. */
+    FQuat(const MVector& Axis, float Angle)
+    {
+        const float HalfAngle = 0.5f * Angle;
+        const float S = sinf(HalfAngle);
+        x = Axis.x * S;
+        y = Axis.y * S;
+        z = Axis.z * S;
+        w = cosf(HalfAngle);
+    }
+
+    FQuat(const glm::quat& Q)
+        : x(Q.x), y(Q.y), z(Q.z), w(Q.w)
+    {
+    }
+
+    operator glm::quat() const
+    {
+        return glm::quat(w, x, y, z);
+    }
+
+    FQuat operator+(const FQuat& Q) const { return FQuat(x + Q.x, y + Q.y, z + Q.z, w + Q.w); }
+    FQuat operator-(const FQuat& Q) const { return FQuat(x - Q.x, y - Q.y, z - Q.z, w - Q.w); }
+    FQuat operator*(float Scale) const { return FQuat(x * Scale, y * Scale, z * Scale, w * Scale); }
+    FQuat operator-() const { return FQuat(-x, -y, -z, -w); }
+
+    /** Rotation by Q followed by this rotation. */
+    FQuat operator*(const FQuat& Q) const
+    {
+        return FQuat(
+            w * Q.x + x * Q.w + y * Q.z - z * Q.y,
+            w * Q.y - x * Q.z + y * Q.w + z * Q.x,
+            w * Q.z + x * Q.y - y * Q.x + z * Q.w,
+            w * Q.w - x * Q.x - y * Q.y - z * Q.z);
+    }
+
+    FQuat& operator*=(const FQuat& Q) { return *this = *this * Q; }
+
+    bool operator==(const FQuat& Q) const { return x == Q.x && y == Q.y && z == Q.z && w == Q.w; }
+    bool operator!=(const FQuat& Q) const { return !(*this == Q); }
+
+    /** Dot product */
+    float operator|(const FQuat& Q) const { return x * Q.x + y * Q.y + z * Q.z + w * Q.w; }
+
+    float Size() const { return sqrtf(SizeSquared()); }
+    float SizeSquared() const { return x * x + y * y + z * z + w * w; }
+
+    bool IsNormalized() const { return fabsf(1.0f - SizeSquared()) < THRESH_QUAT_NORMALIZED; }
+
+    /** Normalizes in place, quaternions too short to normalize become the identity. */
+    void Normalize(float Tolerance = SMALL_NUMBER)
+    {
+        const float SquareSum = SizeSquared();
+        *this = SquareSum >= Tolerance ? *this * (1.0f / sqrtf(SquareSum)) : Identity;
+    }
+
+    FQuat GetNormalized(float Tolerance = SMALL_NUMBER) const
+    {
+        FQuat Result(*this);
+        Result.Normalize(Tolerance);
+        return Result;
+    }
+
+    /** Inverse of a unit quaternion, the conjugate. */
+    FQuat Inverse() const { return FQuat(-x, -y, -z, w); }
+
+    /** Rotates V, the quaternion must be normalized. */
+    MVector RotateVector(const MVector& V) const
+    {
+        // V + 2w (Q x V) + 2 Q x (Q x V), two cross products instead of two quaternion products
+        const MVector Q(x, y, z);
+        const MVector T = (Q ^ V) * 2.0f;
+        return V + T * w + (Q ^ T);
+    }
+
+    MVector UnrotateVector(const MVector& V) const
+    {
+        const MVector Q(-x, -y, -z);
+        const MVector T = (Q ^ V) * 2.0f;
+        return V + T * w + (Q ^ T);
+    }
+
+    MVector GetAxisX() const { return RotateVector(MVector::ForwardVector); }
+    MVector GetAxisY() const { return RotateVector(MVector::RightVector); }
+    MVector GetAxisZ() const { return RotateVector(MVector::UpVector); }
+
+    /** Rotation angle in radians, in [0, 2 Pi]. */
+    float GetAngle() const { return 2.0f * FMath::Acos(w); }
+
+    /** Rotation axis, X for rotations too small to have one. */
+    MVector GetRotationAxis() const
+    {
+        const float SquareSum = FMath::Max(1.0f - w * w, 0.0f);
+        return SquareSum >= 1.e-8f ? MVector(x, y, z) * (1.0f / sqrtf(SquareSum)) : MVector::ForwardVector;
+    }
+
+    /** Angular distance in radians between two unit quaternions. */
+    float AngularDistance(const FQuat& Q) const
+    {
+        const float InnerProduct = *this | Q;
+        return FMath::Acos(2.0f * InnerProduct * InnerProduct - 1.0f);
+    }
+
+    bool Equals(const FQuat& Q, float Tolerance = KINDA_SMALL_NUMBER) const
+    {
+        // Q and -Q are the same rotation
+        return (fabsf(x - Q.x) <= Tolerance && fabsf(y - Q.y) <= Tolerance && fabsf(z - Q.z) <= Tolerance && fabsf(w - Q.w) <= Tolerance)
+            || (fabsf(x + Q.x) <= Tolerance && fabsf(y + Q.y) <= Tolerance && fabsf(z + Q.z) <= Tolerance && fabsf(w + Q.w) <= Tolerance);
+    }
+
+    /** Rotation from Euler angles in degrees, MVector(Roll, Pitch, Yaw), yaw applied last. */
+    static FQuat MakeFromEuler(const MVector& Euler)
+    {
+        const float HalfDegToRad = PI / 360.0f;
+        const float SR = sinf(Euler.x * HalfDegToRad), CR = cosf(Euler.x * HalfDegToRad);
+        const float SP = sinf(Euler.y * HalfDegToRad), CP = cosf(Euler.y * HalfDegToRad);
+        const float SY = sinf(Euler.z * HalfDegToRad), CY = cosf(Euler.z * HalfDegToRad);
+        return FQuat(
+            CR * SP * SY - SR * CP * CY,
+            -CR * SP * CY - SR * CP * SY,
+            CR * CP * SY - SR * SP * CY,
+            CR * CP * CY + SR * SP * SY);
+    }
+
+    /** Inverse of MakeFromEuler, angles in (-180, 180], pitch in [-90, 90]. */
+    MVector Euler() const
+    {
+        // Pitch is +-90 at the singularity, where yaw and roll rotate around the same axis
+        const float SingularityTest = z * x - w * y;
+        const float YawY = 2.0f * (w * z + x * y);
+        const float YawX = 1.0f - 2.0f * (y * y + z * z);
+        const float SingularityThreshold = 0.4999995f;
+
+        const float Yaw = FMath::RadiansToDegrees(FMath::Atan2(YawY, YawX));
+        if (SingularityTest < -SingularityThreshold)
+        {
+            return MVector(FMath::UnwindDegrees(-Yaw - 2.0f * FMath::RadiansToDegrees(FMath::Atan2(x, w))), -90.0f, Yaw);
+        }
+        if (SingularityTest > SingularityThreshold)
+        {
+            return MVector(FMath::UnwindDegrees(Yaw - 2.0f * FMath::RadiansToDegrees(FMath::Atan2(x, w))), 90.0f, Yaw);
+        }
+        return MVector(
+            FMath::RadiansToDegrees(FMath::Atan2(-2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y))),
+            FMath::RadiansToDegrees(FMath::Asin(2.0f * SingularityTest)),
+            Yaw);
+    }
+
+    /** Shortest rotation taking unit vector A to unit vector B. */
+    static FQuat FindBetweenNormals(const MVector& A, const MVector& B)
+    {
+        const float W = 1.0f + (A | B);
+        if (W >= 1.e-6f)
+        {
+            return FQuat(A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x, W).GetNormalized();
+        }
+
+        // Opposite vectors, rotate half a turn around any axis orthogonal to A
+        return (fabsf(A.x) > fabsf(A.y) ? FQuat(-A.z, 0.0f, A.x, 0.0f) : FQuat(0.0f, -A.z, A.y, 0.0f)).GetNormalized();
+    }
+
+    /** Normalized linear interpolation along the shortest path, cheaper than Slerp and close to it below 90 degrees. */
+    static FQuat Nlerp(const FQuat& A, const FQuat& B, float Alpha)
+    {
+        const float Bias = (A | B) >= 0.0f ? 1.0f : -1.0f;
+        return (A * (1.0f - Alpha) + B * (Alpha * Bias)).GetNormalized();
+    }
+
+    /** Spherical interpolation along the shortest path, constant angular velocity. */
+    static FQuat Slerp(const FQuat& A, const FQuat& B, float Alpha)
+    {
+        const float RawCosom = A | B;
+        const float Cosom = fabsf(RawCosom);
+
+        float ScaleA, ScaleB;
+        if (Cosom < 0.9999f)
+        {
+            const float Omega = acosf(Cosom);
+            const float InvSin = 1.0f / sinf(Omega);
+            ScaleA = sinf((1.0f - Alpha) * Omega) * InvSin;
+            ScaleB = sinf(Alpha * Omega) * InvSin;
+        }
+        else
+        {
+            // Nearly parallel, sin(Omega) is too small to divide by
+            ScaleA = 1.0f - Alpha;
+            ScaleB = Alpha;
+        }
+
+        ScaleB = RawCosom >= 0.0f ? ScaleB : -ScaleB;
+        return (A * ScaleA + B * ScaleB).GetNormalized();
+    }
+
+    std::string ToString() const
+    {
+        return "X=" + std::to_string(x) + " Y=" + std::to_string(y) + " Z=" + std::to_string(z) + " W=" + std::to_string(w);
+    }
+};
+
+inline const FQuat FQuat::Identity(0.0f, 0.0f, 0.0f, 1.0f);
@@ -0,0 +1,293 @@
+#include "RandomStream.h"
+#include "MathUtil.h"
+
+#include <atomic>
+
+namespace
+{
+    uint64_t SplitMix64(uint64_t& Seed)
+    {
+        uint64_t Z = (Seed += 0x9E3779B97F4A7C15ull);
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+        return Z ^ (Z >> 31);
+    }
+
+    /** FFloatWide::Lanes xoshiro128++ generators in structure of arrays layout. */
+    struct FRandomStreamWide
+    {
+        FIntWide State[4];
+
+        explicit FRandomStreamWide(FRandomStream& Parent)
+        {
+            alignas(32) int32_t Lanes[4][FFloatWide::Lanes];
+            for (int32_t Lane = 0; Lane < FFloatWide::Lanes; ++Lane)
+            {
+                uint64_t Seed = Parent.GetUnsignedInt64();
+                const uint64_t Low = SplitMix64(Seed);
+                const uint64_t High = SplitMix64(Seed);
+                Lanes[0][Lane] = (int32_t)Low;
+                Lanes[1][Lane] = (int32_t)(Low >> 32);
+                Lanes[2][Lane] = (int32_t)High;
+                Lanes[3][Lane] = (int32_t)(High >> 32);
+            }
+
+            for (int32_t Word = 0; Word < 4; ++Word)
+            {
+                State[Word] = FIntWide::Load(Lanes[Word]);
+            }
+        }
+
+        static FIntWide RotateLeft(const FIntWide& Value, int32_t Shift)
+        {
+            return Value.ShiftLeft(Shift) | Value.ShiftRightLogical(32 - Shift);
+        }
+
+        FIntWide GetUnsignedInt()
+        {
+            const FIntWide Result = RotateLeft(State[0] + State[3], 7) + State[0];
+            const FIntWide T = State[1].ShiftLeft(9);
+            State[2] = State[2] ^ State[0];
+            State[3] = State[3] ^ State[1];
+            State[1] = State[1] ^ State[2];
+            State[0] = State[0] ^ State[3];
+            State[2] = State[2] ^ T;
+            State[3] = RotateLeft(State[3], 11);
+            return Result;
+        }
+
+        /** [0, 1) from the top 24 bits. */
+        FFloatWide GetFraction()
+        {
+            return GetUnsignedInt().ShiftRightLogical(8).ToFloat() * FFloatWide(1.0f / 16777216.0f);
+        }
+    };
+
+    // Below this many values seeding the wide streams costs more than it saves
+    constexpr int32_t MinWideFill = 64;
+
+    std::atomic<uint64_t> ThreadStreamSeed{ 0 };
+    std::atomic<uint32_t> ThreadStreamGeneration{ 0 };
+    std::atomic<uint32_t> NextThreadStreamIndex{ 0 };
+
+    struct FThreadStreamSlot
+    {
+        FRandomStream Stream;
+        uint32_t StreamIndex = ~0u;
+        uint32_t Generation = ~0u;
+    };
+
+    thread_local FThreadStreamSlot ThreadStreamSlot;
+}
+
+void FRandomStream::Initialize(uint64_t Seed)
+{
+    // SplitMix64 never yields four zero words in a row, the only state xoshiro can't leave
+    const uint64_t Low = SplitMix64(Seed);
+    const uint64_t High = SplitMix64(Seed);
+    State[0] = (uint32_t)Low;
+    State[1] = (uint32_t)(Low >> 32);
+    State[2] = (uint32_t)High;
+    State[3] = (uint32_t)(High >> 32);
+}
+
+void FRandomStream::Jump()
+{
+    static const uint32_t JumpTable[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+    uint32_t Jumped[4] = { 0, 0, 0, 0 };
+    for (uint32_t JumpWord : JumpTable)
+    {
+        for (int32_t Bit = 0; Bit < 32; ++Bit)
+        {
+            if (JumpWord & (1u << Bit))
+            {
+                Jumped[0] ^= State[0];
+                Jumped[1] ^= State[1];
+                Jumped[2] ^= State[2];
+                Jumped[3] ^= State[3];
+            }
+            GetUnsignedInt();
+        }
+    }
+
+    State[0] = Jumped[0];
+    State[1] = Jumped[1];
+    State[2] = Jumped[2];
+    State[3] = Jumped[3];
+}
+
+uint64_t FRandomStream::RandHelper64(uint64_t Range)
+{
+    if (Range <= 0xFFFFFFFFull)
+    {
+        return RandHelper((uint32_t)Range);
+    }
+
+    // Same as RandHelper with a 64x64 -> 128 bit product split in 32 bit halves
+    const auto MultiplyFull = [](uint64_t A, uint64_t B, uint64_t& OutLow)
+    {
+        const uint64_t LowLow = (A & 0xFFFFFFFFull) * (B & 0xFFFFFFFFull);
+        const uint64_t HighLow = (A >> 32) * (B & 0xFFFFFFFFull);
+        const uint64_t LowHigh = (A & 0xFFFFFFFFull) * (B >> 32);
+        const uint64_t HighHigh = (A >> 32) * (B >> 32);
+        const uint64_t Middle = (LowLow >> 32) + (HighLow & 0xFFFFFFFFull) + LowHigh;
+        OutLow = (Middle << 32) | (LowLow & 0xFFFFFFFFull);
+        return HighHigh + (HighLow >> 32) + (Middle >> 32);
+    };
+
+    uint64_t Low;
+    uint64_t High = MultiplyFull(GetUnsignedInt64(), Range, Low);
+    if (Low < Range)
+    {
+        const uint64_t Threshold = (0ull - Range) % Range;
+        while (Low < Threshold)
+        {
+            High = MultiplyFull(GetUnsignedInt64(), Range, Low);
+        }
+    }
+    return High;
+}
+
+MVector FRandomStream::GetUnitVector()
+{
+    // Archimedes: z is uniform on the sphere
+    const float Z = 1.0f - 2.0f * GetFraction();
+    const float Phi = 2.0f * PI * GetFraction();
+    const float Radius = FMath::Sqrt(FMath::Max(0.0f, 1.0f - Z * Z));
+    return MVector(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+}
+
+void FRandomStream::FillFloats(float* OutValues, int32_t NumValues, float InMin, float InMax)
+{
+    if (NumValues < MinWideFill)
+    {
+        for (int32_t Index = 0; Index < NumValues; ++Index)
+        {
+            OutValues[Index] = FRandRange(InMin, InMax);
+        }
+        return;
+    }
+
+    FRandomStreamWide Wide(*this);
+    const FFloatWide WideMin(InMin);
+    const FFloatWide WideRange(InMax - InMin);
+    int32_t Index = 0;
+    for (; Index + FFloatWide::Lanes <= NumValues; Index += FFloatWide::Lanes)
+    {
+        FFloatWide::MulAdd(Wide.GetFraction(), WideRange, WideMin).Store(OutValues + Index);
+    }
+
+    if (Index < NumValues)
+    {
+        FFloatWide::MulAdd(Wide.GetFraction(), WideRange, WideMin).StorePartial(OutValues + Index, NumValues - Index);
+    }
+}
+
+void FRandomStream::FillUnsignedInts(uint32_t* OutValues, int32_t NumValues)
+{
+    if (NumValues < MinWideFill)
+    {
+        for (int32_t Index = 0; Index < NumValues; ++Index)
+        {
+            OutValues[Index] = GetUnsignedInt();
+        }
+        return;
+    }
+
+    FRandomStreamWide Wide(*this);
+    int32_t Index = 0;
+    for (; Index + FFloatWide::Lanes <= NumValues; Index += FFloatWide::Lanes)
+    {
+        Wide.GetUnsignedInt().Store((int32_t*)(OutValues + Index));
+    }
+
+    if (Index < NumValues)
+    {
+        alignas(32) int32_t Tail[FFloatWide::Lanes];
+        Wide.GetUnsignedInt().Store(Tail);
+        for (int32_t Lane = 0; Index < NumValues; ++Index, ++Lane)
+        {
+            OutValues[Index] = (uint32_t)Tail[Lane];
+        }
+    }
+}
+
+void FRandomStream::FillIntRange(int32_t* OutValues, int32_t NumValues, int32_t Min, int32_t Max)
+{
+    if (Max <= Min)
+    {
+        for (int32_t Index = 0; Index < NumValues; ++Index)
+        {
+            OutValues[Index] = Min;
+        }
+        return;
+    }
+
+    FillUnsignedInts((uint32_t*)OutValues, NumValues);
+
+    const uint32_t Range = (uint32_t)Max - (uint32_t)Min + 1u;
+    if (Range == 0)
+    {
+        // Full int32 range, the raw bits are already uniform
+        return;
+    }
+
+    // Map the raw draws with the same multiply and reject as RandHelper, rejected draws are redrawn from this stream
+    const uint32_t Threshold = (0u - Range) % Range;
+    for (int32_t Index = 0; Index < NumValues; ++Index)
+    {
+        const uint64_t Product = (uint64_t)(uint32_t)OutValues[Index] * Range;
+        const uint32_t Offset = (uint32_t)Product >= Threshold ? (uint32_t)(Product >> 32) : RandHelper(Range);
+        OutValues[Index] = (int32_t)((uint32_t)Min + Offset);
+    }
+}
+
+void FRandomStream::FillUnitVectors(MVector* OutVectors, int32_t NumVectors)
+{
+    if (NumVectors < MinWideFill)
+    {
+        for (int32_t Index = 0; Index < NumVectors; ++Index)
+        {
+            OutVectors[Index] = GetUnitVector();
+        }
+        return;
+    }
+
+    FRandomStreamWide Wide(*this);
+    for (int32_t Index = 0; Index < NumVectors; Index += FFloatWide::Lanes)
+    {
+        const FFloatWide Z = FFloatWide::MulAdd(Wide.GetFraction(), FFloatWide(-2.0f), FFloatWide(1.0f));
+        const FFloatWide Phi = Wide.GetFraction() * FFloatWide(2.0f * PI);
+        const FFloatWide Radius = FFloatWide::Sqrt(FFloatWide::Max(FFloatWide(0.0f), FFloatWide(1.0f) - Z * Z));
+        const MVectorWide Vectors(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+        Vectors.Store(OutVectors + Index, FMath::Min(FFloatWide::Lanes, NumVectors - Index));
+    }
+}
+
+FRandomStream& FRandomStream::GetThreadStream()
+{
+    FThreadStreamSlot& Slot = ThreadStreamSlot;
+    const uint32_t Generation = ThreadStreamGeneration.load(std::memory_order_acquire);
+    if (Slot.Generation != Generation)
+    {
+        if (Slot.StreamIndex == ~0u)
+        {
+            Slot.StreamIndex = NextThreadStreamIndex.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Slot.Stream.Initialize(ThreadStreamSeed.load(std::memory_order_relaxed));
+        for (uint32_t JumpIndex = 0; JumpIndex < Slot.StreamIndex; ++JumpIndex)
+        {
+            Slot.Stream.Jump();
+        }
+        Slot.Generation = Generation;
+    }
+    return Slot.Stream;
+}
+
+void FRandomStream::SetThreadStreamSeed(uint64_t Seed)
+{
+    ThreadStreamSeed.store(Seed, std::memory_order_relaxed);
+    ThreadStreamGeneration.fetch_add(1, std::memory_order_release);
+}
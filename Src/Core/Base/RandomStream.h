@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Vector.h"
+
+/**
+ * Seedable xoshiro128++ generator. Copies are independent streams, Jump() splits off a stream that
+ * never overlaps the original for 2^64 draws. Not thread-safe, use GetThreadStream() for a stream
+ * owned by the calling thread. Integer ranges are unbiased (Lemire's multiply and reject).
+ */
+class CORE_API FRandomStream
+{
+public:
+    FRandomStream()
+    {
+        Initialize(0);
+    }
+
+    explicit FRandomStream(uint64_t Seed)
+    {
+        Initialize(Seed);
+    }
+
+    void Initialize(uint64_t Seed);
+
+    /** Advances the stream by 2^64 draws. */
+    void Jump();
+
+    uint32_t GetUnsignedInt()
+    {
+        const uint32_t Result = RotateLeft(State[0] + State[3], 7) + State[0];
+        const uint32_t T = State[1] << 9;
+        State[2] ^= State[0];
+        State[3] ^= State[1];
+        State[1] ^= State[2];
+        State[0] ^= State[3];
+        State[2] ^= T;
+        State[3] = RotateLeft(State[3], 11);
+        return Result;
+    }
+
+    uint64_t GetUnsignedInt64()
+    {
+        const uint64_t High = GetUnsignedInt();
+        return (High << 32) | GetUnsignedInt();
+    }
+
+    /** Returns a random float in [0, 1). */
+    float GetFraction()
+    {
+        return (GetUnsignedInt() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /** Returns a random number in [0, Range), 0 if Range is 0. */
+    uint32_t RandHelper(uint32_t Range)
+    {
+        uint64_t Product = (uint64_t)GetUnsignedInt() * Range;
+        if ((uint32_t)Product < Range)
+        {
+            // Reject the low products that would make some results more likely, (2^32 - Range) % Range
+            const uint32_t Threshold = (0u - Range) % Range;
+            while ((uint32_t)Product < Threshold)
+            {
+                Product = (uint64_t)GetUnsignedInt() * Range;
+            }
+        }
+        return (uint32_t)(Product >> 32);
+    }
+
+    /** Returns a random number in [0, Range), 0 if Range is 0. */
+    uint64_t RandHelper64(uint64_t Range);
+
+    /** Returns a random number >= Min and <= Max, Min if Max < Min. */
+    int32_t RandRange(int32_t Min, int32_t Max)
+    {
+        if (Max <= Min)
+        {
+            return Min;
+        }
+        // The span wraps to 0 for the full int32 range, in which case every draw is valid
+        const uint32_t Range = (uint32_t)Max - (uint32_t)Min + 1u;
+        const uint32_t Offset = Range != 0 ? RandHelper(Range) : GetUnsignedInt();
+        return (int32_t)((uint32_t)Min + Offset);
+    }
+
+    int64_t RandRange(int64_t Min, int64_t Max)
+    {
+        if (Max <= Min)
+        {
+            return Min;
+        }
+        const uint64_t Range = (uint64_t)Max - (uint64_t)Min + 1u;
+        const uint64_t Offset = Range != 0 ? RandHelper64(Range) : GetUnsignedInt64();
+        return (int64_t)((uint64_t)Min + Offset);
+    }
+
+    /** Returns a random float in [InMin, InMax). */
+    float FRandRange(float InMin, float InMax)
+    {
+        return InMin + (InMax - InMin) * GetFraction();
+    }
+
+    bool RandBool()
+    {
+        return (GetUnsignedInt() >> 31) != 0;
+    }
+
+    /** Returns a uniformly distributed point on the unit sphere. */
+    MVector GetUnitVector();
+
+    /**
+     * Bulk generation, FFloatWide::Lanes sub-streams seeded from this one run side by side so the
+     * results differ from the same number of single draws. Deterministic for a given seed.
+     */
+    void FillFloats(float* OutValues, int32_t NumValues, float InMin = 0.0f, float InMax = 1.0f);
+    void FillUnsignedInts(uint32_t* OutValues, int32_t NumValues);
+    void FillIntRange(int32_t* OutValues, int32_t NumValues, int32_t Min, int32_t Max);
+    void FillUnitVectors(MVector* OutVectors, int32_t NumVectors);
+
+    /**
+     * Stream owned by the calling thread. Thread streams are Jump() apart from one common seed so
+     * they never overlap, the order in which threads first draw decides which stream they get.
+     */
+    static FRandomStream& GetThreadStream();
+
+    /** Reseeds every thread stream, each thread picks the new seed up on its next draw. */
+    static void SetThreadStreamSeed(uint64_t Seed);
+
+private:
+    static uint32_t RotateLeft(uint32_t Value, int32_t Shift)
+    {
+        return (Value << Shift) | (Value >> (32 - Shift));
+    }
+
+private:
+    uint32_t State[4];
+};
@@ -0,0 +1,574 @@
+#include "Sampling.h"
+#include "MathUtil.h"
+
+namespace
+{
+    /**
+     * Sobol direction numbers, the first dimension is the van der Corput sequence and the others come
+     * from the primitive polynomials and initial numbers of Joe and Kuo.
+     */
+    struct FSobolTables
+    {
+        uint32_t Directions[FSampling::MaxSobolDimensions][32];
+
+        FSobolTables()
+        {
+            struct FPolynomial
+            {
+                uint32_t Degree;
+                uint32_t Coefficients;
+                uint32_t Initial[3];
+            };
+            static const FPolynomial Polynomials[FSampling::MaxSobolDimensions - 1] =
+            {
+                { 1, 0, { 1 } },
+                { 2, 1, { 1, 3 } },
+                { 3, 1, { 1, 3, 1 } },
+                { 3, 2, { 1, 1, 1 } },
+            };
+
+            for (uint32_t Bit = 0; Bit < 32; ++Bit)
+            {
+                Directions[0][Bit] = 1u << (31 - Bit);
+            }
+
+            for (int32_t Dimension = 1; Dimension < FSampling::MaxSobolDimensions; ++Dimension)
+            {
+                const FPolynomial& Polynomial = Polynomials[Dimension - 1];
+                uint32_t* V = Directions[Dimension];
+                for (uint32_t Bit = 0; Bit < 32; ++Bit)
+                {
+                    if (Bit < Polynomial.Degree)
+                    {
+                        V[Bit] = Polynomial.Initial[Bit] << (31 - Bit);
+                        continue;
+                    }
+
+                    V[Bit] = V[Bit - Polynomial.Degree] ^ (V[Bit - Polynomial.Degree] >> Polynomial.Degree);
+                    for (uint32_t Term = 1; Term < Polynomial.Degree; ++Term)
+                    {
+                        if ((Polynomial.Coefficients >> (Polynomial.Degree - 1 - Term)) & 1)
+                        {
+                            V[Bit] ^= V[Bit - Term];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    const FSobolTables& GetSobolTables()
+    {
+        static const FSobolTables Tables;
+        return Tables;
+    }
+
+    const uint32_t HaltonPrimes[FSampling::MaxHaltonDimensions] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53 };
+
+    /** Largest float below 1. */
+    constexpr float OneMinusEpsilon = 0.99999994f;
+
+    /** R2 steps, the inverses of the plastic number and of its square as 32 bit fractions. */
+    constexpr uint32_t R2StepX = 0xC13FA9A9u;
+    constexpr uint32_t R2StepY = 0x91E10DA6u;
+
+    /** Avalanching integer hash (Wellons' lowbias32), turns seeds into well spread scrambles and shifts. */
+    uint32_t HashSeed(uint32_t Value)
+    {
+        Value ^= Value >> 16;
+        Value *= 0x7FEB352Du;
+        Value ^= Value >> 15;
+        Value *= 0x846CA68Bu;
+        Value ^= Value >> 16;
+        return Value;
+    }
+
+    /** SplitMix64 output function, a counter through it is a good uniform generator that can start anywhere. */
+    uint64_t HashSample(uint64_t Value)
+    {
+        Value += 0x9E3779B97F4A7C15ull;
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    uint32_t HashCombine(uint32_t Seed, uint32_t Value)
+    {
+        return Seed ^ (Value + (Seed << 6) + (Seed >> 2));
+    }
+
+    uint32_t ReverseBits(uint32_t Value)
+    {
+        Value = (Value << 16) | (Value >> 16);
+        Value = ((Value & 0x00FF00FFu) << 8) | ((Value & 0xFF00FF00u) >> 8);
+        Value = ((Value & 0x0F0F0F0Fu) << 4) | ((Value & 0xF0F0F0F0u) >> 4);
+        Value = ((Value & 0x33333333u) << 2) | ((Value & 0xCCCCCCCCu) >> 2);
+        Value = ((Value & 0x55555555u) << 1) | ((Value & 0xAAAAAAAAu) >> 1);
+        return Value;
+    }
+
+    /** Wraps a value shifted by less than 1 back into [0, 1). */
+    float WrapUnit(float Value)
+    {
+        return Value >= 1.0f ? Value - 1.0f : Value;
+    }
+
+    /** Orthonormal frame whose Z is Axis, for orienting bulk warps. */
+    struct FSampleFrame
+    {
+        MVector TangentX;
+        MVector TangentY;
+        MVector Normal;
+
+        explicit FSampleFrame(const MVector& Axis)
+            : Normal(Axis)
+        {
+            Axis.FindBestAxisVectors(TangentX, TangentY);
+        }
+
+        MVectorWide ToWorld(const MVectorWide& Local) const
+        {
+            return MVectorWide(TangentX) * Local.x + MVectorWide(TangentY) * Local.y + MVectorWide(Normal) * Local.z;
+        }
+    };
+
+    /** Runs Kernel on FFloatWide::Lanes samples at a time and stores the directions it returns. */
+    template <typename KernelType>
+    void WarpDirectionsWide(const float* X, const float* Y, int32_t NumSamples, float* OutX, float* OutY, float* OutZ, KernelType Kernel)
+    {
+        int32_t Index = 0;
+        for (; Index + FFloatWide::Lanes <= NumSamples; Index += FFloatWide::Lanes)
+        {
+            const MVectorWide Direction = Kernel(FFloatWide::Load(X + Index), FFloatWide::Load(Y + Index));
+            Direction.x.Store(OutX + Index);
+            Direction.y.Store(OutY + Index);
+            Direction.z.Store(OutZ + Index);
+        }
+
+        if (Index < NumSamples)
+        {
+            const int32_t Num = NumSamples - Index;
+            const MVectorWide Direction = Kernel(FFloatWide::LoadPartial(X + Index, Num), FFloatWide::LoadPartial(Y + Index, Num));
+            Direction.x.StorePartial(OutX + Index, Num);
+            Direction.y.StorePartial(OutY + Index, Num);
+            Direction.z.StorePartial(OutZ + Index, Num);
+        }
+    }
+
+    /**
+     * Ranks of a 64 x 64 blue noise tile, row major. Computed offline with void and cluster (Ulichney 1993)
+     * from a random tenth of the pixels, clusters and voids measured by a toroidal Gaussian energy with
+     * sigma 1.5, so the tile repeats seamlessly.
+     */
+    const uint16_t BlueNoiseRanks[64 * 64] =
+    {
+        2557, 1978, 3692, 2928, 1692, 3930, 2734, 624, 2026, 1434, 4068, 100, 3335, 2354, 3931, 1825, 19, 2944, 688, 3619, 499, 976, 4009, 1697, 3524, 893, 1753, 1236, 2344, 2706, 1090, 3674,
+        731, 3373, 1530, 2521, 1973, 3226, 2843, 3971, 1450, 3218, 244, 1527, 3304, 1007, 3887, 659, 2090, 3595, 2868, 1314, 315, 636, 4078, 1766, 2699, 2209, 431, 3838, 1480, 1837, 2184, 961,
+        3531, 1501, 168, 1119, 2092, 902, 2301, 3287, 3721, 1001, 2985, 2166, 842, 1585, 539, 1122, 3768, 1992, 1266, 2199, 2812, 1470, 3207, 2101, 257, 2741, 3808, 3216, 763, 3914, 191, 2276,
+        1901, 248, 2980, 670, 3551, 77, 1615, 1004, 520, 2687, 2220, 3762, 2536, 2951, 1411, 3184, 1604, 54, 2434, 1883, 3456, 2571, 2148, 70, 1009, 1586, 3242, 2795, 91, 3124, 3967, 1274,
+        564, 2322, 4025, 2502, 3391, 270, 1224, 1613, 156, 2512, 478, 1312, 3676, 3025, 2467, 3497, 829, 2598, 3448, 209, 3835, 2373, 709, 1164, 3011, 609, 2200, 320, 1976, 2976, 1570, 3248,
+        3770, 1005, 2356, 3922, 1194, 2751, 3785, 2415, 3416, 1759, 706, 1222, 98, 1812, 417, 2288, 4019, 1093, 586, 3787, 990, 2989, 1248, 3640, 3044, 3957, 765, 1984, 1142, 2431, 350, 2850,
+        3328, 882, 1802, 3096, 690, 3758, 2869, 3608, 1907, 3183, 3864, 1702, 2625, 323, 1960, 1464, 3155, 460, 1675, 1068, 1870, 363, 3637, 2558, 3933, 1582, 1116, 3682, 1424, 983, 2543, 535,
+        1280, 2690, 1669, 425, 1845, 753, 2060, 265, 1291, 2866, 4023, 2049, 3527, 2764, 3680, 790, 2967, 2606, 1775, 3211, 167, 1676, 704, 2469, 484, 1332, 2393, 3465, 629, 3675, 1605, 1948,
+        13, 2993, 1323, 427, 1597, 2006, 2548, 368, 795, 1182, 2089, 697, 3384, 1091, 4033, 141, 2255, 2870, 3969, 2525, 3331, 2922, 1328, 1817, 76, 3432, 2452, 2807, 3290, 116, 4048, 2041,
+        3038, 27, 3490, 3108, 2256, 3363, 1475, 3023, 3565, 389, 1044, 3147, 480, 971, 1355, 2020, 260, 3407, 1301, 2228, 2793, 3920, 2097, 3493, 1829, 2878, 143, 1664, 3033, 2653, 920, 3893,
+        2570, 2110, 3508, 2692, 3910, 855, 1384, 3110, 2363, 3480, 2852, 71, 2292, 2798, 781, 3276, 1796, 713, 1370, 52, 903, 2161, 555, 3247, 953, 1928, 755, 420, 1668, 2297, 3424, 824,
+        1725, 3865, 1371, 905, 2610, 146, 3738, 926, 2294, 1898, 2580, 1538, 2308, 3347, 2490, 3806, 1643, 536, 3722, 860, 403, 1368, 3095, 242, 881, 3734, 2197, 3906, 1247, 221, 2274, 1385,
+        3756, 722, 1099, 161, 2314, 3326, 495, 4049, 1678, 301, 1448, 3936, 1866, 1321, 3635, 2485, 1146, 3752, 2103, 2986, 3594, 1651, 3987, 2384, 2854, 3872, 3107, 2116, 3814, 578, 1210, 2746,
+        370, 2476, 2098, 562, 4081, 1242, 2813, 1708, 649, 3881, 26, 3638, 728, 1848, 140, 3122, 1129, 2829, 2408, 1932, 3574, 2621, 1064, 1578, 3333, 2637, 1054, 559, 2019, 3599, 3196, 482,
+        1533, 1869, 3657, 3190, 1707, 1152, 2749, 2033, 1049, 2587, 3683, 958, 3129, 421, 1630, 215, 3068, 441, 3387, 1524, 299, 2725, 1115, 371, 1495, 184, 1080, 1363, 2576, 3007, 1925, 3750,
+        3181, 1100, 3593, 1601, 3224, 1977, 462, 2463, 3351, 1320, 2753, 3032, 1189, 3935, 2702, 628, 2169, 4073, 35, 3268, 1635, 635, 3989, 2399, 1953, 338, 1502, 3297, 2775, 1723, 1020, 2937,
+        231, 2804, 2464, 408, 2152, 3840, 39, 3516, 693, 3260, 2142, 595, 2453, 3528, 2168, 3897, 1862, 2624, 957, 2317, 663, 3732, 1764, 3451, 2243, 2664, 3711, 3319, 325, 917, 1561, 137,
+        2221, 734, 2766, 401, 2350, 1010, 3083, 3793, 251, 2118, 841, 1737, 322, 2234, 1418, 3445, 1808, 814, 1466, 1089, 2950, 2247, 155, 3523, 687, 3026, 4082, 2311, 262, 711, 3923, 2155,
+        1205, 4034, 911, 1391, 702, 2938, 1511, 2412, 1734, 2961, 181, 1581, 2913, 1178, 812, 2846, 627, 1310, 4022, 1897, 3273, 2504, 866, 3072, 529, 1875, 769, 1650, 2062, 4018, 3357, 2641,
+        1415, 3410, 1857, 3888, 83, 3572, 1396, 784, 1671, 3233, 4053, 2472, 3177, 3669, 1018, 269, 3037, 3548, 2634, 3874, 351, 1833, 3113, 1342, 2717, 1113, 1765, 848, 3540, 1443, 2524, 3258,
+        643, 3386, 2031, 3136, 2537, 3618, 999, 461, 3945, 1235, 3470, 1940, 4083, 12, 3311, 1487, 2390, 3437, 84, 2783, 1246, 206, 2040, 4084, 1278, 3558, 2886, 18, 3091, 2417, 439, 1042,
+        3823, 481, 3028, 1305, 2596, 1750, 2907, 2205, 2649, 1094, 436, 1455, 681, 1964, 2763, 1600, 2352, 466, 1998, 718, 2468, 3754, 821, 2119, 3831, 22, 2473, 3187, 2043, 2861, 87, 1800,
+        2403, 300, 1611, 3819, 171, 1820, 3321, 2832, 2121, 366, 2711, 707, 1388, 2559, 2064, 3709, 395, 3005, 1621, 803, 3858, 2992, 1459, 404, 2448, 1002, 2201, 3895, 1168, 691, 1882, 2946,
+        2135, 1658, 854, 2237, 3332, 723, 446, 3900, 145, 3447, 1904, 2867, 3509, 58, 3986, 771, 3764, 1191, 3229, 1500, 3365, 1198, 1688, 470, 3234, 1483, 3612, 373, 1223, 3797, 924, 3601,
+        1339, 3001, 2704, 597, 1271, 2293, 747, 1451, 3735, 951, 2371, 3583, 3086, 980, 513, 1748, 1125, 2212, 3563, 1996, 517, 2282, 3588, 2747, 1727, 3309, 458, 1507, 2722, 3690, 1390, 3552,
+        60, 2611, 4042, 243, 1105, 3702, 1999, 3145, 1297, 2394, 3832, 922, 2248, 1253, 2460, 2925, 1864, 240, 2715, 2190, 108, 2897, 3666, 2660, 2290, 749, 1899, 2756, 585, 1694, 3074, 2072,
+        752, 3482, 1043, 1959, 3201, 4060, 2648, 102, 1891, 3210, 1626, 311, 2179, 3827, 2701, 3193, 3998, 254, 993, 2595, 3348, 1674, 923, 89, 3843, 744, 2575, 1969, 3244, 330, 2296, 809,
+        3200, 1186, 3472, 1865, 2880, 2480, 1550, 868, 2782, 340, 1514, 541, 3141, 1682, 364, 3385, 1425, 3566, 945, 3932, 634, 1886, 1026, 294, 3916, 1184, 3000, 4012, 2167, 2586, 346, 3894,
+        2546, 59, 2241, 3586, 271, 1686, 1130, 3510, 2940, 594, 3999, 1092, 1832, 173, 1331, 694, 2432, 2884, 1407, 3801, 180, 1197, 3214, 2113, 2955, 1362, 3662, 131, 978, 1743, 4003, 2787,
+        1974, 423, 2323, 1471, 546, 3270, 67, 4027, 1755, 3338, 2111, 3671, 2677, 3884, 1039, 2125, 605, 2411, 2978, 1592, 3483, 2532, 3138, 2059, 1612, 3330, 194, 887, 1392, 3444, 1079, 1548,
+        1863, 4000, 1300, 2794, 873, 3065, 2435, 407, 2136, 1270, 2801, 2498, 3396, 2906, 3606, 1965, 1566, 3308, 538, 1815, 2833, 2341, 3947, 563, 1889, 1051, 2817, 2222, 3503, 3021, 1239, 579,
+        1591, 3728, 2935, 844, 3861, 2051, 1257, 2265, 600, 2958, 1173, 125, 1872, 737, 2540, 3205, 4020, 11, 1268, 2067, 272, 819, 1406, 3571, 611, 2590, 1836, 2375, 3641, 118, 2825, 3305,
+        415, 3048, 642, 1580, 3794, 2048, 676, 3905, 1595, 3653, 65, 801, 1536, 505, 2340, 930, 75, 3667, 2120, 792, 3151, 380, 1445, 2544, 3425, 280, 3780, 1520, 721, 2534, 214, 3361,
+        2443, 1000, 3295, 304, 2599, 1011, 3500, 2745, 3624, 916, 2478, 3393, 1397, 3041, 218, 1562, 1949, 884, 3733, 2673, 3220, 4071, 2315, 50, 2942, 994, 3743, 471, 3112, 1781, 717, 2324,
+        1013, 3699, 2115, 2581, 335, 3382, 1351, 2683, 863, 2361, 3060, 2052, 3925, 1212, 3168, 3850, 2658, 1153, 2401, 4069, 1081, 2004, 3700, 832, 3066, 1784, 2395, 445, 1997, 3917, 1473, 2102,
+        3853, 152, 1751, 2208, 1506, 3101, 442, 1575, 190, 1955, 3964, 489, 2330, 3798, 1126, 3613, 2718, 3114, 1732, 532, 1124, 1794, 2757, 1218, 3860, 2177, 1482, 2724, 1215, 2130, 3803, 1377,
+        2475, 1718, 229, 3157, 1063, 1842, 2921, 185, 3322, 1789, 519, 3473, 2597, 200, 1684, 2073, 410, 3098, 1647, 153, 3431, 2723, 1713, 74, 1279, 4047, 952, 3334, 2963, 1077, 2743, 783,
+        3035, 1265, 2806, 4095, 3426, 748, 1912, 3869, 2589, 1275, 3123, 1638, 853, 2786, 2112, 630, 1336, 324, 2487, 3452, 2224, 359, 761, 3266, 1913, 307, 3372, 787, 4057, 361, 2896, 3414,
+        696, 2816, 3494, 1413, 4013, 526, 3576, 2226, 1141, 4065, 1426, 914, 1888, 3271, 657, 2914, 1373, 3474, 678, 2533, 1366, 544, 3241, 2289, 2894, 580, 2689, 1408, 30, 3617, 1757, 376,
+        3537, 1951, 602, 1107, 10, 2941, 2346, 1061, 3292, 679, 2203, 42, 3450, 1756, 291, 3262, 2326, 3961, 806, 1467, 3828, 2890, 3603, 1535, 2554, 673, 3017, 1728, 2348, 987, 1652, 6,
+        3976, 1112, 2253, 779, 2010, 2538, 1532, 756, 3137, 2481, 400, 2848, 3717, 1127, 2447, 3994, 977, 1896, 3775, 3046, 2165, 3921, 879, 3584, 1598, 2106, 3687, 1885, 2513, 654, 3222, 2320,
+        1515, 2604, 3730, 2134, 2535, 1374, 3525, 264, 1709, 2909, 3650, 2681, 1154, 4066, 2900, 998, 3517, 1660, 2842, 223, 1956, 992, 2305, 128, 3972, 1148, 3697, 196, 2663, 3577, 3228, 2058,
+        1491, 3131, 163, 3725, 2899, 290, 3836, 1930, 5, 3647, 2044, 1623, 246, 2158, 3422, 44, 2697, 2280, 308, 946, 1787, 261, 2588, 1120, 195, 3199, 391, 899, 3978, 2163, 1203, 3839,
+        133, 888, 3071, 444, 1685, 3812, 825, 2046, 3990, 424, 1442, 1986, 641, 2450, 1460, 1958, 97, 2154, 1133, 3376, 3055, 540, 1358, 3134, 1816, 2216, 2818, 1383, 1943, 614, 1229, 2545,
+        465, 1903, 2662, 1606, 1074, 3327, 1302, 2726, 941, 2987, 1226, 3950, 3061, 839, 1437, 1786, 604, 3538, 1258, 2859, 3380, 1329, 3102, 1985, 3955, 2622, 1324, 3461, 1631, 3039, 453, 2769,
+        3401, 1871, 1256, 3471, 2707, 565, 3167, 2759, 1167, 2505, 915, 3817, 3109, 390, 3705, 764, 3030, 3781, 589, 2511, 1539, 3928, 2640, 3541, 862, 490, 3409, 921, 3952, 3088, 273, 3651,
+        982, 3909, 675, 3217, 2392, 620, 2219, 3518, 1587, 2327, 686, 2646, 497, 2378, 3876, 3225, 2826, 1560, 4038, 2076, 512, 3807, 2328, 754, 1519, 553, 2271, 2828, 123, 1031, 2015, 1465,
+        582, 2366, 3891, 288, 1963, 1034, 2273, 92, 3278, 1893, 3428, 183, 2145, 1657, 3358, 2359, 1361, 2712, 1824, 3660, 0, 2082, 1096, 245, 2920, 1496, 2531, 105, 2171, 1553, 2343, 2910,
+        3415, 2193, 1216, 3610, 99, 1726, 4040, 437, 3176, 232, 3394, 1711, 3568, 1192, 1937, 281, 1059, 2441, 135, 836, 2632, 1653, 41, 3441, 2788, 3681, 1929, 758, 3186, 3629, 2630, 4059,
+        3133, 1067, 2830, 1441, 3286, 4041, 1322, 1659, 3691, 527, 1534, 2968, 1254, 2594, 969, 204, 3991, 402, 1029, 2309, 785, 3317, 1670, 2331, 4061, 1968, 3677, 3002, 1102, 3766, 762, 1768,
+        1400, 2620, 347, 1941, 2572, 3052, 818, 1264, 1911, 3845, 1137, 2084, 94, 3152, 2566, 674, 3818, 3342, 1823, 3135, 3670, 1014, 3008, 1844, 1076, 319, 1249, 3929, 2377, 1712, 250, 846,
+        1799, 104, 2108, 741, 2509, 227, 3006, 2451, 858, 2844, 2259, 4031, 740, 3590, 3198, 2094, 1720, 3104, 3466, 1417, 2970, 3799, 577, 3194, 396, 1158, 712, 1739, 459, 3191, 2703, 154,
+        606, 3097, 3854, 1478, 1028, 3761, 2146, 2931, 2617, 746, 2494, 2908, 870, 3757, 1389, 2965, 2147, 1277, 457, 2364, 1401, 2139, 530, 4087, 2437, 3316, 2952, 1531, 525, 1163, 2180, 3370,
+        2516, 3777, 3532, 2947, 1719, 3652, 610, 1936, 3848, 293, 1087, 2693, 62, 1867, 511, 2873, 1245, 661, 2609, 1880, 349, 2565, 1263, 1852, 2497, 3368, 2820, 2232, 3506, 1309, 2028, 4072,
+        1813, 2304, 849, 2839, 3418, 399, 1640, 122, 3719, 1412, 316, 3983, 1609, 2240, 375, 1724, 3616, 906, 2814, 3948, 222, 3505, 2678, 1446, 811, 2063, 86, 2602, 3249, 3714, 2792, 1444,
+        507, 1136, 1568, 414, 968, 2162, 1196, 3454, 1479, 3150, 2042, 1394, 3694, 2307, 1109, 3919, 2449, 3620, 117, 4016, 985, 2127, 2902, 857, 3830, 263, 1419, 3965, 28, 2477, 925, 3302,
+        1131, 3536, 49, 2096, 664, 2370, 3227, 1083, 3434, 2270, 1847, 3254, 556, 3475, 1037, 2665, 34, 3221, 1572, 1979, 770, 1166, 3250, 267, 3759, 1661, 3529, 960, 1981, 355, 772, 3902,
+        3062, 2016, 3303, 2355, 3954, 3140, 2777, 40, 2517, 575, 3405, 800, 3010, 1559, 3314, 256, 1642, 865, 2233, 3143, 1569, 3724, 69, 3274, 1633, 2109, 950, 2657, 660, 1619, 2927, 277,
+        2720, 1544, 3057, 1758, 3966, 1365, 2774, 1991, 485, 3003, 989, 2737, 1251, 2454, 3084, 4035, 2093, 596, 2424, 3559, 3027, 2499, 1779, 2223, 2924, 639, 2291, 4008, 1386, 2966, 1760, 2245,
+        17, 864, 2738, 188, 1364, 492, 1859, 896, 3993, 2198, 1736, 3899, 332, 2542, 698, 2773, 2071, 3371, 1290, 2803, 612, 3463, 1379, 2312, 548, 3036, 3703, 1827, 3232, 3825, 2122, 3644,
+        2414, 406, 3704, 1181, 2592, 219, 3673, 736, 4088, 1588, 79, 3655, 2053, 207, 1853, 831, 1472, 3786, 1085, 148, 1382, 496, 3970, 908, 3449, 1303, 429, 2527, 197, 3360, 1019, 2607,
+        3469, 1504, 3824, 1814, 3419, 2551, 3668, 1541, 2932, 1150, 159, 2784, 1200, 2035, 3534, 1066, 3867, 177, 1838, 398, 2381, 1909, 820, 4045, 2750, 1243, 189, 2210, 1187, 342, 1353, 751,
+        3940, 936, 2261, 506, 3355, 919, 1706, 2438, 1284, 3298, 2547, 798, 3871, 1499, 3556, 463, 2994, 2560, 3345, 1931, 3672, 2748, 1573, 25, 1954, 2799, 3158, 1681, 3774, 2100, 533, 3979,
+        1228, 2436, 656, 2934, 1114, 750, 2080, 3209, 432, 3602, 2420, 3257, 1603, 3822, 411, 1429, 3015, 2508, 3684, 3284, 1174, 2974, 2585, 358, 1742, 3301, 3569, 827, 2991, 2567, 3350, 1927,
+        2778, 1493, 3148, 1805, 2847, 2141, 3514, 2943, 379, 2186, 1788, 2882, 419, 3142, 2627, 1206, 2213, 284, 1594, 726, 2316, 1025, 3180, 3723, 2457, 1038, 3625, 745, 1140, 2781, 1540, 3080,
+        266, 2069, 3189, 306, 2252, 4085, 205, 1225, 2636, 805, 1906, 522, 928, 3073, 2376, 1860, 794, 524, 1555, 875, 3944, 129, 3592, 1069, 2050, 584, 1510, 2339, 4004, 549, 1628, 113,
+        1217, 3526, 175, 4030, 668, 1395, 9, 1095, 3866, 689, 3443, 1188, 2345, 943, 1983, 3946, 3223, 956, 2796, 4056, 3050, 365, 2129, 708, 1454, 217, 1821, 2217, 3272, 115, 3659, 1921,
+        934, 3741, 1679, 3560, 1432, 2849, 1782, 3765, 2183, 1485, 3977, 3389, 2206, 4, 3487, 2760, 3997, 2295, 3160, 2719, 1783, 2195, 1490, 3165, 3896, 2539, 2905, 57, 1121, 2008, 3739, 3053,
+        699, 2495, 2022, 1056, 2568, 3686, 3172, 1961, 2669, 1512, 158, 4007, 1656, 3512, 82, 672, 1744, 3623, 2056, 160, 1308, 1807, 3859, 2684, 3501, 3070, 4070, 479, 2651, 1341, 2369, 622,
+        2863, 2482, 1172, 537, 2584, 931, 3359, 616, 3045, 126, 2865, 1307, 2659, 1730, 1252, 339, 1023, 2005, 164, 1327, 500, 3430, 703, 2385, 234, 944, 3658, 1704, 3479, 2655, 876, 2189,
+        443, 3805, 1565, 2971, 297, 2281, 1646, 845, 3631, 2397, 3179, 2027, 516, 2962, 2466, 1273, 2680, 449, 1447, 3504, 2562, 3364, 1162, 508, 2025, 880, 2421, 1547, 3811, 967, 3453, 1627,
+        4039, 130, 3336, 1942, 3903, 32, 2298, 1648, 3573, 1062, 1849, 392, 3542, 695, 2948, 3710, 1537, 3275, 3597, 2425, 3763, 2837, 1195, 1831, 3058, 1348, 1993, 613, 3103, 317, 1488, 3381,
+        1793, 3182, 793, 3435, 1232, 3908, 503, 2930, 237, 1269, 768, 2740, 1060, 3790, 1528, 3289, 3882, 2279, 2990, 626, 913, 2262, 73, 1716, 2945, 1287, 344, 2887, 735, 2070, 3024, 426,
+        1272, 2138, 869, 2999, 1523, 3246, 1159, 2729, 318, 2458, 3813, 2085, 962, 4046, 2300, 1828, 618, 2824, 1138, 766, 1926, 29, 3263, 3834, 476, 2668, 4054, 2246, 1293, 2439, 3938, 2767,
+        1149, 2387, 367, 2211, 1778, 2733, 1017, 3486, 2128, 3849, 1804, 3403, 2268, 333, 1887, 830, 142, 1084, 1914, 3810, 1622, 2809, 3985, 3288, 2333, 3791, 3235, 1919, 3564, 2, 2491, 1785,
+        3188, 2670, 3796, 313, 2365, 705, 2018, 4028, 1376, 3119, 583, 3279, 2550, 1423, 124, 3344, 2506, 274, 2172, 4091, 1543, 2479, 965, 2143, 1589, 3375, 828, 132, 3294, 1890, 1012, 31,
+        2957, 4074, 1416, 3579, 162, 3230, 1944, 1435, 2563, 581, 2977, 48, 1440, 3589, 2838, 2137, 3051, 3549, 2633, 252, 3159, 528, 1420, 1024, 666, 179, 1617, 1103, 2593, 1449, 3886, 1036,
+        3550, 617, 1577, 1097, 2862, 3736, 450, 3408, 808, 2196, 1607, 1145, 326, 3059, 2032, 826, 3879, 1378, 3126, 418, 2779, 3399, 593, 2892, 210, 2413, 1157, 3615, 2872, 719, 3726, 2086,
+        1593, 621, 2674, 959, 2422, 733, 4010, 321, 3154, 1687, 1134, 4075, 2603, 981, 558, 3962, 1387, 743, 1715, 1207, 2176, 3543, 1939, 2541, 3679, 2095, 2770, 4021, 309, 3346, 658, 2254,
+        239, 2037, 2520, 3507, 1851, 1352, 2579, 1774, 2939, 106, 3701, 2716, 3911, 1691, 3476, 1170, 2875, 1700, 3498, 877, 1238, 1772, 3642, 1409, 3926, 1908, 2728, 1476, 1729, 394, 2553, 3467,
+        187, 3164, 1902, 3744, 1662, 2864, 1214, 2182, 874, 3745, 2332, 501, 1987, 3128, 1747, 2501, 354, 2380, 3237, 4079, 932, 2698, 139, 3082, 1354, 3320, 942, 591, 2159, 1810, 3118, 2758,
+        1360, 3924, 3018, 63, 822, 3293, 226, 1052, 2440, 3496, 1916, 850, 2235, 647, 2656, 435, 2336, 55, 2014, 2555, 3753, 186, 2353, 1035, 3197, 742, 440, 3771, 2278, 3127, 1344, 897,
+        2306, 3885, 1179, 467, 3352, 80, 3648, 2688, 3438, 208, 2808, 1508, 3519, 149, 1241, 3313, 3742, 2007, 38, 2834, 469, 1552, 3913, 861, 430, 1733, 2418, 3478, 2903, 1240, 886, 3746,
+        1714, 502, 1022, 1962, 4006, 2257, 2998, 3868, 1484, 557, 1255, 2916, 275, 3634, 1347, 3802, 3014, 996, 3956, 547, 2936, 1915, 3093, 360, 2124, 3488, 2929, 1008, 151, 3927, 1971, 2831,
+        1693, 388, 2583, 3047, 2263, 1494, 1966, 545, 1402, 1855, 3185, 700, 2227, 3842, 2871, 587, 1048, 1529, 3582, 1289, 2459, 3280, 1873, 2347, 2879, 3815, 53, 1503, 3907, 377, 2405, 101,
+        3245, 2367, 3429, 1439, 2654, 669, 1672, 386, 3202, 2207, 4086, 3337, 1558, 2510, 2088, 759, 1879, 3255, 1285, 2285, 1497, 837, 3974, 2645, 1666, 1294, 2465, 1895, 3300, 1193, 493, 3581,
+        1318, 3323, 2039, 912, 592, 3982, 1046, 3081, 2528, 975, 3904, 1298, 2638, 929, 1629, 2188, 2623, 3054, 789, 1801, 3804, 1050, 588, 3578, 1199, 2075, 3161, 1057, 1967, 2694, 3520, 1316,
+        2099, 739, 2805, 3760, 353, 1221, 3688, 2045, 2732, 947, 37, 1854, 1078, 3149, 136, 3417, 1517, 296, 2709, 3605, 107, 3379, 1202, 637, 3622, 21, 4063, 573, 1610, 2616, 3020, 799,
+        2496, 36, 3795, 1792, 2675, 3462, 2313, 327, 3698, 2091, 16, 3455, 393, 1878, 3398, 198, 3782, 409, 2334, 3163, 170, 2151, 2983, 247, 1590, 716, 2552, 472, 3261, 683, 1663, 2912,
+        4044, 1128, 157, 1731, 2131, 3265, 2898, 738, 1326, 3747, 2349, 2671, 523, 3949, 937, 2791, 3857, 2192, 730, 1721, 2975, 2087, 2500, 1841, 2822, 954, 3049, 2325, 3712, 212, 2078, 4024,
+        607, 2821, 1469, 3100, 1220, 182, 1689, 3307, 775, 2836, 1745, 2410, 3034, 3963, 715, 2926, 1337, 1933, 3446, 653, 2755, 1380, 3959, 2444, 3390, 2802, 4092, 1369, 2286, 3784, 984, 276,
+        1876, 3153, 2519, 3378, 885, 2419, 174, 1877, 3324, 328, 1430, 3591, 2949, 2029, 1673, 2360, 483, 1190, 3299, 4076, 1071, 510, 3816, 255, 3282, 1516, 2013, 780, 1349, 3477, 1033, 1773,
+        2258, 3522, 833, 433, 3639, 1975, 2954, 1111, 1554, 4037, 569, 1381, 1027, 2117, 1513, 2430, 898, 4014, 1608, 1143, 3737, 1754, 834, 1957, 1098, 310, 1771, 3459, 96, 1923, 2642, 3649,
+        590, 1393, 3844, 412, 1579, 3609, 1156, 3856, 2471, 3012, 1763, 773, 1213, 279, 3460, 1359, 3099, 2618, 1972, 233, 2433, 1644, 2736, 1345, 2269, 3892, 336, 3243, 2523, 474, 2855, 3366,
+        1183, 1665, 3996, 2132, 2518, 692, 3870, 2691, 387, 2215, 3130, 3654, 2744, 314, 3162, 3636, 51, 2776, 2249, 302, 2577, 3343, 8, 3063, 3716, 2244, 852, 2883, 1175, 3120, 1463, 2386,
+        3004, 2021, 995, 2260, 2972, 568, 2752, 1620, 970, 543, 4011, 2239, 3264, 2493, 3800, 796, 3, 3706, 927, 1438, 3169, 3645, 900, 3440, 531, 1073, 2889, 1749, 3973, 2160, 1509, 150,
+        2484, 369, 2765, 1070, 3356, 1399, 66, 2358, 3545, 1233, 909, 112, 1830, 3442, 625, 1989, 1250, 3306, 601, 3106, 1982, 677, 1311, 2507, 561, 1457, 3826, 2530, 651, 3980, 312, 838,
+        3413, 15, 2708, 3539, 1330, 4067, 2181, 56, 3547, 1946, 2768, 120, 1545, 515, 2800, 1811, 2303, 1563, 3468, 2810, 685, 2170, 90, 2984, 1952, 2601, 3557, 61, 1169, 815, 3695, 2982,
+        3837, 1922, 3253, 220, 1769, 3718, 892, 1641, 3195, 1920, 2608, 3778, 1456, 2267, 986, 2626, 3878, 1746, 1032, 3693, 1526, 4052, 2845, 3570, 1846, 3171, 169, 2002, 1645, 3318, 2175, 1780,
+        1267, 3937, 1696, 760, 259, 1840, 835, 3175, 2389, 1171, 3423, 890, 3626, 2000, 997, 3192, 4002, 550, 2061, 372, 3953, 1790, 1118, 3847, 1414, 757, 2218, 1571, 2754, 3204, 1798, 632,
+        3374, 1335, 802, 2372, 3092, 2643, 2083, 3992, 638, 236, 2995, 2382, 468, 4093, 2956, 1584, 374, 2455, 2901, 119, 2406, 938, 2140, 329, 1135, 2338, 3533, 1075, 2964, 514, 2661, 3587,
+        2876, 567, 2150, 3252, 2489, 3420, 2853, 1436, 3918, 298, 1680, 2337, 2918, 3883, 1398, 176, 2631, 1176, 3042, 2407, 1319, 2696, 3310, 2398, 289, 3731, 3139, 560, 3614, 331, 2416, 1055,
+        447, 2895, 3663, 1556, 542, 1147, 285, 2858, 1372, 3492, 1677, 774, 3296, 1281, 138, 3678, 816, 3502, 2047, 1230, 3251, 487, 3439, 1703, 3912, 786, 2762, 362, 3875, 1421, 949, 211,
+        2329, 1065, 3009, 1404, 3783, 1082, 438, 2068, 701, 2578, 3208, 574, 1219, 384, 2275, 3521, 729, 1776, 3353, 147, 3598, 788, 475, 1551, 2860, 1826, 1209, 2515, 2001, 1375, 4058, 2191,
+        1695, 2079, 20, 4017, 1994, 3285, 3611, 2462, 974, 2178, 3890, 1123, 2074, 2780, 1777, 2164, 3115, 1452, 655, 3939, 1835, 2742, 1367, 2573, 111, 3067, 1599, 2133, 2456, 3457, 1900, 4015,
+        1522, 3727, 357, 1934, 88, 2310, 1699, 3621, 3031, 1334, 3767, 1850, 3397, 2647, 1637, 3019, 2030, 3841, 935, 1639, 2009, 3089, 2250, 4094, 933, 3388, 192, 3915, 777, 3013, 127, 2721,
+        871, 3481, 2428, 979, 2686, 1453, 710, 1839, 3240, 455, 2650, 165, 3580, 631, 3238, 1047, 2600, 278, 2379, 2959, 203, 3708, 856, 3215, 1990, 1306, 3772, 680, 1180, 68, 3087, 2591,
+        534, 3367, 2682, 878, 3116, 3968, 2695, 918, 199, 2236, 1003, 78, 2126, 810, 4089, 258, 1283, 2556, 448, 2771, 3901, 1104, 14, 1918, 2612, 665, 2187, 2904, 1614, 3458, 1144, 3219,
+        3792, 477, 1262, 3078, 303, 3821, 2299, 178, 3713, 1567, 3094, 1858, 2526, 1433, 3749, 509, 3889, 1698, 3575, 1088, 1602, 2238, 566, 4001, 2391, 451, 3485, 2676, 3236, 1632, 778, 2123,
+        1259, 1770, 2242, 3544, 1231, 488, 1474, 3436, 1917, 4026, 2797, 3132, 3596, 1151, 2857, 640, 3256, 2157, 3707, 1427, 619, 2388, 3489, 1315, 3146, 1525, 3779, 1053, 1938, 494, 2319, 1481,
+        2017, 2827, 1618, 3383, 1818, 901, 2973, 1139, 2739, 650, 1234, 3975, 883, 2204, 24, 2731, 1304, 2036, 3156, 776, 2628, 3464, 1868, 1177, 2979, 948, 1822, 337, 2055, 3664, 2917, 3833,
+        241, 3231, 644, 1583, 2561, 2057, 2988, 383, 2474, 1574, 551, 1422, 334, 2400, 1945, 1489, 3554, 1015, 235, 2981, 3291, 1740, 2730, 521, 3661, 348, 2486, 72, 3546, 2569, 3942, 228,
+        817, 3600, 2529, 633, 2114, 3515, 1498, 4080, 2012, 3404, 2357, 268, 2923, 3362, 1795, 3075, 2302, 623, 172, 3960, 1340, 378, 2881, 23, 1634, 3341, 2488, 4090, 988, 1325, 456, 2461,
+        955, 2727, 4055, 121, 3665, 727, 3829, 1208, 3259, 804, 3685, 2614, 1761, 3773, 3178, 109, 2705, 1722, 2470, 1980, 894, 287, 3988, 964, 2277, 1894, 3064, 1356, 2823, 646, 1738, 3056,
+        2272, 292, 1101, 3958, 114, 2772, 491, 2429, 47, 963, 1735, 3769, 1486, 598, 1161, 4064, 940, 3530, 2851, 1806, 3325, 2335, 3627, 2038, 3789, 671, 1403, 134, 2841, 2321, 1843, 3421,
+        1468, 1988, 1185, 2893, 1797, 1021, 2284, 2713, 45, 1884, 2230, 1041, 2969, 498, 872, 2229, 3941, 720, 3607, 1317, 3788, 2153, 1542, 2919, 1237, 3412, 859, 4050, 2149, 1016, 3349, 1288,
+        3898, 1935, 3090, 1405, 2287, 3267, 823, 1809, 3656, 3213, 2582, 413, 2077, 2685, 3484, 253, 1624, 2483, 1227, 2156, 972, 570, 1458, 889, 2679, 3079, 2194, 3632, 3212, 682, 3951, 1,
+        3029, 3646, 397, 2225, 3203, 286, 3491, 1649, 3934, 2856, 3312, 216, 3984, 1276, 3495, 1616, 1108, 2811, 166, 3085, 486, 3402, 2564, 202, 3755, 608, 1767, 416, 1505, 3720, 144, 2672,
+        1546, 2815, 767, 3628, 1705, 1201, 3880, 2652, 1428, 571, 1295, 3077, 3643, 813, 2374, 1950, 2960, 464, 3852, 81, 2613, 3040, 4032, 2396, 193, 1211, 518, 1910, 1576, 1132, 2635, 1683,
+        603, 2362, 867, 3406, 1346, 2644, 2011, 473, 907, 1350, 648, 1557, 2351, 1970, 2888, 2492, 434, 3329, 2104, 1636, 2409, 1165, 724, 3174, 2065, 2735, 2342, 3315, 2911, 2445, 1881, 572,
+        1040, 3395, 452, 2549, 230, 2953, 2066, 282, 2996, 2185, 3981, 1045, 1803, 85, 3239, 1299, 3604, 840, 3206, 1492, 3567, 1762, 345, 3269, 1861, 3862, 3369, 2503, 238, 3776, 2144, 3281,
+        1296, 2761, 3855, 1596, 662, 3995, 1106, 3170, 3555, 2173, 3748, 2666, 3377, 714, 7, 3846, 1905, 1282, 4036, 939, 2933, 1892, 3943, 1667, 1338, 33, 3877, 1155, 352, 843, 3121, 3585,
+        43, 2402, 1874, 4051, 973, 3535, 667, 1117, 3400, 1655, 213, 2442, 2915, 1518, 3863, 615, 2629, 1741, 2107, 2819, 732, 1260, 2202, 1072, 2874, 1549, 782, 2789, 1006, 3022, 428, 910,
+        3751, 1834, 103, 2105, 2997, 201, 2427, 1521, 2574, 110, 1856, 405, 1110, 3016, 1461, 847, 3111, 2615, 599, 3433, 95, 3633, 422, 2522, 3553, 991, 3043, 1654, 2054, 4005, 1333, 2231,
+        3851, 1244, 3173, 1477, 2214, 2605, 1791, 3820, 2368, 895, 3499, 684, 3696, 2034, 966, 2251, 343, 4029, 1058, 249, 3809, 2514, 3411, 652, 3715, 385, 2081, 4043, 1462, 1995, 3562, 2446,
+        305, 3125, 1030, 2700, 3511, 1752, 3729, 725, 3069, 1204, 2877, 4077, 1710, 3513, 2318, 3689, 1717, 283, 2283, 1564, 2710, 1086, 2266, 791, 2891, 1947, 576, 3392, 2639, 225, 2835, 1701,
+        382, 2785, 797, 504, 3340, 64, 1313, 3117, 356, 2840, 1819, 2619, 1261, 381, 3166, 2790, 1410, 3339, 2404, 1625, 3076, 1924, 93, 2667, 1343, 2423, 3105, 46, 3427, 554, 1690, 2885,
+        1357, 2174, 4062, 454, 1286, 851, 2264, 341, 2003, 3630, 891, 2426, 552, 2024, 224, 2714, 1160, 3283, 807, 3873, 2023, 3144, 1431, 3354, 295, 3740, 1292, 2383, 904, 3561, 645, 3277,
+    };
+
+    static_assert(FSampling::BlueNoiseTileSize == 64, "BlueNoiseRanks holds a 64 x 64 tile");
+
+    struct FBlueNoiseTile
+    {
+        static constexpr int32_t NumPixels = FSampling::BlueNoiseTileSize * FSampling::BlueNoiseTileSize;
+
+        float Values[NumPixels];
+
+        FBlueNoiseTile()
+        {
+            for (int32_t Pixel = 0; Pixel < NumPixels; ++Pixel)
+            {
+                Values[Pixel] = ((float)BlueNoiseRanks[Pixel] + 0.5f) / (float)NumPixels;
+            }
+        }
+    };
+}
+
+uint32_t FSampling::Sobol(uint32_t Index, int32_t Dimension)
+{
+    const uint32_t* Directions = GetSobolTables().Directions[Dimension];
+    uint32_t Result = 0;
+    for (int32_t Bit = 0; Index; Index >>= 1, ++Bit)
+    {
+        if (Index & 1)
+        {
+            Result ^= Directions[Bit];
+        }
+    }
+    return Result;
+}
+
+uint32_t FSampling::OwenScramble(uint32_t Value, uint32_t Seed)
+{
+    // Laine and Karras' permutation with Burley's constants flips each bit based on the lower ones only,
+    // done on the reversed bits it depends on the higher ones, which is Owen scrambling
+    Value = ReverseBits(Value);
+    Value ^= Value * 0x3D20ADEAu;
+    Value += Seed;
+    Value *= (Seed >> 16) | 1;
+    Value ^= Value * 0x05526C56u;
+    Value ^= Value * 0x53A22864u;
+    return ReverseBits(Value);
+}
+
+float FSampling::SobolOwen(uint32_t Index, int32_t Dimension, uint32_t Seed)
+{
+    const uint32_t Hash = HashSeed(Seed);
+    const uint32_t ShuffledIndex = OwenScramble(Index, Hash);
+    return ToUnitFloat(OwenScramble(Sobol(ShuffledIndex, Dimension), HashCombine(Hash, (uint32_t)Dimension)));
+}
+
+MVector2D FSampling::SobolOwen2D(uint32_t Index, uint32_t Seed)
+{
+    const uint32_t Hash = HashSeed(Seed);
+    const uint32_t ShuffledIndex = OwenScramble(Index, Hash);
+    return MVector2D(
+        ToUnitFloat(OwenScramble(Sobol(ShuffledIndex, 0), HashCombine(Hash, 0))),
+        ToUnitFloat(OwenScramble(Sobol(ShuffledIndex, 1), HashCombine(Hash, 1))));
+}
+
+float FSampling::Halton(uint32_t Index, int32_t Dimension)
+{
+    const uint32_t Base = HaltonPrimes[Dimension];
+    const double InvBase = 1.0 / Base;
+    uint64_t Reversed = 0;
+    double InvBaseN = 1.0;
+    while (Index)
+    {
+        const uint32_t Next = Index / Base;
+        Reversed = Reversed * Base + (Index - Next * Base);
+        InvBaseN *= InvBase;
+        Index = Next;
+    }
+    return FMath::Min((float)(Reversed * InvBaseN), OneMinusEpsilon);
+}
+
+MVector2D FSampling::R2(uint32_t Index, const MVector2D& Offset)
+{
+    // Fixed point keeps the recurrence exact for any index
+    const uint32_t OffsetX = (uint32_t)(int64_t)(Offset.x * 4294967296.0);
+    const uint32_t OffsetY = (uint32_t)(int64_t)(Offset.y * 4294967296.0);
+    return MVector2D(ToUnitFloat(OffsetX + Index * R2StepX), ToUnitFloat(OffsetY + Index * R2StepY));
+}
+
+MVector2D FSampling::ConcentricDisk(const MVector2D& Sample)
+{
+    const float A = Sample.x * 2.0f - 1.0f;
+    const float B = Sample.y * 2.0f - 1.0f;
+    const bool bAMajor = FMath::Abs(A) > FMath::Abs(B);
+    const float Radius = bAMajor ? A : B;
+    const float Ratio = Radius != 0.0f ? (bAMajor ? B : A) / Radius : 0.0f;
+    const float Phi = bAMajor ? Ratio * (PI / 4.0f) : PI / 2.0f - Ratio * (PI / 4.0f);
+    return MVector2D(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi));
+}
+
+MVector FSampling::UniformSphere(const MVector2D& Sample)
+{
+    const float Z = 1.0f - 2.0f * Sample.x;
+    const float Radius = FMath::Sqrt(FMath::Max(0.0f, 1.0f - Z * Z));
+    const float Phi = 2.0f * PI * Sample.y;
+    return MVector(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+}
+
+MVector FSampling::UniformHemisphere(const MVector2D& Sample)
+{
+    return UniformCone(Sample, 0.0f);
+}
+
+MVector FSampling::CosineHemisphere(const MVector2D& Sample)
+{
+    // Malley: uniform on the disk, projected up to the hemisphere
+    const MVector2D Disk = ConcentricDisk(Sample);
+    return MVector(Disk.x, Disk.y, FMath::Sqrt(FMath::Max(0.0f, 1.0f - Disk.SizeSquared())));
+}
+
+MVector FSampling::UniformCone(const MVector2D& Sample, float CosHalfAngle)
+{
+    const float Z = 1.0f - Sample.x * (1.0f - CosHalfAngle);
+    const float Radius = FMath::Sqrt(FMath::Max(0.0f, 1.0f - Z * Z));
+    const float Phi = 2.0f * PI * Sample.y;
+    return MVector(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+}
+
+void FSampling::ConcentricDisk(const FFloatWide& U, const FFloatWide& V, FFloatWide& OutX, FFloatWide& OutY)
+{
+    const FFloatWide Zero(0.0f);
+    const FFloatWide A = U * FFloatWide(2.0f) - FFloatWide(1.0f);
+    const FFloatWide B = V * FFloatWide(2.0f) - FFloatWide(1.0f);
+    const FMaskWide bAMajor = FFloatWide::Abs(A) > FFloatWide::Abs(B);
+    const FFloatWide Radius = FFloatWide::Select(bAMajor, A, B);
+    const FMaskWide bCenter = Radius == Zero;
+    const FFloatWide Ratio = FFloatWide::Select(bCenter, Zero, FFloatWide::Select(bAMajor, B, A) / FFloatWide::Select(bCenter, FFloatWide(1.0f), Radius));
+    const FFloatWide Phi = FFloatWide::Select(bAMajor, Ratio * FFloatWide(PI / 4.0f), FFloatWide(PI / 2.0f) - Ratio * FFloatWide(PI / 4.0f));
+    OutX = Radius * FMath::Cos(Phi);
+    OutY = Radius * FMath::Sin(Phi);
+}
+
+MVectorWide FSampling::UniformSphere(const FFloatWide& U, const FFloatWide& V)
+{
+    const FFloatWide Z = FFloatWide(1.0f) - FFloatWide(2.0f) * U;
+    const FFloatWide Radius = FFloatWide::Sqrt(FFloatWide::Max(FFloatWide(0.0f), FFloatWide(1.0f) - Z * Z));
+    const FFloatWide Phi = FFloatWide(2.0f * PI) * V;
+    return MVectorWide(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+}
+
+MVectorWide FSampling::UniformHemisphere(const FFloatWide& U, const FFloatWide& V)
+{
+    return UniformCone(U, V, 0.0f);
+}
+
+MVectorWide FSampling::CosineHemisphere(const FFloatWide& U, const FFloatWide& V)
+{
+    FFloatWide X, Y;
+    ConcentricDisk(U, V, X, Y);
+    return MVectorWide(X, Y, FFloatWide::Sqrt(FFloatWide::Max(FFloatWide(0.0f), FFloatWide(1.0f) - X * X - Y * Y)));
+}
+
+MVectorWide FSampling::UniformCone(const FFloatWide& U, const FFloatWide& V, float CosHalfAngle)
+{
+    const FFloatWide Z = FFloatWide(1.0f) - U * FFloatWide(1.0f - CosHalfAngle);
+    const FFloatWide Radius = FFloatWide::Sqrt(FFloatWide::Max(FFloatWide(0.0f), FFloatWide(1.0f) - Z * Z));
+    const FFloatWide Phi = FFloatWide(2.0f * PI) * V;
+    return MVectorWide(Radius * FMath::Cos(Phi), Radius * FMath::Sin(Phi), Z);
+}
+
+void FSampling::Generate2D(ESampleSequence Sequence, uint32_t FirstIndex, int32_t NumSamples, uint32_t Seed, float* OutX, float* OutY)
+{
+    // Seed 0 is the plain sequence, other seeds shift it by hashed fractions
+    const uint32_t ShiftX = Seed ? HashSeed(Seed) : 0;
+    const uint32_t ShiftY = Seed ? HashSeed(ShiftX) : 0;
+
+    switch (Sequence)
+    {
+    case ESampleSequence::Random:
+    {
+        // Hashed from the seed and the sample index, so any range of indices matches the whole sequence
+        for (int32_t Index = 0; Index < NumSamples; ++Index)
+        {
+            const uint64_t Bits = HashSample(((uint64_t)Seed << 32) | (FirstIndex + (uint32_t)Index));
+            OutX[Index] = ToUnitFloat((uint32_t)(Bits >> 32));
+            OutY[Index] = ToUnitFloat((uint32_t)Bits);
+        }
+        break;
+    }
+    case ESampleSequence::Halton:
+    {
+        const float UnitShiftX = ToUnitFloat(ShiftX);
+        const float UnitShiftY = ToUnitFloat(ShiftY);
+        for (int32_t Index = 0; Index < NumSamples; ++Index)
+        {
+            OutX[Index] = WrapUnit(Halton(FirstIndex + Index, 0) + UnitShiftX);
+            OutY[Index] = WrapUnit(Halton(FirstIndex + Index, 1) + UnitShiftY);
+        }
+        break;
+    }
+    case ESampleSequence::Sobol:
+    {
+        // The first dimension is the bit reversed index, XOR shifts keep the stratification
+        for (int32_t Index = 0; Index < NumSamples; ++Index)
+        {
+            const uint32_t SampleIndex = FirstIndex + (uint32_t)Index;
+            OutX[Index] = ToUnitFloat(ReverseBits(SampleIndex) ^ ShiftX);
+            OutY[Index] = ToUnitFloat(Sobol(SampleIndex, 1) ^ ShiftY);
+        }
+        break;
+    }
+    case ESampleSequence::OwenSobol:
+    {
+        for (int32_t Index = 0; Index < NumSamples; ++Index)
+        {
+            const MVector2D Sample = SobolOwen2D(FirstIndex + (uint32_t)Index, Seed);
+            OutX[Index] = Sample.x;
+            OutY[Index] = Sample.y;
+        }
+        break;
+    }
+    case ESampleSequence::R2:
+    {
+        uint32_t X = (Seed ? ShiftX : 0x80000000u) + FirstIndex * R2StepX;
+        uint32_t Y = (Seed ? ShiftY : 0x80000000u) + FirstIndex * R2StepY;
+        for (int32_t Index = 0; Index < NumSamples; ++Index, X += R2StepX, Y += R2StepY)
+        {
+            OutX[Index] = ToUnitFloat(X);
+            OutY[Index] = ToUnitFloat(Y);
+        }
+        break;
+    }
+    }
+}
+
+void FSampling::WarpToDisk(const float* X, const float* Y, int32_t NumSamples, float* OutX, float* OutY)
+{
+    int32_t Index = 0;
+    for (; Index + FFloatWide::Lanes <= NumSamples; Index += FFloatWide::Lanes)
+    {
+        FFloatWide DiskX, DiskY;
+        ConcentricDisk(FFloatWide::Load(X + Index), FFloatWide::Load(Y + Index), DiskX, DiskY);
+        DiskX.Store(OutX + Index);
+        DiskY.Store(OutY + Index);
+    }
+
+    if (Index < NumSamples)
+    {
+        const int32_t Num = NumSamples - Index;
+        FFloatWide DiskX, DiskY;
+        ConcentricDisk(FFloatWide::LoadPartial(X + Index, Num), FFloatWide::LoadPartial(Y + Index, Num), DiskX, DiskY);
+        DiskX.StorePartial(OutX + Index, Num);
+        DiskY.StorePartial(OutY + Index, Num);
+    }
+}
+
+void FSampling::WarpToSphere(const float* X, const float* Y, int32_t NumSamples, float* OutX, float* OutY, float* OutZ)
+{
+    WarpDirectionsWide(X, Y, NumSamples, OutX, OutY, OutZ, [](const FFloatWide& U, const FFloatWide& V) { return UniformSphere(U, V); });
+}
+
+void FSampling::WarpToHemisphere(const float* X, const float* Y, int32_t NumSamples, const MVector& Axis, float* OutX, float* OutY, float* OutZ)
+{
+    const FSampleFrame Frame(Axis);
+    WarpDirectionsWide(X, Y, NumSamples, OutX, OutY, OutZ, [&Frame](const FFloatWide& U, const FFloatWide& V) { return Frame.ToWorld(UniformHemisphere(U, V)); });
+}
+
+void FSampling::WarpToCosineHemisphere(const float* X, const float* Y, int32_t NumSamples, const MVector& Axis, float* OutX, float* OutY, float* OutZ)
+{
+    const FSampleFrame Frame(Axis);
+    WarpDirectionsWide(X, Y, NumSamples, OutX, OutY, OutZ, [&Frame](const FFloatWide& U, const FFloatWide& V) { return Frame.ToWorld(CosineHemisphere(U, V)); });
+}
+
+void FSampling::WarpToCone(const float* X, const float* Y, int32_t NumSamples, const MVector& Axis, float CosHalfAngle, float* OutX, float* OutY, float* OutZ)
+{
+    const FSampleFrame Frame(Axis);
+    WarpDirectionsWide(X, Y, NumSamples, OutX, OutY, OutZ, [&Frame, CosHalfAngle](const FFloatWide& U, const FFloatWide& V) { return Frame.ToWorld(UniformCone(U, V, CosHalfAngle)); });
+}
+
+const float* FSampling::GetBlueNoiseTile()
+{
+    static const FBlueNoiseTile Tile;
+    return Tile.Values;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Vector.h"
+#include "Base/VectorWide.h"
+
+/** Point sets FSampling::Generate2D fills buffers from. */
+enum class ESampleSequence : uint8_t
+{
+    /** Independent uniform draws, each hashed from the seed and its index. */
+    Random,
+    /** Radical inverses in bases 2 and 3, shifted by the seed. */
+    Halton,
+    /** First two Sobol dimensions, shifted by the seed. Every power of two prefix is stratified. */
+    Sobol,
+    /** Sobol with the index shuffled and the values Owen scrambled by the seed, decorrelated and still stratified. */
+    OwenSobol,
+    /** Roberts' additive recurrence on the plastic number, shifted by the seed. Well spread for any count. */
+    R2,
+};
+
+/**
+ * Low discrepancy sequences and warps from the unit square to the shapes Monte Carlo estimators
+ * integrate over, for AO, lighting bakes and anything else that averages many samples. Sequences
+ * converge much faster than random draws and the warps are direct mappings, there are no rejection
+ * loops. Warped directions are around +Z unless they take an axis.
+ *
+ * The bulk functions read and write structure of arrays buffers, one float array per component,
+ * and run on FFloatWide. Inputs and outputs may be the same arrays.
+ */
+class CORE_API FSampling
+{
+public:
+    /** Dimensions Sobol and SobolOwen support. */
+    static constexpr int32_t MaxSobolDimensions = 5;
+
+    /** Dimensions Halton supports, one per prime base. */
+    static constexpr int32_t MaxHaltonDimensions = 16;
+
+    /** Side of the blue noise tile. */
+    static constexpr int32_t BlueNoiseTileSize = 64;
+
+    /** Sobol value of Index in Dimension as a 32 bit fraction, Dimension below MaxSobolDimensions. */
+    static uint32_t Sobol(uint32_t Index, int32_t Dimension);
+
+    /** Sobol sample with the shuffled index and Owen scrambled dimensions of hash based Owen scrambling (Burley 2020). */
+    static float SobolOwen(uint32_t Index, int32_t Dimension, uint32_t Seed);
+    static MVector2D SobolOwen2D(uint32_t Index, uint32_t Seed);
+
+    /**
+     * Nested uniform scramble of a 32 bit fraction: each bit is flipped based on the bits above it, which
+     * randomizes the point set but keeps its stratification.
+     */
+    static uint32_t OwenScramble(uint32_t Value, uint32_t Seed);
+
+    /** Radical inverse of Index in the Dimension-th prime base, in [0, 1). */
+    static float Halton(uint32_t Index, int32_t Dimension);
+
+    /** R2 point Index, Offset is the point for index 0 and the sequence wraps around the unit square. */
+    static MVector2D R2(uint32_t Index, const MVector2D& Offset = MVector2D(0.5f));
+
+    /** 32 bit fraction to a float in [0, 1), keeping the 24 bits a float can hold. */
+    static float ToUnitFloat(uint32_t Fraction)
+    {
+        return (Fraction >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /** Unit square to unit disk, Shirley and Chiu's concentric mapping that keeps strata compact. */
+    static MVector2D ConcentricDisk(const MVector2D& Sample);
+
+    static MVector UniformSphere(const MVector2D& Sample);
+    static MVector UniformHemisphere(const MVector2D& Sample);
+
+    /** Directions with a density proportional to their cosine with +Z, the diffuse lobe. Pdf is Z / PI. */
+    static MVector CosineHemisphere(const MVector2D& Sample);
+
+    /** Uniform over the directions within the cone of +Z whose half angle has the given cosine. */
+    static MVector UniformCone(const MVector2D& Sample, float CosHalfAngle);
+
+    /** Wide versions of the warps, one sample per lane. */
+    static void ConcentricDisk(const FFloatWide& U, const FFloatWide& V, FFloatWide& OutX, FFloatWide& OutY);
+    static MVectorWide UniformSphere(const FFloatWide& U, const FFloatWide& V);
+    static MVectorWide UniformHemisphere(const FFloatWide& U, const FFloatWide& V);
+    static MVectorWide CosineHemisphere(const FFloatWide& U, const FFloatWide& V);
+    static MVectorWide UniformCone(const FFloatWide& U, const FFloatWide& V, float CosHalfAngle);
+
+    /**
+     * Fills NumSamples points of Sequence starting at FirstIndex into OutX and OutY. The seed picks one
+     * of many equivalent point sets, use a different one per pixel or texel to decorrelate their noise.
+     * Point i only depends on i and the seed, so a range filled in several calls matches one call.
+     */
+    static void Generate2D(ESampleSequence Sequence, uint32_t FirstIndex, int32_t NumSamples, uint32_t Seed, float* OutX, float* OutY);
+
+    /** Bulk warps from unit square samples, the hemisphere and cone ones oriented around the unit vector Axis. */
+    static void WarpToDisk(const float* X, const float* Y, int32_t NumSamples, float* OutX, float* OutY);
+    static void WarpToSphere(const float* X, const float* Y, int32_t NumSamples, float* OutX, float* OutY, float* OutZ);
+    static void WarpToHemisphere(const float* X, const float* Y, int32_t NumSamples, const MVector& Axis, float* OutX, float* OutY, float* OutZ);
+    static void WarpToCosineHemisphere(const float* X, const float* Y, int32_t NumSamples, const MVector& Axis, float* OutX, float* OutY, float* OutZ);
+    static void WarpToCone(const float* X, const float* Y, int32_t NumSamples, const MVector& Axis, float CosHalfAngle, float* OutX, float* OutY, float* OutZ);
+
+    /**
+     * Tileable BlueNoiseTileSize squared blue noise texture from void and cluster, row major values in
+     * (0, 1) that each appear once. The ranks are precomputed, first use only converts them to floats.
+     * Offsetting a sequence per pixel by it spreads the error as high frequency noise that averages out quickly.
+     */
+    static const float* GetBlueNoiseTile();
+
+    /** Blue noise tile value at the pixel, wrapping around the tile. */
+    static float BlueNoise(int32_t X, int32_t Y)
+    {
+        return GetBlueNoiseTile()[(Y & (BlueNoiseTileSize - 1)) * BlueNoiseTileSize + (X & (BlueNoiseTileSize - 1))];
+    }
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+#include "Base/Color.h"
+#include "Util/CpuInfo.h"
+
+/**
+ * The kernels behind the FMath and FColor array functions. MathUtilWide.inl and ColorWide.inl define them,
+ * with the wide transcendentals and FColorWide they are built on, in the namespace of the wide types: once
+ * for the build's baseline by MathUtil.cpp and Color.cpp, and once per higher tier by a file compiled for
+ * that tier only (SimdKernelsAVX2.cpp). The array functions pick a variant with TSimdKernel, the baseline
+ * one runs on every CPU the build supports and stands in for the Scalar tier.
+ */
+#define MIKASA_DECLARE_SIMD_KERNELS \
+    namespace SimdKernels \
+    { \
+        void Sin(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Cos(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Exp(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Exp2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Log2(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Sqrt(const float* Values, int32_t NumValues, float* OutValues); \
+        void InvSqrt(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Pow(const float* Bases, const float* Exponents, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        void Pow(const float* Bases, float Exponent, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy); \
+        \
+        void SRGBToLinear(const FColor* Colors, int32_t NumColors, FColor* OutColors); \
+        void LinearToSRGB(const FColor* Colors, int32_t NumColors, FColor* OutColors); \
+        void RgbToHsv(const FColor* Colors, int32_t NumColors, FHsvColor* OutColors); \
+        void HsvToRgb(const FHsvColor* Colors, int32_t NumColors, FColor* OutColors); \
+        void Premultiply(const FColor* Colors, int32_t NumColors, FColor* OutColors); \
+        void PackRGBA8(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked); \
+        void PackRGB10A2(const FColor* Colors, int32_t NumColors, uint32_t* OutPacked); \
+        void UnpackRGBA8(const uint32_t* Packed, int32_t NumColors, FColor* OutColors, bool bSRGB); \
+        void UnpackRGB10A2(const uint32_t* Packed, int32_t NumColors, FColor* OutColors); \
+        void SRGBToLinear(const float* Values, int32_t NumValues, float* OutValues); \
+        void LinearToSRGB(const float* Values, int32_t NumValues, float* OutValues); \
+    }
+
+inline namespace MIKASA_SIMD_NAMESPACE
+{
+    MIKASA_DECLARE_SIMD_KERNELS
+}
+
+// Defined by the build when it compiles SimdKernelsAVX2.cpp with AVX2 and FMA
+#if MIKASA_SIMD_TIER_AVX2
+namespace SimdTierAVX2
+{
+    MIKASA_DECLARE_SIMD_KERNELS
+}
+
+#define MIKASA_SIMD_KERNEL_VARIANTS(Kernel) \
+    { \
+        { ESimdTier::Scalar, &SimdKernels::Kernel }, \
+        { ESimdTier::AVX2, &SimdTierAVX2::SimdKernels::Kernel }, \
+    }
+#else
+#define MIKASA_SIMD_KERNEL_VARIANTS(Kernel) \
+    { \
+        { ESimdTier::Scalar, &SimdKernels::Kernel }, \
+    }
+#endif
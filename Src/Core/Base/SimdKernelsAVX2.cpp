@@ -0,0 +1,13 @@
+// Compiled with AVX2 and FMA (/arch:AVX2, -mavx2 -mfma), see Core/CMakeLists.txt. The kernels below only run
+// once FCpuInfo reports the AVX2 tier. Everything here must stay in the wide types' namespace or call out of
+// line: an inline function of another header used here would be emitted with AVX2 instructions, and the
+// linker may keep that copy for the whole library.
+#define MIKASA_SIMD_NAMESPACE SimdTierAVX2
+
+#include "Base/MathUtil.h"
+#include "Base/Color.h"
+
+#if MIKASA_SIMD_TIER_AVX2
+#include "Base/MathUtilWide.inl"
+#include "Base/ColorWide.inl"
+#endif
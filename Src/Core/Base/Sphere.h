@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Box.h"
+
+/** Sphere around Center with radius W. */
+struct FSphere
+{
+    MVector Center;
+    float W;
+
+    constexpr FSphere()
+        : Center(0.0f), W(0.0f)
+    {
+    }
+
+    constexpr FSphere(const MVector& InCenter, float InW)
+        : Center(InCenter), W(InW)
+    {
+    }
+
+    bool IsInside(const MVector& Point, float Tolerance = 1.e-4f) const
+    {
+        return (Point - Center).SizeSquared() <= (W + Tolerance) * (W + Tolerance);
+    }
+
+    /** Touching spheres intersect. */
+    bool Intersects(const FSphere& Other) const
+    {
+        return (Other.Center - Center).SizeSquared() <= (W + Other.W) * (W + Other.W);
+    }
+
+    FBox GetBox() const
+    {
+        return FBox::BuildAABB(Center, MVector(W));
+    }
+
+    std::string ToString() const
+    {
+        return "Center=(" + Center.ToString() + "), W=" + std::to_string(W);
+    }
+};
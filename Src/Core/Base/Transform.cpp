@@ -0,0 +1,250 @@
+#include "Transform.h"
+
+#include "Base/TransformWide.h"
+
+const FTransform FTransform::Identity;
+
+namespace
+{
+    /** Runs Kernel(Index, Num) over packets of FFloatWide::Lanes transforms, the last one partial. */
+    template <typename KernelType>
+    void ForEachPacket(int32_t NumTransforms, KernelType Kernel)
+    {
+        int32_t Index = 0;
+        for (; Index + FFloatWide::Lanes <= NumTransforms; Index += FFloatWide::Lanes)
+        {
+            Kernel(Index, FFloatWide::Lanes);
+        }
+
+        if (Index < NumTransforms)
+        {
+            Kernel(Index, NumTransforms - Index);
+        }
+    }
+
+    void ComposeHierarchyScalar(const FTransform* LocalTransforms, const int32_t* ParentIndices, int32_t Begin, int32_t End, FTransform* OutWorldTransforms)
+    {
+        for (int32_t Index = Begin; Index < End; ++Index)
+        {
+            const int32_t Parent = ParentIndices[Index];
+            if (Parent >= 0)
+            {
+                OutWorldTransforms[Index] = LocalTransforms[Index] * OutWorldTransforms[Parent];
+            }
+            else
+            {
+                OutWorldTransforms[Index] = LocalTransforms[Index];
+            }
+        }
+    }
+
+    /** Composes the transforms Indices lists, one per lane, with their parents, which must be composed already. */
+    void ComposeGathered(const FTransform* LocalTransforms, const int32_t* ParentIndices, const int32_t* Indices, FTransform* OutWorldTransforms)
+    {
+        const FTransformWide Locals = FTransformWide::LoadLanes([=](int32_t Lane) -> const FTransform&
+        {
+            return LocalTransforms[Indices[Lane]];
+        });
+        const FTransformWide Parents = FTransformWide::LoadLanes([=](int32_t Lane) -> const FTransform&
+        {
+            const int32_t Parent = ParentIndices[Indices[Lane]];
+            return Parent >= 0 ? OutWorldTransforms[Parent] : FTransform::Identity;
+        });
+        (Locals * Parents).StoreLanes([=](int32_t Lane) -> FTransform& { return OutWorldTransforms[Indices[Lane]]; });
+    }
+
+    /**
+     * Composes [Begin, End), the transforms before Begin being composed already. The range splits in runs
+     * of transforms whose parent is the transform before them, the chains of a depth first order. Every
+     * lane walks its own run, so most parents are what the lane stored one step before, and a run starts
+     * once the parent of its first transform is composed.
+     */
+    void ComposeRuns(const FTransform* LocalTransforms, const int32_t* ParentIndices, int32_t Begin, int32_t End, FTransform* OutWorldTransforms)
+    {
+        constexpr int32_t Lanes = FFloatWide::Lanes;
+
+        // Lane runs are [RunStarts, RunEnds), composed up to RunCursors
+        int32_t RunStarts[Lanes];
+        int32_t RunCursors[Lanes];
+        int32_t RunEnds[Lanes];
+        std::fill(RunStarts, RunStarts + Lanes, Begin);
+        std::fill(RunCursors, RunCursors + Lanes, Begin);
+        std::fill(RunEnds, RunEnds + Lanes, Begin);
+
+        // Runs are handed out in order, a transform outside the lane runs is composed once it is below NextRun
+        const auto IsComposed = [&](int32_t Index)
+        {
+            for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+            {
+                if (Index >= RunStarts[Lane] && Index < RunEnds[Lane])
+                {
+                    return Index < RunCursors[Lane];
+                }
+            }
+            return true;
+        };
+
+        int32_t NextRun = Begin;
+        while (true)
+        {
+            int32_t Indices[Lanes];
+            bool bReadyLanes[Lanes];
+            int32_t NumReady = 0;
+            int32_t ReadyLane = 0;
+            for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+            {
+                if (RunCursors[Lane] == RunEnds[Lane] && NextRun < End)
+                {
+                    RunStarts[Lane] = NextRun;
+                    RunCursors[Lane] = NextRun;
+                    do
+                    {
+                        ++NextRun;
+                    } while (NextRun < End && ParentIndices[NextRun] == NextRun - 1);
+                    RunEnds[Lane] = NextRun;
+                }
+
+                const int32_t Cursor = RunCursors[Lane];
+                const bool bReady = Cursor < RunEnds[Lane] && (Cursor > RunStarts[Lane] || ParentIndices[Cursor] < 0 || IsComposed(ParentIndices[Cursor]));
+                Indices[Lane] = Cursor;
+                bReadyLanes[Lane] = bReady;
+                NumReady += bReady ? 1 : 0;
+                ReadyLane = bReady ? Lane : ReadyLane;
+            }
+
+            // The lowest transform left always has its parent composed, no ready lane means the range is done
+            if (NumReady == 0)
+            {
+                return;
+            }
+
+            if (NumReady == 1)
+            {
+                ComposeHierarchyScalar(LocalTransforms, ParentIndices, Indices[ReadyLane], Indices[ReadyLane] + 1, OutWorldTransforms);
+            }
+            else
+            {
+                // Waiting lanes repeat a ready one, and store the same value to it again
+                for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+                {
+                    Indices[Lane] = bReadyLanes[Lane] ? Indices[Lane] : Indices[ReadyLane];
+                }
+                ComposeGathered(LocalTransforms, ParentIndices, Indices, OutWorldTransforms);
+            }
+
+            for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+            {
+                RunCursors[Lane] += bReadyLanes[Lane] ? 1 : 0;
+            }
+        }
+    }
+}
+
+FTransform::FTransform(const FMatrix& Matrix)
+    : Translation(Matrix.GetOrigin()), Scale3D(Matrix.GetScaleVector())
+{
+    MVector X = Matrix.GetScaledAxis(0);
+    const MVector Y = Matrix.GetScaledAxis(1);
+    const MVector Z = Matrix.GetScaledAxis(2);
+
+    // A mirrored basis is no rotation, mirror X back and keep the mirroring in the scale
+    if (((X ^ Y) | Z) < 0.0f)
+    {
+        X = -X;
+        Scale3D.x = -Scale3D.x;
+    }
+
+    const MVector InvScale3D = GetSafeScaleReciprocal(Scale3D.GetAbs());
+    Rotation = FMatrix(X * InvScale3D.x, Y * InvScale3D.y, Z * InvScale3D.z, MVector::ZeroVector).ToQuat().GetNormalized();
+}
+
+void FTransform::MultiplyBatch(const FTransform* A, const FTransform* B, int32_t NumTransforms, FTransform* OutTransforms)
+{
+    ForEachPacket(NumTransforms, [=](int32_t Index, int32_t Num)
+    {
+        (FTransformWide::Load(A + Index, Num) * FTransformWide::Load(B + Index, Num)).Store(OutTransforms + Index, Num);
+    });
+}
+
+void FTransform::InverseBatch(const FTransform* Transforms, int32_t NumTransforms, FTransform* OutTransforms)
+{
+    ForEachPacket(NumTransforms, [=](int32_t Index, int32_t Num)
+    {
+        FTransformWide::Load(Transforms + Index, Num).Inverse().Store(OutTransforms + Index, Num);
+    });
+}
+
+void FTransform::BlendBatch(const FTransform* A, const FTransform* B, const float* Alphas, int32_t NumTransforms, FTransform* OutTransforms)
+{
+    ForEachPacket(NumTransforms, [=](int32_t Index, int32_t Num)
+    {
+        const FFloatWide Alpha = FFloatWide::LoadPartial(Alphas + Index, Num);
+        FTransformWide::Blend(FTransformWide::Load(A + Index, Num), FTransformWide::Load(B + Index, Num), Alpha).Store(OutTransforms + Index, Num);
+    });
+}
+
+void FTransform::ToMatrixBatch(const FTransform* Transforms, int32_t NumTransforms, FMatrix* OutMatrices)
+{
+    ForEachPacket(NumTransforms, [=](int32_t Index, int32_t Num)
+    {
+        // FMatrix::MakeRotation with the rows scaled, as ToMatrixWithScale
+        const FTransformWide Transform = FTransformWide::Load(Transforms + Index, Num);
+        const FQuatWide& Q = Transform.Rotation;
+        const FFloatWide One(1.0f);
+        const FFloatWide X2 = Q.x + Q.x, Y2 = Q.y + Q.y, Z2 = Q.z + Q.z;
+        const FFloatWide XX2 = Q.x * X2, YY2 = Q.y * Y2, ZZ2 = Q.z * Z2;
+        const FFloatWide XY2 = Q.x * Y2, XZ2 = Q.x * Z2, YZ2 = Q.y * Z2;
+        const FFloatWide WX2 = Q.w * X2, WY2 = Q.w * Y2, WZ2 = Q.w * Z2;
+        const MVectorWide& Scale = Transform.Scale3D;
+        const MVectorWide& Origin = Transform.Translation;
+
+        FMatrix Buffer[FFloatWide::Lanes];
+        FMatrix* Matrices = Num < FFloatWide::Lanes ? Buffer : OutMatrices + Index;
+        const FFloatWide Zero(0.0f);
+        FFloatWide::StoreTransposed4((One - (YY2 + ZZ2)) * Scale.x, (XY2 + WZ2) * Scale.x, (XZ2 - WY2) * Scale.x, Zero, [Matrices](int32_t Lane) { return Matrices[Lane].M[0]; });
+        FFloatWide::StoreTransposed4((XY2 - WZ2) * Scale.y, (One - (XX2 + ZZ2)) * Scale.y, (YZ2 + WX2) * Scale.y, Zero, [Matrices](int32_t Lane) { return Matrices[Lane].M[1]; });
+        FFloatWide::StoreTransposed4((XZ2 + WY2) * Scale.z, (YZ2 - WX2) * Scale.z, (One - (XX2 + YY2)) * Scale.z, Zero, [Matrices](int32_t Lane) { return Matrices[Lane].M[2]; });
+        FFloatWide::StoreTransposed4(Origin.x, Origin.y, Origin.z, One, [Matrices](int32_t Lane) { return Matrices[Lane].M[3]; });
+
+        if (Matrices == Buffer)
+        {
+            std::copy(Buffer, Buffer + Num, OutMatrices + Index);
+        }
+    });
+}
+
+void FTransform::ComposeHierarchy(const FTransform* LocalTransforms, const int32_t* ParentIndices, int32_t NumTransforms, FTransform* OutWorldTransforms)
+{
+    constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    int32_t Index = 0;
+    bool bPreviousPacketScalar = false;
+    for (; Index + Lanes <= NumTransforms; Index += Lanes)
+    {
+        // Parents composed before this packet, roots compose with the identity, which leaves them unchanged
+        if ((FIntWide::Load(ParentIndices + Index) < FIntWide(Index)).AllTrue())
+        {
+            const FTransformWide Parents = FTransformWide::LoadLanes([=](int32_t Lane) -> const FTransform&
+            {
+                const int32_t Parent = ParentIndices[Index + Lane];
+                return Parent >= 0 ? OutWorldTransforms[Parent] : Identity;
+            });
+            (FTransformWide::Load(LocalTransforms + Index) * Parents).Store(OutWorldTransforms + Index);
+            bPreviousPacketScalar = false;
+            continue;
+        }
+
+        // Two packets in a row with parents inside them, not a level boundary of a breadth first order
+        // but chains of a depth first one
+        if (bPreviousPacketScalar)
+        {
+            ComposeRuns(LocalTransforms, ParentIndices, Index, NumTransforms, OutWorldTransforms);
+            return;
+        }
+
+        ComposeHierarchyScalar(LocalTransforms, ParentIndices, Index, Index + Lanes, OutWorldTransforms);
+        bPreviousPacketScalar = true;
+    }
+
+    ComposeHierarchyScalar(LocalTransforms, ParentIndices, Index, NumTransforms, OutWorldTransforms);
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Matrix.h"
+
+/**
+ * Scale, then rotation, then translation. A * B applies A first, then B, so a local transform times
+ * its parent's world transform is its own world transform, like FMatrix.
+ *
+ * Non-uniform scale combined with rotation composes and inverts approximately, the shear such a
+ * combination produces has no place in the three components, use FMatrix where it matters.
+ *
+ * Every component is padded to four floats, which lets the batch functions below transpose arrays of
+ * transforms to FTransformWide (see TransformWide.h) with full width loads.
+ */
+struct CORE_API FTransform
+{
+    FQuat Rotation;
+    alignas(16) MVector Translation;
+    alignas(16) MVector Scale3D;
+
+    static const FTransform Identity;
+
+    FTransform()
+        : Rotation(), Translation(MVector::ZeroVector), Scale3D(MVector::OneVector)
+    {
+    }
+
+    explicit FTransform(const MVector& InTranslation)
+        : Rotation(), Translation(InTranslation), Scale3D(MVector::OneVector)
+    {
+    }
+
+    explicit FTransform(const FQuat& InRotation)
+        : Rotation(InRotation), Translation(MVector::ZeroVector), Scale3D(MVector::OneVector)
+    {
+    }
+
+    FTransform(const FQuat& InRotation, const MVector& InTranslation, const MVector& InScale3D = MVector::OneVector)
+        : Rotation(InRotation), Translation(InTranslation), Scale3D(InScale3D)
+    {
+    }
+
+    /** Decomposes a matrix, mirroring goes to a negative X scale and shear is lost. */
+    explicit FTransform(const FMatrix& Matrix);
+
+    /** This transform followed by Other. */
+    FTransform operator*(const FTransform& Other) const
+    {
+        return FTransform(Other.Rotation * Rotation, Other.Rotation.RotateVector(Other.Scale3D * Translation) + Other.Translation, Scale3D * Other.Scale3D);
+    }
+
+    FTransform& operator*=(const FTransform& Other) { return *this = *this * Other; }
+
+    /** Exact for uniform scale. Axes scaled by nearly zero get a zero inverse scale. */
+    FTransform Inverse() const
+    {
+        const FQuat InvRotation = Rotation.Inverse();
+        const MVector InvScale3D = GetSafeScaleReciprocal(Scale3D);
+        return FTransform(InvRotation, InvRotation.RotateVector(-Translation) * InvScale3D, InvScale3D);
+    }
+
+    /** This transform in the space of Other, such that GetRelativeTransform(Other) * Other == *this. */
+    FTransform GetRelativeTransform(const FTransform& Other) const
+    {
+        return *this * Other.Inverse();
+    }
+
+    MVector TransformPosition(const MVector& P) const { return Rotation.RotateVector(Scale3D * P) + Translation; }
+    MVector TransformVector(const MVector& V) const { return Rotation.RotateVector(Scale3D * V); }
+    MVector TransformVectorNoScale(const MVector& V) const { return Rotation.RotateVector(V); }
+
+    MVector InverseTransformPosition(const MVector& P) const { return Rotation.UnrotateVector(P - Translation) * GetSafeScaleReciprocal(Scale3D); }
+    MVector InverseTransformVector(const MVector& V) const { return Rotation.UnrotateVector(V) * GetSafeScaleReciprocal(Scale3D); }
+
+    FMatrix ToMatrixWithScale() const
+    {
+        const FMatrix Rotated = FMatrix::MakeRotation(Rotation);
+        return FMatrix(Rotated.GetScaledAxis(0) * Scale3D.x, Rotated.GetScaledAxis(1) * Scale3D.y, Rotated.GetScaledAxis(2) * Scale3D.z, Translation);
+    }
+
+    FMatrix ToMatrixNoScale() const
+    {
+        FMatrix Result = FMatrix::MakeRotation(Rotation);
+        Result.SetOrigin(Translation);
+        return Result;
+    }
+
+    bool Equals(const FTransform& Other, float Tolerance = KINDA_SMALL_NUMBER) const
+    {
+        return Rotation.Equals(Other.Rotation, Tolerance) && Translation.Equals(Other.Translation, Tolerance) && Scale3D.Equals(Other.Scale3D, Tolerance);
+    }
+
+    /** Interpolates every component, the rotation with FQuat::Nlerp. */
+    static FTransform Blend(const FTransform& A, const FTransform& B, float Alpha)
+    {
+        return FTransform(FQuat::Nlerp(A.Rotation, B.Rotation, Alpha), A.Translation + (B.Translation - A.Translation) * Alpha, A.Scale3D + (B.Scale3D - A.Scale3D) * Alpha);
+    }
+
+    static MVector GetSafeScaleReciprocal(const MVector& Scale, float Tolerance = SMALL_NUMBER)
+    {
+        return MVector(
+            fabsf(Scale.x) <= Tolerance ? 0.0f : 1.0f / Scale.x,
+            fabsf(Scale.y) <= Tolerance ? 0.0f : 1.0f / Scale.y,
+            fabsf(Scale.z) <= Tolerance ? 0.0f : 1.0f / Scale.z);
+    }
+
+    std::string ToString() const
+    {
+        return "Rotation: " + Rotation.ToString() + " Translation: " + Translation.ToString() + " Scale3D: " + Scale3D.ToString();
+    }
+
+    /**
+     * Batch functions, FFloatWide::Lanes transforms at a time. Outputs may be one of the inputs but must
+     * not partially overlap them, the results match the scalar functions up to rounding.
+     */
+
+    /** OutTransforms[i] = A[i] * B[i] */
+    static void MultiplyBatch(const FTransform* A, const FTransform* B, int32_t NumTransforms, FTransform* OutTransforms);
+
+    static void InverseBatch(const FTransform* Transforms, int32_t NumTransforms, FTransform* OutTransforms);
+
+    static void BlendBatch(const FTransform* A, const FTransform* B, const float* Alphas, int32_t NumTransforms, FTransform* OutTransforms);
+
+    static void ToMatrixBatch(const FTransform* Transforms, int32_t NumTransforms, FMatrix* OutMatrices);
+
+    /**
+     * World transforms of a hierarchy: OutWorldTransforms[i] = LocalTransforms[i] * OutWorldTransforms[ParentIndices[i]],
+     * roots have a negative parent index. Parents must come before their children. Transforms whose
+     * parents all precede their packet are composed together, so hierarchies sorted by depth (breadth
+     * first) run wide in place. In other orders (depth first) every lane walks its own chain of children
+     * that directly follow their parent, only a single chain left on its own runs one transform at a time.
+     * OutWorldTransforms must not overlap LocalTransforms.
+     */
+    static void ComposeHierarchy(const FTransform* LocalTransforms, const int32_t* ParentIndices, int32_t NumTransforms, FTransform* OutWorldTransforms);
+};
+
+static_assert(sizeof(FTransform) == 12 * sizeof(float), "FTransform components must be padded to four floats");
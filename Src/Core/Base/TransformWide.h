@@ -0,0 +1,221 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/VectorWide.h"
+#include "Base/Transform.h"
+
+/**
+ * FFloatWide::Lanes quaternions in structure of arrays layout, lane N of x, y, z and w forms
+ * quaternion N. Loads and stores transpose from and to FQuat arrays.
+ */
+struct FQuatWide
+{
+    static constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    FFloatWide x, y, z, w;
+
+    FQuatWide()
+    {
+    }
+
+    FQuatWide(const FFloatWide& InX, const FFloatWide& InY, const FFloatWide& InZ, const FFloatWide& InW)
+        : x(InX), y(InY), z(InZ), w(InW)
+    {
+    }
+
+    /** Broadcasts one quaternion to every lane. */
+    FQuatWide(const FQuat& Q)
+        : x(Q.x), y(Q.y), z(Q.z), w(Q.w)
+    {
+    }
+
+    /** Loads up to Lanes quaternions from an FQuat array, missing lanes repeat the last quaternion. */
+    static FQuatWide Load(const FQuat* Quats, int32_t Num = Lanes)
+    {
+        FQuatWide Result;
+        FFloatWide::LoadTransposed4([Quats, Num](int32_t Lane) { return &Quats[Lane < Num ? Lane : Num - 1].x; }, Result.x, Result.y, Result.z, Result.w);
+        return Result;
+    }
+
+    /** Stores the first Num lanes to an FQuat array. */
+    void Store(FQuat* Quats, int32_t Num = Lanes) const
+    {
+        if (Num < Lanes)
+        {
+            FQuat Buffer[Lanes];
+            Store(Buffer);
+            std::copy(Buffer, Buffer + Num, Quats);
+            return;
+        }
+        FFloatWide::StoreTransposed4(x, y, z, w, [Quats](int32_t Lane) { return &Quats[Lane].x; });
+    }
+
+    FQuat GetLane(int32_t Lane) const
+    {
+        return FQuat(x.GetLane(Lane), y.GetLane(Lane), z.GetLane(Lane), w.GetLane(Lane));
+    }
+
+    FQuatWide operator+(const FQuatWide& Q) const { return FQuatWide(x + Q.x, y + Q.y, z + Q.z, w + Q.w); }
+    FQuatWide operator*(const FFloatWide& Scale) const { return FQuatWide(x * Scale, y * Scale, z * Scale, w * Scale); }
+
+    /** Rotation by Q followed by this rotation, per lane. */
+    FQuatWide operator*(const FQuatWide& Q) const
+    {
+        return FQuatWide(
+            FFloatWide::MulAdd(w, Q.x, FFloatWide::MulAdd(x, Q.w, y * Q.z - z * Q.y)),
+            FFloatWide::MulAdd(w, Q.y, FFloatWide::MulAdd(y, Q.w, z * Q.x - x * Q.z)),
+            FFloatWide::MulAdd(w, Q.z, FFloatWide::MulAdd(z, Q.w, x * Q.y - y * Q.x)),
+            w * Q.w - FFloatWide::MulAdd(x, Q.x, FFloatWide::MulAdd(y, Q.y, z * Q.z)));
+    }
+
+    /** Dot product per lane */
+    FFloatWide operator|(const FQuatWide& Q) const
+    {
+        return FFloatWide::MulAdd(x, Q.x, FFloatWide::MulAdd(y, Q.y, FFloatWide::MulAdd(z, Q.z, w * Q.w)));
+    }
+
+    FQuatWide Inverse() const { return FQuatWide(-x, -y, -z, w); }
+
+    /** Rotates V in every lane, the quaternions must be normalized. */
+    MVectorWide RotateVector(const MVectorWide& V) const
+    {
+        const MVectorWide Q(x, y, z);
+        const MVectorWide T = (Q ^ V) * FFloatWide(2.0f);
+        return V + T * w + (Q ^ T);
+    }
+
+    MVectorWide UnrotateVector(const MVectorWide& V) const
+    {
+        const MVectorWide Q(-x, -y, -z);
+        const MVectorWide T = (Q ^ V) * FFloatWide(2.0f);
+        return V + T * w + (Q ^ T);
+    }
+
+    /** Normalizes every lane, lanes too short to normalize become the identity. */
+    FQuatWide GetNormalized(float Tolerance = SMALL_NUMBER) const
+    {
+        const FFloatWide SquareSum = *this | *this;
+        const FMaskWide bValid = SquareSum >= FFloatWide(Tolerance);
+        const FQuatWide Normalized = *this * (FFloatWide(1.0f) / FFloatWide::Sqrt(SquareSum));
+        return FQuatWide(
+            FFloatWide::Select(bValid, Normalized.x, FFloatWide(0.0f)),
+            FFloatWide::Select(bValid, Normalized.y, FFloatWide(0.0f)),
+            FFloatWide::Select(bValid, Normalized.z, FFloatWide(0.0f)),
+            FFloatWide::Select(bValid, Normalized.w, FFloatWide(1.0f)));
+    }
+
+    /** FQuat::Nlerp per lane. */
+    static FQuatWide Nlerp(const FQuatWide& A, const FQuatWide& B, const FFloatWide& Alpha)
+    {
+        const FFloatWide Zero(0.0f);
+        const FFloatWide BiasedAlpha = FFloatWide::Select((A | B) >= Zero, Alpha, -Alpha);
+        return (A * (FFloatWide(1.0f) - Alpha) + B * BiasedAlpha).GetNormalized();
+    }
+};
+
+/**
+ * FFloatWide::Lanes transforms in structure of arrays layout, the kernels behind the FTransform batch
+ * functions, for callers that compose transforms with other wide math.
+ */
+struct FTransformWide
+{
+    static constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    FQuatWide Rotation;
+    MVectorWide Translation;
+    MVectorWide Scale3D;
+
+    FTransformWide()
+    {
+    }
+
+    FTransformWide(const FQuatWide& InRotation, const MVectorWide& InTranslation, const MVectorWide& InScale3D)
+        : Rotation(InRotation), Translation(InTranslation), Scale3D(InScale3D)
+    {
+    }
+
+    /** Broadcasts one transform to every lane. */
+    FTransformWide(const FTransform& Transform)
+        : Rotation(Transform.Rotation), Translation(Transform.Translation), Scale3D(Transform.Scale3D)
+    {
+    }
+
+    /** Loads lane N from Transform(N), which returns a const FTransform& and may gather from anywhere. */
+    template <typename TransformType>
+    static FTransformWide LoadLanes(TransformType Transform)
+    {
+        FTransformWide Result;
+        FFloatWide::LoadTransposed4([&](int32_t Lane) { return &Transform(Lane).Rotation.x; }, Result.Rotation.x, Result.Rotation.y, Result.Rotation.z, Result.Rotation.w);
+        FFloatWide::LoadTransposed3([&](int32_t Lane) { return &Transform(Lane).Translation.x; }, Result.Translation.x, Result.Translation.y, Result.Translation.z);
+        FFloatWide::LoadTransposed3([&](int32_t Lane) { return &Transform(Lane).Scale3D.x; }, Result.Scale3D.x, Result.Scale3D.y, Result.Scale3D.z);
+        return Result;
+    }
+
+    /** Loads up to Lanes transforms from an FTransform array, missing lanes repeat the last transform. */
+    static FTransformWide Load(const FTransform* Transforms, int32_t Num = Lanes)
+    {
+        return LoadLanes([Transforms, Num](int32_t Lane) -> const FTransform& { return Transforms[Lane < Num ? Lane : Num - 1]; });
+    }
+
+    /** Stores the first Num lanes to an FTransform array. */
+    void Store(FTransform* Transforms, int32_t Num = Lanes) const
+    {
+        if (Num < Lanes)
+        {
+            FTransform Buffer[Lanes];
+            Store(Buffer);
+            std::copy(Buffer, Buffer + Num, Transforms);
+            return;
+        }
+        StoreLanes([Transforms](int32_t Lane) -> FTransform& { return Transforms[Lane]; });
+    }
+
+    /** Stores lane N to Transform(N), which returns an FTransform& and may scatter anywhere. Lanes writing the same transform must hold the same value. */
+    template <typename TransformType>
+    void StoreLanes(TransformType Transform) const
+    {
+        // The padding lane of the vectors is written with their Z
+        FFloatWide::StoreTransposed4(Rotation.x, Rotation.y, Rotation.z, Rotation.w, [&](int32_t Lane) { return &Transform(Lane).Rotation.x; });
+        FFloatWide::StoreTransposed3(Translation.x, Translation.y, Translation.z, [&](int32_t Lane) { return &Transform(Lane).Translation.x; });
+        FFloatWide::StoreTransposed3(Scale3D.x, Scale3D.y, Scale3D.z, [&](int32_t Lane) { return &Transform(Lane).Scale3D.x; });
+    }
+
+    FTransform GetLane(int32_t Lane) const
+    {
+        return FTransform(Rotation.GetLane(Lane), Translation.GetLane(Lane), Scale3D.GetLane(Lane));
+    }
+
+    /** This transform followed by Other, per lane. */
+    FTransformWide operator*(const FTransformWide& Other) const
+    {
+        return FTransformWide(Other.Rotation * Rotation, Other.Rotation.RotateVector(Other.Scale3D * Translation) + Other.Translation, Scale3D * Other.Scale3D);
+    }
+
+    /** FTransform::Inverse per lane. */
+    FTransformWide Inverse(float Tolerance = SMALL_NUMBER) const
+    {
+        const FQuatWide InvRotation = Rotation.Inverse();
+        const MVectorWide InvScale3D = GetSafeScaleReciprocal(Scale3D, Tolerance);
+        return FTransformWide(InvRotation, InvRotation.RotateVector(-Translation) * InvScale3D, InvScale3D);
+    }
+
+    MVectorWide TransformPosition(const MVectorWide& P) const { return Rotation.RotateVector(Scale3D * P) + Translation; }
+    MVectorWide TransformVector(const MVectorWide& V) const { return Rotation.RotateVector(Scale3D * V); }
+
+    /** FTransform::Blend per lane. */
+    static FTransformWide Blend(const FTransformWide& A, const FTransformWide& B, const FFloatWide& Alpha)
+    {
+        return FTransformWide(FQuatWide::Nlerp(A.Rotation, B.Rotation, Alpha), A.Translation + (B.Translation - A.Translation) * Alpha, A.Scale3D + (B.Scale3D - A.Scale3D) * Alpha);
+    }
+
+    static MVectorWide GetSafeScaleReciprocal(const MVectorWide& Scale, float Tolerance = SMALL_NUMBER)
+    {
+        const FFloatWide WideTolerance(Tolerance);
+        const FFloatWide Zero(0.0f);
+        const FFloatWide One(1.0f);
+        return MVectorWide(
+            FFloatWide::Select(FFloatWide::Abs(Scale.x) <= WideTolerance, Zero, One / Scale.x),
+            FFloatWide::Select(FFloatWide::Abs(Scale.y) <= WideTolerance, Zero, One / Scale.y),
+            FFloatWide::Select(FFloatWide::Abs(Scale.z) <= WideTolerance, Zero, One / Scale.z));
+    }
+};
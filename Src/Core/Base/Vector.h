@@ -0,0 +1,333 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <cmath>
+
+/**
+ * Scalar 3D vector. Members are named like glm so both can be used side by side,
+ * conversions to and from glm::vec3 are implicit.
+ */
+struct MVector
+{
+    float x, y, z;
+
+    static const MVector ZeroVector;
+    static const MVector OneVector;
+    static const MVector UpVector;
+    static const MVector ForwardVector;
+    static const MVector RightVector;
+
+    constexpr MVector()
+        : x(0.0f), y(0.0f), z(0.0f)
+    {
+    }
+
+    constexpr explicit MVector(float InF)
+        : x(InF), y(InF), z(InF)
+    {
+    }
+
+    constexpr MVector(float InX, float InY, float InZ)
+        : x(InX), y(InY), z(InZ)
+    {
+    }
+
+    MVector(const glm::vec3& V)
+        : x(V.x), y(V.y), z(V.z)
+    {
+    }
+
+    operator glm::vec3() const
+    {
+        return glm::vec3(x, y, z);
+    }
+
+    MVector operator+(const MVector& V) const { return MVector(x + V.x, y + V.y, z + V.z); }
+    MVector operator-(const MVector& V) const { return MVector(x - V.x, y - V.y, z - V.z); }
+    MVector operator*(const MVector& V) const { return MVector(x * V.x, y * V.y, z * V.z); }
+    MVector operator/(const MVector& V) const { return MVector(x / V.x, y / V.y, z / V.z); }
+    MVector operator*(float Scale) const { return MVector(x * Scale, y * Scale, z * Scale); }
+    MVector operator/(float Scale) const { const float RScale = 1.0f / Scale; return MVector(x * RScale, y * RScale, z * RScale); }
+    MVector operator-() const { return MVector(-x, -y, -z); }
+
+    MVector& operator+=(const MVector& V) { x += V.x; y += V.y; z += V.z; return *this; }
+    MVector& operator-=(const MVector& V) { x -= V.x; y -= V.y; z -= V.z; return *this; }
+    MVector& operator*=(const MVector& V) { x *= V.x; y *= V.y; z *= V.z; return *this; }
+    MVector& operator*=(float Scale) { x *= Scale; y *= Scale; z *= Scale; return *this; }
+    MVector& operator/=(float Scale) { const float RScale = 1.0f / Scale; x *= RScale; y *= RScale; z *= RScale; return *this; }
+
+    bool operator==(const MVector& V) const { return x == V.x && y == V.y && z == V.z; }
+    bool operator!=(const MVector& V) const { return x != V.x || y != V.y || z != V.z; }
+
+    /** Dot product */
+    float operator|(const MVector& V) const { return x * V.x + y * V.y + z * V.z; }
+
+    /** Cross product */
+    MVector operator^(const MVector& V) const
+    {
+        return MVector(y * V.z - z * V.y, z * V.x - x * V.z, x * V.y - y * V.x);
+    }
+
+    float& operator[](int32_t Index) { return (&x)[Index]; }
+    float operator[](int32_t Index) const { return (&x)[Index]; }
+
+    static float DotProduct(const MVector& A, const MVector& B) { return A | B; }
+    static MVector CrossProduct(const MVector& A, const MVector& B) { return A ^ B; }
+    static float Dist(const MVector& A, const MVector& B) { return (B - A).Size(); }
+    static float DistSquared(const MVector& A, const MVector& B) { return (B - A).SizeSquared(); }
+
+    float Size() const { return sqrtf(x * x + y * y + z * z); }
+    float SizeSquared() const { return x * x + y * y + z * z; }
+    float Size2D() const { return sqrtf(x * x + y * y); }
+    float SizeSquared2D() const { return x * x + y * y; }
+
+    float GetMax() const { return fmaxf(fmaxf(x, y), z); }
+    float GetMin() const { return fminf(fminf(x, y), z); }
+    MVector ComponentMin(const MVector& Other) const { return MVector(x < Other.x ? x : Other.x, y < Other.y ? y : Other.y, z < Other.z ? z : Other.z); }
+    MVector ComponentMax(const MVector& Other) const { return MVector(x > Other.x ? x : Other.x, y > Other.y ? y : Other.y, z > Other.z ? z : Other.z); }
+    MVector GetAbs() const { return MVector(fabsf(x), fabsf(y), fabsf(z)); }
+
+    bool IsZero() const { return x == 0.0f && y == 0.0f && z == 0.0f; }
+
+    bool IsNearlyZero(float Tolerance = 1.e-4f) const
+    {
+        return fabsf(x) <= Tolerance && fabsf(y) <= Tolerance && fabsf(z) <= Tolerance;
+    }
+
+    bool Equals(const MVector& V, float Tolerance = 1.e-4f) const
+    {
+        return fabsf(x - V.x) <= Tolerance && fabsf(y - V.y) <= Tolerance && fabsf(z - V.z) <= Tolerance;
+    }
+
+    bool IsNormalized() const { return fabsf(1.0f - SizeSquared()) < 0.01f; }
+
+    /** Normalizes in place, leaves the vector untouched and returns false if it is too short. */
+    bool Normalize(float Tolerance = 1.e-8f)
+    {
+        const float SquareSum = SizeSquared();
+        if (SquareSum > Tolerance)
+        {
+            *this *= 1.0f / sqrtf(SquareSum);
+            return true;
+        }
+        return false;
+    }
+
+    /** Returns a normalized copy, or the zero vector if the vector is too short to normalize. */
+    MVector GetSafeNormal(float Tolerance = 1.e-8f) const
+    {
+        const float SquareSum = SizeSquared();
+        if (SquareSum == 1.0f)
+        {
+            return *this;
+        }
+        if (SquareSum < Tolerance)
+        {
+            return ZeroVector;
+        }
+        return *this * (1.0f / sqrtf(SquareSum));
+    }
+
+    /** Gets a copy of this vector projected onto the input vector, which is assumed to be unit length. */
+    MVector ProjectOnToNormal(const MVector& Normal) const
+    {
+        return Normal * (*this | Normal);
+    }
+
+    /** Finds two axis that are orthogonal to this unit vector. */
+    void FindBestAxisVectors(MVector& Axis1, MVector& Axis2) const
+    {
+        const float NX = fabsf(x);
+        const float NY = fabsf(y);
+        const float NZ = fabsf(z);
+
+        if (NZ > NX && NZ > NY)
+        {
+            Axis1 = MVector(1.0f, 0.0f, 0.0f);
+        }
+        else
+        {
+            Axis1 = MVector(0.0f, 0.0f, 1.0f);
+        }
+
+        Axis1 = (Axis1 - *this * (Axis1 | *this)).GetSafeNormal();
+        Axis2 = Axis1 ^ *this;
+    }
+
+    std::string ToString() const
+    {
+        return "X=" + std::to_string(x) + " Y=" + std::to_string(y) + " Z=" + std::to_string(z);
+    }
+};
+
+inline MVector operator*(float Scale, const MVector& V)
+{
+    return V * Scale;
+}
+
+inline const MVector MVector::ZeroVector(0.0f, 0.0f, 0.0f);
+inline const MVector MVector::OneVector(1.0f, 1.0f, 1.0f);
+inline const MVector MVector::UpVector(0.0f, 0.0f, 1.0f);
+inline const MVector MVector::ForwardVector(1.0f, 0.0f, 0.0f);
+inline const MVector MVector::RightVector(0.0f, 1.0f, 0.0f);
+
+/** Scalar 2D vector, converts to and from glm::vec2. */
+struct MVector2D
+{
+    float x, y;
+
+    static const MVector2D ZeroVector;
+    static const MVector2D UnitVector;
+
+    constexpr MVector2D()
+        : x(0.0f), y(0.0f)
+    {
+    }
+
+    constexpr explicit MVector2D(float InF)
+        : x(InF), y(InF)
+    {
+    }
+
+    constexpr MVector2D(float InX, float InY)
+        : x(InX), y(InY)
+    {
+    }
+
+    MVector2D(const glm::vec2& V)
+        : x(V.x), y(V.y)
+    {
+    }
+
+    operator glm::vec2() const
+    {
+        return glm::vec2(x, y);
+    }
+
+    MVector2D operator+(const MVector2D& V) const { return MVector2D(x + V.x, y + V.y); }
+    MVector2D operator-(const MVector2D& V) const { return MVector2D(x - V.x, y - V.y); }
+    MVector2D operator*(const MVector2D& V) const { return MVector2D(x * V.x, y * V.y); }
+    MVector2D operator/(const MVector2D& V) const { return MVector2D(x / V.x, y / V.y); }
+    MVector2D operator*(float Scale) const { return MVector2D(x * Scale, y * Scale); }
+    MVector2D operator/(float Scale) const { const float RScale = 1.0f / Scale; return MVector2D(x * RScale, y * RScale); }
+    MVector2D operator-() const { return MVector2D(-x, -y); }
+
+    MVector2D& operator+=(const MVector2D& V) { x += V.x; y += V.y; return *this; }
+    MVector2D& operator-=(const MVector2D& V) { x -= V.x; y -= V.y; return *this; }
+    MVector2D& operator*=(float Scale) { x *= Scale; y *= Scale; return *this; }
+
+    bool operator==(const MVector2D& V) const { return x == V.x && y == V.y; }
+    bool operator!=(const MVector2D& V) const { return x != V.x || y != V.y; }
+
+    /** Dot product */
+    float operator|(const MVector2D& V) const { return x * V.x + y * V.y; }
+
+    /** Z component of the cross product */
+    float operator^(const MVector2D& V) const { return x * V.y - y * V.x; }
+
+    float& operator[](int32_t Index) { return (&x)[Index]; }
+    float operator[](int32_t Index) const { return (&x)[Index]; }
+
+    static float DotProduct(const MVector2D& A, const MVector2D& B) { return A | B; }
+    static float CrossProduct(const MVector2D& A, const MVector2D& B) { return A ^ B; }
+    static float Distance(const MVector2D& A, const MVector2D& B) { return (B - A).Size(); }
+    static float DistSquared(const MVector2D& A, const MVector2D& B) { return (B - A).SizeSquared(); }
+
+    float Size() const { return sqrtf(x * x + y * y); }
+    float SizeSquared() const { return x * x + y * y; }
+
+    bool IsNearlyZero(float Tolerance = 1.e-4f) const
+    {
+        return fabsf(x) <= Tolerance && fabsf(y) <= Tolerance;
+    }
+
+    bool Equals(const MVector2D& V, float Tolerance = 1.e-4f) const
+    {
+        return fabsf(x - V.x) <= Tolerance && fabsf(y - V.y) <= Tolerance;
+    }
+
+    MVector2D GetSafeNormal(float Tolerance = 1.e-8f) const
+    {
+        const float SquareSum = SizeSquared();
+        if (SquareSum > Tolerance)
+        {
+            return *this * (1.0f / sqrtf(SquareSum));
+        }
+        return ZeroVector;
+    }
+
+    std::string ToString() const
+    {
+        return "X=" + std::to_string(x) + " Y=" + std::to_string(y);
+    }
+};
+
+inline MVector2D operator*(float Scale, const MVector2D& V)
+{
+    return V * Scale;
+}
+
+inline const MVector2D MVector2D::ZeroVector(0.0f, 0.0f);
+inline const MVector2D MVector2D::UnitVector(1.0f, 1.0f);
+
+/** Scalar 4D vector, converts to and from glm::vec4. Operators work on all four components. */
+struct alignas(16) MVector4
+{
+    float x, y, z, w;
+
+    constexpr MVector4()
+        : x(0.0f), y(0.0f), z(0.0f), w(0.0f)
+    {
+    }
+
+    constexpr MVector4(float InX, float InY, float InZ, float InW)
+        : x(InX), y(InY), z(InZ), w(InW)
+    {
+    }
+
+    constexpr MVector4(const MVector& V, float InW = 1.0f)
+        : x(V.x), y(V.y), z(V.z), w(InW)
+    {
+    }
+
+    MVector4(const glm::vec4& V)
+        : x(V.x), y(V.y), z(V.z), w(V.w)
+    {
+    }
+
+    operator glm::vec4() const
+    {
+        return glm::vec4(x, y, z, w);
+    }
+
+    MVector4 operator+(const MVector4& V) const { return MVector4(x + V.x, y + V.y, z + V.z, w + V.w); }
+    MVector4 operator-(const MVector4& V) const { return MVector4(x - V.x, y - V.y, z - V.z, w - V.w); }
+    MVector4 operator*(const MVector4& V) const { return MVector4(x * V.x, y * V.y, z * V.z, w * V.w); }
+    MVector4 operator*(float Scale) const { return MVector4(x * Scale, y * Scale, z * Scale, w * Scale); }
+    MVector4 operator-() const { return MVector4(-x, -y, -z, -w); }
+
+    bool operator==(const MVector4& V) const { return x == V.x && y == V.y && z == V.z && w == V.w; }
+    bool operator!=(const MVector4& V) const { return !(*this == V); }
+
+    float& operator[](int32_t Index) { return (&x)[Index]; }
+    float operator[](int32_t Index) const { return (&x)[Index]; }
+
+    /** Dot product of the xyz components */
+    float Dot3(const MVector4& V) const { return x * V.x + y * V.y + z * V.z; }
+
+    /** Dot product of all four components */
+    float Dot4(const MVector4& V) const { return x * V.x + y * V.y + z * V.z + w * V.w; }
+
+    MVector GetVector() const { return MVector(x, y, z); }
+
+    bool Equals(const MVector4& V, float Tolerance = 1.e-4f) const
+    {
+        return fabsf(x - V.x) <= Tolerance && fabsf(y - V.y) <= Tolerance && fabsf(z - V.z) <= Tolerance && fabsf(w - V.w) <= Tolerance;
+    }
+
+    std::string ToString() const
+    {
+        return "X=" + std::to_string(x) + " Y=" + std::to_string(y) + " Z=" + std::to_string(z) + " W=" + std::to_string(w);
+    }
+};
@@ -0,0 +1,1100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Vector.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX__)
+#define MIKASA_SIMD_AVX 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIKASA_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#define MIKASA_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define MIKASA_SIMD_SCALAR 1
+#endif
+
+#if MIKASA_SIMD_AVX
+#define MIKASA_SIMD_WIDTH 8
+#else
+#define MIKASA_SIMD_WIDTH 4
+#endif
+
+#if MIKASA_SIMD_AVX && !defined(__AVX2__)
+// AVX has no 256 bit integer arithmetic, run the SSE2 instruction on both halves
+#define MIKASA_AVX_INT_SPLIT(Intrinsic, A, B) \
+    _mm256_insertf128_si256(_mm256_castsi128_si256(Intrinsic(_mm256_castsi256_si128(A), _mm256_castsi256_si128(B))), \
+        Intrinsic(_mm256_extractf128_si256(A, 1), _mm256_extractf128_si256(B, 1)), 1)
+#endif
+
+// MulAdd is a single fused instruction. MSVC has no FMA macro, /arch:AVX2 implies it.
+#if (MIKASA_SIMD_AVX && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))) || MIKASA_SIMD_NEON
+#define MIKASA_SIMD_FMA 1
+#endif
+
+// The wide types differ with the instruction set a file is compiled for. Every variant lives in its own
+// inline namespace so that files built for a higher tier (SimdKernelsAVX2.cpp) define distinct symbols
+// instead of clashing with the baseline ones. Those files name their namespace before any include.
+#ifndef MIKASA_SIMD_NAMESPACE
+#if MIKASA_SIMD_AVX
+#define MIKASA_SIMD_NAMESPACE SimdAVX
+#elif MIKASA_SIMD_SSE2
+#define MIKASA_SIMD_NAMESPACE SimdSSE2
+#elif MIKASA_SIMD_NEON
+#define MIKASA_SIMD_NAMESPACE SimdNEON
+#else
+#define MIKASA_SIMD_NAMESPACE SimdScalar
+#endif
+#endif
+
+inline namespace MIKASA_SIMD_NAMESPACE
+{
+
+/** Per lane boolean produced by comparing wide floats. Lanes are either all ones or all zeros. */
+struct FMaskWide
+{
+#if MIKASA_SIMD_AVX
+    __m256 Value;
+#elif MIKASA_SIMD_SSE2
+    __m128 Value;
+#elif MIKASA_SIMD_NEON
+    uint32x4_t Value;
+#else
+    uint32_t Value[4];
+#endif
+
+    FMaskWide operator&(const FMaskWide& M) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_and_ps(Value, M.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_and_ps(Value, M.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vandq_u32(Value, M.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] & M.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FMaskWide operator|(const FMaskWide& M) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_or_ps(Value, M.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_or_ps(Value, M.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vorrq_u32(Value, M.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] | M.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    /** One bit per lane, lane 0 in the lowest bit. */
+    uint32_t GetBits() const
+    {
+#if MIKASA_SIMD_AVX
+        return (uint32_t)_mm256_movemask_ps(Value);
+#elif MIKASA_SIMD_SSE2
+        return (uint32_t)_mm_movemask_ps(Value);
+#elif MIKASA_SIMD_NEON
+        const int32x4_t Shift = { 0, 1, 2, 3 };
+        return vaddvq_u32(vshlq_u32(vshrq_n_u32(Value, 31), Shift));
+#else
+        return (Value[0] & 1) | ((Value[1] & 1) << 1) | ((Value[2] & 1) << 2) | ((Value[3] & 1) << 3);
+#endif
+    }
+
+    bool AnyTrue() const { return GetBits() != 0; }
+    bool AllTrue() const { return GetBits() == (1u << MIKASA_SIMD_WIDTH) - 1; }
+};
+
+struct FFloatWide;
+
+/** A packet of 32 bit integers with the same lane count as FFloatWide, used for bit manipulation of floats. */
+struct FIntWide
+{
+#if MIKASA_SIMD_AVX
+    __m256i Value;
+#elif MIKASA_SIMD_SSE2
+    __m128i Value;
+#elif MIKASA_SIMD_NEON
+    int32x4_t Value;
+#else
+    int32_t Value[4];
+#endif
+
+    FIntWide()
+    {
+        *this = FIntWide(0);
+    }
+
+    /** Broadcasts one value to every lane. */
+    FIntWide(int32_t I)
+    {
+#if MIKASA_SIMD_AVX
+        Value = _mm256_set1_epi32(I);
+#elif MIKASA_SIMD_SSE2
+        Value = _mm_set1_epi32(I);
+#elif MIKASA_SIMD_NEON
+        Value = vdupq_n_s32(I);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Value[Lane] = I; }
+#endif
+    }
+
+    static FIntWide Load(const int32_t* Src)
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_loadu_si256((const __m256i*)Src);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_loadu_si128((const __m128i*)Src);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vld1q_s32(Src);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Src[Lane]; }
+#endif
+        return Result;
+    }
+
+    void Store(int32_t* Dst) const
+    {
+#if MIKASA_SIMD_AVX
+        _mm256_storeu_si256((__m256i*)Dst, Value);
+#elif MIKASA_SIMD_SSE2
+        _mm_storeu_si128((__m128i*)Dst, Value);
+#elif MIKASA_SIMD_NEON
+        vst1q_s32(Dst, Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Dst[Lane] = Value[Lane]; }
+#endif
+    }
+
+    int32_t GetLane(int32_t Lane) const
+    {
+        alignas(32) int32_t Buffer[MIKASA_SIMD_WIDTH];
+        Store(Buffer);
+        return Buffer[Lane];
+    }
+
+    /** Loads Base[Indices[Lane]] into every lane, a hardware gather on AVX2. */
+    static FIntWide Gather(const int32_t* Base, const FIntWide& Indices)
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_i32gather_epi32(Base, Indices.Value, 4);
+#else
+        alignas(32) int32_t Buffer[MIKASA_SIMD_WIDTH];
+        Indices.Store(Buffer);
+        for (int32_t Lane = 0; Lane < MIKASA_SIMD_WIDTH; ++Lane)
+        {
+            Buffer[Lane] = Base[Buffer[Lane]];
+        }
+        Result = Load(Buffer);
+#endif
+        return Result;
+    }
+
+    FIntWide operator+(const FIntWide& I) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_add_epi32(Value, I.Value);
+#elif MIKASA_SIMD_AVX
+        Result.Value = MIKASA_AVX_INT_SPLIT(_mm_add_epi32, Value, I.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_add_epi32(Value, I.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vaddq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (int32_t)((uint32_t)Value[Lane] + (uint32_t)I.Value[Lane]); }
+#endif
+        return Result;
+    }
+
+    FIntWide operator-(const FIntWide& I) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_sub_epi32(Value, I.Value);
+#elif MIKASA_SIMD_AVX
+        Result.Value = MIKASA_AVX_INT_SPLIT(_mm_sub_epi32, Value, I.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_sub_epi32(Value, I.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vsubq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (int32_t)((uint32_t)Value[Lane] - (uint32_t)I.Value[Lane]); }
+#endif
+        return Result;
+    }
+
+    FIntWide operator&(const FIntWide& I) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(Value), _mm256_castsi256_ps(I.Value)));
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_and_si128(Value, I.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vandq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] & I.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FIntWide operator|(const FIntWide& I) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(Value), _mm256_castsi256_ps(I.Value)));
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_or_si128(Value, I.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vorrq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] | I.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FIntWide operator^(const FIntWide& I) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(Value), _mm256_castsi256_ps(I.Value)));
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_xor_si128(Value, I.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = veorq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] ^ I.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FIntWide ShiftLeft(int32_t Count) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_sll_epi32(Value, _mm_cvtsi32_si128(Count));
+#elif MIKASA_SIMD_AVX
+        const __m128i Shift = _mm_cvtsi32_si128(Count);
+        Result.Value = _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_sll_epi32(_mm256_castsi256_si128(Value), Shift)), _mm_sll_epi32(_mm256_extractf128_si256(Value, 1), Shift), 1);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_sll_epi32(Value, _mm_cvtsi32_si128(Count));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vshlq_s32(Value, vdupq_n_s32(Count));
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (int32_t)((uint32_t)Value[Lane] << Count); }
+#endif
+        return Result;
+    }
+
+    FIntWide ShiftRightLogical(int32_t Count) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_srl_epi32(Value, _mm_cvtsi32_si128(Count));
+#elif MIKASA_SIMD_AVX
+        const __m128i Shift = _mm_cvtsi32_si128(Count);
+        Result.Value = _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_srl_epi32(_mm256_castsi256_si128(Value), Shift)), _mm_srl_epi32(_mm256_extractf128_si256(Value, 1), Shift), 1);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_srl_epi32(Value, _mm_cvtsi32_si128(Count));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(Value), vdupq_n_s32(-Count)));
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (int32_t)((uint32_t)Value[Lane] >> Count); }
+#endif
+        return Result;
+    }
+
+    FIntWide ShiftRightArithmetic(int32_t Count) const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_sra_epi32(Value, _mm_cvtsi32_si128(Count));
+#elif MIKASA_SIMD_AVX
+        const __m128i Shift = _mm_cvtsi32_si128(Count);
+        Result.Value = _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_sra_epi32(_mm256_castsi256_si128(Value), Shift)), _mm_sra_epi32(_mm256_extractf128_si256(Value, 1), Shift), 1);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_sra_epi32(Value, _mm_cvtsi32_si128(Count));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vshlq_s32(Value, vdupq_n_s32(-Count));
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] >> Count; }
+#endif
+        return Result;
+    }
+
+    FMaskWide operator==(const FIntWide& I) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_castsi256_ps(_mm256_cmpeq_epi32(Value, I.Value));
+#elif MIKASA_SIMD_AVX
+        Result.Value = _mm256_castsi256_ps(MIKASA_AVX_INT_SPLIT(_mm_cmpeq_epi32, Value, I.Value));
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_castsi128_ps(_mm_cmpeq_epi32(Value, I.Value));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vceqq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] == I.Value[Lane] ? ~0u : 0u; }
+#endif
+        return Result;
+    }
+
+    FMaskWide operator>(const FIntWide& I) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX && defined(__AVX2__)
+        Result.Value = _mm256_castsi256_ps(_mm256_cmpgt_epi32(Value, I.Value));
+#elif MIKASA_SIMD_AVX
+        Result.Value = _mm256_castsi256_ps(MIKASA_AVX_INT_SPLIT(_mm_cmpgt_epi32, Value, I.Value));
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_castsi128_ps(_mm_cmpgt_epi32(Value, I.Value));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vcgtq_s32(Value, I.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] > I.Value[Lane] ? ~0u : 0u; }
+#endif
+        return Result;
+    }
+
+    FMaskWide operator<(const FIntWide& I) const { return I > *this; }
+
+    /** Converts every lane to float. */
+    FFloatWide ToFloat() const;
+
+    /** Reinterprets the bits of every lane as float. */
+    FFloatWide AsFloat() const;
+
+    /** Picks A where Mask is set and B elsewhere. */
+    static FIntWide Select(const FMaskWide& Mask, const FIntWide& A, const FIntWide& B)
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(B.Value), _mm256_castsi256_ps(A.Value), Mask.Value));
+#elif MIKASA_SIMD_SSE2
+        const __m128i IntMask = _mm_castps_si128(Mask.Value);
+        Result.Value = _mm_or_si128(_mm_and_si128(IntMask, A.Value), _mm_andnot_si128(IntMask, B.Value));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vbslq_s32(Mask.Value, A.Value, B.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Mask.Value[Lane] ? A.Value[Lane] : B.Value[Lane]; }
+#endif
+        return Result;
+    }
+};
+
+/**
+ * A packet of floats processed together, 8 lanes with AVX and 4 lanes with SSE2, NEON
+ * or the scalar fallback. Code written against Lanes runs unchanged on every target.
+ */
+struct FFloatWide
+{
+#if MIKASA_SIMD_AVX
+    static constexpr int32_t Lanes = MIKASA_SIMD_WIDTH;
+    __m256 Value;
+#elif MIKASA_SIMD_SSE2
+    static constexpr int32_t Lanes = MIKASA_SIMD_WIDTH;
+    __m128 Value;
+#elif MIKASA_SIMD_NEON
+    static constexpr int32_t Lanes = MIKASA_SIMD_WIDTH;
+    float32x4_t Value;
+#else
+    static constexpr int32_t Lanes = MIKASA_SIMD_WIDTH;
+    float Value[4];
+#endif
+
+    static constexpr uint32_t AllLanesMask = (1u << Lanes) - 1;
+
+    FFloatWide()
+    {
+        *this = FFloatWide(0.0f);
+    }
+
+    /** Broadcasts one value to every lane. */
+    FFloatWide(float F)
+    {
+#if MIKASA_SIMD_AVX
+        Value = _mm256_set1_ps(F);
+#elif MIKASA_SIMD_SSE2
+        Value = _mm_set1_ps(F);
+#elif MIKASA_SIMD_NEON
+        Value = vdupq_n_f32(F);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Value[Lane] = F; }
+#endif
+    }
+
+    /** Loads Lanes floats, no alignment required. */
+    static FFloatWide Load(const float* Src)
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_loadu_ps(Src);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_loadu_ps(Src);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vld1q_f32(Src);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Src[Lane]; }
+#endif
+        return Result;
+    }
+
+    /** Loads the first Num floats, the remaining lanes are set to Fill. */
+    static FFloatWide LoadPartial(const float* Src, int32_t Num, float Fill = 0.0f)
+    {
+        alignas(32) float Buffer[Lanes];
+        for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+        {
+            Buffer[Lane] = Lane < Num ? Src[Lane] : Fill;
+        }
+        return Load(Buffer);
+    }
+
+    /** Stores Lanes floats, no alignment required. */
+    void Store(float* Dst) const
+    {
+#if MIKASA_SIMD_AVX
+        _mm256_storeu_ps(Dst, Value);
+#elif MIKASA_SIMD_SSE2
+        _mm_storeu_ps(Dst, Value);
+#elif MIKASA_SIMD_NEON
+        vst1q_f32(Dst, Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Dst[Lane] = Value[Lane]; }
+#endif
+    }
+
+    /** Stores the first Num lanes. */
+    void StorePartial(float* Dst, int32_t Num) const
+    {
+        alignas(32) float Buffer[Lanes];
+        Store(Buffer);
+        for (int32_t Lane = 0; Lane < Num; ++Lane)
+        {
+            Dst[Lane] = Buffer[Lane];
+        }
+    }
+
+    float GetLane(int32_t Lane) const
+    {
+        alignas(32) float Buffer[Lanes];
+        Store(Buffer);
+        return Buffer[Lane];
+    }
+
+    FFloatWide operator+(const FFloatWide& V) const
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_add_ps(Value, V.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_add_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vaddq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] + V.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FFloatWide operator-(const FFloatWide& V) const
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_sub_ps(Value, V.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_sub_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vsubq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] - V.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FFloatWide operator*(const FFloatWide& V) const
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_mul_ps(Value, V.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_mul_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vmulq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] * V.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FFloatWide operator/(const FFloatWide& V) const
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_div_ps(Value, V.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_div_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vdivq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] / V.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    FFloatWide operator-() const
+    {
+        return FFloatWide(0.0f) - *this;
+    }
+
+    FFloatWide& operator+=(const FFloatWide& V) { return *this = *this + V; }
+    FFloatWide& operator-=(const FFloatWide& V) { return *this = *this - V; }
+    FFloatWide& operator*=(const FFloatWide& V) { return *this = *this * V; }
+
+    FMaskWide operator<(const FFloatWide& V) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_cmp_ps(Value, V.Value, _CMP_LT_OQ);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_cmplt_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vcltq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] < V.Value[Lane] ? ~0u : 0u; }
+#endif
+        return Result;
+    }
+
+    FMaskWide operator<=(const FFloatWide& V) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_cmp_ps(Value, V.Value, _CMP_LE_OQ);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_cmple_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vcleq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] <= V.Value[Lane] ? ~0u : 0u; }
+#endif
+        return Result;
+    }
+
+    FMaskWide operator>(const FFloatWide& V) const { return V < *this; }
+    FMaskWide operator>=(const FFloatWide& V) const { return V <= *this; }
+
+    FMaskWide operator==(const FFloatWide& V) const
+    {
+        FMaskWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_cmp_ps(Value, V.Value, _CMP_EQ_OQ);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_cmpeq_ps(Value, V.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vceqq_f32(Value, V.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Value[Lane] == V.Value[Lane] ? ~0u : 0u; }
+#endif
+        return Result;
+    }
+
+    /** Reinterprets the bits of every lane as integer. */
+    FIntWide AsInt() const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_castps_si256(Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_castps_si128(Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vreinterpretq_s32_f32(Value);
+#else
+        memcpy(Result.Value, Value, sizeof(Value));
+#endif
+        return Result;
+    }
+
+    /** Converts every lane to integer, rounding towards zero. */
+    FIntWide TruncToInt() const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_cvttps_epi32(Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_cvttps_epi32(Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vcvtq_s32_f32(Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (int32_t)Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    /** Converts every lane to integer, rounding to nearest even. */
+    FIntWide RoundToInt() const
+    {
+        FIntWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_cvtps_epi32(Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_cvtps_epi32(Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vcvtnq_s32_f32(Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (int32_t)nearbyintf(Value[Lane]); }
+#endif
+        return Result;
+    }
+
+    /** Rounds every lane to the nearest integral value, only valid for magnitudes below 2^31. */
+    FFloatWide Round() const;
+
+    /** Largest integral value not greater than each lane, only valid for magnitudes below 2^31. */
+    FFloatWide Floor() const;
+
+    /** Approximate 1 / sqrt, about 12 bits on x86 and 8 bits on NEON. */
+    static FFloatWide InvSqrtEst(const FFloatWide& A)
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_rsqrt_ps(A.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_rsqrt_ps(A.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vrsqrteq_f32(A.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = 1.0f / sqrtf(A.Value[Lane]); }
+#endif
+        return Result;
+    }
+
+    static FFloatWide Min(const FFloatWide& A, const FFloatWide& B)
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_min_ps(A.Value, B.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_min_ps(A.Value, B.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vminq_f32(A.Value, B.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = A.Value[Lane] < B.Value[Lane] ? A.Value[Lane] : B.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    static FFloatWide Max(const FFloatWide& A, const FFloatWide& B)
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_max_ps(A.Value, B.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_max_ps(A.Value, B.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vmaxq_f32(A.Value, B.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = A.Value[Lane] > B.Value[Lane] ? A.Value[Lane] : B.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    static FFloatWide Clamp(const FFloatWide& X, const FFloatWide& InMin, const FFloatWide& InMax)
+    {
+        return Min(Max(X, InMin), InMax);
+    }
+
+    static FFloatWide Sqrt(const FFloatWide& A)
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_sqrt_ps(A.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_sqrt_ps(A.Value);
+#elif MIKASA_SIMD_NEON
+        Result.Value = vsqrtq_f32(A.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = sqrtf(A.Value[Lane]); }
+#endif
+        return Result;
+    }
+
+    static FFloatWide Abs(const FFloatWide& A)
+    {
+        return Max(A, -A);
+    }
+
+    /** Returns A * B + C. */
+    static FFloatWide MulAdd(const FFloatWide& A, const FFloatWide& B, const FFloatWide& C)
+    {
+#if MIKASA_SIMD_AVX && MIKASA_SIMD_FMA
+        FFloatWide Result;
+        Result.Value = _mm256_fmadd_ps(A.Value, B.Value, C.Value);
+        return Result;
+#elif MIKASA_SIMD_NEON
+        FFloatWide Result;
+        Result.Value = vfmaq_f32(C.Value, A.Value, B.Value);
+        return Result;
+#else
+        return A * B + C;
+#endif
+    }
+
+    /** Picks A where Mask is set and B elsewhere. */
+    static FFloatWide Select(const FMaskWide& Mask, const FFloatWide& A, const FFloatWide& B)
+    {
+        FFloatWide Result;
+#if MIKASA_SIMD_AVX
+        Result.Value = _mm256_blendv_ps(B.Value, A.Value, Mask.Value);
+#elif MIKASA_SIMD_SSE2
+        Result.Value = _mm_or_ps(_mm_and_ps(Mask.Value, A.Value), _mm_andnot_ps(Mask.Value, B.Value));
+#elif MIKASA_SIMD_NEON
+        Result.Value = vbslq_f32(Mask.Value, A.Value, B.Value);
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = Mask.Value[Lane] ? A.Value[Lane] : B.Value[Lane]; }
+#endif
+        return Result;
+    }
+
+    /**
+     * Loads four floats from Row(Lane) for every lane and transposes them, Out0 gets the first float of
+     * every row. Moves arrays of four float structures (quaternions, padded vectors, matrix rows) to
+     * structure of arrays layout, Row(int32_t) returns the address of a row and may be any pattern.
+     */
+    template <typename RowType>
+    static void LoadTransposed4(RowType Row, FFloatWide& Out0, FFloatWide& Out1, FFloatWide& Out2, FFloatWide& Out3)
+    {
+#if MIKASA_SIMD_AVX
+        // Rows N and N + 4 share a register, the 4x4 transpose then runs in both 128 bit halves at once
+        const __m256 Row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(0))), _mm_loadu_ps(Row(4)), 1);
+        const __m256 Row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(1))), _mm_loadu_ps(Row(5)), 1);
+        const __m256 Row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(2))), _mm_loadu_ps(Row(6)), 1);
+        const __m256 Row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(3))), _mm_loadu_ps(Row(7)), 1);
+        const __m256 Low01 = _mm256_unpacklo_ps(Row0, Row1);
+        const __m256 Low23 = _mm256_unpacklo_ps(Row2, Row3);
+        const __m256 High01 = _mm256_unpackhi_ps(Row0, Row1);
+        const __m256 High23 = _mm256_unpackhi_ps(Row2, Row3);
+        Out0.Value = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(1, 0, 1, 0));
+        Out1.Value = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(3, 2, 3, 2));
+        Out2.Value = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(1, 0, 1, 0));
+        Out3.Value = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(3, 2, 3, 2));
+#elif MIKASA_SIMD_SSE2
+        __m128 Row0 = _mm_loadu_ps(Row(0));
+        __m128 Row1 = _mm_loadu_ps(Row(1));
+        __m128 Row2 = _mm_loadu_ps(Row(2));
+        __m128 Row3 = _mm_loadu_ps(Row(3));
+        _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+        Out0.Value = Row0;
+        Out1.Value = Row1;
+        Out2.Value = Row2;
+        Out3.Value = Row3;
+#elif MIKASA_SIMD_NEON
+        const float32x4x2_t Rows01 = vtrnq_f32(vld1q_f32(Row(0)), vld1q_f32(Row(1)));
+        const float32x4x2_t Rows23 = vtrnq_f32(vld1q_f32(Row(2)), vld1q_f32(Row(3)));
+        Out0.Value = vcombine_f32(vget_low_f32(Rows01.val[0]), vget_low_f32(Rows23.val[0]));
+        Out1.Value = vcombine_f32(vget_low_f32(Rows01.val[1]), vget_low_f32(Rows23.val[1]));
+        Out2.Value = vcombine_f32(vget_high_f32(Rows01.val[0]), vget_high_f32(Rows23.val[0]));
+        Out3.Value = vcombine_f32(vget_high_f32(Rows01.val[1]), vget_high_f32(Rows23.val[1]));
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane)
+        {
+            const float* Values = Row(Lane);
+            Out0.Value[Lane] = Values[0];
+            Out1.Value[Lane] = Values[1];
+            Out2.Value[Lane] = Values[2];
+            Out3.Value[Lane] = Values[3];
+        }
+#endif
+    }
+
+    /** LoadTransposed4 of rows whose fourth float is padding, one shuffle less. */
+    template <typename RowType>
+    static void LoadTransposed3(RowType Row, FFloatWide& Out0, FFloatWide& Out1, FFloatWide& Out2)
+    {
+#if MIKASA_SIMD_AVX
+        const __m256 Row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(0))), _mm_loadu_ps(Row(4)), 1);
+        const __m256 Row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(1))), _mm_loadu_ps(Row(5)), 1);
+        const __m256 Row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(2))), _mm_loadu_ps(Row(6)), 1);
+        const __m256 Row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Row(3))), _mm_loadu_ps(Row(7)), 1);
+        const __m256 Low01 = _mm256_unpacklo_ps(Row0, Row1);
+        const __m256 Low23 = _mm256_unpacklo_ps(Row2, Row3);
+        const __m256 High01 = _mm256_unpackhi_ps(Row0, Row1);
+        const __m256 High23 = _mm256_unpackhi_ps(Row2, Row3);
+        Out0.Value = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(1, 0, 1, 0));
+        Out1.Value = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(3, 2, 3, 2));
+        Out2.Value = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(1, 0, 1, 0));
+#elif MIKASA_SIMD_SSE2
+        const __m128 Row0 = _mm_loadu_ps(Row(0));
+        const __m128 Row1 = _mm_loadu_ps(Row(1));
+        const __m128 Row2 = _mm_loadu_ps(Row(2));
+        const __m128 Row3 = _mm_loadu_ps(Row(3));
+        const __m128 Low01 = _mm_unpacklo_ps(Row0, Row1);
+        const __m128 Low23 = _mm_unpacklo_ps(Row2, Row3);
+        const __m128 High01 = _mm_unpackhi_ps(Row0, Row1);
+        const __m128 High23 = _mm_unpackhi_ps(Row2, Row3);
+        Out0.Value = _mm_movelh_ps(Low01, Low23);
+        Out1.Value = _mm_movehl_ps(Low23, Low01);
+        Out2.Value = _mm_movelh_ps(High01, High23);
+#else
+        FFloatWide Padding;
+        LoadTransposed4(Row, Out0, Out1, Out2, Padding);
+#endif
+    }
+
+    /** Inverse of LoadTransposed4, writes four floats to Row(Lane) for every lane. */
+    template <typename RowType>
+    static void StoreTransposed4(const FFloatWide& In0, const FFloatWide& In1, const FFloatWide& In2, const FFloatWide& In3, RowType Row)
+    {
+#if MIKASA_SIMD_AVX
+        const __m256 Low01 = _mm256_unpacklo_ps(In0.Value, In1.Value);
+        const __m256 Low23 = _mm256_unpacklo_ps(In2.Value, In3.Value);
+        const __m256 High01 = _mm256_unpackhi_ps(In0.Value, In1.Value);
+        const __m256 High23 = _mm256_unpackhi_ps(In2.Value, In3.Value);
+        const __m256 Row0 = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 Row1 = _mm256_shuffle_ps(Low01, Low23, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 Row2 = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 Row3 = _mm256_shuffle_ps(High01, High23, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm_storeu_ps(Row(0), _mm256_castps256_ps128(Row0));
+        _mm_storeu_ps(Row(1), _mm256_castps256_ps128(Row1));
+        _mm_storeu_ps(Row(2), _mm256_castps256_ps128(Row2));
+        _mm_storeu_ps(Row(3), _mm256_castps256_ps128(Row3));
+        _mm_storeu_ps(Row(4), _mm256_extractf128_ps(Row0, 1));
+        _mm_storeu_ps(Row(5), _mm256_extractf128_ps(Row1, 1));
+        _mm_storeu_ps(Row(6), _mm256_extractf128_ps(Row2, 1));
+        _mm_storeu_ps(Row(7), _mm256_extractf128_ps(Row3, 1));
+#elif MIKASA_SIMD_SSE2
+        __m128 Row0 = In0.Value;
+        __m128 Row1 = In1.Value;
+        __m128 Row2 = In2.Value;
+        __m128 Row3 = In3.Value;
+        _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+        _mm_storeu_ps(Row(0), Row0);
+        _mm_storeu_ps(Row(1), Row1);
+        _mm_storeu_ps(Row(2), Row2);
+        _mm_storeu_ps(Row(3), Row3);
+#elif MIKASA_SIMD_NEON
+        const float32x4x2_t Columns01 = vtrnq_f32(In0.Value, In1.Value);
+        const float32x4x2_t Columns23 = vtrnq_f32(In2.Value, In3.Value);
+        vst1q_f32(Row(0), vcombine_f32(vget_low_f32(Columns01.val[0]), vget_low_f32(Columns23.val[0])));
+        vst1q_f32(Row(1), vcombine_f32(vget_low_f32(Columns01.val[1]), vget_low_f32(Columns23.val[1])));
+        vst1q_f32(Row(2), vcombine_f32(vget_high_f32(Columns01.val[0]), vget_high_f32(Columns23.val[0])));
+        vst1q_f32(Row(3), vcombine_f32(vget_high_f32(Columns01.val[1]), vget_high_f32(Columns23.val[1])));
+#else
+        for (int32_t Lane = 0; Lane < 4; ++Lane)
+        {
+            float* Values = Row(Lane);
+            Values[0] = In0.Value[Lane];
+            Values[1] = In1.Value[Lane];
+            Values[2] = In2.Value[Lane];
+            Values[3] = In3.Value[Lane];
+        }
+#endif
+    }
+    /** StoreTransposed4 of rows whose fourth float is padding, which is written with In2. */
+    template <typename RowType>
+    static void StoreTransposed3(const FFloatWide& In0, const FFloatWide& In1, const FFloatWide& In2, RowType Row)
+    {
+#if MIKASA_SIMD_AVX
+        const __m256 Low01 = _mm256_unpacklo_ps(In0.Value, In1.Value);
+        const __m256 High01 = _mm256_unpackhi_ps(In0.Value, In1.Value);
+        const __m256 Row0 = _mm256_shuffle_ps(Low01, In2.Value, _MM_SHUFFLE(0, 0, 1, 0));
+        const __m256 Row1 = _mm256_shuffle_ps(Low01, In2.Value, _MM_SHUFFLE(1, 1, 3, 2));
+        const __m256 Row2 = _mm256_shuffle_ps(High01, In2.Value, _MM_SHUFFLE(2, 2, 1, 0));
+        const __m256 Row3 = _mm256_shuffle_ps(High01, In2.Value, _MM_SHUFFLE(3, 3, 3, 2));
+        _mm_storeu_ps(Row(0), _mm256_castps256_ps128(Row0));
+        _mm_storeu_ps(Row(1), _mm256_castps256_ps128(Row1));
+        _mm_storeu_ps(Row(2), _mm256_castps256_ps128(Row2));
+        _mm_storeu_ps(Row(3), _mm256_castps256_ps128(Row3));
+        _mm_storeu_ps(Row(4), _mm256_extractf128_ps(Row0, 1));
+        _mm_storeu_ps(Row(5), _mm256_extractf128_ps(Row1, 1));
+        _mm_storeu_ps(Row(6), _mm256_extractf128_ps(Row2, 1));
+        _mm_storeu_ps(Row(7), _mm256_extractf128_ps(Row3, 1));
+#elif MIKASA_SIMD_SSE2
+        const __m128 Low01 = _mm_unpacklo_ps(In0.Value, In1.Value);
+        const __m128 High01 = _mm_unpackhi_ps(In0.Value, In1.Value);
+        _mm_storeu_ps(Row(0), _mm_shuffle_ps(Low01, In2.Value, _MM_SHUFFLE(0, 0, 1, 0)));
+        _mm_storeu_ps(Row(1), _mm_shuffle_ps(Low01, In2.Value, _MM_SHUFFLE(1, 1, 3, 2)));
+        _mm_storeu_ps(Row(2), _mm_shuffle_ps(High01, In2.Value, _MM_SHUFFLE(2, 2, 1, 0)));
+        _mm_storeu_ps(Row(3), _mm_shuffle_ps(High01, In2.Value, _MM_SHUFFLE(3, 3, 3, 2)));
+#else
+        StoreTransposed4(In0, In1, In2, In2, Row);
+#endif
+    }
+};
+
+
+inline FFloatWide FIntWide::ToFloat() const
+{
+    FFloatWide Result;
+#if MIKASA_SIMD_AVX
+    Result.Value = _mm256_cvtepi32_ps(Value);
+#elif MIKASA_SIMD_SSE2
+    Result.Value = _mm_cvtepi32_ps(Value);
+#elif MIKASA_SIMD_NEON
+    Result.Value = vcvtq_f32_s32(Value);
+#else
+    for (int32_t Lane = 0; Lane < 4; ++Lane) { Result.Value[Lane] = (float)Value[Lane]; }
+#endif
+    return Result;
+}
+
+inline FFloatWide FIntWide::AsFloat() const
+{
+    FFloatWide Result;
+#if MIKASA_SIMD_AVX
+    Result.Value = _mm256_castsi256_ps(Value);
+#elif MIKASA_SIMD_SSE2
+    Result.Value = _mm_castsi128_ps(Value);
+#elif MIKASA_SIMD_NEON
+    Result.Value = vreinterpretq_f32_s32(Value);
+#else
+    memcpy(Result.Value, Value, sizeof(Value));
+#endif
+    return Result;
+}
+
+inline FFloatWide FFloatWide::Round() const
+{
+    return RoundToInt().ToFloat();
+}
+
+inline FFloatWide FFloatWide::Floor() const
+{
+    const FFloatWide Rounded = Round();
+    return Rounded - Select(Rounded > *this, FFloatWide(1.0f), FFloatWide(0.0f));
+}
+
+/**
+ * FFloatWide::Lanes vectors in structure of arrays layout, lane N of x, y and z form vector N.
+ * Loads and stores convert from and to MVector arrays or separate x, y and z streams.
+ */
+struct MVectorWide
+{
+    static constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    FFloatWide x, y, z;
+
+    MVectorWide()
+    {
+    }
+
+    MVectorWide(const FFloatWide& InX, const FFloatWide& InY, const FFloatWide& InZ)
+        : x(InX), y(InY), z(InZ)
+    {
+    }
+
+    /** Broadcasts one vector to every lane. */
+    MVectorWide(const MVector& V)
+        : x(V.x), y(V.y), z(V.z)
+    {
+    }
+
+    /** Loads Lanes vectors from separate component streams. */
+    static MVectorWide Load(const float* X, const float* Y, const float* Z)
+    {
+        return MVectorWide(FFloatWide::Load(X), FFloatWide::Load(Y), FFloatWide::Load(Z));
+    }
+
+    void Store(float* X, float* Y, float* Z) const
+    {
+        x.Store(X);
+        y.Store(Y);
+        z.Store(Z);
+    }
+
+    /** Loads up to Lanes vectors from an MVector array, missing lanes repeat the last vector. */
+    static MVectorWide Load(const MVector* Vectors, int32_t Num = Lanes)
+    {
+        alignas(32) float X[Lanes];
+        alignas(32) float Y[Lanes];
+        alignas(32) float Z[Lanes];
+        for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+        {
+            const MVector& V = Vectors[Lane < Num ? Lane : Num - 1];
+            X[Lane] = V.x;
+            Y[Lane] = V.y;
+            Z[Lane] = V.z;
+        }
+        return Load(X, Y, Z);
+    }
+
+    /** Stores the first Num lanes to an MVector array. */
+    void Store(MVector* Vectors, int32_t Num = Lanes) const
+    {
+        alignas(32) float X[Lanes];
+        alignas(32) float Y[Lanes];
+        alignas(32) float Z[Lanes];
+        Store(X, Y, Z);
+        for (int32_t Lane = 0; Lane < Num; ++Lane)
+        {
+            Vectors[Lane] = MVector(X[Lane], Y[Lane], Z[Lane]);
+        }
+    }
+
+    MVector GetLane(int32_t Lane) const
+    {
+        return MVector(x.GetLane(Lane), y.GetLane(Lane), z.GetLane(Lane));
+    }
+
+    MVectorWide operator+(const MVectorWide& V) const { return MVectorWide(x + V.x, y + V.y, z + V.z); }
+    MVectorWide operator-(const MVectorWide& V) const { return MVectorWide(x - V.x, y - V.y, z - V.z); }
+    MVectorWide operator*(const MVectorWide& V) const { return MVectorWide(x * V.x, y * V.y, z * V.z); }
+    MVectorWide operator*(const FFloatWide& Scale) const { return MVectorWide(x * Scale, y * Scale, z * Scale); }
+    MVectorWide operator-() const { return MVectorWide(-x, -y, -z); }
+
+    /** Dot product per lane */
+    FFloatWide operator|(const MVectorWide& V) const
+    {
+        return FFloatWide::MulAdd(x, V.x, FFloatWide::MulAdd(y, V.y, z * V.z));
+    }
+
+    /** Cross product per lane */
+    MVectorWide operator^(const MVectorWide& V) const
+    {
+        return MVectorWide(y * V.z - z * V.y, z * V.x - x * V.z, x * V.y - y * V.x);
+    }
+
+    FFloatWide SizeSquared() const { return *this | *this; }
+    FFloatWide Size() const { return FFloatWide::Sqrt(SizeSquared()); }
+
+    /** Normalizes every lane, lanes shorter than the tolerance become zero. */
+    MVectorWide GetSafeNormal(float Tolerance = 1.e-8f) const
+    {
+        const FFloatWide SquareSum = SizeSquared();
+        const FMaskWide bValid = SquareSum >= FFloatWide(Tolerance);
+        const FFloatWide Scale = FFloatWide::Select(bValid, FFloatWide(1.0f) / FFloatWide::Sqrt(SquareSum), FFloatWide(0.0f));
+        return *this * Scale;
+    }
+
+    static MVectorWide Min(const MVectorWide& A, const MVectorWide& B)
+    {
+        return MVectorWide(FFloatWide::Min(A.x, B.x), FFloatWide::Min(A.y, B.y), FFloatWide::Min(A.z, B.z));
+    }
+
+    static MVectorWide Max(const MVectorWide& A, const MVectorWide& B)
+    {
+        return MVectorWide(FFloatWide::Max(A.x, B.x), FFloatWide::Max(A.y, B.y), FFloatWide::Max(A.z, B.z));
+    }
+
+    static MVectorWide Select(const FMaskWide& Mask, const MVectorWide& A, const MVectorWide& B)
+    {
+        return MVectorWide(FFloatWide::Select(Mask, A.x, B.x), FFloatWide::Select(Mask, A.y, B.y), FFloatWide::Select(Mask, A.z, B.z));
+    }
+};
+
+} // namespace MIKASA_SIMD_NAMESPACE
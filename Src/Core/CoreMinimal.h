@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include <cassert>
 #include <string>
 #include <memory>
 #include <functional>
@@ -19,5 +20,8 @@
 #define GET_MEMBER_NAME_CHECKED(ClassName, MemberName) ((void)sizeof(((ClassName*)0)->MemberName), #MemberName)
 #define GET_ENUM_NAME_CHECKED(ClassName, EnumName) ((void)sizeof(ClassName::EnumName), #EnumName)
 
+// Invariant the caller must uphold, compiled out of release builds like assert
+#define check(Expression) assert(Expression)
+
 class FDisplay;
 typedef std::shared_ptr<FDisplay> FDisplayPtr;
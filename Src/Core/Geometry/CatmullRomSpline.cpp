@@ -0,0 +1,311 @@
+#include "CatmullRomSpline.h"
+
+#include <algorithm>
+
+namespace
+{
+    /** 5 point Gauss-Legendre quadrature on [0, 1], exact for the polynomial part of the speed. */
+    const float QuadratureNodes[5] = { 0.0469100770f, 0.2307653449f, 0.5f, 0.7692346551f, 0.9530899230f };
+    const float QuadratureWeights[5] = { 0.1184634425f, 0.2393143352f, 0.2844444444f, 0.2393143352f, 0.1184634425f };
+
+    /** Knot spacing below this is treated as coincident points. */
+    constexpr float MinKnotSpacing = 1.e-4f;
+}
+
+FCatmullRomSpline::FCatmullRomSpline(float InAlpha, bool bInClosedLoop)
+    : Alpha(InAlpha)
+    , bClosedLoop(bInClosedLoop)
+{
+}
+
+void FCatmullRomSpline::SetPoints(const MVector* InPoints, int32_t NumPoints)
+{
+    Points.assign(InPoints, InPoints + FMath::Max(NumPoints, 0));
+
+    const int32_t NumSegments = bClosedLoop ? (NumPoints >= 3 ? NumPoints : 0) : FMath::Max(NumPoints - 1, 0);
+    Segments.resize(NumSegments);
+    LengthTable.resize((size_t)NumSegments * (SamplesPerSegment + 1));
+    for (int32_t Segment = 0; Segment < NumSegments; ++Segment)
+    {
+        BuildSegment(Segment);
+    }
+    AccumulateDistances();
+}
+
+void FCatmullRomSpline::MovePoints(int32_t FirstIndex, const MVector* InPoints, int32_t NumPoints)
+{
+    check(FirstIndex >= 0 && NumPoints >= 0);
+    check(FirstIndex + NumPoints <= (int32_t)Points.size());
+
+    std::copy(InPoints, InPoints + NumPoints, Points.begin() + FirstIndex);
+
+    // A point shapes the two segments it bounds and the ones before and after them
+    const int32_t NumSegments = GetNumSegments();
+    const int32_t FirstSegment = FirstIndex - 2;
+    const int32_t EndSegment = FirstIndex + NumPoints + 1;
+    if (EndSegment - FirstSegment >= NumSegments)
+    {
+        for (int32_t Segment = 0; Segment < NumSegments; ++Segment)
+        {
+            BuildSegment(Segment);
+        }
+    }
+    else
+    {
+        for (int32_t Segment = FirstSegment; Segment < EndSegment; ++Segment)
+        {
+            if (bClosedLoop)
+            {
+                BuildSegment((Segment + NumSegments) % NumSegments);
+            }
+            else if (Segment >= 0 && Segment < NumSegments)
+            {
+                BuildSegment(Segment);
+            }
+        }
+    }
+    AccumulateDistances();
+}
+
+MVector FCatmullRomSpline::GetLocation(float Parameter) const
+{
+    float U;
+    const int32_t Segment = ResolveParameter(Parameter, U);
+    if (Segment < 0)
+    {
+        return Points.empty() ? MVector::ZeroVector : Points[0];
+    }
+    return Segments[Segment].GetLocation(U);
+}
+
+MVector FCatmullRomSpline::GetTangent(float Parameter) const
+{
+    float U;
+    const int32_t Segment = ResolveParameter(Parameter, U);
+    return Segment < 0 ? MVector::ZeroVector : Segments[Segment].GetTangent(U);
+}
+
+float FCatmullRomSpline::GetDistanceAtParameter(float Parameter) const
+{
+    float U;
+    const int32_t Segment = ResolveParameter(Parameter, U);
+    if (Segment < 0)
+    {
+        return 0.0f;
+    }
+
+    const int32_t Step = FMath::Min((int32_t)(U * SamplesPerSegment), SamplesPerSegment - 1);
+    const float StepStart = (float)Step / SamplesPerSegment;
+    return SegmentDistances[Segment] + LengthTable[(size_t)Segment * (SamplesPerSegment + 1) + Step] + IntegrateLength(Segment, StepStart, U);
+}
+
+float FCatmullRomSpline::GetParameterAtDistance(float Distance) const
+{
+    float U;
+    const int32_t Segment = ResolveDistance(Distance, U);
+    return Segment < 0 ? 0.0f : (float)Segment + U;
+}
+
+MVector FCatmullRomSpline::GetLocationAtDistance(float Distance) const
+{
+    float U;
+    const int32_t Segment = ResolveDistance(Distance, U);
+    if (Segment < 0)
+    {
+        return Points.empty() ? MVector::ZeroVector : Points[0];
+    }
+    return Segments[Segment].GetLocation(U);
+}
+
+MVector FCatmullRomSpline::GetDirectionAtDistance(float Distance) const
+{
+    float U;
+    const int32_t Segment = ResolveDistance(Distance, U);
+    return Segment < 0 ? MVector::ZeroVector : Segments[Segment].GetTangent(U).GetSafeNormal();
+}
+
+template <typename ResolveType>
+void FCatmullRomSpline::EvaluateWide(int32_t NumLocations, MVector* OutLocations, ResolveType Resolve) const
+{
+    if (Segments.empty())
+    {
+        std::fill(OutLocations, OutLocations + NumLocations, GetLocation(0.0f));
+        return;
+    }
+
+    constexpr int32_t Lanes = FFloatWide::Lanes;
+    for (int32_t Index = 0; Index < NumLocations; Index += Lanes)
+    {
+        // Segments are resolved one by one, their coefficients transposed to lanes
+        const int32_t Num = FMath::Min(NumLocations - Index, Lanes);
+        alignas(32) float Coefficients[12][Lanes] = {};
+        alignas(32) float Us[Lanes] = {};
+        for (int32_t Lane = 0; Lane < Num; ++Lane)
+        {
+            const FSegment& Segment = Segments[Resolve(Index + Lane, Us[Lane])];
+            const MVector* Terms = &Segment.A;
+            for (int32_t Term = 0; Term < 4; ++Term)
+            {
+                Coefficients[Term * 3 + 0][Lane] = Terms[Term].x;
+                Coefficients[Term * 3 + 1][Lane] = Terms[Term].y;
+                Coefficients[Term * 3 + 2][Lane] = Terms[Term].z;
+            }
+        }
+
+        const FFloatWide U = FFloatWide::Load(Us);
+        const MVectorWide A = MVectorWide::Load(Coefficients[0], Coefficients[1], Coefficients[2]);
+        const MVectorWide B = MVectorWide::Load(Coefficients[3], Coefficients[4], Coefficients[5]);
+        const MVectorWide C = MVectorWide::Load(Coefficients[6], Coefficients[7], Coefficients[8]);
+        const MVectorWide D = MVectorWide::Load(Coefficients[9], Coefficients[10], Coefficients[11]);
+        (((A * U + B) * U + C) * U + D).Store(OutLocations + Index, Num);
+    }
+}
+
+void FCatmullRomSpline::GetLocations(const float* Parameters, int32_t NumParameters, MVector* OutLocations) const
+{
+    EvaluateWide(NumParameters, OutLocations, [this, Parameters](int32_t Index, float& OutU) { return ResolveParameter(Parameters[Index], OutU); });
+}
+
+void FCatmullRomSpline::GetLocationsAtDistances(const float* Distances, int32_t NumDistances, MVector* OutLocations) const
+{
+    EvaluateWide(NumDistances, OutLocations, [this, Distances](int32_t Index, float& OutU) { return ResolveDistance(Distances[Index], OutU); });
+}
+
+void FCatmullRomSpline::GetEvenlySpacedLocations(int32_t NumLocations, MVector* OutLocations) const
+{
+    // Loops end where they start, so the last location is one spacing before the end
+    const int32_t NumSpacings = bClosedLoop ? NumLocations : NumLocations - 1;
+    const float Spacing = NumSpacings > 0 ? GetLength() / NumSpacings : 0.0f;
+    EvaluateWide(NumLocations, OutLocations, [this, Spacing](int32_t Index, float& OutU) { return ResolveDistance(Index * Spacing, OutU); });
+}
+
+MVector FCatmullRomSpline::GetControlPoint(int32_t Index) const
+{
+    const int32_t NumPoints = (int32_t)Points.size();
+    if (bClosedLoop)
+    {
+        return Points[(Index + NumPoints) % NumPoints];
+    }
+    if (Index < 0)
+    {
+        return Points[0] * 2.0f - Points[1];
+    }
+    if (Index >= NumPoints)
+    {
+        return Points[NumPoints - 1] * 2.0f - Points[NumPoints - 2];
+    }
+    return Points[Index];
+}
+
+void FCatmullRomSpline::BuildSegment(int32_t Segment)
+{
+    const MVector P0 = GetControlPoint(Segment - 1);
+    const MVector P1 = GetControlPoint(Segment);
+    const MVector P2 = GetControlPoint(Segment + 1);
+    const MVector P3 = GetControlPoint(Segment + 2);
+
+    const auto KnotSpacing = [this](const MVector& From, const MVector& To)
+    {
+        return FMath::Max(FMath::Pow((To - From).SizeSquared(), Alpha * 0.5f), MinKnotSpacing);
+    };
+    const float D01 = KnotSpacing(P0, P1);
+    const float D12 = KnotSpacing(P1, P2);
+    const float D23 = KnotSpacing(P2, P3);
+
+    // Tangents of the non uniform Catmull-Rom curve over [P1, P2], rescaled to a unit parameter
+    const MVector M1 = ((P1 - P0) * (1.0f / D01) - (P2 - P0) * (1.0f / (D01 + D12)) + (P2 - P1) * (1.0f / D12)) * D12;
+    const MVector M2 = ((P2 - P1) * (1.0f / D12) - (P3 - P1) * (1.0f / (D12 + D23)) + (P3 - P2) * (1.0f / D23)) * D12;
+
+    // Hermite basis (see FMath::CubicInterp) expanded to powers of U
+    FSegment& Result = Segments[Segment];
+    Result.A = P1 * 2.0f - P2 * 2.0f + M1 + M2;
+    Result.B = P2 * 3.0f - P1 * 3.0f - M1 * 2.0f - M2;
+    Result.C = M1;
+    Result.D = P1;
+
+    float* Table = LengthTable.data() + (size_t)Segment * (SamplesPerSegment + 1);
+    Table[0] = 0.0f;
+    for (int32_t Step = 0; Step < SamplesPerSegment; ++Step)
+    {
+        Table[Step + 1] = Table[Step] + IntegrateLength(Segment, (float)Step / SamplesPerSegment, (float)(Step + 1) / SamplesPerSegment);
+    }
+}
+
+void FCatmullRomSpline::AccumulateDistances()
+{
+    const int32_t NumSegments = GetNumSegments();
+    SegmentDistances.resize(NumSegments + 1);
+    SegmentDistances[0] = 0.0f;
+    for (int32_t Segment = 0; Segment < NumSegments; ++Segment)
+    {
+        SegmentDistances[Segment + 1] = SegmentDistances[Segment] + LengthTable[(size_t)Segment * (SamplesPerSegment + 1) + SamplesPerSegment];
+    }
+}
+
+int32_t FCatmullRomSpline::ResolveParameter(float Parameter, float& OutU) const
+{
+    const int32_t NumSegments = GetNumSegments();
+    if (NumSegments == 0)
+    {
+        OutU = 0.0f;
+        return -1;
+    }
+
+    if (bClosedLoop)
+    {
+        Parameter -= FMath::FloorToFloat(Parameter / NumSegments) * NumSegments;
+    }
+    Parameter = FMath::Clamp(Parameter, 0.0f, (float)NumSegments);
+
+    const int32_t Segment = FMath::Min((int32_t)Parameter, NumSegments - 1);
+    OutU = FMath::Min(Parameter - (float)Segment, 1.0f);
+    return Segment;
+}
+
+int32_t FCatmullRomSpline::ResolveDistance(float Distance, float& OutU) const
+{
+    const int32_t NumSegments = GetNumSegments();
+    const float Length = GetLength();
+    if (NumSegments == 0)
+    {
+        OutU = 0.0f;
+        return -1;
+    }
+
+    if (bClosedLoop && Length > 0.0f)
+    {
+        Distance -= FMath::FloorToFloat(Distance / Length) * Length;
+    }
+    Distance = FMath::Clamp(Distance, 0.0f, Length);
+
+    const int32_t Segment = FMath::Min((int32_t)(std::upper_bound(SegmentDistances.begin() + 1, SegmentDistances.end(), Distance) - SegmentDistances.begin()) - 1, NumSegments - 1);
+    const float LocalDistance = Distance - SegmentDistances[Segment];
+
+    const float* Table = LengthTable.data() + (size_t)Segment * (SamplesPerSegment + 1);
+    const int32_t Step = FMath::Min((int32_t)(std::upper_bound(Table + 1, Table + SamplesPerSegment + 1, LocalDistance) - Table) - 1, SamplesPerSegment - 1);
+    const float StepStart = (float)Step / SamplesPerSegment;
+    const float StepEnd = (float)(Step + 1) / SamplesPerSegment;
+
+    // Linear guess within the table step, refined by a Newton step on the exact arc length
+    const float StepLength = Table[Step + 1] - Table[Step];
+    float U = StepLength > 0.0f ? StepStart + (LocalDistance - Table[Step]) / StepLength * (StepEnd - StepStart) : StepStart;
+    const float Speed = Segments[Segment].GetTangent(U).Size();
+    if (Speed > SMALL_NUMBER)
+    {
+        U -= (Table[Step] + IntegrateLength(Segment, StepStart, U) - LocalDistance) / Speed;
+    }
+    OutU = FMath::Clamp(U, StepStart, StepEnd);
+    return Segment;
+}
+
+float FCatmullRomSpline::IntegrateLength(int32_t Segment, float U0, float U1) const
+{
+    const FSegment& Polynomial = Segments[Segment];
+    const float Span = U1 - U0;
+    float Length = 0.0f;
+    for (int32_t Node = 0; Node < 5; ++Node)
+    {
+        Length += QuadratureWeights[Node] * Polynomial.GetTangent(U0 + Span * QuadratureNodes[Node]).Size();
+    }
+    return Length * Span;
+}
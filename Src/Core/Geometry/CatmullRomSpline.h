@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+
+/**
+ * Catmull-Rom spline through a list of points, with an arc length table for constant speed motion
+ * (camera rails, paths followed by AI or particles).
+ *
+ * Segment i runs from point i to point i + 1, a parameter is a segment index plus the fraction along
+ * it, in [0, GetNumSegments()]. Knots are spaced by the distance between points to the power Alpha
+ * as in FMath::CubicCRSplineInterp: 0 is uniform, 0.5 centripetal, which never forms cusps or loops
+ * within a segment, and 1 chordal. Open splines extend their end segments with mirrored points.
+ *
+ * Every segment is kept as a cubic polynomial together with the arc length at SamplesPerSegment
+ * steps, so distance queries are a binary search and one Newton step instead of an integration.
+ * Moving points only rebuilds the up to four segments they shape.
+ */
+class CORE_API FCatmullRomSpline
+{
+public:
+    /** Arc length table steps per segment. */
+    static constexpr int32_t SamplesPerSegment = 16;
+
+    explicit FCatmullRomSpline(float InAlpha = 0.5f, bool bInClosedLoop = false);
+
+    /** Replaces all points and rebuilds every segment. Closed loops need 3 points, open splines 2. */
+    void SetPoints(const MVector* InPoints, int32_t NumPoints);
+
+    /** Moves NumPoints existing points starting at FirstIndex, rebuilding only the segments they shape. */
+    void MovePoints(int32_t FirstIndex, const MVector* InPoints, int32_t NumPoints);
+
+    void MovePoint(int32_t Index, const MVector& Location)
+    {
+        MovePoints(Index, &Location, 1);
+    }
+
+    const std::vector<MVector>& GetPoints() const { return Points; }
+    int32_t GetNumSegments() const { return (int32_t)Segments.size(); }
+    float GetAlpha() const { return Alpha; }
+    bool IsClosedLoop() const { return bClosedLoop; }
+
+    float GetLength() const { return SegmentDistances.empty() ? 0.0f : SegmentDistances.back(); }
+
+    /** Parameters outside of the spline are clamped, or wrapped for closed loops. */
+    MVector GetLocation(float Parameter) const;
+
+    /** Derivative of the location by the parameter. */
+    MVector GetTangent(float Parameter) const;
+
+    float GetDistanceAtParameter(float Parameter) const;
+    float GetParameterAtDistance(float Distance) const;
+
+    /** Distances outside of [0, GetLength()] are clamped, or wrapped for closed loops. */
+    MVector GetLocationAtDistance(float Distance) const;
+
+    /** Unit direction of travel. */
+    MVector GetDirectionAtDistance(float Distance) const;
+
+    /** Batch versions, FFloatWide::Lanes locations are evaluated at once. */
+    void GetLocations(const float* Parameters, int32_t NumParameters, MVector* OutLocations) const;
+    void GetLocationsAtDistances(const float* Distances, int32_t NumDistances, MVector* OutLocations) const;
+
+    /** NumLocations points at equal distances from the start to the end, or around the loop. */
+    void GetEvenlySpacedLocations(int32_t NumLocations, MVector* OutLocations) const;
+
+private:
+    /** Location = ((A * U + B) * U + C) * U + D for U in [0, 1]. */
+    struct FSegment
+    {
+        MVector A, B, C, D;
+
+        MVector GetLocation(float U) const { return ((A * U + B) * U + C) * U + D; }
+        MVector GetTangent(float U) const { return (A * (3.0f * U) + B * 2.0f) * U + C; }
+    };
+
+    MVector GetControlPoint(int32_t Index) const;
+    void BuildSegment(int32_t Segment);
+    void AccumulateDistances();
+
+    /** Splits a parameter in its segment and the fraction along it. */
+    int32_t ResolveParameter(float Parameter, float& OutU) const;
+    int32_t ResolveDistance(float Distance, float& OutU) const;
+
+    /** Arc length of a segment between two fractions. */
+    float IntegrateLength(int32_t Segment, float U0, float U1) const;
+
+    /** Resolve(int32_t Index, float& OutU) returns the segment of location Index. */
+    template <typename ResolveType>
+    void EvaluateWide(int32_t NumLocations, MVector* OutLocations, ResolveType Resolve) const;
+
+private:
+    float Alpha;
+    bool bClosedLoop;
+
+    std::vector<MVector> Points;
+    std::vector<FSegment> Segments;
+
+    /** Distance from the segment start at each table step, SamplesPerSegment + 1 entries per segment. */
+    std::vector<float> LengthTable;
+
+    /** Distance from the spline start to each segment start, and the length as the last entry. */
+    std::vector<float> SegmentDistances;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+
+/**
+ * Convex volume bounded by up to MaxPlanes planes whose normals point out of it, a point is
+ * inside when PlaneDot is at most 0 for every plane.
+ */
+struct FFrustum
+{
+    static constexpr int32_t MaxPlanes = 8;
+
+    FPlane Planes[MaxPlanes];
+    int32_t NumPlanes;
+
+    FFrustum()
+        : NumPlanes(0)
+    {
+    }
+
+    FFrustum(const FPlane* InPlanes, int32_t InNumPlanes)
+        : NumPlanes(FMath::Min(InNumPlanes, MaxPlanes))
+    {
+        std::copy(InPlanes, InPlanes + NumPlanes, Planes);
+    }
+
+    /**
+     * View frustum of a perspective camera at Origin looking along Forward, with a horizontal field
+     * of view of 2 * HalfFovRadians and AspectRatio = width / height. A FarDistance of 0 or less
+     * leaves the frustum open at the far end.
+     */
+    static FFrustum MakePerspective(const MVector& Origin, const MVector& Forward, const MVector& Up, float HalfFovRadians, float AspectRatio, float NearDistance, float FarDistance)
+    {
+        const MVector Front = Forward.GetSafeNormal();
+        const MVector Right = (Up ^ Front).GetSafeNormal();
+        const MVector Top = Front ^ Right;
+        const float TanHorizontal = FMath::Tan(HalfFovRadians);
+        const float TanVertical = TanHorizontal / AspectRatio;
+
+        FFrustum Frustum;
+        const auto AddPlane = [&Frustum](const MVector& Normal, const MVector& Base)
+        {
+            Frustum.Planes[Frustum.NumPlanes++] = FPlane(Base, Normal.GetSafeNormal());
+        };
+        AddPlane(-Front, Origin + Front * NearDistance);
+        AddPlane(Right - Front * TanHorizontal, Origin);
+        AddPlane(-Right - Front * TanHorizontal, Origin);
+        AddPlane(Top - Front * TanVertical, Origin);
+        AddPlane(-Top - Front * TanVertical, Origin);
+        if (FarDistance > 0.0f)
+        {
+            AddPlane(Front, Origin + Front * FarDistance);
+        }
+        return Frustum;
+    }
+
+    bool IntersectPoint(const MVector& Point) const
+    {
+        for (int32_t Index = 0; Index < NumPlanes; ++Index)
+        {
+            if (Planes[Index].PlaneDot(Point) > 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Conservative, boxes near the frustum's edges may pass although they are outside. */
+    bool IntersectBox(const MVector& Center, const MVector& Extent) const
+    {
+        for (int32_t Index = 0; Index < NumPlanes; ++Index)
+        {
+            if (Planes[Index].PlaneDot(Center) > (Extent | Planes[Index].GetAbs()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IntersectBox(const FBox& Box) const
+    {
+        return IntersectBox(Box.GetCenter(), Box.GetExtent());
+    }
+
+    /** Conservative like IntersectBox. */
+    bool IntersectSphere(const MVector& Center, float Radius) const
+    {
+        for (int32_t Index = 0; Index < NumPlanes; ++Index)
+        {
+            if (Planes[Index].PlaneDot(Center) > Radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IntersectSphere(const FSphere& Sphere) const
+    {
+        return IntersectSphere(Sphere.Center, Sphere.W);
+    }
+};
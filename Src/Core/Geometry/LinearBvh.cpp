@@ -0,0 +1,401 @@
+#include "LinearBvh.h"
+
+#include "Async/JobSystem.h"
+#include "Base/MathUtil.h"
+#include "Profiler/CpuProfiler.h"
+
+namespace
+{
+    constexpr int32_t MinBatchSize = 4096;
+    constexpr int32_t RadixBits = 10;
+    constexpr int32_t RadixBuckets = 1 << RadixBits;
+    // Deepest possible tree: one level per bit of the 64 bit keys
+    constexpr int32_t MaxTraversalDepth = 128;
+
+    /** Splits [0, Num) in chunks for the steps that need per chunk results in a fixed order. */
+    int32_t GetNumChunks(int32_t Num)
+    {
+        const int32_t MaxChunks = FJobSystem::Get().GetNumThreads() * 4;
+        return FMath::Clamp((Num + MinBatchSize - 1) / MinBatchSize, 1, MaxChunks);
+    }
+
+    int32_t GetChunkBegin(int32_t Num, int32_t NumChunks, int32_t Chunk)
+    {
+        return (int32_t)((int64_t)Num * Chunk / NumChunks);
+    }
+}
+
+FLinearBvh::FLinearBvh()
+    : NumPrimitives(0)
+{
+}
+
+void FLinearBvh::Build(const FBox* PrimitiveBounds, int32_t InNumPrimitives)
+{
+    SCOPED_CPU_TIMER("FLinearBvh::Build");
+
+    NumPrimitives = FMath::Max(InNumPrimitives, 0);
+    if (NumPrimitives == 0)
+    {
+        Nodes.clear();
+        return;
+    }
+
+    Nodes.resize(2 * (size_t)NumPrimitives - 1);
+    MortonKeys.resize(NumPrimitives);
+    SortScratch.resize(NumPrimitives);
+
+    ComputeMortonKeys(PrimitiveBounds);
+    SortMortonKeys();
+    EmitHierarchy();
+    ComputeNodeBounds(PrimitiveBounds);
+}
+
+void FLinearBvh::Refit(const FBox* PrimitiveBounds)
+{
+    SCOPED_CPU_TIMER("FLinearBvh::Refit");
+
+    if (NumPrimitives > 0)
+    {
+        ComputeNodeBounds(PrimitiveBounds);
+    }
+}
+
+void FLinearBvh::ComputeMortonKeys(const FBox* PrimitiveBounds)
+{
+    SCOPED_CPU_TIMER("FLinearBvh::ComputeMortonKeys");
+
+    // Centroid bounds, reduced per chunk so the result doesn't depend on scheduling
+    const int32_t NumChunks = GetNumChunks(NumPrimitives);
+    std::vector<FBox> ChunkBounds(NumChunks);
+    FJobSystem::Get().ParallelFor(NumChunks, [&](int32_t Chunk)
+        {
+            FBox Bounds;
+            const int32_t End = GetChunkBegin(NumPrimitives, NumChunks, Chunk + 1);
+            for (int32_t Index = GetChunkBegin(NumPrimitives, NumChunks, Chunk); Index < End; ++Index)
+            {
+                Bounds += PrimitiveBounds[Index].GetCenter();
+            }
+            ChunkBounds[Chunk] = Bounds;
+        });
+
+    FBox CentroidBounds;
+    for (const FBox& Bounds : ChunkBounds)
+    {
+        CentroidBounds += Bounds;
+    }
+
+    // Quantize to a 1024^3 grid, flat axes all land in cell 0
+    const MVector Size = CentroidBounds.GetSize();
+    const MVector Scale(Size.x > 0.0f ? 1023.0f / Size.x : 0.0f, Size.y > 0.0f ? 1023.0f / Size.y : 0.0f, Size.z > 0.0f ? 1023.0f / Size.z : 0.0f);
+    const MVector Origin = CentroidBounds.Min;
+
+    FJobSystem::Get().ParallelForRange(NumPrimitives, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Index = Begin; Index < End; ++Index)
+            {
+                const MVector Cell = (PrimitiveBounds[Index].GetCenter() - Origin) * Scale;
+                const uint32_t X = (uint32_t)FMath::Clamp(Cell.x + 0.5f, 0.0f, 1023.0f);
+                const uint32_t Y = (uint32_t)FMath::Clamp(Cell.y + 0.5f, 0.0f, 1023.0f);
+                const uint32_t Z = (uint32_t)FMath::Clamp(Cell.z + 0.5f, 0.0f, 1023.0f);
+                const uint32_t Code = FMath::MortonCode3(X) | (FMath::MortonCode3(Y) << 1) | (FMath::MortonCode3(Z) << 2);
+                MortonKeys[Index] = ((uint64_t)Code << 32) | (uint32_t)Index;
+            }
+        }, MinBatchSize);
+}
+
+void FLinearBvh::SortMortonKeys()
+{
+    SCOPED_CPU_TIMER("FLinearBvh::SortMortonKeys");
+
+    // LSD radix sort on the 30 code bits, each pass is stable so the indices stay ascending within equal codes
+    const int32_t NumChunks = GetNumChunks(NumPrimitives);
+    std::vector<uint32_t> Histograms((size_t)NumChunks * RadixBuckets);
+
+    for (int32_t Shift = 32; Shift < 62; Shift += RadixBits)
+    {
+        std::fill(Histograms.begin(), Histograms.end(), 0u);
+        FJobSystem::Get().ParallelFor(NumChunks, [&](int32_t Chunk)
+            {
+                uint32_t* Histogram = Histograms.data() + (size_t)Chunk * RadixBuckets;
+                const int32_t End = GetChunkBegin(NumPrimitives, NumChunks, Chunk + 1);
+                for (int32_t Index = GetChunkBegin(NumPrimitives, NumChunks, Chunk); Index < End; ++Index)
+                {
+                    ++Histogram[(MortonKeys[Index] >> Shift) & (RadixBuckets - 1)];
+                }
+            });
+
+        // Turn the counts into scatter offsets, bucket major so that chunk order is kept inside a bucket
+        uint32_t Offset = 0;
+        bool bAllInOneBucket = false;
+        for (int32_t Bucket = 0; Bucket < RadixBuckets; ++Bucket)
+        {
+            uint32_t BucketCount = 0;
+            for (int32_t Chunk = 0; Chunk < NumChunks; ++Chunk)
+            {
+                uint32_t& Count = Histograms[(size_t)Chunk * RadixBuckets + Bucket];
+                BucketCount += Count;
+                const uint32_t ChunkCount = Count;
+                Count = Offset;
+                Offset += ChunkCount;
+            }
+            bAllInOneBucket |= BucketCount == (uint32_t)NumPrimitives;
+        }
+
+        if (bAllInOneBucket)
+        {
+            continue;
+        }
+
+        FJobSystem::Get().ParallelFor(NumChunks, [&](int32_t Chunk)
+            {
+                uint32_t* ChunkOffsets = Histograms.data() + (size_t)Chunk * RadixBuckets;
+                const int32_t End = GetChunkBegin(NumPrimitives, NumChunks, Chunk + 1);
+                for (int32_t Index = GetChunkBegin(NumPrimitives, NumChunks, Chunk); Index < End; ++Index)
+                {
+                    const uint64_t Key = MortonKeys[Index];
+                    SortScratch[ChunkOffsets[(Key >> Shift) & (RadixBuckets - 1)]++] = Key;
+                }
+            });
+        MortonKeys.swap(SortScratch);
+    }
+}
+
+void FLinearBvh::EmitHierarchy()
+{
+    SCOPED_CPU_TIMER("FLinearBvh::EmitHierarchy");
+
+    const int32_t NumInternalNodes = NumPrimitives - 1;
+    const uint64_t* Keys = MortonKeys.data();
+    const int32_t Num = NumPrimitives;
+
+    // Length of the common key prefix of two sorted leaves, -1 outside of the array
+    const auto CommonPrefix = [Keys, Num](int32_t A, int32_t B) -> int32_t
+    {
+        if (B < 0 || B >= Num)
+        {
+            return -1;
+        }
+        return (int32_t)FMath::CountLeadingZeros64(Keys[A] ^ Keys[B]);
+    };
+
+    FJobSystem::Get().ParallelForRange(NumInternalNodes, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Node = Begin; Node < End; ++Node)
+            {
+                // The node's range extends towards the neighbour sharing the longer prefix
+                const int32_t Direction = CommonPrefix(Node, Node + 1) > CommonPrefix(Node, Node - 1) ? 1 : -1;
+                const int32_t MinPrefix = CommonPrefix(Node, Node - Direction);
+
+                // Exponential then binary search for the other end of the range
+                int32_t MaxLength = 2;
+                while (CommonPrefix(Node, Node + MaxLength * Direction) > MinPrefix)
+                {
+                    MaxLength *= 2;
+                }
+                int32_t Length = 0;
+                for (int32_t Step = MaxLength / 2; Step > 0; Step /= 2)
+                {
+                    if (CommonPrefix(Node, Node + (Length + Step) * Direction) > MinPrefix)
+                    {
+                        Length += Step;
+                    }
+                }
+                const int32_t Other = Node + Length * Direction;
+
+                // Binary search for the split, the last leaf sharing more than the range's common prefix with Node
+                const int32_t NodePrefix = CommonPrefix(Node, Other);
+                int32_t Split = 0;
+                int32_t Step = Length;
+                do
+                {
+                    Step = (Step + 1) / 2;
+                    if (CommonPrefix(Node, Node + (Split + Step) * Direction) > NodePrefix)
+                    {
+                        Split += Step;
+                    }
+                } while (Step > 1);
+                const int32_t Gamma = Node + Split * Direction + FMath::Min(Direction, 0);
+
+                const int32_t Left = FMath::Min(Node, Other) == Gamma ? NumInternalNodes + Gamma : Gamma;
+                const int32_t Right = FMath::Max(Node, Other) == Gamma + 1 ? NumInternalNodes + Gamma + 1 : Gamma + 1;
+                Nodes[Node].LeftChild = Left;
+                Nodes[Node].RightChild = Right;
+            }
+        }, MinBatchSize / 4);
+
+    FJobSystem::Get().ParallelForRange(NumPrimitives, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Leaf = Begin; Leaf < End; ++Leaf)
+            {
+                FBvhNode& Node = Nodes[NumInternalNodes + Leaf];
+                Node.LeftChild = (int32_t)(uint32_t)Keys[Leaf];
+                Node.RightChild = -1;
+            }
+        }, MinBatchSize);
+}
+
+void FLinearBvh::ComputeNodeBounds(const FBox* PrimitiveBounds)
+{
+    SCOPED_CPU_TIMER("FLinearBvh::ComputeNodeBounds");
+
+    // Splits the top of the tree breadth first until there are enough subtrees to keep every thread busy
+    TopNodes.clear();
+    SubtreeRoots.assign(1, 0);
+    const int32_t NumSubtrees = FJobSystem::Get().GetNumThreads() * 8;
+    for (size_t Next = 0; Next < SubtreeRoots.size() && (int32_t)(SubtreeRoots.size() - Next) < NumSubtrees; )
+    {
+        const int32_t Node = SubtreeRoots[Next];
+        if (Nodes[Node].IsLeaf())
+        {
+            ++Next;
+            continue;
+        }
+        TopNodes.push_back(Node);
+        SubtreeRoots.erase(SubtreeRoots.begin() + Next);
+        SubtreeRoots.push_back(Nodes[Node].LeftChild);
+        SubtreeRoots.push_back(Nodes[Node].RightChild);
+    }
+
+    // Post-order walk per subtree. The children of an internal node sit next to each other and the
+    // leaves of a subtree are contiguous, so this streams through memory without any synchronization
+    FJobSystem::Get().ParallelFor((int32_t)SubtreeRoots.size(), [&](int32_t SubtreeIndex)
+        {
+            const auto UpdateLeaf = [&](FBvhNode& Leaf)
+            {
+                const FBox& Bounds = PrimitiveBounds[Leaf.LeftChild];
+                Leaf.BoundsMin = Bounds.Min;
+                Leaf.BoundsMax = Bounds.Max;
+            };
+
+            const int32_t Root = SubtreeRoots[SubtreeIndex];
+            if (Nodes[Root].IsLeaf())
+            {
+                UpdateLeaf(Nodes[Root]);
+                return;
+            }
+
+            // Internal nodes only, the sign marks nodes whose children are done
+            int32_t Stack[MaxTraversalDepth * 2];
+            int32_t StackSize = 0;
+            Stack[StackSize++] = Root + 1;
+            while (StackSize > 0)
+            {
+                const int32_t Entry = Stack[--StackSize];
+                if (Entry > 0)
+                {
+                    const int32_t Node = Entry - 1;
+                    Stack[StackSize++] = -Entry;
+                    for (const int32_t Child : { Nodes[Node].RightChild, Nodes[Node].LeftChild })
+                    {
+                        if (Nodes[Child].IsLeaf())
+                        {
+                            UpdateLeaf(Nodes[Child]);
+                        }
+                        else
+                        {
+                            Stack[StackSize++] = Child + 1;
+                        }
+                    }
+                }
+                else
+                {
+                    FBvhNode& Parent = Nodes[-Entry - 1];
+                    const FBvhNode& Left = Nodes[Parent.LeftChild];
+                    const FBvhNode& Right = Nodes[Parent.RightChild];
+                    Parent.BoundsMin = Left.BoundsMin.ComponentMin(Right.BoundsMin);
+                    Parent.BoundsMax = Left.BoundsMax.ComponentMax(Right.BoundsMax);
+                }
+            }
+        });
+
+    // Breadth first order has children after their parents
+    for (auto It = TopNodes.rbegin(); It != TopNodes.rend(); ++It)
+    {
+        FBvhNode& Parent = Nodes[*It];
+        const FBvhNode& Left = Nodes[Parent.LeftChild];
+        const FBvhNode& Right = Nodes[Parent.RightChild];
+        Parent.BoundsMin = Left.BoundsMin.ComponentMin(Right.BoundsMin);
+        Parent.BoundsMax = Left.BoundsMax.ComponentMax(Right.BoundsMax);
+    }
+}
+
+FBox FLinearBvh::GetBounds() const
+{
+    return NumPrimitives > 0 ? Nodes[0].GetBounds() : FBox();
+}
+
+void FLinearBvh::QueryOverlaps(const FBox& Box, std::vector<int32_t>& OutPrimitiveIndices) const
+{
+    if (NumPrimitives == 0)
+    {
+        return;
+    }
+
+    int32_t Stack[MaxTraversalDepth];
+    int32_t StackSize = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const FBvhNode& Node = Nodes[Stack[--StackSize]];
+        if (!Box.Intersect(FBox(Node.BoundsMin, Node.BoundsMax)))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            OutPrimitiveIndices.push_back(Node.GetPrimitiveIndex());
+        }
+        else
+        {
+            Stack[StackSize++] = Node.RightChild;
+            Stack[StackSize++] = Node.LeftChild;
+        }
+    }
+}
+
+void FLinearBvh::QueryRay(const MVector& Start, const MVector& End, std::vector<int32_t>& OutPrimitiveIndices) const
+{
+    if (NumPrimitives == 0)
+    {
+        return;
+    }
+
+    // Slab test against the segment parametrized over [0, 1], axis parallel segments give infinite
+    // reciprocals which the min/max below handle (NaN only for a zero length axis on a slab plane)
+    const MVector Direction = End - Start;
+    const MVector InvDirection(1.0f / Direction.x, 1.0f / Direction.y, 1.0f / Direction.z);
+    const auto HitsBounds = [&](const FBvhNode& Node)
+    {
+        const MVector T0 = (Node.BoundsMin - Start) * InvDirection;
+        const MVector T1 = (Node.BoundsMax - Start) * InvDirection;
+        const MVector TNear = T0.ComponentMin(T1);
+        const MVector TFar = T0.ComponentMax(T1);
+        const float Enter = FMath::Max(FMath::Max(TNear.x, TNear.y), FMath::Max(TNear.z, 0.0f));
+        const float Exit = FMath::Min(FMath::Min(TFar.x, TFar.y), FMath::Min(TFar.z, 1.0f));
+        return Enter <= Exit;
+    };
+
+    int32_t Stack[MaxTraversalDepth];
+    int32_t StackSize = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const FBvhNode& Node = Nodes[Stack[--StackSize]];
+        if (!HitsBounds(Node))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            OutPrimitiveIndices.push_back(Node.GetPrimitiveIndex());
+        }
+        else
+        {
+            Stack[StackSize++] = Node.RightChild;
+            Stack[StackSize++] = Node.LeftChild;
+        }
+    }
+}
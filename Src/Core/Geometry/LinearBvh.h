@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Box.h"
+
+/** FLinearBvh node, a leaf when RightChild is negative. */
+struct FBvhNode
+{
+    MVector BoundsMin;
+    /** Left child node, or the primitive index for leaves. */
+    int32_t LeftChild;
+    MVector BoundsMax;
+    int32_t RightChild;
+
+    bool IsLeaf() const { return RightChild < 0; }
+    int32_t GetPrimitiveIndex() const { return LeftChild; }
+    FBox GetBounds() const { return FBox(BoundsMin, BoundsMax); }
+};
+
+/**
+ * Linear BVH over an array of primitive bounds (Karras, "Maximizing Parallelism in the Construction
+ * of BVHs, Octrees, and k-d Trees"). Centroids are sorted along a 30 bit Morton curve and every
+ * internal node is emitted independently, so each step of the build runs on the job system.
+ *
+ * Node 0 is the root. Internal nodes come first, the NumPrimitives leaves follow in Morton order.
+ * The tree is binary and one primitive per leaf, which builds fast but traverses slower than an
+ * SAH tree; use it for scenes that change every frame.
+ */
+class CORE_API FLinearBvh
+{
+public:
+    FLinearBvh();
+
+    /** Rebuilds the tree, primitive indices returned by queries index into PrimitiveBounds. */
+    void Build(const FBox* PrimitiveBounds, int32_t InNumPrimitives);
+
+    /**
+     * Recomputes the node bounds from moved primitives and keeps the topology. PrimitiveBounds must
+     * hold as many boxes as the last Build, queries stay correct but slow down as primitives drift
+     * from where they were at build time.
+     */
+    void Refit(const FBox* PrimitiveBounds);
+
+    /** Appends the primitives whose bounds intersect Box. */
+    void QueryOverlaps(const FBox& Box, std::vector<int32_t>& OutPrimitiveIndices) const;
+
+    /** Appends the primitives whose bounds the segment from Start to End passes through. */
+    void QueryRay(const MVector& Start, const MVector& End, std::vector<int32_t>& OutPrimitiveIndices) const;
+
+    int32_t GetNumPrimitives() const { return NumPrimitives; }
+    const std::vector<FBvhNode>& GetNodes() const { return Nodes; }
+
+    /** Bounds of all primitives, invalid when empty. */
+    FBox GetBounds() const;
+
+private:
+    void ComputeMortonKeys(const FBox* PrimitiveBounds);
+    void SortMortonKeys();
+    void EmitHierarchy();
+    void ComputeNodeBounds(const FBox* PrimitiveBounds);
+
+private:
+    int32_t NumPrimitives;
+    std::vector<FBvhNode> Nodes;
+
+    /** Morton code in the high 32 bits, primitive index in the low ones, which makes every key unique. */
+    std::vector<uint64_t> MortonKeys;
+    std::vector<uint64_t> SortScratch;
+
+    /** Bounds are computed per subtree in parallel, then for the nodes above them. */
+    std::vector<int32_t> TopNodes;
+    std::vector<int32_t> SubtreeRoots;
+};
@@ -0,0 +1,471 @@
+#include "WideBvh.h"
+
+#include "Async/JobSystem.h"
+#include "Profiler/CpuProfiler.h"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr int32_t NumBins = 16;
+    // Ranges this small become leaves without looking for a split, larger ones up to MaxLeafSize if SAH says so
+    constexpr int32_t MinLeafSize = 2;
+    constexpr int32_t MaxLeafSize = 8;
+    // SAH cost of visiting a node relative to intersecting one primitive
+    constexpr float TraversalCost = 1.0f;
+    // Binary splits below this depth fall back to median splits, which bounds the traversal stacks
+    constexpr int32_t MaxSahDepth = 64;
+    // Ranges this large are binned on the job system
+    constexpr int32_t MinParallelBinning = 1 << 16;
+
+    /** Box without a validity flag, empty while Min > Max. */
+    struct FBuildBounds
+    {
+        MVector Min = MVector(FLT_MAX);
+        MVector Max = MVector(-FLT_MAX);
+
+        void Add(const MVector& InMin, const MVector& InMax)
+        {
+            Min = Min.ComponentMin(InMin);
+            Max = Max.ComponentMax(InMax);
+        }
+
+        void Add(const FBuildBounds& Other)
+        {
+            Add(Other.Min, Other.Max);
+        }
+
+        float GetHalfSurfaceArea() const
+        {
+            if (Min.x > Max.x)
+            {
+                return 0.0f;
+            }
+            const MVector Size = Max - Min;
+            return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+        }
+    };
+
+    struct FBuildPrimitive
+    {
+        MVector BoundsMin;
+        int32_t Index;
+        MVector BoundsMax;
+
+        /** Twice the centroid, the factor doesn't matter for binning. */
+        MVector GetCentroid() const { return BoundsMin + BoundsMax; }
+    };
+
+    struct FBuildRange
+    {
+        int32_t Begin = 0;
+        int32_t End = 0;
+        /** Binary splits above this range. */
+        int32_t Depth = 0;
+        /** Set once SAH decided against splitting. */
+        bool bLeaf = false;
+        FBuildBounds Bounds{};
+        FBuildBounds CentroidBounds{};
+
+        int32_t GetNum() const { return End - Begin; }
+    };
+
+    struct FBin
+    {
+        FBuildBounds Bounds;
+        int32_t Count = 0;
+    };
+
+    using FBins = FBin[3][NumBins];
+
+    /**
+     * Maps centroids of a range to bins, the same mapping is used for binning and partitioning.
+     * Small ranges use fewer bins, which costs them nothing in split quality.
+     */
+    struct FBinMapping
+    {
+        MVector Origin;
+        MVector Scale;
+        int32_t NumUsedBins;
+
+        FBinMapping(const FBuildBounds& CentroidBounds, int32_t NumPrimitives)
+            : Origin(CentroidBounds.Min), NumUsedBins(FMath::Min(NumPrimitives, NumBins))
+        {
+            const MVector Size = CentroidBounds.Max - CentroidBounds.Min;
+            for (int32_t Axis = 0; Axis < 3; ++Axis)
+            {
+                Scale[Axis] = Size[Axis] > 0.0f ? NumUsedBins * 0.9999f / Size[Axis] : 0.0f;
+            }
+        }
+
+        int32_t GetBin(const MVector& Centroid, int32_t Axis) const
+        {
+            return FMath::Clamp((int32_t)((Centroid[Axis] - Origin[Axis]) * Scale[Axis]), 0, NumUsedBins - 1);
+        }
+    };
+
+    void BinPrimitives(const FBuildPrimitive* Primitives, int32_t Begin, int32_t End, const FBinMapping& Mapping, FBins& OutBins)
+    {
+        for (int32_t Index = Begin; Index < End; ++Index)
+        {
+            const FBuildPrimitive& Primitive = Primitives[Index];
+            const MVector Centroid = Primitive.GetCentroid();
+            for (int32_t Axis = 0; Axis < 3; ++Axis)
+            {
+                FBin& Bin = OutBins[Axis][Mapping.GetBin(Centroid, Axis)];
+                Bin.Bounds.Add(Primitive.BoundsMin, Primitive.BoundsMax);
+                ++Bin.Count;
+            }
+        }
+    }
+
+    /** Splits the range in two halves of the same size along the longest centroid axis. */
+    void SplitMedian(FBuildPrimitive* Primitives, const FBuildRange& Range, FBuildRange& OutLeft, FBuildRange& OutRight)
+    {
+        const MVector Size = Range.CentroidBounds.Max - Range.CentroidBounds.Min;
+        const int32_t Axis = Size.x >= Size.y && Size.x >= Size.z ? 0 : (Size.y >= Size.z ? 1 : 2);
+        const int32_t Middle = Range.Begin + Range.GetNum() / 2;
+        if (Size[Axis] > 0.0f)
+        {
+            std::nth_element(Primitives + Range.Begin, Primitives + Middle, Primitives + Range.End, [Axis](const FBuildPrimitive& A, const FBuildPrimitive& B)
+                {
+                    return A.GetCentroid()[Axis] < B.GetCentroid()[Axis];
+                });
+        }
+
+        OutLeft = { Range.Begin, Middle, Range.Depth + 1, false };
+        OutRight = { Middle, Range.End, Range.Depth + 1, false };
+        for (FBuildRange* Half : { &OutLeft, &OutRight })
+        {
+            for (int32_t Index = Half->Begin; Index < Half->End; ++Index)
+            {
+                const FBuildPrimitive& Primitive = Primitives[Index];
+                const MVector Centroid = Primitive.GetCentroid();
+                Half->Bounds.Add(Primitive.BoundsMin, Primitive.BoundsMax);
+                Half->CentroidBounds.Add(Centroid, Centroid);
+            }
+        }
+    }
+
+    /** Partitions the range at the cheapest binned SAH split, returns false if it should stay a leaf. */
+    bool SplitRange(FBuildPrimitive* Primitives, const FBuildRange& Range, FBuildRange& OutLeft, FBuildRange& OutRight)
+    {
+        const int32_t Num = Range.GetNum();
+        if (Num <= MinLeafSize)
+        {
+            return false;
+        }
+
+        const MVector CentroidSize = Range.CentroidBounds.Max - Range.CentroidBounds.Min;
+        const bool bCanBin = CentroidSize.x > 0.0f || CentroidSize.y > 0.0f || CentroidSize.z > 0.0f;
+        if (!bCanBin || Range.Depth >= MaxSahDepth)
+        {
+            // Nothing to tell the primitives apart (or too deep), only split what doesn't fit a leaf
+            if (Num <= MaxLeafSize)
+            {
+                return false;
+            }
+            SplitMedian(Primitives, Range, OutLeft, OutRight);
+            return true;
+        }
+
+        const FBinMapping Mapping(Range.CentroidBounds, Num);
+        FBins Bins;
+        if (Num >= MinParallelBinning && FJobSystem::Get().GetNumThreads() > 1)
+        {
+            const int32_t NumChunks = FMath::Min(FJobSystem::Get().GetNumThreads() * 4, Num / (MinParallelBinning / 16));
+            std::vector<FBins> ChunkBins(NumChunks);
+            FJobSystem::Get().ParallelFor(NumChunks, [&](int32_t Chunk)
+                {
+                    const int32_t Begin = Range.Begin + (int32_t)((int64_t)Num * Chunk / NumChunks);
+                    const int32_t End = Range.Begin + (int32_t)((int64_t)Num * (Chunk + 1) / NumChunks);
+                    BinPrimitives(Primitives, Begin, End, Mapping, ChunkBins[Chunk]);
+                });
+
+            for (const FBins& Chunk : ChunkBins)
+            {
+                for (int32_t Axis = 0; Axis < 3; ++Axis)
+                {
+                    for (int32_t Bin = 0; Bin < NumBins; ++Bin)
+                    {
+                        Bins[Axis][Bin].Bounds.Add(Chunk[Axis][Bin].Bounds);
+                        Bins[Axis][Bin].Count += Chunk[Axis][Bin].Count;
+                    }
+                }
+            }
+        }
+        else
+        {
+            BinPrimitives(Primitives, Range.Begin, Range.End, Mapping, Bins);
+        }
+
+        // Sweep from the right to get the cost of the right side of every split, then from the left
+        float BestCost = FLT_MAX;
+        int32_t BestAxis = -1;
+        int32_t BestSplit = 0;
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            float RightCosts[NumBins];
+            FBuildBounds Right;
+            int32_t RightCount = 0;
+            for (int32_t Bin = Mapping.NumUsedBins - 1; Bin > 0; --Bin)
+            {
+                Right.Add(Bins[Axis][Bin].Bounds);
+                RightCount += Bins[Axis][Bin].Count;
+                RightCosts[Bin] = RightCount > 0 ? Right.GetHalfSurfaceArea() * RightCount : -1.0f;
+            }
+
+            FBuildBounds Left;
+            int32_t LeftCount = 0;
+            for (int32_t Split = 0; Split < Mapping.NumUsedBins - 1; ++Split)
+            {
+                Left.Add(Bins[Axis][Split].Bounds);
+                LeftCount += Bins[Axis][Split].Count;
+                if (LeftCount == 0 || RightCosts[Split + 1] < 0.0f)
+                {
+                    continue;
+                }
+
+                const float Cost = Left.GetHalfSurfaceArea() * LeftCount + RightCosts[Split + 1];
+                if (Cost < BestCost)
+                {
+                    BestCost = Cost;
+                    BestAxis = Axis;
+                    BestSplit = Split;
+                }
+            }
+        }
+
+        if (BestAxis < 0)
+        {
+            if (Num <= MaxLeafSize)
+            {
+                return false;
+            }
+            SplitMedian(Primitives, Range, OutLeft, OutRight);
+            return true;
+        }
+
+        const float Area = Range.Bounds.GetHalfSurfaceArea();
+        if (Num <= MaxLeafSize && Area * Num <= TraversalCost * Area + BestCost)
+        {
+            return false;
+        }
+
+        // Hoare partition, the centroid bounds of both sides are gathered on the way
+        FBuildBounds LeftCentroids;
+        FBuildBounds RightCentroids;
+        int32_t Left = Range.Begin;
+        int32_t Right = Range.End - 1;
+        while (true)
+        {
+            MVector Centroid;
+            while (Left <= Right && Mapping.GetBin(Centroid = Primitives[Left].GetCentroid(), BestAxis) <= BestSplit)
+            {
+                LeftCentroids.Add(Centroid, Centroid);
+                ++Left;
+            }
+            while (Left <= Right && Mapping.GetBin(Centroid = Primitives[Right].GetCentroid(), BestAxis) > BestSplit)
+            {
+                RightCentroids.Add(Centroid, Centroid);
+                --Right;
+            }
+            if (Left > Right)
+            {
+                break;
+            }
+            std::swap(Primitives[Left], Primitives[Right]);
+        }
+
+        OutLeft = { Range.Begin, Left, Range.Depth + 1, false };
+        OutRight = { Left, Range.End, Range.Depth + 1, false };
+        OutLeft.CentroidBounds = LeftCentroids;
+        OutRight.CentroidBounds = RightCentroids;
+        for (int32_t Bin = 0; Bin < Mapping.NumUsedBins; ++Bin)
+        {
+            (Bin <= BestSplit ? OutLeft : OutRight).Bounds.Add(Bins[BestAxis][Bin].Bounds);
+        }
+        return true;
+    }
+
+    /** A child node whose subtree is built as its own job. */
+    struct FSubtreeTask
+    {
+        int32_t Parent = 0;
+        int32_t Lane = 0;
+        FBuildRange Ranges[2]{};
+        std::vector<FWideBvhNode> Nodes{};
+    };
+
+    /**
+     * Fills Nodes[NodeIndex] from its first children, splitting the largest child until the node
+     * is full, and recurses depth first. With Tasks set, children at TaskDepth are left for jobs.
+     */
+    void BuildNode(FBuildPrimitive* Primitives, FBuildRange* Ranges, int32_t NumRanges, int32_t NodeIndex, int32_t Depth, std::vector<FWideBvhNode>& Nodes, std::vector<FSubtreeTask>* Tasks, int32_t TaskDepth)
+    {
+        constexpr int32_t Lanes = FWideBvhNode::Lanes;
+
+        FBuildRange Children[Lanes];
+        std::copy(Ranges, Ranges + NumRanges, Children);
+        int32_t NumChildren = NumRanges;
+        while (NumChildren < Lanes)
+        {
+            int32_t Largest = -1;
+            float LargestArea = -1.0f;
+            for (int32_t Child = 0; Child < NumChildren; ++Child)
+            {
+                const float Area = Children[Child].Bounds.GetHalfSurfaceArea();
+                if (!Children[Child].bLeaf && Area > LargestArea)
+                {
+                    Largest = Child;
+                    LargestArea = Area;
+                }
+            }
+
+            if (Largest < 0)
+            {
+                break;
+            }
+
+            FBuildRange Left;
+            FBuildRange Right;
+            if (SplitRange(Primitives, Children[Largest], Left, Right))
+            {
+                Children[Largest] = Left;
+                Children[NumChildren++] = Right;
+            }
+            else
+            {
+                Children[Largest].bLeaf = true;
+            }
+        }
+
+        FWideBvhNode Node = {};
+        Node.NumChildren = NumChildren;
+        for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+        {
+            Node.Children[Lane] = -1;
+        }
+
+        for (int32_t Lane = 0; Lane < NumChildren; ++Lane)
+        {
+            const FBuildRange& Child = Children[Lane];
+            for (int32_t Axis = 0; Axis < 3; ++Axis)
+            {
+                Node.Bounds[Axis][Lane] = Child.Bounds.Min[Axis];
+                Node.Bounds[Axis + 3][Lane] = Child.Bounds.Max[Axis];
+            }
+
+            FBuildRange Grandchildren[2];
+            if (Child.bLeaf || !SplitRange(Primitives, Child, Grandchildren[0], Grandchildren[1]))
+            {
+                Node.Children[Lane] = Child.Begin;
+                Node.NumPrimitives[Lane] = Child.GetNum();
+            }
+            else if (Tasks && Depth + 1 >= TaskDepth)
+            {
+                Tasks->push_back({ NodeIndex, Lane, { Grandchildren[0], Grandchildren[1] } });
+            }
+            else
+            {
+                Node.Children[Lane] = (int32_t)Nodes.size();
+                Nodes.emplace_back();
+                BuildNode(Primitives, Grandchildren, 2, Node.Children[Lane], Depth + 1, Nodes, Tasks, TaskDepth);
+            }
+        }
+
+        Nodes[NodeIndex] = Node;
+    }
+}
+
+FWideBvh::FWideBvh()
+{
+}
+
+void FWideBvh::Build(const FBox* PrimitiveBounds, int32_t InNumPrimitives)
+{
+    SCOPED_CPU_TIMER("FWideBvh::Build");
+
+    const int32_t NumPrimitives = FMath::Max(InNumPrimitives, 0);
+    Nodes.clear();
+    PrimitiveIndices.resize(NumPrimitives);
+    Bounds = FBox();
+    if (NumPrimitives == 0)
+    {
+        return;
+    }
+
+    std::vector<FBuildPrimitive> Primitives(NumPrimitives);
+    FJobSystem::Get().ParallelForRange(NumPrimitives, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Index = Begin; Index < End; ++Index)
+            {
+                Primitives[Index] = { PrimitiveBounds[Index].Min, Index, PrimitiveBounds[Index].Max };
+            }
+        }, 4096);
+
+    FBuildRange Root = { 0, NumPrimitives, 0, false };
+    for (const FBuildPrimitive& Primitive : Primitives)
+    {
+        const MVector Centroid = Primitive.GetCentroid();
+        Root.Bounds.Add(Primitive.BoundsMin, Primitive.BoundsMax);
+        Root.CentroidBounds.Add(Centroid, Centroid);
+    }
+    Bounds = FBox(Root.Bounds.Min, Root.Bounds.Max);
+
+    // The top levels are built here until there is about four subtrees per thread, these are then built as jobs
+    std::vector<FSubtreeTask> Tasks;
+    const int32_t NumThreads = FJobSystem::Get().GetNumThreads();
+    int32_t TaskDepth = 1;
+    for (int32_t NumSubtrees = Lanes; NumSubtrees < NumThreads * 4; NumSubtrees *= Lanes)
+    {
+        ++TaskDepth;
+    }
+
+    Nodes.emplace_back();
+    BuildNode(Primitives.data(), &Root, 1, 0, 0, Nodes, NumThreads > 1 ? &Tasks : nullptr, TaskDepth);
+
+    FJobSystem::Get().ParallelFor((int32_t)Tasks.size(), [&](int32_t TaskIndex)
+        {
+            FSubtreeTask& Task = Tasks[TaskIndex];
+            Task.Nodes.emplace_back();
+            BuildNode(Primitives.data(), Task.Ranges, 2, 0, 0, Task.Nodes, nullptr, 0);
+        });
+
+    // Append the subtrees in task order, which keeps the result independent of scheduling
+    std::vector<int32_t> Offsets(Tasks.size());
+    int32_t NumNodes = (int32_t)Nodes.size();
+    for (size_t TaskIndex = 0; TaskIndex < Tasks.size(); ++TaskIndex)
+    {
+        Offsets[TaskIndex] = NumNodes;
+        Nodes[Tasks[TaskIndex].Parent].Children[Tasks[TaskIndex].Lane] = NumNodes;
+        NumNodes += (int32_t)Tasks[TaskIndex].Nodes.size();
+    }
+    Nodes.resize(NumNodes);
+
+    FJobSystem::Get().ParallelFor((int32_t)Tasks.size(), [&](int32_t TaskIndex)
+        {
+            const int32_t Offset = Offsets[TaskIndex];
+            const std::vector<FWideBvhNode>& TaskNodes = Tasks[TaskIndex].Nodes;
+            for (size_t Index = 0; Index < TaskNodes.size(); ++Index)
+            {
+                FWideBvhNode& Node = Nodes[Offset + Index];
+                Node = TaskNodes[Index];
+                for (int32_t Lane = 0; Lane < Node.NumChildren; ++Lane)
+                {
+                    if (!Node.IsLeaf(Lane))
+                    {
+                        Node.Children[Lane] += Offset;
+                    }
+                }
+            }
+        });
+
+    FJobSystem::Get().ParallelForRange(NumPrimitives, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Index = Begin; Index < End; ++Index)
+            {
+                PrimitiveIndices[Index] = Primitives[Index].Index;
+            }
+        }, 4096);
+}
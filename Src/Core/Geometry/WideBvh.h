@@ -0,0 +1,378 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Box.h"
+#include "Base/MathUtil.h"
+
+/**
+ * FWideBvh node holding the bounds of up to Lanes children side by side, so one FFloatWide slab
+ * test covers all of them. Bounds[0..2] are the min x, y, z rows and Bounds[3..5] the max rows.
+ */
+struct alignas(32) FWideBvhNode
+{
+    static constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    float Bounds[6][Lanes];
+    /** Child node index, or the first entry in the primitive index array for leaves. */
+    int32_t Children[Lanes];
+    /** Primitive count of leaf children, 0 for child nodes. */
+    int32_t NumPrimitives[Lanes];
+    /** Children occupy lanes [0, NumChildren). */
+    int32_t NumChildren;
+
+    bool IsLeaf(int32_t Lane) const { return NumPrimitives[Lane] > 0; }
+
+    FBox GetChildBounds(int32_t Lane) const
+    {
+        return FBox(MVector(Bounds[0][Lane], Bounds[1][Lane], Bounds[2][Lane]), MVector(Bounds[3][Lane], Bounds[4][Lane], Bounds[5][Lane]));
+    }
+};
+
+/**
+ * Bounding volume hierarchy with FFloatWide::Lanes (4 or 8) children per node, built top down with
+ * binned SAH. Each node is made by splitting its largest child until it has Lanes children, the
+ * first levels are built serially and the subtrees below them as parallel jobs.
+ *
+ * Slower to build than FLinearBvh but much faster to query, use it for static scenes that are
+ * raycast many times (picking, visibility). Queries run a callback on the primitives in the leaves
+ * the rays reach, so the tree works for any primitive that has bounds.
+ */
+class CORE_API FWideBvh
+{
+public:
+    static constexpr int32_t Lanes = FFloatWide::Lanes;
+
+    FWideBvh();
+
+    /** Rebuilds the tree, primitive indices passed to the hit functions index into PrimitiveBounds. */
+    void Build(const FBox* PrimitiveBounds, int32_t InNumPrimitives);
+
+    /**
+     * Closest hit along the segment from Start to End. HitFunction(int32_t PrimitiveIndex, float& InOutHitTime)
+     * intersects one primitive, and when it is hit before InOutHitTime (a fraction of the segment)
+     * lowers InOutHitTime and returns true.
+     * @return the primitive hit first, -1 if none
+     */
+    template<typename THitFunction>
+    int32_t Raycast(const MVector& Start, const MVector& End, THitFunction&& HitFunction, float* OutHitTime = nullptr) const;
+
+    /** Whether anything is hit along the segment, stops at the first hit. HitFunction(int32_t PrimitiveIndex) returns true on a hit. */
+    template<typename THitFunction>
+    bool RaycastAny(const MVector& Start, const MVector& End, THitFunction&& HitFunction) const;
+
+    /**
+     * Closest hits of NumRays segments, traced Lanes at a time: every node is loaded once for the
+     * whole packet, which pays off for coherent rays such as the pixels of a screen tile.
+     * HitFunction(int32_t PrimitiveIndex, int32_t RayIndex, float& InOutHitTime) works as in Raycast.
+     * OutHitTimes may be null, rays that hit nothing get -1 and a time of 1.
+     */
+    template<typename THitFunction>
+    void RaycastPacket(const MVector* Starts, const MVector* Ends, int32_t NumRays, THitFunction&& HitFunction, int32_t* OutPrimitiveIndices, float* OutHitTimes = nullptr) const;
+
+    /**
+     * Appends the primitives overlapping Box. The tree only knows the bounds of its leaves, so
+     * OverlapFunction(int32_t PrimitiveIndex) tests each primitive in a leaf Box reaches and returns
+     * true when it overlaps, typically PrimitiveBounds[PrimitiveIndex].Intersect(Box).
+     */
+    template<typename TOverlapFunction>
+    void QueryOverlaps(const FBox& Box, TOverlapFunction&& OverlapFunction, std::vector<int32_t>& OutPrimitiveIndices) const;
+
+    int32_t GetNumPrimitives() const { return (int32_t)PrimitiveIndices.size(); }
+    const std::vector<FWideBvhNode>& GetNodes() const { return Nodes; }
+
+    /** Leaves reference ranges of this array, which holds indices into the bounds passed to Build. */
+    const std::vector<int32_t>& GetPrimitiveIndices() const { return PrimitiveIndices; }
+
+    /** Bounds of all primitives, invalid when empty. */
+    FBox GetBounds() const { return Bounds; }
+
+private:
+    /** Enough for the deepest tree the build makes, see MaxSahDepth in the cpp. */
+    static constexpr int32_t MaxStackSize = 96 * (Lanes - 1) + 1;
+
+    struct FStackEntry
+    {
+        int32_t Node;
+        float Time;
+    };
+
+    /** Per segment constants of the slab test, the near and far rows depend on the direction signs. */
+    struct FRay
+    {
+        FFloatWide Origin[3];
+        FFloatWide Scale[3];
+        int32_t NearRow[3];
+
+        FRay(const MVector& Start, const MVector& End)
+        {
+            const MVector Direction = End - Start;
+            for (int32_t Axis = 0; Axis < 3; ++Axis)
+            {
+                const float InvDirection = 1.0f / Direction[Axis];
+                Origin[Axis] = FFloatWide(Start[Axis]);
+                Scale[Axis] = FFloatWide(InvDirection);
+                NearRow[Axis] = InvDirection >= 0.0f ? Axis : Axis + 3;
+            }
+        }
+
+        /**
+         * Entry times of the children hit before MaxTime, returns the mask of those children. Axis
+         * parallel segments give infinite scales, NaN only for a bound lying exactly on the start.
+         */
+        uint32_t Intersect(const FWideBvhNode& Node, float MaxTime, FFloatWide& OutTimes) const
+        {
+            FFloatWide Enter(0.0f);
+            FFloatWide Exit(MaxTime);
+            for (int32_t Axis = 0; Axis < 3; ++Axis)
+            {
+                const int32_t FarRow = NearRow[Axis] < 3 ? Axis + 3 : Axis;
+                Enter = FFloatWide::Max(Enter, (FFloatWide::Load(Node.Bounds[NearRow[Axis]]) - Origin[Axis]) * Scale[Axis]);
+                Exit = FFloatWide::Min(Exit, (FFloatWide::Load(Node.Bounds[FarRow]) - Origin[Axis]) * Scale[Axis]);
+            }
+            OutTimes = Enter;
+            return (Enter <= Exit).GetBits() & ((1u << Node.NumChildren) - 1);
+        }
+    };
+
+private:
+    std::vector<FWideBvhNode> Nodes;
+    std::vector<int32_t> PrimitiveIndices;
+    FBox Bounds;
+};
+
+template<typename THitFunction>
+int32_t FWideBvh::Raycast(const MVector& Start, const MVector& End, THitFunction&& HitFunction, float* OutHitTime) const
+{
+    int32_t HitPrimitive = -1;
+    float HitTime = 1.0f;
+    if (Nodes.empty())
+    {
+        if (OutHitTime)
+        {
+            *OutHitTime = HitTime;
+        }
+        return HitPrimitive;
+    }
+
+    const FRay Ray(Start, End);
+    FStackEntry Stack[MaxStackSize];
+    int32_t StackSize = 0;
+    Stack[StackSize++] = { 0, 0.0f };
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        if (Entry.Time > HitTime)
+        {
+            continue;
+        }
+
+        const FWideBvhNode& Node = Nodes[Entry.Node];
+        FFloatWide Times;
+        uint32_t HitMask = Ray.Intersect(Node, HitTime, Times);
+        if (HitMask == 0)
+        {
+            continue;
+        }
+
+        alignas(32) float ChildTimes[Lanes];
+        Times.Store(ChildTimes);
+
+        // Leaves right away, child nodes sorted so the nearest is popped first
+        const int32_t FirstPushed = StackSize;
+        while (HitMask != 0)
+        {
+            const int32_t Lane = (int32_t)FMath::CountTrailingZeros(HitMask);
+            HitMask &= HitMask - 1;
+            if (Node.IsLeaf(Lane))
+            {
+                const int32_t* Primitives = PrimitiveIndices.data() + Node.Children[Lane];
+                for (int32_t Index = 0; Index < Node.NumPrimitives[Lane]; ++Index)
+                {
+                    if (HitFunction(Primitives[Index], HitTime))
+                    {
+                        HitPrimitive = Primitives[Index];
+                    }
+                }
+                continue;
+            }
+
+            int32_t Slot = StackSize++;
+            for (; Slot > FirstPushed && Stack[Slot - 1].Time < ChildTimes[Lane]; --Slot)
+            {
+                Stack[Slot] = Stack[Slot - 1];
+            }
+            Stack[Slot] = { Node.Children[Lane], ChildTimes[Lane] };
+        }
+    }
+
+    if (OutHitTime)
+    {
+        *OutHitTime = HitTime;
+    }
+    return HitPrimitive;
+}
+
+template<typename THitFunction>
+bool FWideBvh::RaycastAny(const MVector& Start, const MVector& End, THitFunction&& HitFunction) const
+{
+    if (Nodes.empty())
+    {
+        return false;
+    }
+
+    const FRay Ray(Start, End);
+    int32_t Stack[MaxStackSize];
+    int32_t StackSize = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const FWideBvhNode& Node = Nodes[Stack[--StackSize]];
+        FFloatWide Times;
+        uint32_t HitMask = Ray.Intersect(Node, 1.0f, Times);
+        while (HitMask != 0)
+        {
+            const int32_t Lane = (int32_t)FMath::CountTrailingZeros(HitMask);
+            HitMask &= HitMask - 1;
+            if (!Node.IsLeaf(Lane))
+            {
+                Stack[StackSize++] = Node.Children[Lane];
+                continue;
+            }
+
+            const int32_t* Primitives = PrimitiveIndices.data() + Node.Children[Lane];
+            for (int32_t Index = 0; Index < Node.NumPrimitives[Lane]; ++Index)
+            {
+                if (HitFunction(Primitives[Index]))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+template<typename THitFunction>
+void FWideBvh::RaycastPacket(const MVector* Starts, const MVector* Ends, int32_t NumRays, THitFunction&& HitFunction, int32_t* OutPrimitiveIndices, float* OutHitTimes) const
+{
+    for (int32_t First = 0; First < NumRays; First += Lanes)
+    {
+        const int32_t NumPacketRays = FMath::Min(Lanes, NumRays - First);
+        alignas(32) float HitTimes[Lanes];
+        for (int32_t Ray = 0; Ray < NumPacketRays; ++Ray)
+        {
+            HitTimes[Ray] = 1.0f;
+            OutPrimitiveIndices[First + Ray] = -1;
+        }
+
+        if (!Nodes.empty())
+        {
+            // One ray per lane, missing lanes repeat the last ray and are masked out
+            const MVectorWide Start = MVectorWide::Load(Starts + First, NumPacketRays);
+            const MVectorWide Direction = MVectorWide::Load(Ends + First, NumPacketRays) - Start;
+            const FFloatWide Origin[3] = { Start.x, Start.y, Start.z };
+            const FFloatWide Scale[3] = { FFloatWide(1.0f) / Direction.x, FFloatWide(1.0f) / Direction.y, FFloatWide(1.0f) / Direction.z };
+            const uint32_t PacketMask = (1u << NumPacketRays) - 1;
+
+            int32_t Stack[MaxStackSize];
+            int32_t StackSize = 0;
+            Stack[StackSize++] = 0;
+            while (StackSize > 0)
+            {
+                const FWideBvhNode& Node = Nodes[Stack[--StackSize]];
+                const FFloatWide MaxTime = FFloatWide::Load(HitTimes);
+
+                // Children in reverse so the first child is popped first, rays of a packet disagree on front to back order
+                for (int32_t Lane = Node.NumChildren - 1; Lane >= 0; --Lane)
+                {
+                    FFloatWide Enter(0.0f);
+                    FFloatWide Exit = MaxTime;
+                    for (int32_t Axis = 0; Axis < 3; ++Axis)
+                    {
+                        const FFloatWide T0 = (FFloatWide(Node.Bounds[Axis][Lane]) - Origin[Axis]) * Scale[Axis];
+                        const FFloatWide T1 = (FFloatWide(Node.Bounds[Axis + 3][Lane]) - Origin[Axis]) * Scale[Axis];
+                        Enter = FFloatWide::Max(Enter, FFloatWide::Min(T0, T1));
+                        Exit = FFloatWide::Min(Exit, FFloatWide::Max(T0, T1));
+                    }
+
+                    uint32_t RayMask = (Enter <= Exit).GetBits() & PacketMask;
+                    if (RayMask == 0)
+                    {
+                        continue;
+                    }
+
+                    if (!Node.IsLeaf(Lane))
+                    {
+                        Stack[StackSize++] = Node.Children[Lane];
+                        continue;
+                    }
+
+                    const int32_t* Primitives = PrimitiveIndices.data() + Node.Children[Lane];
+                    for (; RayMask != 0; RayMask &= RayMask - 1)
+                    {
+                        const int32_t Ray = (int32_t)FMath::CountTrailingZeros(RayMask);
+                        for (int32_t Index = 0; Index < Node.NumPrimitives[Lane]; ++Index)
+                        {
+                            if (HitFunction(Primitives[Index], First + Ray, HitTimes[Ray]))
+                            {
+                                OutPrimitiveIndices[First + Ray] = Primitives[Index];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (OutHitTimes)
+        {
+            for (int32_t Ray = 0; Ray < NumPacketRays; ++Ray)
+            {
+                OutHitTimes[First + Ray] = HitTimes[Ray];
+            }
+        }
+    }
+}
+
+template<typename TOverlapFunction>
+void FWideBvh::QueryOverlaps(const FBox& Box, TOverlapFunction&& OverlapFunction, std::vector<int32_t>& OutPrimitiveIndices) const
+{
+    if (Nodes.empty())
+    {
+        return;
+    }
+
+    const FFloatWide BoxMin[3] = { Box.Min.x, Box.Min.y, Box.Min.z };
+    const FFloatWide BoxMax[3] = { Box.Max.x, Box.Max.y, Box.Max.z };
+
+    int32_t Stack[MaxStackSize];
+    int32_t StackSize = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const FWideBvhNode& Node = Nodes[Stack[--StackSize]];
+        FMaskWide Overlaps = (FFloatWide::Load(Node.Bounds[0]) <= BoxMax[0]) & (BoxMin[0] <= FFloatWide::Load(Node.Bounds[3]));
+        for (int32_t Axis = 1; Axis < 3; ++Axis)
+        {
+            Overlaps = Overlaps & (FFloatWide::Load(Node.Bounds[Axis]) <= BoxMax[Axis]) & (BoxMin[Axis] <= FFloatWide::Load(Node.Bounds[Axis + 3]));
+        }
+
+        for (uint32_t Mask = Overlaps.GetBits() & ((1u << Node.NumChildren) - 1); Mask != 0; Mask &= Mask - 1)
+        {
+            const int32_t Lane = (int32_t)FMath::CountTrailingZeros(Mask);
+            if (!Node.IsLeaf(Lane))
+            {
+                Stack[StackSize++] = Node.Children[Lane];
+                continue;
+            }
+
+            const int32_t* Primitives = PrimitiveIndices.data() + Node.Children[Lane];
+            for (int32_t Index = 0; Index < Node.NumPrimitives[Lane]; ++Index)
+            {
+                if (OverlapFunction(Primitives[Index]))
+                {
+                    OutPrimitiveIndices.push_back(Primitives[Index]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> NumAllocations(0);
+
+#ifdef MIKASA_COUNT_ALLOCATIONS
+    void* Allocate(size_t Size)
+    {
+        NumAllocations.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(Size != 0 ? Size : 1);
+    }
+
+    void* AllocateAligned(size_t Size, std::align_val_t Alignment)
+    {
+        NumAllocations.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+        return _aligned_malloc(Size != 0 ? Size : 1, (size_t)Alignment);
+#else
+        // aligned_alloc wants a multiple of the alignment
+        const size_t AlignmentMask = (size_t)Alignment - 1;
+        return std::aligned_alloc((size_t)Alignment, ((Size != 0 ? Size : 1) + AlignmentMask) & ~AlignmentMask);
+#endif
+    }
+
+    void Free(void* Memory)
+    {
+        std::free(Memory);
+    }
+
+    void FreeAligned(void* Memory)
+    {
+#ifdef _WIN32
+        _aligned_free(Memory);
+#else
+        std::free(Memory);
+#endif
+    }
+
+    void* AllocateOrThrow(size_t Size)
+    {
+        void* Memory = Allocate(Size);
+        if (Memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return Memory;
+    }
+
+    void* AllocateAlignedOrThrow(size_t Size, std::align_val_t Alignment)
+    {
+        void* Memory = AllocateAligned(Size, Alignment);
+        if (Memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return Memory;
+    }
+#endif // MIKASA_COUNT_ALLOCATIONS
+}
+
+bool FAllocationCounter::IsEnabled()
+{
+#ifdef MIKASA_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t FAllocationCounter::GetNumAllocations()
+{
+    return NumAllocations.load(std::memory_order_relaxed);
+}
+
+#ifdef MIKASA_COUNT_ALLOCATIONS
+void* operator new(size_t Size) { return AllocateOrThrow(Size); }
+void* operator new[](size_t Size) { return AllocateOrThrow(Size); }
+void* operator new(size_t Size, const std::nothrow_t&) noexcept { return Allocate(Size); }
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept { return Allocate(Size); }
+void* operator new(size_t Size, std::align_val_t Alignment) { return AllocateAlignedOrThrow(Size, Alignment); }
+void* operator new[](size_t Size, std::align_val_t Alignment) { return AllocateAlignedOrThrow(Size, Alignment); }
+void* operator new(size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return AllocateAligned(Size, Alignment); }
+void* operator new[](size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return AllocateAligned(Size, Alignment); }
+
+void operator delete(void* Memory) noexcept { Free(Memory); }
+void operator delete[](void* Memory) noexcept { Free(Memory); }
+void operator delete(void* Memory, size_t) noexcept { Free(Memory); }
+void operator delete[](void* Memory, size_t) noexcept { Free(Memory); }
+void operator delete(void* Memory, const std::nothrow_t&) noexcept { Free(Memory); }
+void operator delete[](void* Memory, const std::nothrow_t&) noexcept { Free(Memory); }
+void operator delete(void* Memory, std::align_val_t) noexcept { FreeAligned(Memory); }
+void operator delete[](void* Memory, std::align_val_t) noexcept { FreeAligned(Memory); }
+void operator delete(void* Memory, size_t, std::align_val_t) noexcept { FreeAligned(Memory); }
+void operator delete[](void* Memory, size_t, std::align_val_t) noexcept { FreeAligned(Memory); }
+void operator delete(void* Memory, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(Memory); }
+void operator delete[](void* Memory, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(Memory); }
+#endif // MIKASA_COUNT_ALLOCATIONS
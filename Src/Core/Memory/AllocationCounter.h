@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Process wide count of heap allocations, made by replacing the global operator new and delete in Core
+ * when it is built with MIKASA_COUNT_ALLOCATIONS. Replacements are per module on Windows, there the
+ * count covers allocations made by Core. Without the define nothing is replaced and the count stays 0.
+ */
+class CORE_API FAllocationCounter
+{
+public:
+    static bool IsEnabled();
+
+    /** operator new calls, of every thread, since the program started. */
+    static uint64_t GetNumAllocations();
+};
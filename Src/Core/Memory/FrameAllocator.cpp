@@ -0,0 +1,130 @@
+#include "FrameAllocator.h"
+
+#include <new>
+
+namespace
+{
+    constexpr size_t BufferAlignment = 64;
+
+    uint8_t* AllocateBufferMemory(size_t Size)
+    {
+        return static_cast<uint8_t*>(::operator new(Size, std::align_val_t(BufferAlignment)));
+    }
+
+    void FreeBufferMemory(uint8_t* Memory)
+    {
+        ::operator delete(Memory, std::align_val_t(BufferAlignment));
+    }
+}
+
+FFrameArena::FFrameArena(size_t InitialBufferSize)
+    : CurrentBuffer(0)
+    , NumHeapAllocations(0)
+{
+    for (FBuffer& Buffer : Buffers)
+    {
+        Buffer.Capacity = InitialBufferSize;
+        Buffer.Memory = AllocateBufferMemory(InitialBufferSize);
+        Buffer.Overflow.reserve(64);
+    }
+}
+
+FFrameArena::~FFrameArena()
+{
+    for (FBuffer& Buffer : Buffers)
+    {
+        ResetBuffer(Buffer);
+        FreeBufferMemory(Buffer.Memory);
+    }
+}
+
+void* FFrameArena::Allocate(size_t Size, size_t Alignment)
+{
+    FBuffer& Buffer = Buffers[CurrentBuffer];
+    Buffer.RequestedBytes.fetch_add(Size + Alignment - 1, std::memory_order_relaxed);
+
+    const uintptr_t Base = (uintptr_t)Buffer.Memory;
+    size_t Offset = Buffer.Offset.load(std::memory_order_relaxed);
+    size_t AlignedOffset;
+    do
+    {
+        AlignedOffset = (size_t)(((Base + Offset + Alignment - 1) & ~(uintptr_t)(Alignment - 1)) - Base);
+        if (AlignedOffset + Size > Buffer.Capacity)
+        {
+            return AllocateOverflow(Buffer, Size, Alignment);
+        }
+    } while (!Buffer.Offset.compare_exchange_weak(Offset, AlignedOffset + Size, std::memory_order_relaxed));
+
+    return Buffer.Memory + AlignedOffset;
+}
+
+void FFrameArena::BeginFrame(uint32_t BufferIndex, bool bReset)
+{
+    CurrentBuffer = BufferIndex % NumBuffers;
+    if (!bReset)
+    {
+        return;
+    }
+
+    FBuffer& Buffer = Buffers[CurrentBuffer];
+    const size_t RequestedBytes = Buffer.RequestedBytes.load(std::memory_order_relaxed);
+    ResetBuffer(Buffer);
+
+    // The buffer overflowed the last time it was used, grow it so the next frames fit
+    if (RequestedBytes > Buffer.Capacity)
+    {
+        size_t NewCapacity = Buffer.Capacity;
+        while (NewCapacity < RequestedBytes)
+        {
+            NewCapacity *= 2;
+        }
+
+        FreeBufferMemory(Buffer.Memory);
+        Buffer.Memory = AllocateBufferMemory(NewCapacity);
+        Buffer.Capacity = NewCapacity;
+        NumHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint32_t FFrameArena::GetCurrentBuffer() const
+{
+    return CurrentBuffer;
+}
+
+uint64_t FFrameArena::GetNumHeapAllocations() const
+{
+    return NumHeapAllocations.load(std::memory_order_relaxed);
+}
+
+size_t FFrameArena::GetUsedBytes() const
+{
+    return Buffers[CurrentBuffer].RequestedBytes.load(std::memory_order_relaxed);
+}
+
+size_t FFrameArena::GetCapacity() const
+{
+    return Buffers[CurrentBuffer].Capacity;
+}
+
+void* FFrameArena::AllocateOverflow(FBuffer& Buffer, size_t Size, size_t Alignment)
+{
+    const size_t BlockAlignment = Alignment > BufferAlignment ? Alignment : BufferAlignment;
+    void* Memory = ::operator new(Size, std::align_val_t(BlockAlignment));
+
+    std::lock_guard<std::mutex> Lock(OverflowMutex);
+    Buffer.Overflow.push_back({ Memory, BlockAlignment });
+    NumHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return Memory;
+}
+
+void FFrameArena::ResetBuffer(FBuffer& Buffer)
+{
+    for (const FOverflowBlock& Block : Buffer.Overflow)
+    {
+        ::operator delete(Block.Memory, std::align_val_t(Block.Alignment));
+    }
+    Buffer.Overflow.clear();
+
+    Buffer.Offset.store(0, std::memory_order_relaxed);
+    Buffer.RequestedBytes.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * Per-frame linear allocator with one buffer per frame in flight.
+ * Allocations are a single atomic bump and are never freed individually, a buffer is reset as a whole
+ * when its frame is recycled, which happens once the render thread can no longer reference it.
+ * Requests that do not fit fall back to the heap, and the buffer grows at its next reset,
+ * so steady-state frames do not allocate from the heap at all.
+ */
+class CORE_API FFrameArena
+{
+public:
+    static constexpr uint32_t NumBuffers = 3;
+
+    explicit FFrameArena(size_t InitialBufferSize = 1 << 20);
+    ~FFrameArena();
+
+    FFrameArena(const FFrameArena&) = delete;
+    FFrameArena& operator=(const FFrameArena&) = delete;
+
+    /** Thread safe, the memory stays valid until the buffer's frame is recycled. */
+    void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+    template<typename T, typename... ArgTypes>
+    T* New(ArgTypes&&... Args)
+    {
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<ArgTypes>(Args)...);
+    }
+
+    /**
+     * Switches allocations to BufferIndex and resets it. Must not run concurrently with Allocate(),
+     * the caller guarantees nothing allocated from that buffer is still in use.
+     * With bReset false the buffer keeps its allocations and the new frame allocates behind them,
+     * for buffers whose last frame may still be referenced.
+     */
+    void BeginFrame(uint32_t BufferIndex, bool bReset = true);
+
+    uint32_t GetCurrentBuffer() const;
+
+    /** Heap allocations made since construction, both fallbacks and buffer growth. */
+    uint64_t GetNumHeapAllocations() const;
+
+    /** Bytes requested from the current buffer so far. */
+    size_t GetUsedBytes() const;
+
+    size_t GetCapacity() const;
+
+private:
+    struct FOverflowBlock
+    {
+        void* Memory;
+        size_t Alignment;
+    };
+
+    struct FBuffer
+    {
+        uint8_t* Memory = nullptr;
+        size_t Capacity = 0;
+        std::atomic<size_t> Offset{ 0 };
+        std::atomic<size_t> RequestedBytes{ 0 };
+        std::vector<FOverflowBlock> Overflow;
+    };
+
+    void* AllocateOverflow(FBuffer& Buffer, size_t Size, size_t Alignment);
+    void ResetBuffer(FBuffer& Buffer);
+
+private:
+    FBuffer Buffers[NumBuffers];
+    uint32_t CurrentBuffer;
+
+    std::mutex OverflowMutex;
+    std::atomic<uint64_t> NumHeapAllocations;
+};
+
+/** STL allocator adapter over a frame arena, deallocation is a no-op. */
+template<typename T>
+class TFrameAllocator
+{
+public:
+    typedef T value_type;
+
+    explicit TFrameAllocator(FFrameArena& InArena)
+        : Arena(&InArena)
+    {
+    }
+
+    template<typename U>
+    TFrameAllocator(const TFrameAllocator<U>& Other)
+        : Arena(Other.GetArena())
+    {
+    }
+
+    T* allocate(size_t Num)
+    {
+        return static_cast<T*>(Arena->Allocate(Num * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t)
+    {
+    }
+
+    FFrameArena* GetArena() const
+    {
+        return Arena;
+    }
+
+    template<typename U>
+    bool operator==(const TFrameAllocator<U>& Other) const
+    {
+        return Arena == Other.GetArena();
+    }
+
+    template<typename U>
+    bool operator!=(const TFrameAllocator<U>& Other) const
+    {
+        return Arena != Other.GetArena();
+    }
+
+private:
+    FFrameArena* Arena;
+};
+
+using FFrameString = std::basic_string<char, std::char_traits<char>, TFrameAllocator<char>>;
+
+/** Copies String to Arena, the copy is never destroyed and lives as long as the arena buffer. */
+inline const char* CopyToFrameArena(FFrameArena& Arena, const std::string& String)
+{
+    return Arena.New<FFrameString>(String.data(), String.size(), TFrameAllocator<char>(Arena))->c_str();
+}
@@ -0,0 +1,259 @@
+#include "CpuProfiler.h"
+
+#include <chrono>
+#include <fstream>
+#include "nlohmann/json.hpp"
+
+namespace
+{
+    // Events kept per thread, older ones are overwritten unless they belong to the frame history
+    constexpr uint32_t InitialThreadBufferCapacity = 1 << 16;
+
+    // Events with this duration are exported as instant events
+    constexpr uint64_t InstantEvent = ~0ull;
+
+    // Name given before the thread recorded anything, buffers are only created for threads that record
+    thread_local std::string PendingThreadName;
+
+    // Frame set by SetThreadFrame, GameThreadFrame unless the thread works on an earlier frame
+    thread_local uint32_t ThreadFrame = FCpuProfiler::GameThreadFrame;
+
+    int64_t GetSteadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+struct FCpuThreadBuffer
+{
+    // Slots are relaxed atomics, the exporter may read while the owner thread overwrites
+    struct FEvent
+    {
+        std::atomic<const char*> Name{ nullptr };
+        std::atomic<uint64_t> StartTime{ 0 };
+        std::atomic<uint64_t> Duration{ 0 };
+        std::atomic<uint32_t> Frame{ 0 };
+    };
+
+    explicit FCpuThreadBuffer(uint32_t InThreadId)
+        : ThreadId(InThreadId)
+        , Events(new FEvent[InitialThreadBufferCapacity])
+        , Capacity(InitialThreadBufferCapacity)
+        , WritePosition(0)
+    {
+    }
+
+    uint32_t ThreadId;
+    std::string ThreadName;
+    // Replaced only by the owner thread and under the profiler mutex, which the exporter holds
+    std::unique_ptr<FEvent[]> Events;
+    uint64_t Capacity;
+    std::atomic<uint64_t> WritePosition;
+};
+
+namespace
+{
+    thread_local FCpuThreadBuffer* CurrentThreadBuffer = nullptr;
+}
+
+FCpuProfiler& FCpuProfiler::Get()
+{
+    static FCpuProfiler CpuProfiler;
+    return CpuProfiler;
+}
+
+FCpuProfiler::FCpuProfiler()
+    : bEnabled(false)
+    , FrameNumber(0)
+    , FrameHistory(0)
+    , StartTime(GetSteadyNanoseconds())
+{
+}
+
+void FCpuProfiler::SetEnabled(bool bInEnabled)
+{
+    bEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+void FCpuProfiler::SetFrameHistory(uint32_t NumFrames)
+{
+    FrameHistory.store(NumFrames, std::memory_order_relaxed);
+}
+
+void FCpuProfiler::MarkFrame()
+{
+    if (IsEnabled())
+    {
+        const uint64_t Now = GetTimestamp();
+        RecordEvent("Frame", Now, Now + InstantEvent, FrameNumber.load(std::memory_order_relaxed));
+    }
+    FrameNumber.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FCpuProfiler::SetThreadFrame(uint32_t Frame)
+{
+    ThreadFrame = Frame;
+}
+
+uint32_t FCpuProfiler::GetFrame() const
+{
+    return ThreadFrame != GameThreadFrame ? ThreadFrame : FrameNumber.load(std::memory_order_relaxed);
+}
+
+void FCpuProfiler::SetThreadName(const std::string& Name)
+{
+    PendingThreadName = Name;
+    if (FCpuThreadBuffer* Buffer = CurrentThreadBuffer)
+    {
+        std::lock_guard<std::mutex> Lock(ThreadBuffersMutex);
+        Buffer->ThreadName = Name;
+    }
+}
+
+uint64_t FCpuProfiler::GetTimestamp() const
+{
+    return (uint64_t)(GetSteadyNanoseconds() - StartTime);
+}
+
+void FCpuProfiler::RecordEvent(const char* Name, uint64_t EventStartTime, uint64_t EventEndTime, uint32_t Frame)
+{
+    FCpuThreadBuffer& Buffer = GetThreadBuffer();
+
+    const uint64_t Position = Buffer.WritePosition.load(std::memory_order_relaxed);
+    if (Position >= Buffer.Capacity)
+    {
+        // The event about to be overwritten is still part of the frame history
+        const uint32_t History = FrameHistory.load(std::memory_order_relaxed);
+        const uint32_t CurrentFrame = FrameNumber.load(std::memory_order_relaxed);
+        const uint32_t OldestFrame = Buffer.Events[Position & (Buffer.Capacity - 1)].Frame.load(std::memory_order_relaxed);
+        if (History > 0 && (uint64_t)OldestFrame + History >= CurrentFrame)
+        {
+            GrowThreadBuffer(Buffer);
+        }
+    }
+
+    // Orders the slot stores after the position published by the previous event, see ExportTrace
+    std::atomic_thread_fence(std::memory_order_release);
+
+    FCpuThreadBuffer::FEvent& Event = Buffer.Events[Position & (Buffer.Capacity - 1)];
+    Event.Name.store(Name, std::memory_order_relaxed);
+    Event.StartTime.store(EventStartTime, std::memory_order_relaxed);
+    Event.Duration.store(EventEndTime - EventStartTime, std::memory_order_relaxed);
+    Event.Frame.store(Frame, std::memory_order_relaxed);
+    Buffer.WritePosition.store(Position + 1, std::memory_order_release);
+}
+
+std::string FCpuProfiler::ExportTrace()
+{
+    const uint32_t CurrentFrame = FrameNumber.load(std::memory_order_relaxed);
+    const uint32_t History = FrameHistory.load(std::memory_order_relaxed);
+    const uint32_t FirstFrame = (History > 0 && CurrentFrame > History) ? CurrentFrame - History : 0;
+
+    nlohmann::json TraceEvents = nlohmann::json::array();
+
+    std::lock_guard<std::mutex> Lock(ThreadBuffersMutex);
+    for (const std::shared_ptr<FCpuThreadBuffer>& Buffer : ThreadBuffers)
+    {
+        if (!Buffer->ThreadName.empty())
+        {
+            TraceEvents.push_back({
+                { "name", "thread_name" }, { "ph", "M" }, { "pid", 0 }, { "tid", Buffer->ThreadId },
+                { "args", { { "name", Buffer->ThreadName } } } });
+        }
+
+        const uint64_t Capacity = Buffer->Capacity;
+        const uint64_t End = Buffer->WritePosition.load(std::memory_order_acquire);
+        const uint64_t Begin = End > Capacity ? End - Capacity : 0;
+
+        for (uint64_t Position = Begin; Position < End; ++Position)
+        {
+            const FCpuThreadBuffer::FEvent& Event = Buffer->Events[Position & (Capacity - 1)];
+            const char* Name = Event.Name.load(std::memory_order_relaxed);
+            const uint64_t EventStartTime = Event.StartTime.load(std::memory_order_relaxed);
+            const uint64_t Duration = Event.Duration.load(std::memory_order_relaxed);
+            const uint32_t Frame = Event.Frame.load(std::memory_order_relaxed);
+
+            // The owner thread kept recording and may be writing this slot already: it started once the
+            // position Capacity events later was reached. The fence pairs with the one in RecordEvent, a
+            // slot read that saw any newer store also sees that position.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Buffer->WritePosition.load(std::memory_order_relaxed) - Position >= Capacity)
+            {
+                continue;
+            }
+
+            if (Name == nullptr || Frame < FirstFrame)
+            {
+                continue;
+            }
+
+            nlohmann::json TraceEvent = {
+                { "name", Name }, { "pid", 0 }, { "tid", Buffer->ThreadId }, { "ts", EventStartTime / 1000.0 } };
+            if (Duration == InstantEvent)
+            {
+                TraceEvent["ph"] = "i";
+                TraceEvent["s"] = "g";
+            }
+            else
+            {
+                TraceEvent["ph"] = "X";
+                TraceEvent["dur"] = Duration / 1000.0;
+            }
+            TraceEvents.push_back(std::move(TraceEvent));
+        }
+    }
+
+    nlohmann::json Trace;
+    Trace["traceEvents"] = std::move(TraceEvents);
+    Trace["displayTimeUnit"] = "ms";
+    return Trace.dump();
+}
+
+bool FCpuProfiler::SaveTrace(const std::string& Path)
+{
+    std::ofstream FileWriter;
+
+    FileWriter.open(Path);
+    if (!FileWriter.is_open())
+    {
+        return false;
+    }
+
+    FileWriter << ExportTrace();
+    FileWriter.close();
+    return true;
+}
+
+FCpuThreadBuffer& FCpuProfiler::GetThreadBuffer()
+{
+    if (CurrentThreadBuffer == nullptr)
+    {
+        std::lock_guard<std::mutex> Lock(ThreadBuffersMutex);
+        ThreadBuffers.push_back(std::make_shared<FCpuThreadBuffer>((uint32_t)ThreadBuffers.size()));
+        CurrentThreadBuffer = ThreadBuffers.back().get();
+        CurrentThreadBuffer->ThreadName = PendingThreadName;
+    }
+
+    return *CurrentThreadBuffer;
+}
+
+void FCpuProfiler::GrowThreadBuffer(FCpuThreadBuffer& Buffer)
+{
+    const uint64_t Capacity = Buffer.Capacity * 2;
+    std::unique_ptr<FCpuThreadBuffer::FEvent[]> Events(new FCpuThreadBuffer::FEvent[Capacity]);
+
+    // Only the owner thread writes the events, the lock keeps the exporter off the old array
+    std::lock_guard<std::mutex> Lock(ThreadBuffersMutex);
+    const uint64_t End = Buffer.WritePosition.load(std::memory_order_relaxed);
+    for (uint64_t Position = End - Buffer.Capacity; Position < End; ++Position)
+    {
+        const FCpuThreadBuffer::FEvent& Source = Buffer.Events[Position & (Buffer.Capacity - 1)];
+        FCpuThreadBuffer::FEvent& Destination = Events[Position & (Capacity - 1)];
+        Destination.Name.store(Source.Name.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        Destination.StartTime.store(Source.StartTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        Destination.Duration.store(Source.Duration.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        Destination.Frame.store(Source.Frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    Buffer.Events = std::move(Events);
+    Buffer.Capacity = Capacity;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+#include <mutex>
+
+#ifndef WITH_CPU_PROFILER
+#define WITH_CPU_PROFILER 1
+#endif
+
+struct FCpuThreadBuffer;
+
+/**
+ * Collects scoped CPU timings into per-thread ring buffers and exports them as Chrome trace-event JSON
+ * (chrome://tracing, Perfetto). Recording is lock-free: every thread only ever writes its own buffer,
+ * the mutex is taken when a thread records its first event, when a buffer grows and when exporting.
+ *
+ * Every event belongs to the frame its thread worked on when the scope began. Without a frame history
+ * each ring keeps the last 64k events of its thread. With one, a ring grows instead of overwriting events
+ * of the last NumFrames frames, so those frames are exported complete whatever their event count.
+ */
+class CORE_API FCpuProfiler
+{
+public:
+    /** SetThreadFrame value of threads that follow the game thread's frame. */
+    static constexpr uint32_t GameThreadFrame = ~0u;
+
+    static FCpuProfiler& Get();
+
+    void SetEnabled(bool bInEnabled);
+
+    bool IsEnabled() const
+    {
+        return bEnabled.load(std::memory_order_relaxed);
+    }
+
+    /** Keeps and exports only the last NumFrames frames, 0 exports everything still in the buffers. */
+    void SetFrameHistory(uint32_t NumFrames);
+
+    /** Marks the end of a frame, called once per frame by the game thread. */
+    void MarkFrame();
+
+    /**
+     * Attributes the calling thread's next events to Frame, for threads that work on an earlier frame
+     * than the game thread is building (the render thread). GameThreadFrame goes back to following it.
+     */
+    void SetThreadFrame(uint32_t Frame);
+
+    /** Frame the calling thread works on. */
+    uint32_t GetFrame() const;
+
+    /** Names the calling thread in exported traces. */
+    void SetThreadName(const std::string& Name);
+
+    /** Nanoseconds since the profiler was created. */
+    uint64_t GetTimestamp() const;
+
+    /** Records a finished scope of Frame on the calling thread. Name must have static storage duration. */
+    void RecordEvent(const char* Name, uint64_t StartTime, uint64_t EndTime, uint32_t Frame);
+
+    std::string ExportTrace();
+    bool SaveTrace(const std::string& Path);
+
+private:
+    FCpuProfiler();
+
+    FCpuThreadBuffer& GetThreadBuffer();
+    void GrowThreadBuffer(FCpuThreadBuffer& Buffer);
+
+private:
+    std::atomic<bool> bEnabled;
+    std::atomic<uint32_t> FrameNumber;
+    std::atomic<uint32_t> FrameHistory;
+    int64_t StartTime;
+
+    std::mutex ThreadBuffersMutex;
+    std::vector<std::shared_ptr<FCpuThreadBuffer>> ThreadBuffers;
+};
+
+/** Records the lifetime of the scope it is declared in. */
+class FScopedCpuTimer
+{
+public:
+    explicit FScopedCpuTimer(const char* InName)
+        : Name(InName)
+        , StartTime(0)
+        , Frame(0)
+    {
+        if (FCpuProfiler::Get().IsEnabled())
+        {
+            StartTime = FCpuProfiler::Get().GetTimestamp();
+            Frame = FCpuProfiler::Get().GetFrame();
+        }
+        else
+        {
+            Name = nullptr;
+        }
+    }
+
+    ~FScopedCpuTimer()
+    {
+        if (Name != nullptr)
+        {
+            FCpuProfiler::Get().RecordEvent(Name, StartTime, FCpuProfiler::Get().GetTimestamp(), Frame);
+        }
+    }
+
+    FScopedCpuTimer(const FScopedCpuTimer&) = delete;
+    FScopedCpuTimer& operator=(const FScopedCpuTimer&) = delete;
+
+private:
+    const char* Name;
+    uint64_t StartTime;
+    uint32_t Frame;
+};
+
+#define CPU_PROFILER_JOIN_INNER(A, B) A##B
+#define CPU_PROFILER_JOIN(A, B) CPU_PROFILER_JOIN_INNER(A, B)
+
+#if WITH_CPU_PROFILER
+#define SCOPED_CPU_TIMER(Name) FScopedCpuTimer CPU_PROFILER_JOIN(ScopedCpuTimer, __LINE__)(Name)
+#else
+#define SCOPED_CPU_TIMER(Name)
+#endif
@@ -1,4 +1,6 @@
 #include "Display.h"
+#include "Base/Color.h"
+#include "Render/RenderCommand.h"
 
 FDisplaySize FDisplaySize::FULL_SCREEN = FDisplaySize("Full Screen", 0, 0);
 FDisplaySize FDisplaySize::WIN_1600_900 = FDisplaySize("1600 x 900", 1600, 900);
@@ -45,3 +47,62 @@ FDisplay::FDisplay()
 FDisplay::~FDisplay()
 {
 }
+
+void FDisplay::PollEvents()
+{
+}
+
+void FDisplay::AttachToCurrentThread()
+{
+}
+
+void FDisplay::DetachFromCurrentThread()
+{
+}
+
+void FDisplay::BeginFrame(uint64_t /*FrameNumber*/)
+{
+}
+
+void FDisplay::DrawTriangles(const FDrawTrianglesCommand& /*Command*/)
+{
+}
+
+bool FDisplay::SaveScreenshot(const std::string& /*Path*/)
+{
+    return false;
+}
+
+void FDisplay::ExecuteCommands(const FRenderCommand* Commands, uint32_t NumCommands)
+{
+    for (uint32_t Index = 0; Index < NumCommands; ++Index)
+    {
+        const FRenderCommand& Command = Commands[Index];
+        switch (Command.Type)
+        {
+        case ERenderCommandType::SetInitBackground:
+        {
+            const FSetInitBackgroundCommand& Payload = Command.GetPayload<FSetInitBackgroundCommand>();
+            SetInitBackground(FColor(Payload.R, Payload.G, Payload.B, Payload.A));
+            break;
+        }
+        case ERenderCommandType::SetVSync:
+            SetVSync(Command.GetPayload<FSetVSyncCommand>().bEnable);
+            break;
+        case ERenderCommandType::SetTitle:
+            SetTitle(Command.GetPayload<FSetTitleCommand>().Title);
+            break;
+        case ERenderCommandType::DrawTriangles:
+            DrawTriangles(Command.GetPayload<FDrawTrianglesCommand>());
+            break;
+        case ERenderCommandType::SaveScreenshot:
+            SaveScreenshot(Command.GetPayload<FSaveScreenshotCommand>().Path);
+            break;
+        case ERenderCommandType::BeginFrame:
+            BeginFrame(Command.GetPayload<FBeginFrameCommand>().FrameNumber);
+            break;
+        default:
+            break;
+        }
+    }
+}
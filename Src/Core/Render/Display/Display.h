@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 
 class FColor;
+struct FRenderCommand;
+struct FDrawTrianglesCommand;
 
 class CORE_API FDisplaySize
 {
@@ -40,8 +42,27 @@ public:
 
     virtual void SwapBuffers() = 0;
 
+    // Window events must be pumped on the thread that created the display
+    virtual void PollEvents();
+
+    // Binds / releases the display's rendering context, called when presentation moves to another thread
+    virtual void AttachToCurrentThread();
+    virtual void DetachFromCurrentThread();
+
     virtual void SetDisplaySize(const FDisplaySize& InDisplaySize) = 0;
     virtual void SetVSync(bool Enable) = 0;
     virtual void SetInitBackground(const FColor& Color) = 0;
     virtual void SetTitle(const std::string& Title) = 0;
+
+    // Starts recording FrameNumber, drops the draws still queued by frames that were never refreshed
+    virtual void BeginFrame(uint64_t FrameNumber);
+
+    // Queues triangles for the next RefreshDisplay(), ignored by displays that cannot draw them
+    virtual void DrawTriangles(const FDrawTrianglesCommand& Command);
+
+    // Writes the last presented frame to Path, returns false if the display cannot read its pixels back
+    virtual bool SaveScreenshot(const std::string& Path);
+
+    // Executes a contiguous batch of recorded render commands, one virtual call per batch
+    virtual void ExecuteCommands(const FRenderCommand* Commands, uint32_t NumCommands);
 };
\ No newline at end of file
@@ -0,0 +1,440 @@
+#include "OcclusionBuffer.h"
+
+#include "Async/JobSystem.h"
+#include "Profiler/CpuProfiler.h"
+
+namespace
+{
+    constexpr int32_t Lanes = FFloatWide::Lanes;
+    constexpr int32_t MinTestChunkSize = 1024;
+
+    /** Edge functions and depth plane of a screen space triangle, evaluated at pixel centers. */
+    struct FRasterTriangle
+    {
+        float EdgeA[3];
+        float EdgeB[3];
+        float EdgeC[3];
+        float Depth0;
+        float DepthDX;
+        float DepthDY;
+        int32_t MinX;
+        int32_t MinY;
+        int32_t MaxX;
+        int32_t MaxY;
+    };
+
+    /** Pixel position and NDC depth of a clip space vertex in front of the camera. */
+    MVector ToScreen(const glm::vec4& Clip, int32_t Width, int32_t Height)
+    {
+        const float InvW = 1.0f / Clip.w;
+        return MVector((Clip.x * InvW * 0.5f + 0.5f) * Width, (0.5f - Clip.y * InvW * 0.5f) * Height, Clip.z * InvW);
+    }
+
+    bool IsBehindNearPlane(const glm::vec4& Clip)
+    {
+        return Clip.w <= 0.0f || Clip.z < -Clip.w;
+    }
+
+    /** Returns false for triangles that cover no pixel centers. */
+    bool SetupTriangle(const MVector& V0, const MVector& V1, const MVector& V2, int32_t Width, int32_t Height, FRasterTriangle& OutTriangle)
+    {
+        const float Area = (V1.x - V0.x) * (V2.y - V0.y) - (V2.x - V0.x) * (V1.y - V0.y);
+        if (FMath::Abs(Area) < 1.e-6f)
+        {
+            return false;
+        }
+
+        // Clamped before the conversion, vertices close to the camera plane project very far out
+        OutTriangle.MinX = FMath::FloorToInt(FMath::Max(FMath::Min3(V0.x, V1.x, V2.x), 0.0f));
+        OutTriangle.MinY = FMath::FloorToInt(FMath::Max(FMath::Min3(V0.y, V1.y, V2.y), 0.0f));
+        OutTriangle.MaxX = FMath::FloorToInt(FMath::Min(FMath::Max3(V0.x, V1.x, V2.x), Width - 1.0f));
+        OutTriangle.MaxY = FMath::FloorToInt(FMath::Min(FMath::Max3(V0.y, V1.y, V2.y), Height - 1.0f));
+        if (OutTriangle.MinX > OutTriangle.MaxX || OutTriangle.MinY > OutTriangle.MaxY)
+        {
+            return false;
+        }
+
+        // Edge i is opposite to vertex i, oriented so that the inside is positive whatever the winding
+        const MVector* Vertices[3] = { &V0, &V1, &V2 };
+        const float Sign = Area > 0.0f ? 1.0f : -1.0f;
+        for (int32_t Edge = 0; Edge < 3; ++Edge)
+        {
+            const MVector& A = *Vertices[(Edge + 1) % 3];
+            const MVector& B = *Vertices[(Edge + 2) % 3];
+            OutTriangle.EdgeA[Edge] = Sign * (A.y - B.y);
+            OutTriangle.EdgeB[Edge] = Sign * (B.x - A.x);
+            OutTriangle.EdgeC[Edge] = Sign * (A.x * B.y - B.x * A.y);
+        }
+
+        // NDC depth is linear in screen space
+        const float InvArea = 1.0f / Area;
+        OutTriangle.DepthDX = ((V1.z - V0.z) * (V2.y - V0.y) - (V2.z - V0.z) * (V1.y - V0.y)) * InvArea;
+        OutTriangle.DepthDY = ((V2.z - V0.z) * (V1.x - V0.x) - (V1.z - V0.z) * (V2.x - V0.x)) * InvArea;
+        OutTriangle.Depth0 = V0.z - OutTriangle.DepthDX * V0.x - OutTriangle.DepthDY * V0.y;
+        return true;
+    }
+
+    /** Draws the part of Triangle inside the tile, keeping the nearest depth. */
+    void RasterizeTriangle(const FRasterTriangle& Triangle, int32_t TileMinX, int32_t TileMinY, int32_t TileMaxX, int32_t TileMaxY, float* Depth, int32_t Width)
+    {
+        alignas(32) static const float LaneOffsets[8] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f };
+
+        // Blocks start Lanes aligned, tiles are a multiple of Lanes wide so they never leave the tile
+        const int32_t MinX = FMath::Max(Triangle.MinX, TileMinX) & ~(Lanes - 1);
+        const int32_t MaxX = FMath::Min(Triangle.MaxX, TileMaxX);
+        const int32_t MinY = FMath::Max(Triangle.MinY, TileMinY);
+        const int32_t MaxY = FMath::Min(Triangle.MaxY, TileMaxY);
+        if (MinX > MaxX || MinY > MaxY)
+        {
+            return;
+        }
+
+        const FFloatWide Zero(0.0f);
+        const FFloatWide EdgeA[3] = { Triangle.EdgeA[0], Triangle.EdgeA[1], Triangle.EdgeA[2] };
+        const FFloatWide DepthDX(Triangle.DepthDX);
+        const FFloatWide Offsets = FFloatWide::Load(LaneOffsets);
+
+        for (int32_t Y = MinY; Y <= MaxY; ++Y)
+        {
+            const float CenterY = Y + 0.5f;
+            const FFloatWide RowEdge[3] =
+            {
+                Triangle.EdgeB[0] * CenterY + Triangle.EdgeC[0],
+                Triangle.EdgeB[1] * CenterY + Triangle.EdgeC[1],
+                Triangle.EdgeB[2] * CenterY + Triangle.EdgeC[2]
+            };
+            const FFloatWide RowDepth(Triangle.Depth0 + Triangle.DepthDY * CenterY);
+            float* Row = Depth + (size_t)Y * Width;
+
+            for (int32_t X = MinX; X <= MaxX; X += Lanes)
+            {
+                const FFloatWide CenterX = FFloatWide((float)X) + Offsets;
+                const FMaskWide Inside = (Zero <= FFloatWide::MulAdd(EdgeA[0], CenterX, RowEdge[0]))
+                    & (Zero <= FFloatWide::MulAdd(EdgeA[1], CenterX, RowEdge[1]))
+                    & (Zero <= FFloatWide::MulAdd(EdgeA[2], CenterX, RowEdge[2]));
+                if (!Inside.AnyTrue())
+                {
+                    continue;
+                }
+
+                const FFloatWide Old = FFloatWide::Load(Row + X);
+                const FFloatWide New = FFloatWide::MulAdd(DepthDX, CenterX, RowDepth);
+                FFloatWide::Select(Inside, FFloatWide::Min(Old, New), Old).Store(Row + X);
+            }
+        }
+    }
+}
+
+FOcclusionBuffer::FOcclusionBuffer()
+    : Width(0), Height(0), ViewProjection(1.0f), NumRasterizedTriangles(0)
+{
+}
+
+void FOcclusionBuffer::Initialize(int32_t InWidth, int32_t InHeight)
+{
+    Width = FMath::Max((InWidth + TileWidth - 1) / TileWidth, 1) * TileWidth;
+    Height = FMath::Max((InHeight + TileHeight - 1) / TileHeight, 1) * TileHeight;
+
+    // Halved down to a single texel
+    Levels.clear();
+    int32_t LevelWidth = Width;
+    int32_t LevelHeight = Height;
+    while (true)
+    {
+        Levels.push_back({ LevelWidth, LevelHeight, std::vector<float>((size_t)LevelWidth * LevelHeight, FLT_MAX) });
+        if (LevelWidth == 1 && LevelHeight == 1)
+        {
+            break;
+        }
+        LevelWidth = (LevelWidth + 1) / 2;
+        LevelHeight = (LevelHeight + 1) / 2;
+    }
+}
+
+void FOcclusionBuffer::BeginFrame(const glm::mat4& InViewProjection)
+{
+    ViewProjection = InViewProjection;
+    ClipVertices.clear();
+    TriangleIndices.clear();
+    NumRasterizedTriangles = 0;
+    for (FLevel& Level : Levels)
+    {
+        std::fill(Level.Depth.begin(), Level.Depth.end(), FLT_MAX);
+    }
+}
+
+void FOcclusionBuffer::AddOccluder(const MVector* Vertices, int32_t NumVertices, const int32_t* Indices, int32_t NumIndices)
+{
+    const int32_t FirstVertex = (int32_t)ClipVertices.size();
+    for (int32_t Index = 0; Index < NumVertices; ++Index)
+    {
+        ClipVertices.push_back(ViewProjection * glm::vec4(Vertices[Index].x, Vertices[Index].y, Vertices[Index].z, 1.0f));
+    }
+
+    for (int32_t Index = 0; Index + 2 < NumIndices; Index += 3)
+    {
+        // Clipping against the near plane is skipped, dropping the triangle only makes the test more conservative
+        const int32_t Triangle[3] = { FirstVertex + Indices[Index], FirstVertex + Indices[Index + 1], FirstVertex + Indices[Index + 2] };
+        if (!IsBehindNearPlane(ClipVertices[Triangle[0]]) && !IsBehindNearPlane(ClipVertices[Triangle[1]]) && !IsBehindNearPlane(ClipVertices[Triangle[2]]))
+        {
+            TriangleIndices.insert(TriangleIndices.end(), Triangle, Triangle + 3);
+        }
+    }
+}
+
+void FOcclusionBuffer::Rasterize()
+{
+    SCOPED_CPU_TIMER("FOcclusionBuffer::Rasterize");
+
+    if (Levels.empty())
+    {
+        return;
+    }
+
+    const int32_t NumTriangles = (int32_t)TriangleIndices.size() / 3;
+    std::vector<FRasterTriangle> Triangles(NumTriangles);
+    std::vector<uint8_t> ValidTriangles(NumTriangles);
+    FJobSystem::Get().ParallelForRange(NumTriangles, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Index = Begin; Index < End; ++Index)
+            {
+                const MVector V0 = ToScreen(ClipVertices[TriangleIndices[Index * 3]], Width, Height);
+                const MVector V1 = ToScreen(ClipVertices[TriangleIndices[Index * 3 + 1]], Width, Height);
+                const MVector V2 = ToScreen(ClipVertices[TriangleIndices[Index * 3 + 2]], Width, Height);
+                ValidTriangles[Index] = SetupTriangle(V0, V1, V2, Width, Height, Triangles[Index]);
+            }
+        }, 256);
+
+    // Bin by the tiles each triangle's bounds overlap, in triangle order
+    const int32_t NumTilesX = Width / TileWidth;
+    const int32_t NumTilesY = Height / TileHeight;
+    std::vector<std::vector<int32_t>> TileTriangles((size_t)NumTilesX * NumTilesY);
+    NumRasterizedTriangles = 0;
+    for (int32_t Index = 0; Index < NumTriangles; ++Index)
+    {
+        if (!ValidTriangles[Index])
+        {
+            continue;
+        }
+
+        ++NumRasterizedTriangles;
+        const FRasterTriangle& Triangle = Triangles[Index];
+        for (int32_t TileY = Triangle.MinY / TileHeight; TileY <= Triangle.MaxY / TileHeight; ++TileY)
+        {
+            for (int32_t TileX = Triangle.MinX / TileWidth; TileX <= Triangle.MaxX / TileWidth; ++TileX)
+            {
+                TileTriangles[(size_t)TileY * NumTilesX + TileX].push_back(Index);
+            }
+        }
+    }
+
+    // Tiles own disjoint pixels, so they are drawn in parallel without synchronization
+    float* Depth = Levels[0].Depth.data();
+    FJobSystem::Get().ParallelFor(NumTilesX * NumTilesY, [&](int32_t Tile)
+        {
+            const int32_t TileMinX = (Tile % NumTilesX) * TileWidth;
+            const int32_t TileMinY = (Tile / NumTilesX) * TileHeight;
+            for (const int32_t Index : TileTriangles[Tile])
+            {
+                RasterizeTriangle(Triangles[Index], TileMinX, TileMinY, TileMinX + TileWidth - 1, TileMinY + TileHeight - 1, Depth, Width);
+            }
+        });
+
+    BuildHiZ();
+}
+
+void FOcclusionBuffer::BuildHiZ()
+{
+    SCOPED_CPU_TIMER("FOcclusionBuffer::BuildHiZ");
+
+    for (size_t LevelIndex = 1; LevelIndex < Levels.size(); ++LevelIndex)
+    {
+        const FLevel& Source = Levels[LevelIndex - 1];
+        FLevel& Target = Levels[LevelIndex];
+        FJobSystem::Get().ParallelForRange(Target.Height, [&](int32_t Begin, int32_t End)
+            {
+                for (int32_t Y = Begin; Y < End; ++Y)
+                {
+                    // Odd sizes repeat the last row or column
+                    const float* Row0 = Source.Depth.data() + (size_t)(Y * 2) * Source.Width;
+                    const float* Row1 = Source.Depth.data() + (size_t)FMath::Min(Y * 2 + 1, Source.Height - 1) * Source.Width;
+                    float* TargetRow = Target.Depth.data() + (size_t)Y * Target.Width;
+                    for (int32_t X = 0; X < Target.Width; ++X)
+                    {
+                        const int32_t X0 = X * 2;
+                        const int32_t X1 = FMath::Min(X0 + 1, Source.Width - 1);
+                        TargetRow[X] = FMath::Max(FMath::Max(Row0[X0], Row0[X1]), FMath::Max(Row1[X0], Row1[X1]));
+                    }
+                }
+            }, 16);
+    }
+}
+
+float FOcclusionBuffer::GetMaxDepth(int32_t MinX, int32_t MinY, int32_t MaxX, int32_t MaxY) const
+{
+    // Coarsest level at which the rectangle spans at most 2x2 texels
+    int32_t LevelIndex = (int32_t)FMath::FloorLog2((uint32_t)FMath::Max(FMath::Max(MaxX - MinX, MaxY - MinY), 1));
+    while ((MaxX >> LevelIndex) - (MinX >> LevelIndex) > 1 || (MaxY >> LevelIndex) - (MinY >> LevelIndex) > 1)
+    {
+        ++LevelIndex;
+    }
+    LevelIndex = FMath::Min(LevelIndex, (int32_t)Levels.size() - 1);
+
+    const FLevel& Level = Levels[LevelIndex];
+    const int32_t X0 = MinX >> LevelIndex;
+    const int32_t Y0 = MinY >> LevelIndex;
+    const int32_t X1 = MaxX >> LevelIndex;
+    const int32_t Y1 = MaxY >> LevelIndex;
+    const float* Row0 = Level.Depth.data() + (size_t)Y0 * Level.Width;
+    const float* Row1 = Level.Depth.data() + (size_t)Y1 * Level.Width;
+    return FMath::Max(FMath::Max(Row0[X0], Row0[X1]), FMath::Max(Row1[X0], Row1[X1]));
+}
+
+FOcclusionStats FOcclusionBuffer::TestBoxes(const FBoxBoundsSoA& Bounds, const int32_t* Candidates, int32_t NumCandidates, int32_t* OutVisibleIndices) const
+{
+    SCOPED_CPU_TIMER("FOcclusionBuffer::TestBoxes");
+
+    FOcclusionStats Stats;
+    Stats.NumOccluderTriangles = NumRasterizedTriangles;
+    Stats.NumTested = FMath::Max(NumCandidates, 0);
+    if (Levels.empty() || Stats.NumTested == 0)
+    {
+        return Stats;
+    }
+
+    // Same chunked compaction as FViewCulling, a chunk's output never overtakes its input so Candidates may alias it
+    const int32_t Num = Stats.NumTested;
+    const int32_t NumChunks = FMath::Clamp((Num + MinTestChunkSize - 1) / MinTestChunkSize, 1, FJobSystem::Get().GetNumThreads() * 4);
+    const auto GetChunkBegin = [Num, NumChunks](int32_t Chunk)
+    {
+        return (int32_t)((int64_t)Num * Chunk / NumChunks);
+    };
+
+    FFloatWide Matrix[4][4];
+    for (int32_t Column = 0; Column < 4; ++Column)
+    {
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            Matrix[Column][Row] = FFloatWide(ViewProjection[Column][Row]);
+        }
+    }
+
+    std::vector<int32_t> ChunkCounts(NumChunks);
+    FJobSystem::Get().ParallelFor(NumChunks, [&](int32_t Chunk)
+        {
+            const int32_t Begin = GetChunkBegin(Chunk);
+            const int32_t End = GetChunkBegin(Chunk + 1);
+            int32_t* Output = OutVisibleIndices + Begin;
+
+            for (int32_t First = Begin; First < End; First += Lanes)
+            {
+                const int32_t NumInBlock = FMath::Min(Lanes, End - First);
+                alignas(32) int32_t BoxIndices[Lanes];
+                alignas(32) float Box[6][Lanes];
+                for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+                {
+                    const int32_t Candidate = First + FMath::Min(Lane, NumInBlock - 1);
+                    const int32_t BoxIndex = Candidates ? Candidates[Candidate] : Candidate;
+                    BoxIndices[Lane] = BoxIndex;
+                    Box[0][Lane] = Bounds.CenterX[BoxIndex];
+                    Box[1][Lane] = Bounds.CenterY[BoxIndex];
+                    Box[2][Lane] = Bounds.CenterZ[BoxIndex];
+                    Box[3][Lane] = Bounds.ExtentX[BoxIndex];
+                    Box[4][Lane] = Bounds.ExtentY[BoxIndex];
+                    Box[5][Lane] = Bounds.ExtentZ[BoxIndex];
+                }
+
+                // Corners are the clip space center plus or minus the clip space extent along each axis
+                FFloatWide Center[4];
+                FFloatWide Axes[3][4];
+                for (int32_t Row = 0; Row < 4; ++Row)
+                {
+                    Center[Row] = FFloatWide::MulAdd(Matrix[0][Row], FFloatWide::Load(Box[0]),
+                        FFloatWide::MulAdd(Matrix[1][Row], FFloatWide::Load(Box[1]), FFloatWide::MulAdd(Matrix[2][Row], FFloatWide::Load(Box[2]), Matrix[3][Row])));
+                    for (int32_t Axis = 0; Axis < 3; ++Axis)
+                    {
+                        Axes[Axis][Row] = Matrix[Axis][Row] * FFloatWide::Load(Box[3 + Axis]);
+                    }
+                }
+
+                FFloatWide MinX(FLT_MAX), MinY(FLT_MAX), MinZ(FLT_MAX);
+                FFloatWide MaxX(-FLT_MAX), MaxY(-FLT_MAX);
+                FMaskWide Clipped = Center[3] <= FFloatWide(0.0f);
+                for (int32_t Corner = 0; Corner < 8; ++Corner)
+                {
+                    FFloatWide Clip[4];
+                    for (int32_t Row = 0; Row < 4; ++Row)
+                    {
+                        Clip[Row] = Center[Row];
+                        for (int32_t Axis = 0; Axis < 3; ++Axis)
+                        {
+                            Clip[Row] = Corner & (1 << Axis) ? Clip[Row] + Axes[Axis][Row] : Clip[Row] - Axes[Axis][Row];
+                        }
+                    }
+
+                    Clipped = Clipped | (Clip[3] <= FFloatWide(0.0f)) | (Clip[2] < -Clip[3]);
+                    const FFloatWide InvW = FFloatWide(1.0f) / Clip[3];
+                    const FFloatWide X = Clip[0] * InvW;
+                    const FFloatWide Y = Clip[1] * InvW;
+                    MinX = FFloatWide::Min(MinX, X);
+                    MaxX = FFloatWide::Max(MaxX, X);
+                    MinY = FFloatWide::Min(MinY, Y);
+                    MaxY = FFloatWide::Max(MaxY, Y);
+                    MinZ = FFloatWide::Min(MinZ, Clip[2] * InvW);
+                }
+
+                // NDC to pixels, y points down on screen
+                alignas(32) float Rect[5][Lanes];
+                FFloatWide::MulAdd(MinX, FFloatWide(0.5f * Width), FFloatWide(0.5f * Width)).Store(Rect[0]);
+                FFloatWide::MulAdd(MaxY, FFloatWide(-0.5f * Height), FFloatWide(0.5f * Height)).Store(Rect[1]);
+                FFloatWide::MulAdd(MaxX, FFloatWide(0.5f * Width), FFloatWide(0.5f * Width)).Store(Rect[2]);
+                FFloatWide::MulAdd(MinY, FFloatWide(-0.5f * Height), FFloatWide(0.5f * Height)).Store(Rect[3]);
+                MinZ.Store(Rect[4]);
+                const uint32_t ClippedBits = Clipped.GetBits();
+
+                for (int32_t Lane = 0; Lane < NumInBlock; ++Lane)
+                {
+                    bool bVisible = (ClippedBits >> Lane) & 1;
+                    if (!bVisible)
+                    {
+                        // Boxes outside of the screen are left to frustum culling
+                        const float RectMinX = Rect[0][Lane];
+                        const float RectMinY = Rect[1][Lane];
+                        const float RectMaxX = Rect[2][Lane];
+                        const float RectMaxY = Rect[3][Lane];
+                        bVisible = RectMaxX < 0.0f || RectMaxY < 0.0f || RectMinX >= Width || RectMinY >= Height
+                            || Rect[4][Lane] <= GetMaxDepth(
+                                (int32_t)FMath::Max(RectMinX, 0.0f), (int32_t)FMath::Max(RectMinY, 0.0f),
+                                (int32_t)FMath::Min(RectMaxX, Width - 1.0f), (int32_t)FMath::Min(RectMaxY, Height - 1.0f));
+                    }
+
+                    if (bVisible)
+                    {
+                        *Output++ = BoxIndices[Lane];
+                    }
+                }
+            }
+
+            ChunkCounts[Chunk] = (int32_t)(Output - (OutVisibleIndices + Begin));
+        });
+
+    int32_t NumVisible = ChunkCounts[0];
+    for (int32_t Chunk = 1; Chunk < NumChunks; ++Chunk)
+    {
+        memmove(OutVisibleIndices + NumVisible, OutVisibleIndices + GetChunkBegin(Chunk), ChunkCounts[Chunk] * sizeof(int32_t));
+        NumVisible += ChunkCounts[Chunk];
+    }
+
+    Stats.NumOccluded = Num - NumVisible;
+    return Stats;
+}
+
+bool FOcclusionBuffer::IsBoxVisible(const FBox& Box) const
+{
+    const MVector Center = Box.GetCenter();
+    const MVector Extent = Box.GetExtent();
+    const float Values[6] = { Center.x, Center.y, Center.z, Extent.x, Extent.y, Extent.z };
+    const FBoxBoundsSoA Bounds = { Values, Values + 1, Values + 2, Values + 3, Values + 4, Values + 5, 1 };
+    int32_t VisibleIndex;
+    return TestBoxes(Bounds, nullptr, 1, &VisibleIndex).NumOccluded == 0;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Render/ViewCulling.h"
+
+/** Counters of the last occlusion pass. */
+struct FOcclusionStats
+{
+    int32_t NumOccluderTriangles = 0;
+    int32_t NumTested = 0;
+    int32_t NumOccluded = 0;
+};
+
+/**
+ * CPU occlusion culling against a small software depth buffer, runs without a GPU.
+ *
+ * Each frame: BeginFrame with the view, AddOccluder for a few low-poly meshes (walls, terrain,
+ * building hulls), Rasterize, then TestBoxes with the boxes that survived frustum culling.
+ * Occluders are rasterized with FFloatWide::Lanes pixels per step, one job per screen tile of
+ * TileWidth x TileHeight pixels. The depth buffer is then reduced to a Hi-Z pyramid holding the
+ * farthest depth of every 2x2 block, and each box is tested against the 2x2 texels of the level
+ * that covers its screen rectangle.
+ *
+ * The test is conservative: boxes crossing the near plane or leaving the screen are kept, as
+ * are occluder triangles crossing the near plane, which are dropped.
+ */
+class CORE_API FOcclusionBuffer
+{
+public:
+    static constexpr int32_t TileWidth = 64;
+    static constexpr int32_t TileHeight = 16;
+
+    FOcclusionBuffer();
+
+    /** Sizes are rounded up to whole tiles, a few hundred pixels wide is plenty. */
+    void Initialize(int32_t InWidth, int32_t InHeight);
+
+    /**
+     * Clears the depth and the occluders of the last frame. ViewProjection maps world space to
+     * OpenGL clip space (-w <= z <= w), as glm::perspective and glm::lookAt do.
+     */
+    void BeginFrame(const glm::mat4& InViewProjection);
+
+    /** Queues an indexed triangle mesh with world space vertices. */
+    void AddOccluder(const MVector* Vertices, int32_t NumVertices, const int32_t* Indices, int32_t NumIndices);
+
+    /** Rasterizes the queued occluders and builds the Hi-Z pyramid. */
+    void Rasterize();
+
+    /**
+     * Writes the candidates that may be visible to OutVisibleIndices in their input order, returns
+     * the number written in NumTested - NumOccluded. Candidates index into Bounds, null tests
+     * every box of Bounds. OutVisibleIndices may be Candidates itself.
+     */
+    FOcclusionStats TestBoxes(const FBoxBoundsSoA& Bounds, const int32_t* Candidates, int32_t NumCandidates, int32_t* OutVisibleIndices) const;
+
+    bool IsBoxVisible(const FBox& Box) const;
+
+    int32_t GetWidth() const { return Width; }
+    int32_t GetHeight() const { return Height; }
+
+    /** Row-major depth as NDC z, FLT_MAX where no occluder was drawn. Level 0 is the depth buffer itself. */
+    int32_t GetNumLevels() const { return (int32_t)Levels.size(); }
+    const std::vector<float>& GetLevel(int32_t Level) const { return Levels[Level].Depth; }
+
+private:
+    struct FLevel
+    {
+        int32_t Width;
+        int32_t Height;
+        std::vector<float> Depth;
+    };
+
+    /** Farthest depth of the pixels in [MinX, MaxX] x [MinY, MaxY]. */
+    float GetMaxDepth(int32_t MinX, int32_t MinY, int32_t MaxX, int32_t MaxY) const;
+
+    void BuildHiZ();
+
+private:
+    int32_t Width;
+    int32_t Height;
+    glm::mat4 ViewProjection;
+
+    std::vector<FLevel> Levels;
+
+    /** Clip space vertices of the queued occluders and their triangles. */
+    std::vector<glm::vec4> ClipVertices;
+    std::vector<int32_t> TriangleIndices;
+
+    int32_t NumRasterizedTriangles;
+};
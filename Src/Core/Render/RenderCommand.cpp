@@ -0,0 +1,46 @@
+#include "RenderCommand.h"
+#include "Render/Display/Display.h"
+
+FRenderCommandQueue::FRenderCommandQueue()
+    : Commands(new FRenderCommand[Capacity])
+    , WritePosition(0)
+    , CachedReadPosition(0)
+    , ReadPosition(0)
+{
+}
+
+uint64_t FRenderCommandQueue::GetWritePosition() const
+{
+    return WritePosition.load(std::memory_order_relaxed);
+}
+
+uint32_t FRenderCommandQueue::Execute(FDisplay& Display, uint64_t Fence)
+{
+    const uint64_t Tail = ReadPosition.load(std::memory_order_relaxed);
+    const uint64_t Head = WritePosition.load(std::memory_order_acquire);
+    const uint64_t End = Fence < Head ? Fence : Head;
+
+    if (End <= Tail)
+    {
+        return 0;
+    }
+
+    // At most two contiguous batches, before and after the wrap around
+    uint64_t Position = Tail;
+    while (Position < End)
+    {
+        const uint32_t Index = (uint32_t)(Position & (Capacity - 1));
+        const uint64_t BatchEnd = Position + (Capacity - Index) < End ? Position + (Capacity - Index) : End;
+
+        Display.ExecuteCommands(&Commands[Index], (uint32_t)(BatchEnd - Position));
+        Position = BatchEnd;
+    }
+
+    ReadPosition.store(End, std::memory_order_release);
+    return (uint32_t)(End - Tail);
+}
+
+uint32_t FRenderCommandQueue::Execute(FDisplay& Display)
+{
+    return Execute(Display, WritePosition.load(std::memory_order_acquire));
+}
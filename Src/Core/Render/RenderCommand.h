@@ -0,0 +1,202 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+#include "Base/Color.h"
+#include "Base/Vector.h"
+#include "Memory/FrameAllocator.h"
+
+enum class ERenderCommandType : uint8_t
+{
+    SetInitBackground,
+    SetVSync,
+    SetTitle,
+    DrawTriangles,
+    SaveScreenshot,
+    BeginFrame
+};
+
+/**
+ * One fixed size slot of the render command stream. Commands are POD payloads constructed in place,
+ * so recording never touches the heap.
+ */
+struct alignas(64) FRenderCommand
+{
+    static constexpr uint32_t PayloadSize = 56;
+
+    template<typename TCommand>
+    const TCommand& GetPayload() const
+    {
+        return *std::launder(reinterpret_cast<const TCommand*>(Payload));
+    }
+
+    ERenderCommandType Type;
+    alignas(8) unsigned char Payload[PayloadSize];
+};
+
+struct FSetInitBackgroundCommand
+{
+    static constexpr ERenderCommandType Type = ERenderCommandType::SetInitBackground;
+
+    explicit FSetInitBackgroundCommand(const FColor& Color)
+        : R(Color.R), G(Color.G), B(Color.B), A(Color.A)
+    {
+    }
+
+    float R, G, B, A;
+};
+
+struct FSetVSyncCommand
+{
+    static constexpr ERenderCommandType Type = ERenderCommandType::SetVSync;
+
+    explicit FSetVSyncCommand(bool bInEnable)
+        : bEnable(bInEnable)
+    {
+    }
+
+    bool bEnable;
+};
+
+struct FSetTitleCommand
+{
+    static constexpr ERenderCommandType Type = ERenderCommandType::SetTitle;
+
+    // The title is copied to the frame arena, which keeps it until the recording frame has been presented
+    FSetTitleCommand(FFrameArena& Arena, const std::string& InTitle)
+        : Title(CopyToFrameArena(Arena, InTitle))
+    {
+    }
+
+    const char* Title;
+};
+
+/**
+ * Indexed triangle list with one color per vertex. The arrays are referenced, not copied, so they
+ * must stay valid and unchanged until the frame recording the command has been presented.
+ * Displays without a triangle path ignore it.
+ */
+struct FDrawTrianglesCommand
+{
+    static constexpr ERenderCommandType Type = ERenderCommandType::DrawTriangles;
+
+    FDrawTrianglesCommand(const glm::mat4* InViewProjection, const MVector* InPositions, const uint32_t* InColors, int32_t InNumVertices, const int32_t* InIndices, int32_t InNumIndices)
+        : ViewProjection(InViewProjection)
+        , Positions(InPositions)
+        , Colors(InColors)
+        , Indices(InIndices)
+        , NumVertices(InNumVertices)
+        , NumIndices(InNumIndices)
+    {
+    }
+
+    // World space to OpenGL clip space (-w <= z <= w)
+    const glm::mat4* ViewProjection;
+    const MVector* Positions;
+    // RGBA8, red in the lowest byte
+    const uint32_t* Colors;
+    const int32_t* Indices;
+    int32_t NumVertices;
+    int32_t NumIndices;
+};
+
+/**
+ * Writes the last presented frame to an image file, for displays that can read their pixels back.
+ * Path is copied to the frame arena like the title of FSetTitleCommand.
+ */
+struct FSaveScreenshotCommand
+{
+    static constexpr ERenderCommandType Type = ERenderCommandType::SaveScreenshot;
+
+    FSaveScreenshotCommand(FFrameArena& Arena, const std::string& InPath)
+        : Path(CopyToFrameArena(Arena, InPath))
+    {
+    }
+
+    const char* Path;
+};
+
+/**
+ * First command of every frame. Commands of a dropped frame run together with the next frame's, the
+ * display discards what the dropped frame queued for drawing when it sees this.
+ */
+struct FBeginFrameCommand
+{
+    static constexpr ERenderCommandType Type = ERenderCommandType::BeginFrame;
+
+    explicit FBeginFrameCommand(uint64_t InFrameNumber)
+        : FrameNumber(InFrameNumber)
+    {
+    }
+
+    uint64_t FrameNumber;
+};
+
+/**
+ * Lock-free single producer / single consumer ring of render commands.
+ * One thread records (the game thread, or any thread that owns the queue for the frame) and the render
+ * thread drains it, handing every contiguous run of commands to the display in one call.
+ */
+class CORE_API FRenderCommandQueue
+{
+public:
+    static constexpr uint32_t Capacity = 1024;
+
+    FRenderCommandQueue();
+
+    FRenderCommandQueue(const FRenderCommandQueue&) = delete;
+    FRenderCommandQueue& operator=(const FRenderCommandQueue&) = delete;
+
+    /**
+     * Producer side, records a copy of the command.
+     * @return false if the ring is full, nothing is recorded in that case.
+     */
+    template<typename TCommand>
+    bool Enqueue(const TCommand& Command)
+    {
+        static_assert(std::is_trivially_copyable<TCommand>::value, "Render commands must be trivially copyable");
+        static_assert(sizeof(TCommand) <= FRenderCommand::PayloadSize, "Render command does not fit in a slot");
+        static_assert(alignof(TCommand) <= 8, "Render command alignment exceeds the slot payload alignment");
+
+        const uint64_t Head = WritePosition.load(std::memory_order_relaxed);
+        if (Head - CachedReadPosition >= Capacity)
+        {
+            CachedReadPosition = ReadPosition.load(std::memory_order_acquire);
+            if (Head - CachedReadPosition >= Capacity)
+            {
+                return false;
+            }
+        }
+
+        FRenderCommand& Slot = Commands[Head & (Capacity - 1)];
+        Slot.Type = TCommand::Type;
+        new (Slot.Payload) TCommand(Command);
+
+        WritePosition.store(Head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Producer side, position of the next recorded command. Used as a fence by frame packets. */
+    uint64_t GetWritePosition() const;
+
+    /**
+     * Consumer side, executes the commands recorded before Fence on the display.
+     * @return the number of executed commands.
+     */
+    uint32_t Execute(FDisplay& Display, uint64_t Fence);
+
+    /** Consumer side, executes every command recorded so far. */
+    uint32_t Execute(FDisplay& Display);
+
+private:
+    std::unique_ptr<FRenderCommand[]> Commands;
+
+    alignas(64) std::atomic<uint64_t> WritePosition;
+    uint64_t CachedReadPosition;
+
+    alignas(64) std::atomic<uint64_t> ReadPosition;
+};
@@ -1,6 +1,12 @@
 #include "RenderManager.h"
 #include "Util/ModuleUtil.h"
 #include "Render/Display/Display.h"
+#include "Render/RenderThread.h"
+#include "Memory/FrameAllocator.h"
+#include "Memory/AllocationCounter.h"
+#include "Profiler/CpuProfiler.h"
+
+#include <thread>
 
 FRenderManager& FRenderManager::Get()
 {
@@ -8,12 +14,58 @@ FRenderManager& FRenderManager::Get()
     return RenderManager;
 }
 
+FRenderManager::~FRenderManager()
+{
+    RenderThread->Stop();
+}
+
 void FRenderManager::InitRenderStatus()
 {
     InitLibrary();
     InitDisplay();
 }
 
+void FRenderManager::ShutdownRenderStatus()
+{
+    RenderThread->Stop();
+
+    if (Display != nullptr)
+    {
+        RenderCommands->Execute(*Display);
+        Display->DestroyDisplay();
+        Display = nullptr;
+    }
+}
+
+void FRenderManager::SetRenderType(ERenderType InRenderType)
+{
+    // The backend library is chosen once, the display must not exist yet
+    if (Display == nullptr)
+    {
+        RenderType = InRenderType;
+    }
+}
+
+ERenderType FRenderManager::GetRenderType() const
+{
+    return RenderType;
+}
+
+void FRenderManager::SetRenderThreadMode(ERenderThreadMode InRenderThreadMode)
+{
+    if (InRenderThreadMode == ERenderThreadMode::Sync)
+    {
+        RenderThread->Stop();
+    }
+
+    RenderThreadMode = InRenderThreadMode;
+}
+
+ERenderThreadMode FRenderManager::GetRenderThreadMode() const
+{
+    return RenderThreadMode;
+}
+
 FDisplayPtr FRenderManager::GetDisplay()
 {
     if (Display == nullptr)
@@ -24,6 +76,79 @@ FDisplayPtr FRenderManager::GetDisplay()
     return Display;
 }
 
+void FRenderManager::SubmitFrame()
+{
+    SCOPED_CPU_TIMER("SubmitFrame");
+    FCpuProfiler::Get().MarkFrame();
+
+    FDisplayPtr CurrentDisplay = GetDisplay();
+
+    ++NumFramesSubmitted;
+    NumFrameArenaBytes = FrameArena->GetUsedBytes();
+
+    const uint64_t NumAllocations = FAllocationCounter::GetNumAllocations();
+    NumFrameHeapAllocations = NumAllocations - NumAllocationsAtLastSubmit;
+    NumAllocationsAtLastSubmit = NumAllocations;
+
+    if (RenderThreadMode == ERenderThreadMode::Sync)
+    {
+        FFramePacket Packet;
+        Packet.FrameNumber = NumFramesSubmitted;
+        Packet.CommandFence = RenderCommands->GetWritePosition();
+
+        FRenderThread::RenderFrame(*CurrentDisplay, Packet, *RenderCommands);
+        ++NumFramesRenderedSync;
+
+        // Presented, nothing of this frame is referenced anymore
+        FrameArena->BeginFrame(FrameArena->GetCurrentBuffer() + 1);
+        EnqueueRenderCommand(FBeginFrameCommand(NumFramesSubmitted + 1));
+        return;
+    }
+
+    if (!RenderThread->IsRunning())
+    {
+        // Packet slots and arena buffers share their index, the frame being built is in the current buffer
+        RenderThread->Start(CurrentDisplay, RenderCommands.get(), FrameArena->GetCurrentBuffer());
+    }
+
+    FFramePacket& Packet = RenderThread->GetWritePacket();
+    Packet.FrameNumber = NumFramesSubmitted;
+    Packet.CommandFence = RenderCommands->GetWritePosition();
+
+    // The frame's arena buffer is referenced by the commands before its fence
+    FrameArenaFences[RenderThread->GetWritePacketIndex()] = Packet.CommandFence;
+
+    if (!RenderThread->Publish())
+    {
+        ++NumFramesDropped;
+    }
+
+    // The new write slot holds either a presented frame or the one just dropped, whose commands still run
+    // with the next fence. Until the render thread presented past them the buffer is kept, and the next
+    // frame allocates behind the dropped one.
+    const uint32_t WriteIndex = RenderThread->GetWritePacketIndex();
+    FrameArena->BeginFrame(WriteIndex, RenderThread->GetPresentedCommandFence() >= FrameArenaFences[WriteIndex]);
+    EnqueueRenderCommand(FBeginFrameCommand(NumFramesSubmitted + 1));
+}
+
+FFrameArena& FRenderManager::GetFrameArena()
+{
+    return *FrameArena;
+}
+
+FRenderStats FRenderManager::GetRenderStats() const
+{
+    FRenderStats Stats;
+    Stats.NumFramesSubmitted = NumFramesSubmitted;
+    Stats.NumFramesRendered = NumFramesRenderedSync + RenderThread->GetNumFramesRendered();
+    Stats.NumFramesDropped = NumFramesDropped;
+    Stats.NumFrameArenaHeapAllocations = FrameArena->GetNumHeapAllocations();
+    Stats.NumFrameArenaBytes = NumFrameArenaBytes;
+    Stats.NumFrameHeapAllocations = NumFrameHeapAllocations;
+    Stats.NumHeapAllocations = FAllocationCounter::GetNumAllocations();
+    return Stats;
+}
+
 void FRenderManager::RegisterDisplay(const std::string& InstanceName, const std::function<FDisplayPtr()>& DisplayCreateFunc)
 {
     RegisteredDisplay.emplace(InstanceName, DisplayCreateFunc);
@@ -36,10 +161,35 @@ void FRenderManager::UnRegisterDisplay(const std::string& InstanceName)
 
 FRenderManager::FRenderManager()
     : RenderType(ERenderType::OpenGL)
+    , RenderThreadMode(ERenderThreadMode::Threaded)
+    , RenderThread(std::make_unique<FRenderThread>())
+    , RenderCommands(std::make_unique<FRenderCommandQueue>())
+    , FrameArena(std::make_unique<FFrameArena>())
+    , NumFramesSubmitted(0)
+    , NumFramesDropped(0)
+    , NumFramesRenderedSync(0)
+    , NumFrameArenaBytes(0)
+    , NumFrameHeapAllocations(0)
+    , NumAllocationsAtLastSubmit(0)
+    , FrameArenaFences{}
 {
 
 }
 
+void FRenderManager::WaitForRenderCommandSpace()
+{
+    if (RenderThread->IsRunning())
+    {
+        // The ring filled up within one frame, let the render thread drain it without waiting for a packet
+        RenderThread->FlushCommands(RenderCommands->GetWritePosition());
+        std::this_thread::yield();
+    }
+    else
+    {
+        RenderCommands->Execute(*GetDisplay());
+    }
+}
+
 void FRenderManager::InitLibrary()
 {
     if (Display == nullptr)
@@ -49,6 +199,12 @@ void FRenderManager::InitLibrary()
         case ERenderType::OpenGL:
             FModuleUtil::LoadDynamicLibrary(GET_ENUM_NAME_CHECKED(ERenderType, OpenGL));
             break;
+        case ERenderType::Headless:
+            FModuleUtil::LoadDynamicLibrary(GET_ENUM_NAME_CHECKED(ERenderType, Headless));
+            break;
+        case ERenderType::Software:
+            FModuleUtil::LoadDynamicLibrary(GET_ENUM_NAME_CHECKED(ERenderType, Software));
+            break;
         default:
             FModuleUtil::LoadDynamicLibrary(GET_ENUM_NAME_CHECKED(ERenderType, OpenGL));
             break;
@@ -67,6 +223,16 @@ void FRenderManager::InitDisplay()
             Display = RegisteredDisplay[GET_ENUM_NAME_CHECKED(ERenderType, OpenGL)]();
             break;
         }
+        case ERenderType::Headless:
+        {
+            Display = RegisteredDisplay[GET_ENUM_NAME_CHECKED(ERenderType, Headless)]();
+            break;
+        }
+        case ERenderType::Software:
+        {
+            Display = RegisteredDisplay[GET_ENUM_NAME_CHECKED(ERenderType, Software)]();
+            break;
+        }
         default:
             Display = RegisteredDisplay[GET_ENUM_NAME_CHECKED(ERenderType, OpenGL)]();
             break;
@@ -2,11 +2,27 @@
 
 #include "CoreMinimal.h"
 
+#include "RenderStats.h"
+#include "RenderCommand.h"
+#include "Memory/FrameAllocator.h"
+
 enum class ERenderType
 {
-    OpenGL
+    OpenGL,
+    Headless,
+    Software
+};
+
+enum class ERenderThreadMode
+{
+    // Frames are rendered inline by SubmitFrame(), deterministic and single threaded
+    Sync,
+    // Frames are handed to a dedicated render thread through a triple buffer
+    Threaded
 };
 
+class FRenderThread;
+
 
 
 class CORE_API FRenderManager
@@ -14,10 +30,37 @@ class CORE_API FRenderManager
 public:
     static FRenderManager& Get();
 
+    ~FRenderManager();
+
     void InitRenderStatus();
+    void ShutdownRenderStatus();
+
+    void SetRenderType(ERenderType InRenderType);
+    ERenderType GetRenderType() const;
+
+    void SetRenderThreadMode(ERenderThreadMode InRenderThreadMode);
+    ERenderThreadMode GetRenderThreadMode() const;
 
     FDisplayPtr GetDisplay();
 
+    // Publishes the game thread's frame, in Sync mode it is presented before returning
+    void SubmitFrame();
+
+    FRenderStats GetRenderStats() const;
+
+    // Transient memory for the frame being built, recycled once the render thread is done with it
+    FFrameArena& GetFrameArena();
+
+    // Records a command for the display, executed before the next submitted frame is presented
+    template<typename TCommand>
+    void EnqueueRenderCommand(const TCommand& Command)
+    {
+        while (!RenderCommands->Enqueue(Command))
+        {
+            WaitForRenderCommandSpace();
+        }
+    }
+
     void RegisterDisplay(const std::string& InstanceName, const std::function<FDisplayPtr()>& DisplayCreateFunc);
     void UnRegisterDisplay(const std::string& InstanceName);
 
@@ -27,9 +70,26 @@ private:
     void InitLibrary();
     void InitDisplay();
 
+    void WaitForRenderCommandSpace();
+
 private:
     std::map<std::string, std::function<FDisplayPtr()>> RegisteredDisplay;
 
     FDisplayPtr Display;
     ERenderType RenderType;
+
+    ERenderThreadMode RenderThreadMode;
+    std::unique_ptr<FRenderThread> RenderThread;
+    std::unique_ptr<FRenderCommandQueue> RenderCommands;
+    std::unique_ptr<FFrameArena> FrameArena;
+
+    uint64_t NumFramesSubmitted;
+    uint64_t NumFramesDropped;
+    uint64_t NumFramesRenderedSync;
+    uint64_t NumFrameArenaBytes;
+    uint64_t NumFrameHeapAllocations;
+    uint64_t NumAllocationsAtLastSubmit;
+
+    // Command fence of the last frame published from each arena buffer
+    uint64_t FrameArenaFences[FFrameArena::NumBuffers];
 };
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Snapshot of the frame counters kept by FRenderManager. */
+struct FRenderStats
+{
+    /** Frames published by the game thread. */
+    uint64_t NumFramesSubmitted = 0;
+
+    /** Frames the display actually refreshed and presented. */
+    uint64_t NumFramesRendered = 0;
+
+    /** Frames overwritten in the triple buffer before the render thread picked them up. */
+    uint64_t NumFramesDropped = 0;
+
+    /** Heap allocations made by the frame arena, constant once frames reached a steady state. */
+    uint64_t NumFrameArenaHeapAllocations = 0;
+
+    /** Frame arena bytes requested by the last submitted frame. */
+    uint64_t NumFrameArenaBytes = 0;
+
+    /** Heap allocations of every thread since the previous frame was submitted, see FAllocationCounter. */
+    uint64_t NumFrameHeapAllocations = 0;
+
+    /** Heap allocations of every thread since the program started. */
+    uint64_t NumHeapAllocations = 0;
+};
@@ -0,0 +1,176 @@
+#include "RenderThread.h"
+#include "Render/Display/Display.h"
+#include "Render/RenderCommand.h"
+#include "Profiler/CpuProfiler.h"
+
+FRenderThread::FRenderThread()
+    : Commands(nullptr)
+    , bRunning(false)
+    , CommandFlushFence(0)
+    , NumFramesRendered(0)
+    , PresentedCommandFence(0)
+{
+}
+
+FRenderThread::~FRenderThread()
+{
+    Stop();
+}
+
+void FRenderThread::Start(const FDisplayPtr& InDisplay, FRenderCommandQueue* InCommands, uint32_t FirstPacketIndex)
+{
+    if (IsRunning() || InDisplay == nullptr || InCommands == nullptr)
+    {
+        return;
+    }
+
+    Display = InDisplay;
+    Commands = InCommands;
+    Packets.Reset(FirstPacketIndex);
+    Display->DetachFromCurrentThread();
+
+    bRunning = true;
+    Thread = std::thread(&FRenderThread::Run, this);
+}
+
+void FRenderThread::Stop()
+{
+    if (!Thread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+        bRunning = false;
+    }
+    WakeCondition.notify_one();
+    Thread.join();
+
+    Display->AttachToCurrentThread();
+    Display = nullptr;
+    Commands = nullptr;
+}
+
+bool FRenderThread::IsRunning() const
+{
+    return bRunning;
+}
+
+FFramePacket& FRenderThread::GetWritePacket()
+{
+    return Packets.GetWriteBuffer();
+}
+
+uint32_t FRenderThread::GetWritePacketIndex() const
+{
+    return Packets.GetWriteIndex();
+}
+
+bool FRenderThread::Publish()
+{
+    const bool bConsumed = Packets.Publish();
+
+    // The lock only orders the wake up against the render thread's predicate check,
+    // it is never held while a frame is presented.
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+    }
+    WakeCondition.notify_one();
+
+    return bConsumed;
+}
+
+void FRenderThread::FlushCommands(uint64_t Fence)
+{
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+        CommandFlushFence = Fence;
+    }
+    WakeCondition.notify_one();
+}
+
+uint64_t FRenderThread::GetNumFramesRendered() const
+{
+    return NumFramesRendered;
+}
+
+uint64_t FRenderThread::GetPresentedCommandFence() const
+{
+    return PresentedCommandFence.load(std::memory_order_acquire);
+}
+
+void FRenderThread::RenderFrame(FDisplay& Display, const FFramePacket& Packet, FRenderCommandQueue& Commands)
+{
+    // The game thread has marked the frame and moved on, its events belong to the packet's frame.
+    // Packets count frames from 1, the profiler from 0.
+    FCpuProfiler::Get().SetThreadFrame((uint32_t)(Packet.FrameNumber - 1));
+
+    {
+        SCOPED_CPU_TIMER("RenderFrame");
+
+        {
+            SCOPED_CPU_TIMER("ExecuteRenderCommands");
+            Commands.Execute(Display, Packet.CommandFence);
+        }
+
+        {
+            SCOPED_CPU_TIMER("RefreshDisplay");
+            Display.RefreshDisplay();
+        }
+
+        {
+            SCOPED_CPU_TIMER("SwapBuffers");
+            Display.SwapBuffers();
+        }
+    }
+
+    FCpuProfiler::Get().SetThreadFrame(FCpuProfiler::GameThreadFrame);
+}
+
+void FRenderThread::Run()
+{
+    FCpuProfiler::Get().SetThreadName("RenderThread");
+    Display->AttachToCurrentThread();
+
+    uint64_t ExecutedFlushFence = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock(WakeMutex);
+            WakeCondition.wait(Lock, [this, ExecutedFlushFence]()
+                {
+                    return !bRunning || Packets.HasPending() || CommandFlushFence != ExecutedFlushFence;
+                });
+        }
+
+        // The last published packet is still presented when stopping
+        const bool bStopping = !bRunning;
+
+        // The game thread ran out of command slots within a single frame
+        const uint64_t FlushFence = CommandFlushFence;
+        if (FlushFence != ExecutedFlushFence)
+        {
+            Commands->Execute(*Display, FlushFence);
+            ExecutedFlushFence = FlushFence;
+        }
+
+        if (Packets.Update())
+        {
+            const FFramePacket& Packet = Packets.GetReadBuffer();
+            RenderFrame(*Display, Packet, *Commands);
+            ++NumFramesRendered;
+            PresentedCommandFence.store(Packet.CommandFence, std::memory_order_release);
+        }
+
+        if (bStopping)
+        {
+            // Commands recorded after the last frame still reach the display
+            Commands->Execute(*Display);
+            break;
+        }
+    }
+
+    Display->DetachFromCurrentThread();
+}
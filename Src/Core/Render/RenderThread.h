@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Async/TripleBuffer.h"
+
+/** Everything the render thread needs to present one frame, filled by the game thread. */
+struct FFramePacket
+{
+    uint64_t FrameNumber = 0;
+
+    // Render commands recorded before this position are executed before the frame is presented
+    uint64_t CommandFence = 0;
+};
+
+class FRenderCommandQueue;
+
+/**
+ * Dedicated thread presenting frame packets on a display.
+ * The game thread publishes packets through a triple buffer and never waits for presentation,
+ * the render thread always renders the most recent packet and sleeps while there is none.
+ */
+class CORE_API FRenderThread
+{
+public:
+    FRenderThread();
+    ~FRenderThread();
+
+    /**
+     * Moves the display to a new render thread. Must be called from the thread owning the display.
+     * @param FirstPacketIndex		Buffer index the first written packet gets, see GetWritePacketIndex().
+     */
+    void Start(const FDisplayPtr& InDisplay, FRenderCommandQueue* InCommands, uint32_t FirstPacketIndex = 0);
+
+    /** Joins the render thread and hands the display back to the calling thread. */
+    void Stop();
+
+    bool IsRunning() const;
+
+    /** Game thread side, the packet to fill for the next Publish(). */
+    FFramePacket& GetWritePacket();
+
+    /** Game thread side, index in [0, 3) of the write packet. The render thread never reads this packet's data. */
+    uint32_t GetWritePacketIndex() const;
+
+    /**
+     * Game thread side, makes the write packet visible to the render thread.
+     * @return false if an unrendered packet was replaced.
+     */
+    bool Publish();
+
+    /** Game thread side, asks the render thread to execute commands up to Fence without waiting for a frame. */
+    void FlushCommands(uint64_t Fence);
+
+    uint64_t GetNumFramesRendered() const;
+
+    /**
+     * Command fence of the last presented packet. Commands before it have been executed and their frame
+     * presented, so nothing they reference is read anymore.
+     */
+    uint64_t GetPresentedCommandFence() const;
+
+    /** Executes the frame's commands, refreshes and presents, shared by the render thread and the synchronous path. */
+    static void RenderFrame(FDisplay& Display, const FFramePacket& Packet, FRenderCommandQueue& Commands);
+
+private:
+    void Run();
+
+private:
+    FDisplayPtr Display;
+    FRenderCommandQueue* Commands;
+    std::thread Thread;
+
+    TTripleBuffer<FFramePacket> Packets;
+
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+    std::atomic<bool> bRunning;
+    std::atomic<uint64_t> CommandFlushFence;
+    std::atomic<uint64_t> NumFramesRendered;
+    std::atomic<uint64_t> PresentedCommandFence;
+};
@@ -0,0 +1,231 @@
+#include "SwizzledTexture.h"
+
+#include "Async/JobSystem.h"
+#include "Base/MathUtil.h"
+#include "Profiler/CpuProfiler.h"
+
+namespace
+{
+    constexpr int32_t TileMask = FSwizzledTexture::TileSize - 1;
+
+    /** FMath::MortonCode2 of every lane, for values below 256. */
+    FIntWide MortonCode2(FIntWide X)
+    {
+        X = (X ^ X.ShiftLeft(4)) & FIntWide(0x0f0f0f0f);
+        X = (X ^ X.ShiftLeft(2)) & FIntWide(0x33333333);
+        X = (X ^ X.ShiftLeft(1)) & FIntWide(0x55555555);
+        return X;
+    }
+
+    /** Rounded per channel average of a 2x2 block. */
+    uint32_t AverageTexels(uint32_t A, uint32_t B, uint32_t C, uint32_t D)
+    {
+        uint32_t Result = 0;
+        for (int32_t Shift = 0; Shift < 32; Shift += 8)
+        {
+            const uint32_t Sum = ((A >> Shift) & 0xFF) + ((B >> Shift) & 0xFF) + ((C >> Shift) & 0xFF) + ((D >> Shift) & 0xFF);
+            Result |= ((Sum + 2) / 4) << Shift;
+        }
+        return Result;
+    }
+
+    /**
+     * Coordinate with NaN and infinite lanes at 0 and the others within +-2^23, where floats are still
+     * whole texels apart and the wrap below stays exact. Truncating anything else would give INT_MIN.
+     */
+    FFloatWide SanitizeCoordinate(const FFloatWide& Coordinate)
+    {
+        const FFloatWide Limit(8388608.0f);
+        const FMaskWide bFinite = FFloatWide::Abs(Coordinate) <= FFloatWide(FLT_MAX);
+        return FFloatWide::Select(bFinite, FFloatWide::Clamp(Coordinate, -Limit, Limit), FFloatWide(0.0f));
+    }
+
+    /** Texel coordinates of Coordinate in [0, Size), in floats so that any size wraps without integer division. */
+    FFloatWide ApplyAddress(const FFloatWide& Coordinate, const FFloatWide& Size, const FFloatWide& InvSize, ETextureAddress Address)
+    {
+        if (Address == ETextureAddress::Clamp)
+        {
+            return FFloatWide::Clamp(Coordinate, FFloatWide(0.0f), Size - FFloatWide(1.0f));
+        }
+
+        // The quotient may round across an integer, the selects bring the result back in range
+        const FFloatWide Wrapped = Coordinate - (Coordinate * InvSize).Floor() * Size;
+        const FFloatWide Zero(0.0f);
+        return FFloatWide::Select(Wrapped < Zero, Wrapped + Size, FFloatWide::Select(Wrapped >= Size, Wrapped - Size, Wrapped));
+    }
+
+    /** Channel of FFloatWide::Lanes packed texels, in [0, 255]. */
+    FFloatWide GetChannel(const FIntWide& Texels, int32_t Channel)
+    {
+        return (Texels.ShiftRightLogical(Channel * 8) & FIntWide(0xFF)).ToFloat();
+    }
+}
+
+FSwizzledTexture::FSwizzledTexture()
+{
+}
+
+void FSwizzledTexture::Initialize(const uint32_t* InTexels, int32_t Width, int32_t Height, bool bGenerateMips)
+{
+    SCOPED_CPU_TIMER("FSwizzledTexture::Initialize");
+
+    LevelWidths.clear();
+    LevelHeights.clear();
+    LevelTilesX.clear();
+    LevelOffsets.clear();
+
+    Width = FMath::Max(Width, 1);
+    Height = FMath::Max(Height, 1);
+    size_t NumTexels = 0;
+    while (true)
+    {
+        const int32_t TilesX = (Width + TileSize - 1) >> TileSizeLog2;
+        const int32_t TilesY = (Height + TileSize - 1) >> TileSizeLog2;
+        LevelWidths.push_back(Width);
+        LevelHeights.push_back(Height);
+        LevelTilesX.push_back(TilesX);
+        LevelOffsets.push_back((int32_t)NumTexels);
+
+        // A level within one tile only reaches the Morton code of its power of two bounds
+        const size_t LevelSize = TilesX * TilesY > 1 ? (size_t)TilesX * TilesY * TileSize * TileSize : FMath::Square((size_t)FMath::RoundUpToPowerOfTwo(FMath::Max(Width, Height)));
+
+        // Levels start on a cache line
+        NumTexels = (NumTexels + LevelSize + 15) & ~(size_t)15;
+
+        if (!bGenerateMips || (Width == 1 && Height == 1))
+        {
+            break;
+        }
+        Width = (Width + 1) / 2;
+        Height = (Height + 1) / 2;
+    }
+    Texels.assign(NumTexels, 0);
+
+    FJobSystem::Get().ParallelForRange(LevelHeights[0], [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Y = Begin; Y < End; ++Y)
+            {
+                const uint32_t* Row = InTexels + (size_t)Y * LevelWidths[0];
+                for (int32_t X = 0; X < LevelWidths[0]; ++X)
+                {
+                    Texels[GetTexelIndex(X, Y, 0)] = Row[X];
+                }
+            }
+        }, 16);
+
+    for (int32_t Level = 1; Level < GetNumLevels(); ++Level)
+    {
+        const int32_t SourceWidth = LevelWidths[Level - 1];
+        const int32_t SourceHeight = LevelHeights[Level - 1];
+        FJobSystem::Get().ParallelForRange(LevelHeights[Level], [&](int32_t Begin, int32_t End)
+            {
+                for (int32_t Y = Begin; Y < End; ++Y)
+                {
+                    // Odd sizes repeat the last row or column
+                    const int32_t Y0 = Y * 2;
+                    const int32_t Y1 = FMath::Min(Y0 + 1, SourceHeight - 1);
+                    for (int32_t X = 0; X < LevelWidths[Level]; ++X)
+                    {
+                        const int32_t X0 = X * 2;
+                        const int32_t X1 = FMath::Min(X0 + 1, SourceWidth - 1);
+                        Texels[GetTexelIndex(X, Y, Level)] = AverageTexels(GetTexel(X0, Y0, Level - 1), GetTexel(X1, Y0, Level - 1), GetTexel(X0, Y1, Level - 1), GetTexel(X1, Y1, Level - 1));
+                    }
+                }
+            }, 16);
+    }
+}
+
+size_t FSwizzledTexture::GetTexelIndex(int32_t X, int32_t Y, int32_t Level) const
+{
+    const size_t Tile = (size_t)(Y >> TileSizeLog2) * LevelTilesX[Level] + (X >> TileSizeLog2);
+    return LevelOffsets[Level] + (Tile << (2 * TileSizeLog2)) + (FMath::MortonCode2(X & TileMask) | (FMath::MortonCode2(Y & TileMask) << 1));
+}
+
+void FSwizzledTexture::ReadLevel(int32_t Level, uint32_t* OutTexels) const
+{
+    for (int32_t Y = 0; Y < LevelHeights[Level]; ++Y)
+    {
+        for (int32_t X = 0; X < LevelWidths[Level]; ++X)
+        {
+            OutTexels[(size_t)Y * LevelWidths[Level] + X] = GetTexel(X, Y, Level);
+        }
+    }
+}
+
+FColorWide FSwizzledTexture::SampleBilinear(const FFloatWide& U, const FFloatWide& V, int32_t Level, ETextureAddress Address) const
+{
+    return SampleLevels(U, V, FIntWide(FMath::Clamp(Level, 0, GetNumLevels() - 1)), Address);
+}
+
+FColorWide FSwizzledTexture::SampleTrilinear(const FFloatWide& U, const FFloatWide& V, const FFloatWide& Lod, ETextureAddress Address) const
+{
+    const FFloatWide MaxLevel((float)(GetNumLevels() - 1));
+    // NaN lanes take level 0, Min and Max do not drop NaNs on every platform
+    const FFloatWide ClampedLod = FFloatWide::Select(Lod == Lod, FFloatWide::Clamp(Lod, FFloatWide(0.0f), MaxLevel), FFloatWide(0.0f));
+    const FFloatWide Level0 = ClampedLod.Floor();
+    const FFloatWide Fraction = ClampedLod - Level0;
+
+    const FColorWide Color0 = SampleLevels(U, V, Level0.TruncToInt(), Address);
+    if (!(Fraction > FFloatWide(0.0f)).AnyTrue())
+    {
+        return Color0;
+    }
+
+    const FColorWide Color1 = SampleLevels(U, V, FFloatWide::Min(Level0 + FFloatWide(1.0f), MaxLevel).TruncToInt(), Address);
+    FColorWide Result;
+    Result.R = FFloatWide::MulAdd(Color1.R - Color0.R, Fraction, Color0.R);
+    Result.G = FFloatWide::MulAdd(Color1.G - Color0.G, Fraction, Color0.G);
+    Result.B = FFloatWide::MulAdd(Color1.B - Color0.B, Fraction, Color0.B);
+    Result.A = FFloatWide::MulAdd(Color1.A - Color0.A, Fraction, Color0.A);
+    return Result;
+}
+
+FColorWide FSwizzledTexture::SampleLevels(const FFloatWide& U, const FFloatWide& V, const FIntWide& Levels, ETextureAddress Address) const
+{
+    const FFloatWide Width = FIntWide::Gather(LevelWidths.data(), Levels).ToFloat();
+    const FFloatWide Height = FIntWide::Gather(LevelHeights.data(), Levels).ToFloat();
+    const FFloatWide TilesX = FIntWide::Gather(LevelTilesX.data(), Levels).ToFloat();
+    const FIntWide Offsets = FIntWide::Gather(LevelOffsets.data(), Levels);
+
+    // Texel centers are at half integers
+    const FFloatWide Half(0.5f);
+    const FFloatWide One(1.0f);
+    const FFloatWide X = SanitizeCoordinate(FFloatWide::MulAdd(U, Width, -Half));
+    const FFloatWide Y = SanitizeCoordinate(FFloatWide::MulAdd(V, Height, -Half));
+    const FFloatWide FloorX = X.Floor();
+    const FFloatWide FloorY = Y.Floor();
+    const FFloatWide FractionX = X - FloorX;
+    const FFloatWide FractionY = Y - FloorY;
+
+    const FFloatWide InvWidth = One / Width;
+    const FFloatWide InvHeight = One / Height;
+    const FIntWide X0 = ApplyAddress(FloorX, Width, InvWidth, Address).TruncToInt();
+    const FIntWide X1 = ApplyAddress(FloorX + One, Width, InvWidth, Address).TruncToInt();
+    const FIntWide Y0 = ApplyAddress(FloorY, Height, InvHeight, Address).TruncToInt();
+    const FIntWide Y1 = ApplyAddress(FloorY + One, Height, InvHeight, Address).TruncToInt();
+
+    // Index = Offset + Tile * TileSize^2 + Morton code within the tile, split in its column and row parts
+    const FIntWide Mask(TileMask);
+    const FIntWide Column0 = MortonCode2(X0 & Mask) + X0.ShiftRightLogical(TileSizeLog2).ShiftLeft(2 * TileSizeLog2);
+    const FIntWide Column1 = MortonCode2(X1 & Mask) + X1.ShiftRightLogical(TileSizeLog2).ShiftLeft(2 * TileSizeLog2);
+    const FIntWide Row0 = Offsets + MortonCode2(Y0 & Mask).ShiftLeft(1) + (Y0.ShiftRightLogical(TileSizeLog2).ToFloat() * TilesX).TruncToInt().ShiftLeft(2 * TileSizeLog2);
+    const FIntWide Row1 = Offsets + MortonCode2(Y1 & Mask).ShiftLeft(1) + (Y1.ShiftRightLogical(TileSizeLog2).ToFloat() * TilesX).TruncToInt().ShiftLeft(2 * TileSizeLog2);
+
+    const int32_t* Base = (const int32_t*)Texels.data();
+    const FIntWide Texel00 = FIntWide::Gather(Base, Row0 + Column0);
+    const FIntWide Texel10 = FIntWide::Gather(Base, Row0 + Column1);
+    const FIntWide Texel01 = FIntWide::Gather(Base, Row1 + Column0);
+    const FIntWide Texel11 = FIntWide::Gather(Base, Row1 + Column1);
+
+    FFloatWide Channels[4];
+    const FFloatWide Scale(1.0f / 255.0f);
+    for (int32_t Channel = 0; Channel < 4; ++Channel)
+    {
+        const FFloatWide C00 = GetChannel(Texel00, Channel);
+        const FFloatWide C01 = GetChannel(Texel01, Channel);
+        const FFloatWide Top = FFloatWide::MulAdd(GetChannel(Texel10, Channel) - C00, FractionX, C00);
+        const FFloatWide Bottom = FFloatWide::MulAdd(GetChannel(Texel11, Channel) - C01, FractionX, C01);
+        Channels[Channel] = FFloatWide::MulAdd(Bottom - Top, FractionY, Top) * Scale;
+    }
+    return { Channels[0], Channels[1], Channels[2], Channels[3] };
+}
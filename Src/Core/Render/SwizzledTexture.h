@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Color.h"
+#include "Base/VectorWide.h"
+
+enum class ETextureAddress
+{
+    Wrap,
+    Clamp
+};
+
+/**
+ * RGBA8 texture with a mip chain for CPU sampling, red in the lowest byte.
+ *
+ * Each level is split in TileSize x TileSize tiles stored one after the other, and the texels of a
+ * tile follow the Z-order curve of FMath::MortonCode2. Neighbors in both directions then share cache
+ * lines, so bilinear footprints and walks along any direction (rotated or minified lookups) touch a
+ * few lines per tile instead of one per row. Levels smaller than a tile only use the part of the
+ * curve they cover.
+ *
+ * The samplers take FFloatWide::Lanes texture coordinates per call. Texel centers are at
+ * (X + 0.5) / Width like on the GPU, and the result is in [0, 1] per channel. NaN and infinite
+ * coordinates sample the first texel center and NaN levels of detail level 0, so every lookup stays
+ * inside the texture.
+ */
+class CORE_API FSwizzledTexture
+{
+public:
+    static constexpr int32_t TileSizeLog2 = 5;
+    static constexpr int32_t TileSize = 1 << TileSizeLog2;
+
+    FSwizzledTexture();
+
+    /** Copies row-major texels, then box filters the mip chain down to 1x1 unless bGenerateMips is false. */
+    void Initialize(const uint32_t* InTexels, int32_t Width, int32_t Height, bool bGenerateMips = true);
+
+    int32_t GetNumLevels() const { return (int32_t)LevelWidths.size(); }
+    int32_t GetWidth(int32_t Level = 0) const { return LevelWidths[Level]; }
+    int32_t GetHeight(int32_t Level = 0) const { return LevelHeights[Level]; }
+
+    uint32_t GetTexel(int32_t X, int32_t Y, int32_t Level = 0) const
+    {
+        return Texels[GetTexelIndex(X, Y, Level)];
+    }
+
+    /** Position of texel (X, Y) of Level in the swizzled storage. */
+    size_t GetTexelIndex(int32_t X, int32_t Y, int32_t Level) const;
+
+    /** Copies a level back to row-major order. */
+    void ReadLevel(int32_t Level, uint32_t* OutTexels) const;
+
+    /** Bilinear filtering inside one mip level. */
+    FColorWide SampleBilinear(const FFloatWide& U, const FFloatWide& V, int32_t Level, ETextureAddress Address = ETextureAddress::Wrap) const;
+
+    /** Bilinear filtering of the two levels around each lane's Lod, blended linearly. Lod is clamped to the chain. */
+    FColorWide SampleTrilinear(const FFloatWide& U, const FFloatWide& V, const FFloatWide& Lod, ETextureAddress Address = ETextureAddress::Wrap) const;
+
+private:
+    /** Level parameters per lane, levels may differ between lanes. */
+    FColorWide SampleLevels(const FFloatWide& U, const FFloatWide& V, const FIntWide& Levels, ETextureAddress Address) const;
+
+private:
+    std::vector<uint32_t> Texels;
+
+    // Indexed by level, int32_t so the samplers can gather them
+    std::vector<int32_t> LevelWidths;
+    std::vector<int32_t> LevelHeights;
+    std::vector<int32_t> LevelTilesX;
+    std::vector<int32_t> LevelOffsets;
+};
@@ -0,0 +1,188 @@
+#include "ViewCulling.h"
+
+#include "Async/JobSystem.h"
+#include "Profiler/CpuProfiler.h"
+
+#include <cstring>
+
+namespace
+{
+    constexpr int32_t Lanes = FFloatWide::Lanes;
+    constexpr int32_t MinChunkSize = 4096;
+
+    struct FWidePlane
+    {
+        FFloatWide X, Y, Z, W;
+        FFloatWide AbsX, AbsY, AbsZ;
+    };
+
+    /** The planes of one view broadcast to every lane. */
+    struct FWideView
+    {
+        FWidePlane Planes[FFrustum::MaxPlanes];
+        int32_t NumPlanes = 0;
+
+        explicit FWideView(const FFrustum& Frustum)
+            : NumPlanes(Frustum.NumPlanes)
+        {
+            for (int32_t Index = 0; Index < NumPlanes; ++Index)
+            {
+                const FPlane& Plane = Frustum.Planes[Index];
+                Planes[Index] = { Plane.x, Plane.y, Plane.z, Plane.W, FMath::Abs(Plane.x), FMath::Abs(Plane.y), FMath::Abs(Plane.z) };
+            }
+        }
+
+        FWideView() = default;
+    };
+
+    FFloatWide LoadLanes(const float* Src, int32_t Index, int32_t Num)
+    {
+        return Num == Lanes ? FFloatWide::Load(Src + Index) : FFloatWide::LoadPartial(Src + Index, Num);
+    }
+
+    struct FBoxBlock
+    {
+        FFloatWide CenterX, CenterY, CenterZ;
+        FFloatWide ExtentX, ExtentY, ExtentZ;
+
+        FBoxBlock(const FBoxBoundsSoA& Bounds, int32_t Index, int32_t Num)
+            : CenterX(LoadLanes(Bounds.CenterX, Index, Num)), CenterY(LoadLanes(Bounds.CenterY, Index, Num)), CenterZ(LoadLanes(Bounds.CenterZ, Index, Num))
+            , ExtentX(LoadLanes(Bounds.ExtentX, Index, Num)), ExtentY(LoadLanes(Bounds.ExtentY, Index, Num)), ExtentZ(LoadLanes(Bounds.ExtentZ, Index, Num))
+        {
+        }
+
+        /** Outside once the center is further in front of a plane than the box's projected radius. */
+        FMaskWide IsInside(const FWidePlane& Plane) const
+        {
+            const FFloatWide Distance = FFloatWide::MulAdd(Plane.X, CenterX, FFloatWide::MulAdd(Plane.Y, CenterY, FFloatWide::MulAdd(Plane.Z, CenterZ, -Plane.W)));
+            const FFloatWide Radius = FFloatWide::MulAdd(Plane.AbsX, ExtentX, FFloatWide::MulAdd(Plane.AbsY, ExtentY, Plane.AbsZ * ExtentZ));
+            return Distance <= Radius;
+        }
+    };
+
+    struct FSphereBlock
+    {
+        FFloatWide CenterX, CenterY, CenterZ;
+        FFloatWide Radius;
+
+        FSphereBlock(const FSphereBoundsSoA& Bounds, int32_t Index, int32_t Num)
+            : CenterX(LoadLanes(Bounds.CenterX, Index, Num)), CenterY(LoadLanes(Bounds.CenterY, Index, Num)), CenterZ(LoadLanes(Bounds.CenterZ, Index, Num))
+            , Radius(LoadLanes(Bounds.Radius, Index, Num))
+        {
+        }
+
+        FMaskWide IsInside(const FWidePlane& Plane) const
+        {
+            const FFloatWide Distance = FFloatWide::MulAdd(Plane.X, CenterX, FFloatWide::MulAdd(Plane.Y, CenterY, FFloatWide::MulAdd(Plane.Z, CenterZ, -Plane.W)));
+            return Distance <= Radius;
+        }
+    };
+
+    template<typename TBlock>
+    uint32_t GetVisibleBits(const TBlock& Block, const FWideView& View)
+    {
+        if (View.NumPlanes == 0)
+        {
+            return ~0u;
+        }
+
+        FMaskWide Inside = Block.IsInside(View.Planes[0]);
+        for (int32_t Index = 1; Index < View.NumPlanes; ++Index)
+        {
+            Inside = Inside & Block.IsInside(View.Planes[Index]);
+        }
+        return Inside.GetBits();
+    }
+
+    /**
+     * Each chunk writes its visible indices at its own offset in the output arrays, the chunks'
+     * lists are then moved down to close the gaps. No counting pass, and the order stays ascending.
+     */
+    template<typename TBlock, typename TBounds>
+    void CullViews(const FFrustum* Views, int32_t NumViews, const TBounds& Bounds, int32_t* const* OutVisibleIndices, FViewCullingStats* OutStats)
+    {
+        const int32_t Num = FMath::Max(Bounds.Num, 0);
+        const int32_t NumChunks = FMath::Clamp((Num + MinChunkSize - 1) / MinChunkSize, 1, FJobSystem::Get().GetNumThreads() * 4);
+        const auto GetChunkBegin = [Num, NumChunks](int32_t Chunk)
+        {
+            // Lanes aligned so that only the last block of the array is partial
+            return Chunk == NumChunks ? Num : (int32_t)((int64_t)Num * Chunk / NumChunks) & ~(Lanes - 1);
+        };
+
+        std::vector<int32_t> ChunkCounts((size_t)NumChunks * FViewCulling::MaxViewsPerPass);
+        for (int32_t FirstView = 0; FirstView < NumViews; FirstView += FViewCulling::MaxViewsPerPass)
+        {
+            const int32_t NumPassViews = FMath::Min(NumViews - FirstView, FViewCulling::MaxViewsPerPass);
+            FWideView WideViews[FViewCulling::MaxViewsPerPass];
+            for (int32_t View = 0; View < NumPassViews; ++View)
+            {
+                WideViews[View] = FWideView(Views[FirstView + View]);
+            }
+
+            FJobSystem::Get().ParallelFor(NumChunks, [&](int32_t Chunk)
+                {
+                    const int32_t Begin = GetChunkBegin(Chunk);
+                    const int32_t End = GetChunkBegin(Chunk + 1);
+                    int32_t* Outputs[FViewCulling::MaxViewsPerPass];
+                    for (int32_t View = 0; View < NumPassViews; ++View)
+                    {
+                        Outputs[View] = OutVisibleIndices[FirstView + View] + Begin;
+                    }
+
+                    for (int32_t Index = Begin; Index < End; Index += Lanes)
+                    {
+                        const int32_t NumInBlock = FMath::Min(Lanes, End - Index);
+                        const TBlock Block(Bounds, Index, NumInBlock);
+                        const uint32_t ValidBits = (1u << NumInBlock) - 1;
+                        for (int32_t View = 0; View < NumPassViews; ++View)
+                        {
+                            // Every lane is written and the cursor only advances past visible ones, visibility is too random to branch on
+                            const uint32_t Bits = GetVisibleBits(Block, WideViews[View]) & ValidBits;
+                            int32_t* Output = Outputs[View];
+                            for (int32_t Lane = 0; Lane < NumInBlock; ++Lane)
+                            {
+                                *Output = Index + Lane;
+                                Output += (Bits >> Lane) & 1;
+                            }
+                            Outputs[View] = Output;
+                        }
+                    }
+
+                    for (int32_t View = 0; View < NumPassViews; ++View)
+                    {
+                        ChunkCounts[(size_t)Chunk * FViewCulling::MaxViewsPerPass + View] = (int32_t)(Outputs[View] - (OutVisibleIndices[FirstView + View] + Begin));
+                    }
+                });
+
+            for (int32_t View = 0; View < NumPassViews; ++View)
+            {
+                int32_t* Output = OutVisibleIndices[FirstView + View];
+                int32_t NumVisible = 0;
+                for (int32_t Chunk = 0; Chunk < NumChunks; ++Chunk)
+                {
+                    const int32_t Count = ChunkCounts[(size_t)Chunk * FViewCulling::MaxViewsPerPass + View];
+                    if (NumVisible != GetChunkBegin(Chunk))
+                    {
+                        memmove(Output + NumVisible, Output + GetChunkBegin(Chunk), Count * sizeof(int32_t));
+                    }
+                    NumVisible += Count;
+                }
+
+                OutStats[FirstView + View].NumTested = Num;
+                OutStats[FirstView + View].NumVisible = NumVisible;
+            }
+        }
+    }
+}
+
+void FViewCulling::CullBoxes(const FFrustum* Views, int32_t NumViews, const FBoxBoundsSoA& Bounds, int32_t* const* OutVisibleIndices, FViewCullingStats* OutStats)
+{
+    SCOPED_CPU_TIMER("FViewCulling::CullBoxes");
+    CullViews<FBoxBlock>(Views, NumViews, Bounds, OutVisibleIndices, OutStats);
+}
+
+void FViewCulling::CullSpheres(const FFrustum* Views, int32_t NumViews, const FSphereBoundsSoA& Bounds, int32_t* const* OutVisibleIndices, FViewCullingStats* OutStats)
+{
+    SCOPED_CPU_TIMER("FViewCulling::CullSpheres");
+    CullViews<FSphereBlock>(Views, NumViews, Bounds, OutVisibleIndices, OutStats);
+}
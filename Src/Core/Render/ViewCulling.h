@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Geometry/Frustum.h"
+
+/** Boxes in structure of arrays layout, box i is centered on (CenterX[i], CenterY[i], CenterZ[i]) with half size (ExtentX[i], ...). */
+struct FBoxBoundsSoA
+{
+    const float* CenterX = nullptr;
+    const float* CenterY = nullptr;
+    const float* CenterZ = nullptr;
+    const float* ExtentX = nullptr;
+    const float* ExtentY = nullptr;
+    const float* ExtentZ = nullptr;
+    int32_t Num = 0;
+};
+
+/** Spheres in structure of arrays layout. */
+struct FSphereBoundsSoA
+{
+    const float* CenterX = nullptr;
+    const float* CenterY = nullptr;
+    const float* CenterZ = nullptr;
+    const float* Radius = nullptr;
+    int32_t Num = 0;
+};
+
+/** Result of culling one view. */
+struct FViewCullingStats
+{
+    int32_t NumTested = 0;
+    int32_t NumVisible = 0;
+};
+
+/**
+ * Frustum culling of bounds arrays, FFloatWide::Lanes bounds per step and chunks of the arrays on
+ * the job system. Several views are culled in one pass over the bounds, which then stream through
+ * the cache once instead of once per view (shadow cascades, stereo).
+ *
+ * Visible indices are written in ascending order, each output array needs room for every input.
+ * The tests are the ones of FFrustum::IntersectBox and IntersectSphere, conservative near the
+ * frustum's edges.
+ */
+class CORE_API FViewCulling
+{
+public:
+    /** Returns the stats of each view in OutStats, which holds NumViews entries. */
+    static void CullBoxes(const FFrustum* Views, int32_t NumViews, const FBoxBoundsSoA& Bounds, int32_t* const* OutVisibleIndices, FViewCullingStats* OutStats);
+    static void CullSpheres(const FFrustum* Views, int32_t NumViews, const FSphereBoundsSoA& Bounds, int32_t* const* OutVisibleIndices, FViewCullingStats* OutStats);
+
+    static FViewCullingStats CullBoxes(const FFrustum& View, const FBoxBoundsSoA& Bounds, int32_t* OutVisibleIndices)
+    {
+        FViewCullingStats Stats;
+        CullBoxes(&View, 1, Bounds, &OutVisibleIndices, &Stats);
+        return Stats;
+    }
+
+    static FViewCullingStats CullSpheres(const FFrustum& View, const FSphereBoundsSoA& Bounds, int32_t* OutVisibleIndices)
+    {
+        FViewCullingStats Stats;
+        CullSpheres(&View, 1, Bounds, &OutVisibleIndices, &Stats);
+        return Stats;
+    }
+
+    /** Most views culled in one pass, more are culled in several. */
+    static constexpr int32_t MaxViewsPerPass = 8;
+};
@@ -0,0 +1,252 @@
+#include "CpuInfo.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if MIKASA_CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace
+{
+#if MIKASA_CPU_X86
+    struct FCpuidRegisters
+    {
+        uint32_t Eax = 0;
+        uint32_t Ebx = 0;
+        uint32_t Ecx = 0;
+        uint32_t Edx = 0;
+    };
+
+    FCpuidRegisters Cpuid(uint32_t Leaf, uint32_t SubLeaf = 0)
+    {
+        FCpuidRegisters Registers;
+#if defined(_MSC_VER)
+        int32_t Values[4];
+        __cpuidex(Values, (int32_t)Leaf, (int32_t)SubLeaf);
+        Registers.Eax = (uint32_t)Values[0];
+        Registers.Ebx = (uint32_t)Values[1];
+        Registers.Ecx = (uint32_t)Values[2];
+        Registers.Edx = (uint32_t)Values[3];
+#else
+        __cpuid_count(Leaf, SubLeaf, Registers.Eax, Registers.Ebx, Registers.Ecx, Registers.Edx);
+#endif
+        return Registers;
+    }
+
+    /** Register states the OS saves on context switches, XCR0. */
+    uint64_t GetEnabledXStates()
+    {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        uint32_t Low, High;
+        __asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+        return ((uint64_t)High << 32) | Low;
+#endif
+    }
+
+    bool HasBit(uint32_t Register, int32_t Bit)
+    {
+        return (Register >> Bit) & 1;
+    }
+#endif
+
+    FCpuFeatures DetectFeatures()
+    {
+        FCpuFeatures Features;
+#if MIKASA_CPU_X86
+        const FCpuidRegisters Leaf0 = Cpuid(0);
+        char Vendor[13] = {};
+        std::memcpy(Vendor, &Leaf0.Ebx, 4);
+        std::memcpy(Vendor + 4, &Leaf0.Edx, 4);
+        std::memcpy(Vendor + 8, &Leaf0.Ecx, 4);
+        Features.Vendor = Vendor;
+
+        if (Cpuid(0x80000000).Eax >= 0x80000004)
+        {
+            char Brand[49] = {};
+            for (uint32_t Leaf = 0; Leaf < 3; ++Leaf)
+            {
+                const FCpuidRegisters Registers = Cpuid(0x80000002 + Leaf);
+                std::memcpy(Brand + Leaf * 16, &Registers, 16);
+            }
+            Features.Brand = Brand;
+            Features.Brand.erase(0, Features.Brand.find_first_not_of(' '));
+        }
+
+        const uint32_t MaxLeaf = Leaf0.Eax;
+        if (MaxLeaf >= 1)
+        {
+            const FCpuidRegisters Leaf1 = Cpuid(1);
+            Features.bSSE2 = HasBit(Leaf1.Edx, 26);
+            Features.bSSE3 = HasBit(Leaf1.Ecx, 0);
+            Features.bSSSE3 = HasBit(Leaf1.Ecx, 9);
+            Features.bFMA = HasBit(Leaf1.Ecx, 12);
+            Features.bSSE41 = HasBit(Leaf1.Ecx, 19);
+            Features.bSSE42 = HasBit(Leaf1.Ecx, 20);
+            Features.bPOPCNT = HasBit(Leaf1.Ecx, 23);
+            Features.bF16C = HasBit(Leaf1.Ecx, 29);
+
+            // AVX registers are only usable when the OS saves them, which XCR0 tells once OSXSAVE is set
+            const bool bOSXSave = HasBit(Leaf1.Ecx, 27);
+            const uint64_t XStates = bOSXSave ? GetEnabledXStates() : 0;
+            const bool bYmmStates = (XStates & 0x6) == 0x6;
+            const bool bZmmStates = (XStates & 0xE6) == 0xE6;
+            Features.bAVX = HasBit(Leaf1.Ecx, 28) && bYmmStates;
+            Features.bFMA = Features.bFMA && bYmmStates;
+            Features.bF16C = Features.bF16C && bYmmStates;
+
+            if (MaxLeaf >= 7)
+            {
+                const FCpuidRegisters Leaf7 = Cpuid(7);
+                Features.bAVX2 = HasBit(Leaf7.Ebx, 5) && bYmmStates;
+                Features.bBMI2 = HasBit(Leaf7.Ebx, 8);
+                Features.bAVX512F = HasBit(Leaf7.Ebx, 16) && bZmmStates;
+                Features.bAVX512DQ = HasBit(Leaf7.Ebx, 17) && bZmmStates;
+                Features.bAVX512BW = HasBit(Leaf7.Ebx, 30) && bZmmStates;
+                Features.bAVX512VL = HasBit(Leaf7.Ebx, 31) && bZmmStates;
+            }
+        }
+#elif MIKASA_CPU_ARM64
+        // Advanced SIMD is mandatory on AArch64
+        Features.bNEON = true;
+#endif
+        return Features;
+    }
+
+    struct FCpuState
+    {
+        FCpuFeatures Features;
+        ESimdTier BestTier;
+        std::atomic<ESimdTier> ActiveTier;
+        std::atomic<uint32_t> Generation;
+
+        FCpuState()
+            : Features(DetectFeatures())
+            , BestTier(Features.GetBestTier())
+            , ActiveTier(BestTier)
+            , Generation(0)
+        {
+            ESimdTier Tier;
+            const char* Override = std::getenv("MIKASA_SIMD_TIER");
+            if (Override && FCpuInfo::ParseSimdTier(Override, Tier))
+            {
+                ActiveTier = ClampTier(Tier);
+            }
+        }
+
+        /** Tiers from another architecture fall back to scalar. */
+        ESimdTier ClampTier(ESimdTier Tier) const
+        {
+            if (Tier == ESimdTier::Scalar || (Tier == ESimdTier::NEON) != (BestTier == ESimdTier::NEON))
+            {
+                return ESimdTier::Scalar;
+            }
+            return Tier < BestTier ? Tier : BestTier;
+        }
+    };
+
+    FCpuState& GetState()
+    {
+        static FCpuState State;
+        return State;
+    }
+
+    const char* const TierNames[] = { "Scalar", "SSE2", "SSE42", "AVX", "AVX2", "AVX512", "NEON" };
+}
+
+ESimdTier FCpuFeatures::GetBestTier() const
+{
+    if (bNEON)
+    {
+        return ESimdTier::NEON;
+    }
+    if (!bSSE2)
+    {
+        return ESimdTier::Scalar;
+    }
+    if (!(bSSE3 && bSSSE3 && bSSE41 && bSSE42 && bPOPCNT))
+    {
+        return ESimdTier::SSE2;
+    }
+    if (!bAVX)
+    {
+        return ESimdTier::SSE42;
+    }
+    if (!(bAVX2 && bFMA && bF16C && bBMI2))
+    {
+        return ESimdTier::AVX;
+    }
+    if (!(bAVX512F && bAVX512BW && bAVX512DQ && bAVX512VL))
+    {
+        return ESimdTier::AVX2;
+    }
+    return ESimdTier::AVX512;
+}
+
+const FCpuFeatures& FCpuInfo::GetFeatures()
+{
+    return GetState().Features;
+}
+
+ESimdTier FCpuInfo::GetSimdTier()
+{
+    return GetState().ActiveTier.load(std::memory_order_relaxed);
+}
+
+void FCpuInfo::ForceSimdTier(ESimdTier Tier)
+{
+    FCpuState& State = GetState();
+    State.ActiveTier = State.ClampTier(Tier);
+    ++State.Generation;
+}
+
+void FCpuInfo::ResetSimdTier()
+{
+    FCpuState& State = GetState();
+    State.ActiveTier = State.BestTier;
+    ++State.Generation;
+}
+
+bool FCpuInfo::IsTierActive(ESimdTier Tier)
+{
+    const ESimdTier Active = GetSimdTier();
+    if (Tier == ESimdTier::Scalar)
+    {
+        return true;
+    }
+    if (Tier == ESimdTier::NEON || Active == ESimdTier::NEON)
+    {
+        return Tier == Active;
+    }
+    return Tier <= Active;
+}
+
+uint32_t FCpuInfo::GetTierGeneration()
+{
+    return GetState().Generation.load(std::memory_order_acquire);
+}
+
+const char* FCpuInfo::GetSimdTierName(ESimdTier Tier)
+{
+    return TierNames[(int32_t)Tier];
+}
+
+bool FCpuInfo::ParseSimdTier(const std::string& Name, ESimdTier& OutTier)
+{
+    for (int32_t Index = 0; Index < (int32_t)(sizeof(TierNames) / sizeof(TierNames[0])); ++Index)
+    {
+        if (Name == TierNames[Index])
+        {
+            OutTier = (ESimdTier)Index;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+#include <initializer_list>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MIKASA_CPU_X86 1
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define MIKASA_CPU_ARM64 1
+#endif
+
+// Lets a function use instructions beyond the build's baseline, to be called only after checking the tier.
+// MSVC accepts every intrinsic in any function and needs nothing.
+#if MIKASA_CPU_X86 && (defined(__GNUC__) || defined(__clang__))
+#define MIKASA_TARGET(Features) __attribute__((target(Features)))
+#else
+#define MIKASA_TARGET(Features)
+#endif
+
+/**
+ * Instruction set levels kernels are written for, each x86 tier includes the previous ones.
+ * SSE42 adds SSE3, SSSE3, SSE4.1 and POPCNT, AVX2 adds FMA, F16C and BMI2, and AVX512 is F, BW, DQ and VL.
+ */
+enum class ESimdTier : uint8_t
+{
+    Scalar,
+    SSE2,
+    SSE42,
+    AVX,
+    AVX2,
+    AVX512,
+    NEON,
+};
+
+struct FCpuFeatures
+{
+    std::string Vendor;
+    std::string Brand;
+
+    bool bSSE2 = false;
+    bool bSSE3 = false;
+    bool bSSSE3 = false;
+    bool bSSE41 = false;
+    bool bSSE42 = false;
+    bool bPOPCNT = false;
+    bool bAVX = false;
+    bool bAVX2 = false;
+    bool bFMA = false;
+    bool bF16C = false;
+    bool bBMI2 = false;
+    bool bAVX512F = false;
+    bool bAVX512BW = false;
+    bool bAVX512DQ = false;
+    bool bAVX512VL = false;
+    bool bNEON = false;
+
+    /** Highest tier whose instructions are all supported, by the CPU and for AVX registers by the OS. */
+    ESimdTier GetBestTier() const;
+};
+
+/**
+ * CPU feature detection and the SIMD tier used by dispatched kernels. Features are read once with
+ * CPUID (and XGETBV for the OS side of AVX). The active tier is the best supported one unless it
+ * was lowered, by the MIKASA_SIMD_TIER environment variable at startup or by ForceSimdTier, which
+ * makes it possible to test and benchmark every kernel variant on one machine.
+ *
+ * Code compiled for the build's baseline (FFloatWide and everything built on it) is not affected by
+ * the tier, only kernels dispatched with TSimdKernel are, among them the FMath and FColor array
+ * functions (Base/SimdKernels.h).
+ */
+class CORE_API FCpuInfo
+{
+public:
+    static const FCpuFeatures& GetFeatures();
+
+    static ESimdTier GetSimdTier();
+
+    /**
+     * Caps the active tier, tiers above the best supported one are clamped to it. Kernels pick it up on
+     * their next call, call it while no dispatched kernel is running.
+     */
+    static void ForceSimdTier(ESimdTier Tier);
+
+    /** Back to the best supported tier. */
+    static void ResetSimdTier();
+
+    /** Whether kernels written for Tier may run with the active tier. */
+    static bool IsTierActive(ESimdTier Tier);
+
+    /** Incremented whenever the active tier changes, lets dispatched kernels cache their choice. */
+    static uint32_t GetTierGeneration();
+
+    static const char* GetSimdTierName(ESimdTier Tier);
+
+    /** Case sensitive tier name as returned by GetSimdTierName, false if Name is none of them. */
+    static bool ParseSimdTier(const std::string& Name, ESimdTier& OutTier);
+};
+
+/**
+ * A kernel with one implementation per SIMD tier, calls go to the best variant allowed by the
+ * active tier. The choice is made on the first call and again after the tier was forced, other calls
+ * cost one atomic load and an indirect call. A Scalar variant is required as the last resort.
+ *
+ *     static const TSimdKernel<void(const float*, int32_t, float*)> ScaleKernel =
+ *     {
+ *         { ESimdTier::Scalar, &ScaleScalar },
+ *         { ESimdTier::AVX2, &ScaleAVX2 },
+ *     };
+ *     ScaleKernel(Values, NumValues, OutValues);
+ */
+template <typename FunctionType>
+class TSimdKernel
+{
+public:
+    struct FVariant
+    {
+        ESimdTier Tier;
+        FunctionType* Function;
+    };
+
+    static constexpr int32_t MaxVariants = 8;
+
+    TSimdKernel(std::initializer_list<FVariant> InVariants)
+        : NumVariants(0)
+        , CachedFunction(nullptr)
+        , CachedGeneration(~0u)
+    {
+        for (const FVariant& Variant : InVariants)
+        {
+            if (NumVariants < MaxVariants)
+            {
+                Variants[NumVariants++] = Variant;
+            }
+        }
+    }
+
+    FunctionType* Get() const
+    {
+        const uint32_t Generation = FCpuInfo::GetTierGeneration();
+        if (CachedGeneration.load(std::memory_order_acquire) != Generation)
+        {
+            // Concurrent first calls may all resolve, they store the same function
+            CachedFunction.store(Resolve(), std::memory_order_relaxed);
+            CachedGeneration.store(Generation, std::memory_order_release);
+        }
+        return CachedFunction.load(std::memory_order_relaxed);
+    }
+
+    template <typename... ArgTypes>
+    decltype(auto) operator()(ArgTypes&&... Args) const
+    {
+        return Get()(std::forward<ArgTypes>(Args)...);
+    }
+
+private:
+    FunctionType* Resolve() const
+    {
+        FunctionType* Best = nullptr;
+        ESimdTier BestTier = ESimdTier::Scalar;
+        for (int32_t Index = 0; Index < NumVariants; ++Index)
+        {
+            const FVariant& Variant = Variants[Index];
+            if (FCpuInfo::IsTierActive(Variant.Tier) && (!Best || Variant.Tier > BestTier))
+            {
+                Best = Variant.Function;
+                BestTier = Variant.Tier;
+            }
+        }
+        return Best;
+    }
+
+private:
+    FVariant Variants[MaxVariants];
+    int32_t NumVariants;
+
+    mutable std::atomic<FunctionType*> CachedFunction;
+    mutable std::atomic<uint32_t> CachedGeneration;
+};
@@ -0,0 +1,227 @@
+#include "CoreMinimal.h"
+
+#include <chrono>
+#include <thread>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+#include "Render/RenderManager.h"
+#include "Render/Display/Display.h"
+
+#include "Base/Color.h"
+
+namespace
+{
+    uint32_t PackColorRGBA8(const FColor& Color)
+    {
+        auto Quantize = [](float Value) -> uint32_t
+        {
+            Value = Value < 0.0f ? 0.0f : (Value > 1.0f ? 1.0f : Value);
+            return (uint32_t)(Value * 255.0f + 0.5f);
+        };
+
+        return Quantize(Color.R) | (Quantize(Color.G) << 8) | (Quantize(Color.B) << 16) | (Quantize(Color.A) << 24);
+    }
+
+    /**
+     * Fills a 32 bit framebuffer with one value. The framebuffer is far larger than the caches,
+     * so the vector path uses non-temporal stores to avoid reading every line back before writing it.
+     */
+    void ClearFramebuffer(uint32_t* Pixels, size_t NumPixels, uint32_t Value)
+    {
+        size_t Index = 0;
+
+#if defined(__AVX__)
+        for (; Index < NumPixels && ((uintptr_t)(Pixels + Index) & 31) != 0; ++Index)
+        {
+            Pixels[Index] = Value;
+        }
+
+        const __m256i Fill = _mm256_set1_epi32((int32_t)Value);
+        for (; Index + 16 <= NumPixels; Index += 16)
+        {
+            _mm256_stream_si256((__m256i*)(Pixels + Index), Fill);
+            _mm256_stream_si256((__m256i*)(Pixels + Index + 8), Fill);
+        }
+        _mm_sfence();
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        for (; Index < NumPixels && ((uintptr_t)(Pixels + Index) & 15) != 0; ++Index)
+        {
+            Pixels[Index] = Value;
+        }
+
+        const __m128i Fill = _mm_set1_epi32((int32_t)Value);
+        for (; Index + 16 <= NumPixels; Index += 16)
+        {
+            _mm_stream_si128((__m128i*)(Pixels + Index), Fill);
+            _mm_stream_si128((__m128i*)(Pixels + Index + 4), Fill);
+            _mm_stream_si128((__m128i*)(Pixels + Index + 8), Fill);
+            _mm_stream_si128((__m128i*)(Pixels + Index + 12), Fill);
+        }
+        _mm_sfence();
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+        const uint32x4_t Fill = vdupq_n_u32(Value);
+        for (; Index + 16 <= NumPixels; Index += 16)
+        {
+            vst1q_u32(Pixels + Index, Fill);
+            vst1q_u32(Pixels + Index + 4, Fill);
+            vst1q_u32(Pixels + Index + 8, Fill);
+            vst1q_u32(Pixels + Index + 12, Fill);
+        }
+#endif
+
+        for (; Index < NumPixels; ++Index)
+        {
+            Pixels[Index] = Value;
+        }
+    }
+}
+
+/**
+ * Display backend without window or GPU. It renders into a CPU framebuffer and emulates
+ * the present interval, so the frame loop can run on machines without a display server.
+ */
+class FDisplayHeadless : public FDisplay
+{
+public:
+    FDisplayHeadless()
+        : FDisplay()
+        , DisplaySize(FDisplaySize::WIN_1600_900)
+        , BGColor(FColor::BlackColor)
+        , Title("Mikasa")
+        , bVSync(false)
+        , bShouldClose(false)
+        , Width(0)
+        , Height(0)
+    {
+    }
+
+    virtual ~FDisplayHeadless()
+    {
+        DestroyDisplay();
+    }
+
+    virtual void InitDisplay() override
+    {
+        ResizeFramebuffer();
+        LastPresentTime = std::chrono::steady_clock::now();
+        bShouldClose = false;
+    }
+
+    virtual void RefreshDisplay() override
+    {
+        ClearFramebuffer(Framebuffer.data(), Framebuffer.size(), PackColorRGBA8(BGColor));
+    }
+
+    virtual void DestroyDisplay() override
+    {
+        Framebuffer.clear();
+        Framebuffer.shrink_to_fit();
+        Width = 0;
+        Height = 0;
+    }
+
+    virtual void CloseDisplay() override
+    {
+        bShouldClose = true;
+    }
+
+    virtual bool ShouldCloseDisplay() override
+    {
+        return bShouldClose;
+    }
+
+    virtual void SwapBuffers() override
+    {
+        if (bVSync)
+        {
+            const auto NextPresentTime = LastPresentTime + PresentInterval;
+            std::this_thread::sleep_until(NextPresentTime);
+
+            // Stay on the refresh grid unless we already missed a whole interval
+            const auto Now = std::chrono::steady_clock::now();
+            LastPresentTime = (Now - NextPresentTime < PresentInterval) ? NextPresentTime : Now;
+        }
+        else
+        {
+            LastPresentTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    virtual void SetDisplaySize(const FDisplaySize& InDisplaySize) override
+    {
+        DisplaySize = InDisplaySize;
+        if (!Framebuffer.empty())
+        {
+            ResizeFramebuffer();
+        }
+    }
+
+    virtual void SetVSync(bool Enable) override
+    {
+        bVSync = Enable;
+    }
+
+    virtual void SetInitBackground(const FColor& Color) override
+    {
+        BGColor = Color;
+    }
+
+    virtual void SetTitle(const std::string& InTitle) override
+    {
+        Title = InTitle;
+    }
+
+private:
+    void ResizeFramebuffer()
+    {
+        // Full screen has no meaning without a monitor, fall back to the default window size
+        Width = DisplaySize.GetWidth() > 0 ? DisplaySize.GetWidth() : FDisplaySize::WIN_1600_900.GetWidth();
+        Height = DisplaySize.GetHeight() > 0 ? DisplaySize.GetHeight() : FDisplaySize::WIN_1600_900.GetHeight();
+
+        Framebuffer.assign((size_t)Width * (size_t)Height, 0);
+    }
+
+private:
+    // Emulated 60 Hz refresh used when VSync is enabled
+    static constexpr std::chrono::nanoseconds PresentInterval = std::chrono::nanoseconds(16666667);
+
+    FDisplaySize DisplaySize;
+    FColor BGColor;
+    std::string Title;
+    bool bVSync;
+    bool bShouldClose;
+
+    int32_t Width;
+    int32_t Height;
+    std::vector<uint32_t> Framebuffer;
+    std::chrono::steady_clock::time_point LastPresentTime;
+};
+
+class FDisplayRegisterHeadless
+{
+public:
+    FDisplayRegisterHeadless()
+    {
+        FRenderManager::Get().RegisterDisplay("Headless", []() -> FDisplayPtr
+            {
+                return std::make_shared<FDisplayHeadless>();
+            });
+    }
+
+    ~FDisplayRegisterHeadless()
+    {
+        FRenderManager::Get().UnRegisterDisplay("Headless");
+    }
+};
+
+namespace
+{
+    FDisplayRegisterHeadless DisplayHeadless;
+}
@@ -1,4 +1,5 @@
 ﻿#include <iostream>
+#include <chrono>
 
 #include <Windows.h>
 
@@ -7,31 +8,183 @@
 #include "CoreMinimal.h"
 #include "Render/RenderManager.h"
 #include "Render/Display/Display.h"
+#include "Async/JobSystem.h"
+#include "Profiler/CpuProfiler.h"
+#include "Util/CpuInfo.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+namespace
+{
+    /**
+     * Spinning vertex colored cube over a ground plane, drawn by displays with a triangle path.
+     * The arrays live as long as the program, only the camera is recorded per frame.
+     */
+    class FDemoScene
+    {
+    public:
+        FDemoScene()
+        {
+            const uint32_t CornerColors[8] = { 0xFF0000FF, 0xFF00FF00, 0xFFFF0000, 0xFF00FFFF, 0xFFFF00FF, 0xFFFFFF00, 0xFFFFFFFF, 0xFF404040 };
+            for (int32_t Corner = 0; Corner < 8; ++Corner)
+            {
+                Positions.emplace_back((Corner & 1) ? 1.0f : -1.0f, (Corner & 2) ? 1.0f : -1.0f, (Corner & 4) ? 1.0f : -1.0f);
+                Colors.push_back(CornerColors[Corner]);
+            }
+            Indices = { 0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4, 2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5 };
+
+            // Large enough to cross the near plane below the camera
+            const int32_t FirstGroundVertex = (int32_t)Positions.size();
+            for (int32_t Corner = 0; Corner < 4; ++Corner)
+            {
+                Positions.emplace_back((Corner & 1) ? 50.0f : -50.0f, -1.5f, (Corner & 2) ? 50.0f : -50.0f);
+                Colors.push_back((Corner & 1) ? 0xFF306030 : 0xFF203020);
+            }
+            for (const int32_t Index : { 0, 1, 2, 1, 3, 2 })
+            {
+                Indices.push_back(FirstGroundVertex + Index);
+            }
+        }
+
+        void Draw(int64_t FrameIndex)
+        {
+            const float Angle = FrameIndex * 0.02f;
+            const glm::mat4 Projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+            const glm::mat4 View = glm::lookAt(glm::vec3(4.0f * glm::sin(Angle), 2.0f, 4.0f * glm::cos(Angle)), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+            // The command references the matrix, which the frame arena keeps until the frame is presented
+            FFrameArena& Arena = FRenderManager::Get().GetFrameArena();
+            const glm::mat4* ViewProjection = Arena.New<glm::mat4>(Projection * View);
+            FRenderManager::Get().EnqueueRenderCommand(FDrawTrianglesCommand(ViewProjection, Positions.data(), Colors.data(), (int32_t)Positions.size(), Indices.data(), (int32_t)Indices.size()));
+        }
+
+    private:
+        std::vector<MVector> Positions;
+        std::vector<uint32_t> Colors;
+        std::vector<int32_t> Indices;
+    };
+}
 
 //void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 //void processInput(GLFWwindow* window);
 
-int main()
+int main(int argc, char* argv[])
 {
+    // -Headless selects the GPU-less backend, -Software the CPU rasterizer, -SyncRender presents
+    // on the main thread, -Frames=N closes the display after N frames, -Screenshot=File writes the
+    // last frame as a PPM image (software backend), -Trace=File writes a Chrome trace of the
+    // last -TraceFrames=N frames (all by default) on exit, -SimdTier=Name caps the dispatched SIMD
+    // kernels to a lower instruction set (Scalar, SSE2, SSE42, AVX, AVX2, AVX512)
+    int64_t MaxFrames = 0;
+    std::string ScreenshotPath;
+    std::string TracePath;
+    for (int ArgIndex = 1; ArgIndex < argc; ++ArgIndex)
+    {
+        const std::string Arg = argv[ArgIndex];
+        if (Arg == "-Headless")
+        {
+            FRenderManager::Get().SetRenderType(ERenderType::Headless);
+        }
+        else if (Arg == "-Software")
+        {
+            FRenderManager::Get().SetRenderType(ERenderType::Software);
+        }
+        else if (Arg == "-SyncRender")
+        {
+            FRenderManager::Get().SetRenderThreadMode(ERenderThreadMode::Sync);
+        }
+        else if (Arg.rfind("-Frames=", 0) == 0)
+        {
+            MaxFrames = std::stoll(Arg.substr(8));
+        }
+        else if (Arg.rfind("-Screenshot=", 0) == 0)
+        {
+            ScreenshotPath = Arg.substr(12);
+        }
+        else if (Arg.rfind("-Trace=", 0) == 0)
+        {
+            TracePath = Arg.substr(7);
+            FCpuProfiler::Get().SetEnabled(true);
+        }
+        else if (Arg.rfind("-TraceFrames=", 0) == 0)
+        {
+            FCpuProfiler::Get().SetFrameHistory((uint32_t)std::stoul(Arg.substr(13)));
+        }
+        else if (Arg.rfind("-SimdTier=", 0) == 0)
+        {
+            ESimdTier Tier;
+            if (FCpuInfo::ParseSimdTier(Arg.substr(10), Tier))
+            {
+                FCpuInfo::ForceSimdTier(Tier);
+            }
+            else
+            {
+                std::cout << "Unknown SIMD tier " << Arg.substr(10) << std::endl;
+            }
+        }
+    }
+
+    FCpuProfiler::Get().SetThreadName("GameThread");
     FRenderManager::Get().InitRenderStatus();
 
     FDisplayPtr Display = FRenderManager::Get().GetDisplay();
+
+    FDemoScene DemoScene;
+
+    int64_t FrameCount = 0;
+    const auto LoopStartTime = std::chrono::steady_clock::now();
     
     // render loop
     // -----------
     while (!Display->ShouldCloseDisplay())
     {
-        Display->RefreshDisplay();
+        // glfw: poll IO events (keys pressed/released, mouse moved etc.)
+        // --------------------------------------------------------------
+        Display->PollEvents();
+
+        DemoScene.Draw(FrameCount);
+
+        // hand the frame to the render thread, which refreshes and swaps buffers
+        // -----------------------------------------------------------------------
+        FRenderManager::Get().SubmitFrame();
 
-        // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-        // -------------------------------------------------------------------------------
-        Display->SwapBuffers();
+        if (++FrameCount == MaxFrames)
+        {
+            Display->CloseDisplay();
+        }
+    }
 
+    // Executed by the shutdown below, after the last frame was presented
+    if (!ScreenshotPath.empty())
+    {
+        FRenderManager::Get().EnqueueRenderCommand(FSaveScreenshotCommand(FRenderManager::Get().GetFrameArena(), ScreenshotPath));
     }
 
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
-    Display->DestroyDisplay();
+    FRenderManager::Get().ShutdownRenderStatus();
+
+    // Joins the job workers while Core is still loaded, not from its static destructors
+    FJobSystem::Get().Shutdown();
+
+    const std::chrono::duration<double, std::milli> LoopTime = std::chrono::steady_clock::now() - LoopStartTime;
+    if (FrameCount > 0)
+    {
+        const FRenderStats Stats = FRenderManager::Get().GetRenderStats();
+        std::cout << "Frames: " << FrameCount
+            << ", Total: " << LoopTime.count() << " ms"
+            << ", Frame: " << LoopTime.count() / FrameCount << " ms"
+            << ", FPS: " << FrameCount * 1000.0 / LoopTime.count()
+            << ", Rendered: " << Stats.NumFramesRendered
+            << ", Dropped: " << Stats.NumFramesDropped
+            << ", Frame arena heap allocations: " << Stats.NumFrameArenaHeapAllocations
+            << ", Last frame heap allocations: " << Stats.NumFrameHeapAllocations << std::endl;
+    }
+
+    if (!TracePath.empty() && !FCpuProfiler::Get().SaveTrace(TracePath))
+    {
+        std::cout << "Failed to write trace " << TracePath << std::endl;
+    }
     return 0;
 }
 
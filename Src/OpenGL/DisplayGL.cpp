@@ -69,9 +69,23 @@ public:
     virtual void SwapBuffers() override
     {
         glfwSwapBuffers(Window);
+    }
+
+    virtual void PollEvents() override
+    {
         glfwPollEvents();
     }
 
+    virtual void AttachToCurrentThread() override
+    {
+        glfwMakeContextCurrent(Window);
+    }
+
+    virtual void DetachFromCurrentThread() override
+    {
+        glfwMakeContextCurrent(NULL);
+    }
+
     virtual void SetDisplaySize(const FDisplaySize& InDisplaySize) override
     {
         DisplaySize = InDisplaySize;
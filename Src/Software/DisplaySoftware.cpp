@@ -0,0 +1,211 @@
+#include "CoreMinimal.h"
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include "Render/RenderManager.h"
+#include "Render/Display/Display.h"
+
+#include "Base/Color.h"
+
+#include "SoftwareRasterizer.h"
+
+namespace
+{
+    uint32_t PackColorRGBA8(const FColor& Color)
+    {
+        auto Quantize = [](float Value) -> uint32_t
+        {
+            Value = Value < 0.0f ? 0.0f : (Value > 1.0f ? 1.0f : Value);
+            return (uint32_t)(Value * 255.0f + 0.5f);
+        };
+
+        return Quantize(Color.R) | (Quantize(Color.G) << 8) | (Quantize(Color.B) << 16) | (Quantize(Color.A) << 24);
+    }
+}
+
+/**
+ * Display backend drawing with FSoftwareRasterizer on the job system, without window or GPU.
+ * Frames are deterministic whatever the core count, which makes them usable for image comparisons
+ * and thumbnails on machines without a display server. Presenting is emulated like the headless display.
+ */
+class FDisplaySoftware : public FDisplay
+{
+public:
+    FDisplaySoftware()
+        : FDisplay()
+        , DisplaySize(FDisplaySize::WIN_1600_900)
+        , BGColor(FColor::BlackColor)
+        , Title("Mikasa")
+        , bVSync(false)
+        , bShouldClose(false)
+    {
+    }
+
+    virtual ~FDisplaySoftware()
+    {
+        DestroyDisplay();
+    }
+
+    virtual void InitDisplay() override
+    {
+        ResizeFramebuffer();
+        LastPresentTime = std::chrono::steady_clock::now();
+        bShouldClose = false;
+    }
+
+    virtual void RefreshDisplay() override
+    {
+        Rasterizer.BeginFrame(PackColorRGBA8(BGColor));
+        for (const FDrawTrianglesCommand& Command : PendingDraws)
+        {
+            Rasterizer.DrawTriangles(*Command.ViewProjection, Command.Positions, Command.Colors, Command.NumVertices, Command.Indices, Command.NumIndices);
+        }
+        PendingDraws.clear();
+
+        Rasterizer.Render();
+    }
+
+    virtual void DestroyDisplay() override
+    {
+        PendingDraws.clear();
+        Rasterizer = FSoftwareRasterizer();
+    }
+
+    virtual void CloseDisplay() override
+    {
+        bShouldClose = true;
+    }
+
+    virtual bool ShouldCloseDisplay() override
+    {
+        return bShouldClose;
+    }
+
+    virtual void SwapBuffers() override
+    {
+        if (bVSync)
+        {
+            const auto NextPresentTime = LastPresentTime + PresentInterval;
+            std::this_thread::sleep_until(NextPresentTime);
+
+            const auto Now = std::chrono::steady_clock::now();
+            LastPresentTime = (Now - NextPresentTime < PresentInterval) ? NextPresentTime : Now;
+        }
+        else
+        {
+            LastPresentTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    virtual void SetDisplaySize(const FDisplaySize& InDisplaySize) override
+    {
+        DisplaySize = InDisplaySize;
+        if (Rasterizer.GetWidth() > 0)
+        {
+            ResizeFramebuffer();
+        }
+    }
+
+    virtual void SetVSync(bool Enable) override
+    {
+        bVSync = Enable;
+    }
+
+    virtual void SetInitBackground(const FColor& Color) override
+    {
+        BGColor = Color;
+    }
+
+    virtual void SetTitle(const std::string& InTitle) override
+    {
+        Title = InTitle;
+    }
+
+    virtual void BeginFrame(uint64_t /*FrameNumber*/) override
+    {
+        // Whatever is still queued belongs to a dropped frame, drawing it as well would ghost
+        PendingDraws.clear();
+    }
+
+    virtual void DrawTriangles(const FDrawTrianglesCommand& Command) override
+    {
+        // Binned when the frame is refreshed, the arrays stay valid until it is presented
+        PendingDraws.push_back(Command);
+    }
+
+    virtual bool SaveScreenshot(const std::string& Path) override
+    {
+        const int32_t Width = Rasterizer.GetWidth();
+        const int32_t Height = Rasterizer.GetHeight();
+        if (Width <= 0 || Height <= 0)
+        {
+            return false;
+        }
+
+        // Binary PPM, readable by every image tool without an encoder dependency
+        std::ofstream File(Path, std::ios::binary);
+        File << "P6\n" << Width << " " << Height << "\n255\n";
+
+        std::vector<char> Row((size_t)Width * 3);
+        for (int32_t Y = 0; Y < Height; ++Y)
+        {
+            const uint32_t* Pixels = Rasterizer.GetPixels() + (size_t)Y * Rasterizer.GetPitch();
+            for (int32_t X = 0; X < Width; ++X)
+            {
+                Row[X * 3] = (char)(Pixels[X] & 0xFF);
+                Row[X * 3 + 1] = (char)((Pixels[X] >> 8) & 0xFF);
+                Row[X * 3 + 2] = (char)((Pixels[X] >> 16) & 0xFF);
+            }
+            File.write(Row.data(), Row.size());
+        }
+        return File.good();
+    }
+
+private:
+    void ResizeFramebuffer()
+    {
+        // Full screen has no meaning without a monitor, fall back to the default window size
+        const int32_t Width = DisplaySize.GetWidth() > 0 ? DisplaySize.GetWidth() : FDisplaySize::WIN_1600_900.GetWidth();
+        const int32_t Height = DisplaySize.GetHeight() > 0 ? DisplaySize.GetHeight() : FDisplaySize::WIN_1600_900.GetHeight();
+
+        Rasterizer.Resize(Width, Height);
+    }
+
+private:
+    // Emulated 60 Hz refresh used when VSync is enabled
+    static constexpr std::chrono::nanoseconds PresentInterval = std::chrono::nanoseconds(16666667);
+
+    FDisplaySize DisplaySize;
+    FColor BGColor;
+    std::string Title;
+    bool bVSync;
+    bool bShouldClose;
+
+    FSoftwareRasterizer Rasterizer;
+    std::vector<FDrawTrianglesCommand> PendingDraws;
+    std::chrono::steady_clock::time_point LastPresentTime;
+};
+
+class FDisplayRegisterSoftware
+{
+public:
+    FDisplayRegisterSoftware()
+    {
+        FRenderManager::Get().RegisterDisplay("Software", []() -> FDisplayPtr
+            {
+                return std::make_shared<FDisplaySoftware>();
+            });
+    }
+
+    ~FDisplayRegisterSoftware()
+    {
+        FRenderManager::Get().UnRegisterDisplay("Software");
+    }
+};
+
+namespace
+{
+    FDisplayRegisterSoftware DisplaySoftware;
+}
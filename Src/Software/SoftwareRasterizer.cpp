@@ -0,0 +1,369 @@
+#include "SoftwareRasterizer.h"
+
+#include "Async/JobSystem.h"
+#include "Base/MathUtil.h"
+#include "Base/VectorWide.h"
+#include "Profiler/CpuProfiler.h"
+
+namespace
+{
+    constexpr int32_t Lanes = FFloatWide::Lanes;
+    constexpr int32_t MinTrianglesPerBin = 256;
+    constexpr int32_t NumColorAttributes = 4;
+
+    /** Index of the first color in FSetupTriangle::Attributes, after depth and 1 / w. */
+    constexpr int32_t FirstColorAttribute = 2;
+
+    glm::vec4 UnpackColor(uint32_t Color)
+    {
+        return glm::vec4(Color & 0xFF, (Color >> 8) & 0xFF, (Color >> 16) & 0xFF, Color >> 24) * (1.0f / 255.0f);
+    }
+}
+
+FSoftwareRasterizer::FSoftwareRasterizer()
+    : Width(0), Height(0), NumTilesX(0), NumTilesY(0), ClearColor(0), NumUsedBins(0)
+{
+}
+
+void FSoftwareRasterizer::Resize(int32_t InWidth, int32_t InHeight)
+{
+    Width = FMath::Max(InWidth, 1);
+    Height = FMath::Max(InHeight, 1);
+    NumTilesX = (Width + TileSize - 1) / TileSize;
+    NumTilesY = (Height + TileSize - 1) / TileSize;
+
+    // Padded to whole tiles, so pixel blocks never need a partial store
+    const size_t NumTiles = (size_t)NumTilesX * NumTilesY;
+    Pixels.assign(NumTiles * TileSize * TileSize, 0);
+    TileDepth.assign(NumTiles * TileSize * TileSize, 1.0f);
+
+    for (FTriangleBin& Bin : Bins)
+    {
+        Bin.Triangles.clear();
+        Bin.TileTriangles.assign(NumTiles, std::vector<int32_t>());
+    }
+    NumUsedBins = 0;
+}
+
+void FSoftwareRasterizer::BeginFrame(uint32_t InClearColor)
+{
+    ClearColor = InClearColor;
+
+    // Cleared but not freed, steady frames bin without allocating
+    for (int32_t BinIndex = 0; BinIndex < NumUsedBins; ++BinIndex)
+    {
+        Bins[BinIndex].Triangles.clear();
+        for (std::vector<int32_t>& TileTriangles : Bins[BinIndex].TileTriangles)
+        {
+            TileTriangles.clear();
+        }
+    }
+    NumUsedBins = 0;
+}
+
+void FSoftwareRasterizer::DrawTriangles(const glm::mat4& ViewProjection, const MVector* Positions, const uint32_t* Colors, int32_t NumVertices, const int32_t* Indices, int32_t NumIndices)
+{
+    SCOPED_CPU_TIMER("FSoftwareRasterizer::DrawTriangles");
+
+    const int32_t NumTriangles = NumIndices / 3;
+    if (NumTriangles <= 0 || NumVertices <= 0 || Pixels.empty())
+    {
+        return;
+    }
+
+    ClipVertices.resize(NumVertices);
+    FJobSystem::Get().ParallelForRange(NumVertices, [&](int32_t Begin, int32_t End)
+        {
+            for (int32_t Index = Begin; Index < End; ++Index)
+            {
+                ClipVertices[Index].Position = ViewProjection * glm::vec4(Positions[Index].x, Positions[Index].y, Positions[Index].z, 1.0f);
+                ClipVertices[Index].Color = UnpackColor(Colors[Index]);
+            }
+        }, 1024);
+
+    // One bin per contiguous range of triangles, kept in submission order
+    const int32_t NumBins = FMath::Clamp((NumTriangles + MinTrianglesPerBin - 1) / MinTrianglesPerBin, 1, FJobSystem::Get().GetNumThreads() * 4);
+    const int32_t FirstBin = NumUsedBins;
+    NumUsedBins += NumBins;
+    if ((int32_t)Bins.size() < NumUsedBins)
+    {
+        Bins.resize(NumUsedBins);
+        for (FTriangleBin& Bin : Bins)
+        {
+            Bin.TileTriangles.resize((size_t)NumTilesX * NumTilesY);
+        }
+    }
+
+    FJobSystem::Get().ParallelFor(NumBins, [&](int32_t BinIndex)
+        {
+            FTriangleBin& Bin = Bins[FirstBin + BinIndex];
+            const int32_t Begin = (int32_t)((int64_t)NumTriangles * BinIndex / NumBins);
+            const int32_t End = (int32_t)((int64_t)NumTriangles * (BinIndex + 1) / NumBins);
+
+            for (int32_t Index = Begin; Index < End; ++Index)
+            {
+                const FClipVertex* Vertices[3] =
+                {
+                    &ClipVertices[Indices[Index * 3]], &ClipVertices[Indices[Index * 3 + 1]], &ClipVertices[Indices[Index * 3 + 2]]
+                };
+
+                // Sutherland-Hodgman against z >= -w, the other planes are handled in screen space
+                FClipVertex Clipped[4];
+                int32_t NumClipped = 0;
+                for (int32_t Vertex = 0; Vertex < 3; ++Vertex)
+                {
+                    const FClipVertex& Current = *Vertices[Vertex];
+                    const FClipVertex& Next = *Vertices[(Vertex + 1) % 3];
+                    const float CurrentDistance = Current.Position.z + Current.Position.w;
+                    const float NextDistance = Next.Position.z + Next.Position.w;
+                    if (CurrentDistance >= 0.0f)
+                    {
+                        Clipped[NumClipped++] = Current;
+                    }
+                    if ((CurrentDistance >= 0.0f) != (NextDistance >= 0.0f))
+                    {
+                        const float Alpha = CurrentDistance / (CurrentDistance - NextDistance);
+                        Clipped[NumClipped].Position = glm::mix(Current.Position, Next.Position, Alpha);
+                        Clipped[NumClipped].Color = glm::mix(Current.Color, Next.Color, Alpha);
+                        ++NumClipped;
+                    }
+                }
+
+                for (int32_t Vertex = 2; Vertex < NumClipped; ++Vertex)
+                {
+                    FSetupTriangle Triangle;
+                    if (SetupTriangle(Clipped[0], Clipped[Vertex - 1], Clipped[Vertex], Triangle))
+                    {
+                        BinTriangle(Triangle, Bin);
+                    }
+                }
+            }
+        });
+}
+
+bool FSoftwareRasterizer::SetupTriangle(const FClipVertex& V0, const FClipVertex& V1, const FClipVertex& V2, FSetupTriangle& OutTriangle) const
+{
+    const FClipVertex* Vertices[3] = { &V0, &V1, &V2 };
+    float X[3];
+    float Y[3];
+    float Attributes[6][3];
+    for (int32_t Vertex = 0; Vertex < 3; ++Vertex)
+    {
+        const glm::vec4& Position = Vertices[Vertex]->Position;
+        const float InvW = 1.0f / Position.w;
+        X[Vertex] = (Position.x * InvW * 0.5f + 0.5f) * Width;
+        Y[Vertex] = (0.5f - Position.y * InvW * 0.5f) * Height;
+        Attributes[0][Vertex] = Position.z * InvW;
+        Attributes[1][Vertex] = InvW;
+        for (int32_t Channel = 0; Channel < NumColorAttributes; ++Channel)
+        {
+            Attributes[FirstColorAttribute + Channel][Vertex] = Vertices[Vertex]->Color[Channel] * InvW;
+        }
+    }
+
+    // Entirely beyond the far plane
+    if ((V0.Position.z > V0.Position.w && V1.Position.z > V1.Position.w && V2.Position.z > V2.Position.w))
+    {
+        return false;
+    }
+
+    const float MinX = FMath::Min3(X[0], X[1], X[2]);
+    const float MinY = FMath::Min3(Y[0], Y[1], Y[2]);
+    const float MaxX = FMath::Max3(X[0], X[1], X[2]);
+    const float MaxY = FMath::Max3(Y[0], Y[1], Y[2]);
+    if (!(MinX < Width && MinY < Height && MaxX >= 0.0f && MaxY >= 0.0f))
+    {
+        return false;
+    }
+
+    const double Area = ((double)X[1] - X[0]) * ((double)Y[2] - Y[0]) - ((double)X[2] - X[0]) * ((double)Y[1] - Y[0]);
+    if (Area == 0.0)
+    {
+        return false;
+    }
+
+    // Clamped before the conversion, vertices close to the camera plane project very far out
+    OutTriangle.MinX = FMath::FloorToInt(FMath::Max(MinX, 0.0f));
+    OutTriangle.MinY = FMath::FloorToInt(FMath::Max(MinY, 0.0f));
+    OutTriangle.MaxX = FMath::FloorToInt(FMath::Min(MaxX, Width - 1.0f));
+    OutTriangle.MaxY = FMath::FloorToInt(FMath::Min(MaxY, Height - 1.0f));
+
+    // Oriented so that the inside is positive whatever the winding, both sides are drawn
+    const float Sign = Area > 0.0 ? 1.0f : -1.0f;
+    for (int32_t Edge = 0; Edge < 3; ++Edge)
+    {
+        const int32_t A = (Edge + 1) % 3;
+        const int32_t B = (Edge + 2) % 3;
+        OutTriangle.EdgeA[Edge] = Sign * (Y[A] - Y[B]);
+        OutTriangle.EdgeB[Edge] = Sign * (X[B] - X[A]);
+        OutTriangle.EdgeC[Edge] = Sign * ((double)X[A] * Y[B] - (double)X[B] * Y[A]);
+
+        // With y down, left edges have the inside to their right and top edges the inside below them
+        OutTriangle.bTopLeft[Edge] = OutTriangle.EdgeA[Edge] > 0.0f || (OutTriangle.EdgeA[Edge] == 0.0f && OutTriangle.EdgeB[Edge] > 0.0f);
+    }
+
+    // Planes through the vertices, stored as the value at vertex 0 and the screen gradient
+    const float InvArea = (float)(1.0 / Area);
+    OutTriangle.Origin[0] = X[0];
+    OutTriangle.Origin[1] = Y[0];
+    for (int32_t Attribute = 0; Attribute < 6; ++Attribute)
+    {
+        const float Delta1 = Attributes[Attribute][1] - Attributes[Attribute][0];
+        const float Delta2 = Attributes[Attribute][2] - Attributes[Attribute][0];
+        OutTriangle.Attributes[Attribute][0] = Attributes[Attribute][0];
+        OutTriangle.Attributes[Attribute][1] = (Delta1 * (Y[2] - Y[0]) - Delta2 * (Y[1] - Y[0])) * InvArea;
+        OutTriangle.Attributes[Attribute][2] = (Delta2 * (X[1] - X[0]) - Delta1 * (X[2] - X[0])) * InvArea;
+    }
+    return true;
+}
+
+void FSoftwareRasterizer::BinTriangle(const FSetupTriangle& Triangle, FTriangleBin& Bin) const
+{
+    const int32_t Index = (int32_t)Bin.Triangles.size();
+    Bin.Triangles.push_back(Triangle);
+
+    for (int32_t TileY = Triangle.MinY / TileSize; TileY <= Triangle.MaxY / TileSize; ++TileY)
+    {
+        for (int32_t TileX = Triangle.MinX / TileSize; TileX <= Triangle.MaxX / TileSize; ++TileX)
+        {
+            Bin.TileTriangles[(size_t)TileY * NumTilesX + TileX].push_back(Index);
+        }
+    }
+}
+
+void FSoftwareRasterizer::Render()
+{
+    SCOPED_CPU_TIMER("FSoftwareRasterizer::Render");
+
+    FJobSystem::Get().ParallelFor(NumTilesX * NumTilesY, [this](int32_t Tile)
+        {
+            RenderTile(Tile);
+        });
+}
+
+int32_t FSoftwareRasterizer::GetNumTriangles() const
+{
+    int32_t NumTriangles = 0;
+    for (int32_t BinIndex = 0; BinIndex < NumUsedBins; ++BinIndex)
+    {
+        NumTriangles += (int32_t)Bins[BinIndex].Triangles.size();
+    }
+    return NumTriangles;
+}
+
+void FSoftwareRasterizer::RenderTile(int32_t Tile)
+{
+    alignas(32) static const float LaneOffsets[8] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f };
+
+    const int32_t TileMinX = (Tile % NumTilesX) * TileSize;
+    const int32_t TileMinY = (Tile / NumTilesX) * TileSize;
+    const int32_t Pitch = GetPitch();
+    uint32_t* TilePixels = Pixels.data() + (size_t)TileMinY * Pitch + TileMinX;
+    float* Depth = TileDepth.data() + (size_t)Tile * TileSize * TileSize;
+
+    for (int32_t Row = 0; Row < TileSize; ++Row)
+    {
+        std::fill(TilePixels + (size_t)Row * Pitch, TilePixels + (size_t)Row * Pitch + TileSize, ClearColor);
+    }
+    std::fill(Depth, Depth + TileSize * TileSize, 1.0f);
+
+    const FFloatWide Zero(0.0f);
+    const FFloatWide One(1.0f);
+    const FFloatWide ColorScale(255.0f);
+    const FFloatWide Half(0.5f);
+    const FFloatWide Offsets = FFloatWide::Load(LaneOffsets);
+
+    for (int32_t BinIndex = 0; BinIndex < NumUsedBins; ++BinIndex)
+    {
+        const FTriangleBin& Bin = Bins[BinIndex];
+        for (const int32_t Index : Bin.TileTriangles[Tile])
+        {
+            const FSetupTriangle& Triangle = Bin.Triangles[Index];
+
+            // Tile local bounds, blocks start Lanes aligned and the tile is a multiple of Lanes wide
+            const int32_t MinX = (FMath::Max(Triangle.MinX, TileMinX) - TileMinX) & ~(Lanes - 1);
+            const int32_t MaxX = FMath::Min(Triangle.MaxX, TileMinX + TileSize - 1) - TileMinX;
+            const int32_t MinY = FMath::Max(Triangle.MinY, TileMinY) - TileMinY;
+            const int32_t MaxY = FMath::Min(Triangle.MaxY, TileMinY + TileSize - 1) - TileMinY;
+
+            // Edges and planes rebased on the tile's corner, which keeps the per pixel values small
+            FFloatWide EdgeA[3];
+            float EdgeB[3];
+            float EdgeC[3];
+            FMaskWide TopLeft[3];
+            for (int32_t Edge = 0; Edge < 3; ++Edge)
+            {
+                EdgeA[Edge] = FFloatWide(Triangle.EdgeA[Edge]);
+                EdgeB[Edge] = Triangle.EdgeB[Edge];
+                EdgeC[Edge] = (float)(Triangle.EdgeC[Edge] + (double)Triangle.EdgeA[Edge] * TileMinX + (double)Triangle.EdgeB[Edge] * TileMinY);
+                TopLeft[Edge] = Zero <= FFloatWide(Triangle.bTopLeft[Edge] ? 0.0f : -1.0f);
+            }
+
+            FFloatWide AttributeDX[6];
+            float AttributeDY[6];
+            float AttributeBase[6];
+            for (int32_t Attribute = 0; Attribute < 6; ++Attribute)
+            {
+                const float* Plane = Triangle.Attributes[Attribute];
+                AttributeDX[Attribute] = FFloatWide(Plane[1]);
+                AttributeDY[Attribute] = Plane[2];
+                AttributeBase[Attribute] = Plane[0] + Plane[1] * (TileMinX - Triangle.Origin[0]) + Plane[2] * (TileMinY - Triangle.Origin[1]);
+            }
+
+            for (int32_t Y = MinY; Y <= MaxY; ++Y)
+            {
+                const float CenterY = Y + 0.5f;
+                FFloatWide RowEdge[3];
+                for (int32_t Edge = 0; Edge < 3; ++Edge)
+                {
+                    RowEdge[Edge] = FFloatWide(EdgeB[Edge] * CenterY + EdgeC[Edge]);
+                }
+                FFloatWide RowAttribute[6];
+                for (int32_t Attribute = 0; Attribute < 6; ++Attribute)
+                {
+                    RowAttribute[Attribute] = FFloatWide(AttributeBase[Attribute] + AttributeDY[Attribute] * CenterY);
+                }
+
+                float* DepthRow = Depth + Y * TileSize;
+                int32_t* PixelRow = (int32_t*)(TilePixels + (size_t)Y * Pitch);
+
+                for (int32_t X = MinX; X <= MaxX; X += Lanes)
+                {
+                    const FFloatWide CenterX = FFloatWide((float)X) + Offsets;
+                    const FFloatWide Distance0 = FFloatWide::MulAdd(EdgeA[0], CenterX, RowEdge[0]);
+                    const FFloatWide Distance1 = FFloatWide::MulAdd(EdgeA[1], CenterX, RowEdge[1]);
+                    const FFloatWide Distance2 = FFloatWide::MulAdd(EdgeA[2], CenterX, RowEdge[2]);
+
+                    // Pixels exactly on an edge belong to the triangle only if it is a top or left edge
+                    FMaskWide Inside = ((Zero < Distance0) | ((Zero == Distance0) & TopLeft[0]))
+                        & ((Zero < Distance1) | ((Zero == Distance1) & TopLeft[1]))
+                        & ((Zero < Distance2) | ((Zero == Distance2) & TopLeft[2]));
+                    if (!Inside.AnyTrue())
+                    {
+                        continue;
+                    }
+
+                    // Depth starts at the far plane, so fragments beyond it fail the test as well
+                    const FFloatWide OldDepth = FFloatWide::Load(DepthRow + X);
+                    const FFloatWide NewDepth = FFloatWide::MulAdd(AttributeDX[0], CenterX, RowAttribute[0]);
+                    Inside = Inside & (NewDepth < OldDepth);
+                    if (!Inside.AnyTrue())
+                    {
+                        continue;
+                    }
+                    FFloatWide::Select(Inside, NewDepth, OldDepth).Store(DepthRow + X);
+
+                    const FFloatWide W = One / FFloatWide::MulAdd(AttributeDX[1], CenterX, RowAttribute[1]);
+                    FIntWide Color(0);
+                    for (int32_t Channel = 0; Channel < NumColorAttributes; ++Channel)
+                    {
+                        const int32_t Attribute = FirstColorAttribute + Channel;
+                        const FFloatWide Value = FFloatWide::Clamp(FFloatWide::MulAdd(AttributeDX[Attribute], CenterX, RowAttribute[Attribute]) * W, Zero, One);
+                        Color = Color | FFloatWide::MulAdd(Value, ColorScale, Half).TruncToInt().ShiftLeft(Channel * 8);
+                    }
+                    FIntWide::Select(Inside, Color, FIntWide::Load(PixelRow + X)).Store(PixelRow + X);
+                }
+            }
+        }
+    }
+}
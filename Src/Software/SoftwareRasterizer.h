@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Base/Vector.h"
+
+/**
+ * Tile binning rasterizer of the software display.
+ *
+ * DrawTriangles transforms the vertices, clips the triangles against the near plane and bins them
+ * into the TileSize x TileSize screen tiles their bounds overlap, all of it on the job system.
+ * Render then runs one job per tile, which owns the tile's pixels and its own depth buffer, clears
+ * them and draws the tile's triangles in submission order, FFloatWide::Lanes pixels per step.
+ *
+ * The output does not depend on the number of threads: every pixel is written by one tile job,
+ * which sees the triangles in the order they were drawn. Coverage follows the top-left rule, so
+ * triangles sharing an edge never both draw a pixel. Colors are interpolated perspective correct
+ * and written without blending, the depth test keeps the nearest fragment.
+ */
+class FSoftwareRasterizer
+{
+public:
+    static constexpr int32_t TileSize = 64;
+
+    FSoftwareRasterizer();
+
+    void Resize(int32_t InWidth, int32_t InHeight);
+
+    /** Drops the triangles of the last frame, Render starts from ClearColor and the far depth. */
+    void BeginFrame(uint32_t InClearColor);
+
+    /**
+     * Bins an indexed triangle list with RGBA8 vertex colors, red in the lowest byte.
+     * ViewProjection maps world space to OpenGL clip space (-w <= z <= w).
+     */
+    void DrawTriangles(const glm::mat4& ViewProjection, const MVector* Positions, const uint32_t* Colors, int32_t NumVertices, const int32_t* Indices, int32_t NumIndices);
+
+    /** Rasterizes the triangles drawn since BeginFrame into the pixels. */
+    void Render();
+
+    int32_t GetWidth() const { return Width; }
+    int32_t GetHeight() const { return Height; }
+
+    /** RGBA8 pixels, rows are GetPitch() pixels apart and the first row is the top of the image. */
+    const uint32_t* GetPixels() const { return Pixels.data(); }
+    int32_t GetPitch() const { return NumTilesX * TileSize; }
+
+    /** Triangles binned since BeginFrame, after near plane clipping. */
+    int32_t GetNumTriangles() const;
+
+private:
+    struct FClipVertex
+    {
+        glm::vec4 Position;
+        glm::vec4 Color;
+    };
+
+    /** Screen space edge functions and attribute planes of one triangle. */
+    struct FSetupTriangle
+    {
+        // Edge i is opposite to vertex i and positive inside, C in double keeps shared edges exact negations
+        float EdgeA[3];
+        float EdgeB[3];
+        double EdgeC[3];
+        bool bTopLeft[3];
+
+        // NDC depth, 1 / w and color / w, linear in screen space
+        float Origin[2];
+        float Attributes[6][3];
+
+        int32_t MinX;
+        int32_t MinY;
+        int32_t MaxX;
+        int32_t MaxY;
+    };
+
+    /** Triangles of a contiguous range of the submitted ones and their indices per tile. */
+    struct FTriangleBin
+    {
+        std::vector<FSetupTriangle> Triangles;
+        std::vector<std::vector<int32_t>> TileTriangles;
+    };
+
+    bool SetupTriangle(const FClipVertex& V0, const FClipVertex& V1, const FClipVertex& V2, FSetupTriangle& OutTriangle) const;
+    void BinTriangle(const FSetupTriangle& Triangle, FTriangleBin& Bin) const;
+    void RenderTile(int32_t Tile);
+
+private:
+    int32_t Width;
+    int32_t Height;
+    int32_t NumTilesX;
+    int32_t NumTilesY;
+
+    uint32_t ClearColor;
+
+    std::vector<uint32_t> Pixels;
+    // Tile after tile, each one TileSize x TileSize
+    std::vector<float> TileDepth;
+
+    std::vector<FClipVertex> ClipVertices;
+    std::vector<FTriangleBin> Bins;
+    int32_t NumUsedBins;
+};
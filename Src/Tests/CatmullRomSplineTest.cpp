@@ -0,0 +1,153 @@
+#include "CoreMinimal.h"
+#include "Base/RandomStream.h"
+#include "Geometry/CatmullRomSpline.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * FCatmullRomSpline arc lengths against a finely sampled polyline, distance and parameter round trips,
+ * the batch evaluation against the scalar one, and MovePoints against rebuilding from scratch, for
+ * open and closed splines with uniform, centripetal and chordal knots.
+ */
+
+namespace
+{
+    constexpr int32_t NumPoints = 12;
+
+    // Polyline steps per segment, more would let the rounding of the float locations lengthen the polyline
+    constexpr int32_t NumPolylineSteps = 1000;
+
+    // Relative to the spline's length, for the arc length table and for the one Newton step of distance queries
+    constexpr double LengthTolerance = 1.e-5;
+    constexpr double DistanceTolerance = 1.e-4;
+
+    constexpr int32_t NumQueries = 1000;
+
+    int32_t NumFailures = 0;
+
+    void Report(const std::string& Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check.c_str(), bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    std::vector<MVector> MakePoints(FRandomStream& Stream)
+    {
+        // A wandering path with uneven spacing, some points close together
+        std::vector<MVector> Points;
+        MVector Location(0.0f);
+        for (int32_t Index = 0; Index < NumPoints; ++Index)
+        {
+            Points.push_back(Location);
+            Location += Stream.GetUnitVector() * (Index % 4 == 3 ? 0.2f : Stream.FRandRange(1.0f, 10.0f));
+        }
+        return Points;
+    }
+
+    /** Distance from the spline start to the start of each segment and to its end, along a polyline through the curve. */
+    std::vector<double> GetPolylineDistances(const FCatmullRomSpline& Spline)
+    {
+        std::vector<double> Distances = { 0.0 };
+        MVector Previous = Spline.GetLocation(0.0f);
+        for (int32_t Segment = 0; Segment < Spline.GetNumSegments(); ++Segment)
+        {
+            double Distance = Distances.back();
+            for (int32_t Step = 1; Step <= NumPolylineSteps; ++Step)
+            {
+                const MVector Location = Spline.GetLocation(Segment + (float)Step / NumPolylineSteps);
+                Distance += (double)(Location - Previous).Size();
+                Previous = Location;
+            }
+            Distances.push_back(Distance);
+        }
+        return Distances;
+    }
+
+    void TestSpline(FRandomStream& Stream, float Alpha, bool bClosedLoop)
+    {
+        const std::string Name = std::string(bClosedLoop ? "Closed" : "Open") + (Alpha == 0.0f ? ", uniform" : Alpha == 0.5f ? ", centripetal" : ", chordal");
+        const std::vector<MVector> Points = MakePoints(Stream);
+        FCatmullRomSpline Spline(Alpha, bClosedLoop);
+        Spline.SetPoints(Points.data(), NumPoints);
+
+        // Total length and distance to each segment start against the polyline, the loop's end wraps to its start
+        const std::vector<double> PolylineDistances = GetPolylineDistances(Spline);
+        const double Length = PolylineDistances.back();
+        double MaxLengthError = std::fabs(Spline.GetLength() - Length);
+        for (int32_t Segment = 0; Segment < Spline.GetNumSegments(); ++Segment)
+        {
+            MaxLengthError = FMath::Max(MaxLengthError, std::fabs(Spline.GetDistanceAtParameter((float)Segment) - PolylineDistances[Segment]));
+        }
+        Report(Name + ", arc length matches the polyline", Spline.GetNumSegments() == (bClosedLoop ? NumPoints : NumPoints - 1) && MaxLengthError < LengthTolerance * Length);
+
+        // Round trips, distance to parameter and back, and parameter to distance and back measured along the curve
+        double MaxDistanceError = 0.0;
+        double MaxLocationError = 0.0;
+        bool bLocationsMatch = true;
+        std::vector<float> Distances(NumQueries);
+        for (int32_t Query = 0; Query < NumQueries; ++Query)
+        {
+            const float Distance = Stream.GetFraction() * Spline.GetLength();
+            const float Parameter = Spline.GetParameterAtDistance(Distance);
+            MaxDistanceError = FMath::Max(MaxDistanceError, (double)std::fabs(Spline.GetDistanceAtParameter(Parameter) - Distance));
+
+            const float OtherParameter = Stream.GetFraction() * Spline.GetNumSegments();
+            const float RoundTripParameter = Spline.GetParameterAtDistance(Spline.GetDistanceAtParameter(OtherParameter));
+            MaxLocationError = FMath::Max(MaxLocationError, (double)(Spline.GetLocation(RoundTripParameter) - Spline.GetLocation(OtherParameter)).Size());
+
+            bLocationsMatch &= (Spline.GetLocationAtDistance(Distance) - Spline.GetLocation(Parameter)).Size() < 1.e-4f;
+            Distances[Query] = Distance;
+        }
+        std::printf("%s, length %g, errors: length %g, distance round trip %g, parameter round trip %g\n", Name.c_str(), Length, MaxLengthError, MaxDistanceError, MaxLocationError);
+        Report(Name + ", distance round trips", MaxDistanceError < DistanceTolerance * Length && bLocationsMatch);
+        Report(Name + ", parameter round trips", MaxLocationError < DistanceTolerance * Length);
+
+        // The batch evaluation, over a count that leaves a partial vector
+        std::vector<MVector> Locations(NumQueries - 1);
+        Spline.GetLocationsAtDistances(Distances.data(), NumQueries - 1, Locations.data());
+        float MaxBatchError = 0.0f;
+        for (int32_t Query = 0; Query < NumQueries - 1; ++Query)
+        {
+            MaxBatchError = FMath::Max(MaxBatchError, (Locations[Query] - Spline.GetLocationAtDistance(Distances[Query])).Size());
+        }
+        Report(Name + ", batch matches scalar", MaxBatchError < 1.e-4f);
+
+        // Moving points rebuilds what a fresh spline would have, at the ends and in the middle
+        std::vector<MVector> MovedPoints = Points;
+        const int32_t MovedIndices[3] = { 0, 5, NumPoints - 2 };
+        for (const int32_t Index : MovedIndices)
+        {
+            MovedPoints[Index] += Stream.GetUnitVector() * 3.0f;
+            MovedPoints[Index + 1] += Stream.GetUnitVector();
+            Spline.MovePoints(Index, &MovedPoints[Index], 2);
+        }
+        FCatmullRomSpline Rebuilt(Alpha, bClosedLoop);
+        Rebuilt.SetPoints(MovedPoints.data(), NumPoints);
+
+        bool bMovedMatches = Spline.GetLength() == Rebuilt.GetLength();
+        for (int32_t Step = 0; Step <= 10 * Spline.GetNumSegments(); ++Step)
+        {
+            bMovedMatches &= Spline.GetLocation(Step * 0.1f) == Rebuilt.GetLocation(Step * 0.1f);
+        }
+        Report(Name + ", MovePoints matches a rebuild", bMovedMatches);
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0xC4A7);
+
+    for (const bool bClosedLoop : { false, true })
+    {
+        for (const float Alpha : { 0.0f, 0.5f, 1.0f })
+        {
+            TestSpline(Stream, Alpha, bClosedLoop);
+        }
+    }
+
+    std::printf("%s\n", NumFailures == 0 ? "All spline checks passed" : "Spline checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
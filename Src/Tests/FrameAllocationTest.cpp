@@ -0,0 +1,126 @@
+#include "CoreMinimal.h"
+#include "Memory/AllocationCounter.h"
+#include "Memory/FrameAllocator.h"
+#include "Render/RenderManager.h"
+#include "Render/Display/Display.h"
+
+#include <cstdio>
+
+/**
+ * Steady-state frames must not touch the heap: after a few warm-up frames, recording commands with
+ * frame arena memory and presenting them through either render thread mode makes no allocation.
+ * Needs MIKASA_COUNT_ALLOCATIONS, without it there is nothing to count and the test is skipped.
+ */
+
+namespace
+{
+    constexpr int32_t NumWarmUpFrames = 10;
+    constexpr int32_t NumFrames = 200;
+
+    int32_t NumFailures = 0;
+
+    // Keeps the probe allocation from being optimized away
+    int32_t* volatile ProbeSink = nullptr;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    /** Executes the commands like a real backend but draws nothing. */
+    class FTestDisplay : public FDisplay
+    {
+    public:
+        void InitDisplay() override {}
+        void RefreshDisplay() override { ++NumRefreshes; }
+        void DestroyDisplay() override {}
+        void CloseDisplay() override {}
+        bool ShouldCloseDisplay() override { return false; }
+        void SwapBuffers() override {}
+        void SetDisplaySize(const FDisplaySize&) override {}
+        void SetVSync(bool) override {}
+        void SetInitBackground(const FColor&) override {}
+        void SetTitle(const std::string&) override {}
+
+        void DrawTriangles(const FDrawTrianglesCommand& Command) override
+        {
+            NumIndicesDrawn += (uint64_t)Command.NumIndices;
+        }
+
+        uint64_t NumRefreshes = 0;
+        uint64_t NumIndicesDrawn = 0;
+    };
+
+    /** A frame of the demo loop: transient data in the frame arena, referenced by a draw command. */
+    void BuildFrame(int32_t FrameIndex, const std::vector<MVector>& Positions, const std::vector<uint32_t>& Colors)
+    {
+        FFrameArena& Arena = FRenderManager::Get().GetFrameArena();
+
+        std::vector<int32_t, TFrameAllocator<int32_t>> Indices{ TFrameAllocator<int32_t>(Arena) };
+        for (int32_t Index = 0; Index < 3 * (1 + FrameIndex % 7); ++Index)
+        {
+            Indices.push_back(Index % 3);
+        }
+
+        const glm::mat4* ViewProjection = Arena.New<glm::mat4>(1.0f);
+        FRenderManager::Get().EnqueueRenderCommand(FDrawTrianglesCommand(ViewProjection, Positions.data(), Colors.data(), (int32_t)Positions.size(), Indices.data(), (int32_t)Indices.size()));
+        FRenderManager::Get().SubmitFrame();
+    }
+
+    void TestSteadyState(const char* Name, const std::vector<MVector>& Positions, const std::vector<uint32_t>& Colors)
+    {
+        int32_t FrameIndex = 0;
+        for (; FrameIndex < NumWarmUpFrames; ++FrameIndex)
+        {
+            BuildFrame(FrameIndex, Positions, Colors);
+        }
+
+        const uint64_t NumAllocations = FAllocationCounter::GetNumAllocations();
+        uint64_t MaxFrameAllocations = 0;
+        for (; FrameIndex < NumWarmUpFrames + NumFrames; ++FrameIndex)
+        {
+            BuildFrame(FrameIndex, Positions, Colors);
+            const uint64_t NumFrameAllocations = FRenderManager::Get().GetRenderStats().NumFrameHeapAllocations;
+            MaxFrameAllocations = NumFrameAllocations > MaxFrameAllocations ? NumFrameAllocations : MaxFrameAllocations;
+        }
+        const uint64_t NumSteadyAllocations = FAllocationCounter::GetNumAllocations() - NumAllocations;
+
+        std::printf("%s: %llu allocations over %d frames after warm-up, at most %llu in one frame\n",
+            Name, (unsigned long long)NumSteadyAllocations, NumFrames, (unsigned long long)MaxFrameAllocations);
+        Report(Name, NumSteadyAllocations == 0 && MaxFrameAllocations == 0);
+    }
+}
+
+int main()
+{
+    if (!FAllocationCounter::IsEnabled())
+    {
+        std::printf("Built without MIKASA_COUNT_ALLOCATIONS, skipped\n");
+        return 0;
+    }
+
+    // The counter sees this allocation, which checks that the replacement is the one in use
+    const uint64_t NumAllocationsBefore = FAllocationCounter::GetNumAllocations();
+    std::unique_ptr<int32_t> Probe = std::make_unique<int32_t>(0);
+    ProbeSink = Probe.get();
+    Report("operator new is counted", FAllocationCounter::GetNumAllocations() > NumAllocationsBefore);
+
+    std::shared_ptr<FTestDisplay> Display = std::make_shared<FTestDisplay>();
+    FRenderManager::Get().RegisterDisplay("Headless", [Display]() { return Display; });
+    FRenderManager::Get().SetRenderType(ERenderType::Headless);
+
+    const std::vector<MVector> Positions = { MVector(0.0f), MVector(1.0f, 0.0f, 0.0f), MVector(0.0f, 1.0f, 0.0f) };
+    const std::vector<uint32_t> Colors(Positions.size(), 0xFFFFFFFF);
+
+    TestSteadyState("Threaded render, no heap allocation per frame", Positions, Colors);
+
+    FRenderManager::Get().SetRenderThreadMode(ERenderThreadMode::Sync);
+    TestSteadyState("Sync render, no heap allocation per frame", Positions, Colors);
+
+    FRenderManager::Get().ShutdownRenderStatus();
+    Report("Frames were drawn", Display->NumRefreshes > 0 && Display->NumIndicesDrawn > 0);
+
+    std::printf("%s\n", NumFailures == 0 ? "All frame allocation checks passed" : "Frame allocation checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,287 @@
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+#include "Base/RandomStream.h"
+
+#include <cmath>
+#include <cstdio>
+
+/**
+ * Reference accuracy of the vectorized FMath transcendentals. Every function runs through its batch
+ * version, which covers the FFloatWide overloads and the partial last packet, and is compared against
+ * the std:: function evaluated in double precision, with the error bounds documented in MathUtil.h.
+ */
+
+namespace
+{
+    constexpr int32_t NumSamples = (1 << 20) + 3;
+
+    // Precise stays within 2 ulp of the correctly rounded result
+    constexpr double PreciseMaxUlp = 2.0;
+
+    // Precise Pow rounds once from double-float arithmetic, whatever B * Log2(A)
+    constexpr double PreciseMaxPowUlp = 1.0;
+
+    // Precise Sin / Cos errors are absolute, about 1e-7, once the argument leaves [-Pi, Pi]
+    constexpr double PreciseMaxReducedError = 1.5e-7;
+
+    // Fast stays within about 1e-4
+    constexpr double FastMaxError = 1.e-4;
+
+    enum class EErrorMetric
+    {
+        Ulp,
+        Absolute,
+        Relative,
+        // Relative for results above one, absolute below, for results that cross zero
+        Mixed
+    };
+
+    typedef void (*FBatchFunction)(const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy);
+    typedef double (*FReferenceFunction)(double Value);
+    typedef float (*FLibmFunction)(float Value);
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Name, const char* Check, double Error, double Bound)
+    {
+        const bool bPassed = Error <= Bound;
+        std::printf("%-7s %-22s %10.3g  (bound %.3g)  %s\n", Name, Check, Error, Bound, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    double GetError(float Value, double Reference, EErrorMetric Metric)
+    {
+        const double Difference = std::fabs((double)Value - Reference);
+        switch (Metric)
+        {
+        case EErrorMetric::Ulp:
+        {
+            const double AbsReference = std::fabs((double)(float)Reference);
+            return Difference / ((double)std::nextafter((float)AbsReference, INFINITY) - AbsReference);
+        }
+        case EErrorMetric::Relative:
+            return Difference / std::fabs(Reference);
+        case EErrorMetric::Mixed:
+            return Difference / FMath::Max(1.0, std::fabs(Reference));
+        default:
+            return Difference;
+        }
+    }
+
+    std::vector<float> MakeUniform(FRandomStream& Stream, float Min, float Max)
+    {
+        std::vector<float> Values(NumSamples);
+        for (float& Value : Values)
+        {
+            Value = Stream.FRandRange(Min, Max);
+        }
+        return Values;
+    }
+
+    /** Positive normal floats spread evenly over the binary exponents in [MinExponent, MaxExponent]. */
+    std::vector<float> MakeLogUniform(FRandomStream& Stream, float MinExponent, float MaxExponent)
+    {
+        std::vector<float> Values(NumSamples);
+        for (float& Value : Values)
+        {
+            Value = std::exp2(Stream.FRandRange(MinExponent, MaxExponent));
+        }
+        return Values;
+    }
+
+    void CheckAccuracy(const char* Name, FBatchFunction Function, FReferenceFunction Reference, const std::vector<float>& Values, EMathAccuracy Accuracy, EErrorMetric Metric, double Bound)
+    {
+        std::vector<float> Results(Values.size());
+        Function(Values.data(), (int32_t)Values.size(), Results.data(), Accuracy);
+
+        double MaxError = 0.0;
+        for (size_t Index = 0; Index < Values.size(); ++Index)
+        {
+            const double Error = GetError(Results[Index], Reference((double)Values[Index]), Metric);
+            MaxError = Error == Error ? FMath::Max(MaxError, Error) : INFINITY;
+        }
+
+        static const char* const MetricNames[] = { "ulp", "absolute", "relative", "relative / absolute" };
+        const std::string Check = std::string(Accuracy == EMathAccuracy::Fast ? "fast " : "precise ") + MetricNames[(int32_t)Metric];
+        Report(Name, Check.c_str(), MaxError, Bound);
+    }
+
+    /** Precise returns what libm returns for special and out of range inputs. */
+    void CheckSpecialValues(const char* Name, FBatchFunction Function, FLibmFunction LibmFunction, const std::vector<float>& Values)
+    {
+        std::vector<float> Results(Values.size());
+        Function(Values.data(), (int32_t)Values.size(), Results.data(), EMathAccuracy::Precise);
+
+        int32_t NumMismatches = 0;
+        for (size_t Index = 0; Index < Values.size(); ++Index)
+        {
+            const float Expected = LibmFunction(Values[Index]);
+            if (Expected == Expected ? Results[Index] != Expected : Results[Index] == Results[Index])
+            {
+                std::printf("%-7s %g gives %g instead of %g\n", Name, Values[Index], Results[Index], Expected);
+                ++NumMismatches;
+            }
+        }
+        Report(Name, "special value mismatches", NumMismatches, 0.0);
+    }
+
+    void TestSinCos(FRandomStream& Stream)
+    {
+        const FBatchFunction Sin = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::Sin(Values, NumValues, OutValues, Accuracy); };
+        const FBatchFunction Cos = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::Cos(Values, NumValues, OutValues, Accuracy); };
+        const FReferenceFunction SinReference = [](double Value) { return std::sin(Value); };
+        const FReferenceFunction CosReference = [](double Value) { return std::cos(Value); };
+
+        const std::vector<float> Principal = MakeUniform(Stream, -PI, PI);
+        CheckAccuracy("Sin", Sin, SinReference, Principal, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+        CheckAccuracy("Cos", Cos, CosReference, Principal, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+
+        // The Fast domain
+        const std::vector<float> Reduced = MakeUniform(Stream, -8192.0f, 8192.0f);
+        CheckAccuracy("Sin", Sin, SinReference, Reduced, EMathAccuracy::Precise, EErrorMetric::Absolute, PreciseMaxReducedError);
+        CheckAccuracy("Cos", Cos, CosReference, Reduced, EMathAccuracy::Precise, EErrorMetric::Absolute, PreciseMaxReducedError);
+        CheckAccuracy("Sin", Sin, SinReference, Reduced, EMathAccuracy::Fast, EErrorMetric::Absolute, FastMaxError);
+        CheckAccuracy("Cos", Cos, CosReference, Reduced, EMathAccuracy::Fast, EErrorMetric::Absolute, FastMaxError);
+
+        const std::vector<float> Specials = { 0.0f, -0.0f, 1.e6f, -3.e7f, INFINITY, -INFINITY, NAN };
+        CheckSpecialValues("Sin", Sin, [](float Value) { return std::sin(Value); }, Specials);
+        CheckSpecialValues("Cos", Cos, [](float Value) { return std::cos(Value); }, Specials);
+    }
+
+    void TestExp(FRandomStream& Stream)
+    {
+        const FBatchFunction Exp = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::Exp(Values, NumValues, OutValues, Accuracy); };
+        const FBatchFunction Exp2 = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::Exp2(Values, NumValues, OutValues, Accuracy); };
+        const FReferenceFunction ExpReference = [](double Value) { return std::exp(Value); };
+        const FReferenceFunction Exp2Reference = [](double Value) { return std::exp2(Value); };
+
+        // Inputs with normal results, denormal ones have fewer bits to be accurate to
+        const std::vector<float> ExpValues = MakeUniform(Stream, -87.0f, 88.0f);
+        const std::vector<float> Exp2Values = MakeUniform(Stream, -126.0f, 127.9f);
+        CheckAccuracy("Exp", Exp, ExpReference, ExpValues, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+        CheckAccuracy("Exp2", Exp2, Exp2Reference, Exp2Values, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+        CheckAccuracy("Exp", Exp, ExpReference, ExpValues, EMathAccuracy::Fast, EErrorMetric::Relative, FastMaxError);
+        CheckAccuracy("Exp2", Exp2, Exp2Reference, Exp2Values, EMathAccuracy::Fast, EErrorMetric::Relative, FastMaxError);
+
+        const std::vector<float> Specials = { 0.0f, -0.0f, 100.0f, -120.0f, 128.0f, -150.0f, INFINITY, -INFINITY, NAN };
+        CheckSpecialValues("Exp", Exp, [](float Value) { return std::exp(Value); }, Specials);
+        CheckSpecialValues("Exp2", Exp2, [](float Value) { return std::exp2(Value); }, Specials);
+    }
+
+    void TestLog2(FRandomStream& Stream)
+    {
+        const FBatchFunction Log2 = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::Log2(Values, NumValues, OutValues, Accuracy); };
+        const FReferenceFunction Log2Reference = [](double Value) { return std::log2(Value); };
+
+        // All positive normal floats, and the values around one where the result crosses zero
+        const std::vector<float> Values = MakeLogUniform(Stream, -125.0f, 127.0f);
+        const std::vector<float> NearOne = MakeUniform(Stream, 0.5f, 2.0f);
+        CheckAccuracy("Log2", Log2, Log2Reference, Values, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+        CheckAccuracy("Log2", Log2, Log2Reference, NearOne, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+        CheckAccuracy("Log2", Log2, Log2Reference, Values, EMathAccuracy::Fast, EErrorMetric::Mixed, FastMaxError);
+        CheckAccuracy("Log2", Log2, Log2Reference, NearOne, EMathAccuracy::Fast, EErrorMetric::Mixed, FastMaxError);
+
+        const std::vector<float> Specials = { 0.0f, -0.0f, -1.0f, 1.0f, 1.e-40f, INFINITY, -INFINITY, NAN };
+        CheckSpecialValues("Log2", Log2, [](float Value) { return std::log2(Value); }, Specials);
+    }
+
+    void TestSqrt(FRandomStream& Stream)
+    {
+        const FBatchFunction Sqrt = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy) { FMath::Sqrt(Values, NumValues, OutValues); };
+        const FBatchFunction InvSqrt = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::InvSqrt(Values, NumValues, OutValues, Accuracy); };
+        const FReferenceFunction InvSqrtReference = [](double Value) { return 1.0 / std::sqrt(Value); };
+
+        const std::vector<float> Values = MakeLogUniform(Stream, -125.0f, 127.0f);
+
+        // The hardware square root is correctly rounded
+        CheckAccuracy("Sqrt", Sqrt, [](double Value) { return std::sqrt(Value); }, Values, EMathAccuracy::Precise, EErrorMetric::Ulp, 0.5);
+        CheckAccuracy("InvSqrt", InvSqrt, InvSqrtReference, Values, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxUlp);
+        CheckAccuracy("InvSqrt", InvSqrt, InvSqrtReference, Values, EMathAccuracy::Fast, EErrorMetric::Relative, FastMaxError);
+    }
+
+    void TestPow(FRandomStream& Stream)
+    {
+        const FBatchFunction PowGamma = [](const float* Values, int32_t NumValues, float* OutValues, EMathAccuracy Accuracy) { FMath::Pow(Values, 2.2f, NumValues, OutValues, Accuracy); };
+        const FReferenceFunction PowGammaReference = [](double Value) { return std::pow(Value, (double)2.2f); };
+
+        const auto CheckPow = [](const char* Check, const std::vector<float>& Bases, const std::vector<float>& Exponents, EMathAccuracy Accuracy, EErrorMetric Metric, double Bound)
+        {
+            std::vector<float> Results(Bases.size());
+            FMath::Pow(Bases.data(), Exponents.data(), (int32_t)Bases.size(), Results.data(), Accuracy);
+
+            double MaxError = 0.0;
+            for (size_t Index = 0; Index < Bases.size(); ++Index)
+            {
+                const double Error = GetError(Results[Index], std::pow((double)Bases[Index], (double)Exponents[Index]), Metric);
+                MaxError = Error == Error ? FMath::Max(MaxError, Error) : INFINITY;
+            }
+            Report("Pow", Check, MaxError, Bound);
+        };
+
+        const std::vector<float> Bases = MakeUniform(Stream, 0.01f, 10.0f);
+        const std::vector<float> Exponents = MakeUniform(Stream, -8.0f, 8.0f);
+        CheckPow("precise ulp", Bases, Exponents, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxPowUlp);
+        CheckPow("fast relative", Bases, Exponents, EMathAccuracy::Fast, EErrorMetric::Relative, FastMaxError);
+
+        // Any positive normal base with an exponent that keeps the result normal, B * Log2(A) up to +-126
+        const std::vector<float> WideBases = MakeLogUniform(Stream, -125.0f, 127.0f);
+        std::vector<float> WideExponents(NumSamples);
+        for (int32_t Index = 0; Index < NumSamples; ++Index)
+        {
+            const float Log2Base = std::log2(WideBases[Index]);
+            WideExponents[Index] = Log2Base == 0.0f ? 1.0f : Stream.FRandRange(-126.0f, 126.0f) / Log2Base;
+        }
+        CheckPow("precise ulp, wide", WideBases, WideExponents, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxPowUlp);
+
+        // The single exponent overload, gamma correction style
+        const std::vector<float> Colors = MakeUniform(Stream, 0.001f, 1.0f);
+        CheckAccuracy("Pow", PowGamma, PowGammaReference, Colors, EMathAccuracy::Precise, EErrorMetric::Ulp, PreciseMaxPowUlp);
+        CheckAccuracy("Pow", PowGamma, PowGammaReference, Colors, EMathAccuracy::Fast, EErrorMetric::Relative, FastMaxError);
+
+        const std::vector<float> Specials = { 0.0f, -0.0f, -2.0f, 1.0f, 1.e-40f, INFINITY, NAN };
+        CheckSpecialValues("Pow", PowGamma, [](float Value) { return std::pow(Value, 2.2f); }, Specials);
+    }
+
+    /** Batch functions handle any count and may write over their input. */
+    void TestBatchEdges()
+    {
+        int32_t NumMismatches = 0;
+        for (int32_t NumValues = 0; NumValues <= 3 * FFloatWide::Lanes; ++NumValues)
+        {
+            float Values[3 * FFloatWide::Lanes + 1];
+            float Results[3 * FFloatWide::Lanes + 1];
+            for (int32_t Index = 0; Index <= NumValues; ++Index)
+            {
+                Values[Index] = 0.1f * (float)(Index + 1);
+                Results[Index] = -1.0f;
+            }
+
+            FMath::Sin(Values, NumValues, Results);
+            FMath::Sin(Values, NumValues, Values);
+            for (int32_t Index = 0; Index < NumValues; ++Index)
+            {
+                NumMismatches += Values[Index] == Results[Index] && Results[Index] == FMath::Sin(FFloatWide(0.1f * (float)(Index + 1))).GetLane(0) ? 0 : 1;
+            }
+
+            // Nothing is written past the end
+            NumMismatches += Results[NumValues] == -1.0f ? 0 : 1;
+        }
+        Report("Batch", "tail / aliasing errors", NumMismatches, 0.0);
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0x3A7E);
+
+    std::printf("FFloatWide::Lanes = %d\n", FFloatWide::Lanes);
+    TestSinCos(Stream);
+    TestExp(Stream);
+    TestLog2(Stream);
+    TestSqrt(Stream);
+    TestPow(Stream);
+    TestBatchEdges();
+
+    std::printf("%s\n", NumFailures == 0 ? "All accuracy checks passed" : "Accuracy checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
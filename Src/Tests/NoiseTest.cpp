@@ -0,0 +1,174 @@
+#include "CoreMinimal.h"
+#include "Async/JobSystem.h"
+#include "Base/MathUtil.h"
+#include "Base/RandomStream.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/**
+ * FMath Perlin noise: the wide versions against the scalar ones lane by lane, the documented ranges
+ * of the fractal compositions, and NoiseGrid2D / NoiseGrid3D giving the same bits whatever the
+ * number of job system threads.
+ */
+
+namespace
+{
+    constexpr int32_t NumSamples = 1 << 16;
+
+    // The wide and scalar versions fade and interpolate in another order
+    constexpr float ScalarTolerance = 1.e-5f;
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    /** Mostly near the origin, some far out where the lattice wraps, some on lattice points. */
+    float GetRandomCoordinate(FRandomStream& Stream)
+    {
+        const uint32_t Kind = Stream.RandHelper(8);
+        if (Kind == 0)
+        {
+            return (float)Stream.RandRange(-300, 300);
+        }
+        return Kind == 1 ? Stream.FRandRange(-5000.0f, 5000.0f) : Stream.FRandRange(-20.0f, 20.0f);
+    }
+
+    void TestWideMatchesScalar(FRandomStream& Stream)
+    {
+        constexpr int32_t Lanes = FFloatWide::Lanes;
+        float MaxError2D = 0.0f;
+        float MaxError3D = 0.0f;
+        for (int32_t Sample = 0; Sample < NumSamples; Sample += Lanes)
+        {
+            float X[Lanes], Y[Lanes], Z[Lanes];
+            for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+            {
+                X[Lane] = GetRandomCoordinate(Stream);
+                Y[Lane] = GetRandomCoordinate(Stream);
+                Z[Lane] = GetRandomCoordinate(Stream);
+            }
+
+            const FFloatWide Noise2D = FMath::PerlinNoise2D(FFloatWide::Load(X), FFloatWide::Load(Y));
+            const FFloatWide Noise3D = FMath::PerlinNoise3D(MVectorWide(FFloatWide::Load(X), FFloatWide::Load(Y), FFloatWide::Load(Z)));
+            for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+            {
+                MaxError2D = FMath::Max(MaxError2D, std::fabs(Noise2D.GetLane(Lane) - FMath::PerlinNoise2D(MVector2D(X[Lane], Y[Lane]))));
+                MaxError3D = FMath::Max(MaxError3D, std::fabs(Noise3D.GetLane(Lane) - FMath::PerlinNoise3D(MVector(X[Lane], Y[Lane], Z[Lane]))));
+            }
+        }
+        std::printf("Wide against scalar Perlin noise, max error 2D %g, 3D %g\n", MaxError2D, MaxError3D);
+        Report("Wide PerlinNoise2D matches scalar lane by lane", MaxError2D <= ScalarTolerance);
+        Report("Wide PerlinNoise3D matches scalar lane by lane", MaxError3D <= ScalarTolerance);
+
+        // Zero on every lattice point
+        const FFloatWide Lattice = FMath::PerlinNoise3D(MVectorWide(FFloatWide(3.0f), FFloatWide(-7.0f), FFloatWide(250.0f)));
+        Report("Perlin noise is 0 on lattice points", Lattice.GetLane(0) == 0.0f && FMath::PerlinNoise2D(MVector2D(-12.0f, 40.0f)) == 0.0f);
+    }
+
+    void TestFractalRanges(FRandomStream& Stream)
+    {
+        // Gains above 1 make the highest octave dominate, the normalization must still hold
+        const float Gains[3] = { 0.5f, 0.8f, 1.5f };
+        float MinFBm = 0.0f, MaxFBm = 0.0f;
+        float MinRidged = 1.0f, MaxRidged = 0.0f;
+        for (int32_t NumOctaves = 1; NumOctaves <= 8; ++NumOctaves)
+        {
+            for (const float Gain : Gains)
+            {
+                FNoiseFractalSettings Settings;
+                Settings.NumOctaves = NumOctaves;
+                Settings.Gain = Gain;
+                Settings.Lacunarity = 2.3f;
+                for (int32_t Sample = 0; Sample < NumSamples / 16; ++Sample)
+                {
+                    const FFloatWide X(GetRandomCoordinate(Stream));
+                    const FFloatWide Y(GetRandomCoordinate(Stream));
+                    const FFloatWide Z(GetRandomCoordinate(Stream));
+
+                    Settings.Type = ENoiseFractal::FBm;
+                    const float FBm2D = FMath::FractalNoise2D(X, Y, Settings).GetLane(0);
+                    const float FBm3D = FMath::FractalNoise3D(MVectorWide(X, Y, Z), Settings).GetLane(0);
+                    Settings.Type = ENoiseFractal::Ridged;
+                    const float Ridged2D = FMath::FractalNoise2D(X, Y, Settings).GetLane(0);
+                    const float Ridged3D = FMath::FractalNoise3D(MVectorWide(X, Y, Z), Settings).GetLane(0);
+
+                    MinFBm = FMath::Min3(MinFBm, FBm2D, FBm3D);
+                    MaxFBm = FMath::Max3(MaxFBm, FBm2D, FBm3D);
+                    MinRidged = FMath::Min3(MinRidged, Ridged2D, Ridged3D);
+                    MaxRidged = FMath::Max3(MaxRidged, Ridged2D, Ridged3D);
+                }
+            }
+        }
+        std::printf("FBm in [%g, %g], ridged in [%g, %g]\n", MinFBm, MaxFBm, MinRidged, MaxRidged);
+        Report("FBm stays in [-1, 1]", MinFBm >= -1.0f && MaxFBm <= 1.0f && MinFBm < -0.3f && MaxFBm > 0.3f);
+        Report("Ridged stays in [0, 1]", MinRidged >= 0.0f && MaxRidged <= 1.0f && MaxRidged > 0.7f);
+
+        // One octave of FBm is plain Perlin noise
+        const FFloatWide X(1.37f), Y(-4.21f);
+        Report("One octave of FBm is Perlin noise", FMath::FractalNoise2D(X, Y, FNoiseFractalSettings()).GetLane(0) == FMath::PerlinNoise2D(X, Y).GetLane(0));
+    }
+
+    void TestGridThreads()
+    {
+        // Sizes that are not multiples of the lane count, so rows end in partial vectors
+        constexpr int32_t SizeX = 67;
+        constexpr int32_t SizeY = 45;
+        constexpr int32_t SizeZ = 13;
+
+        FNoiseFractalSettings Settings;
+        Settings.Type = ENoiseFractal::Ridged;
+        Settings.NumOctaves = 5;
+
+        const int32_t NumWorkers[3] = { 0, 1, 3 };
+        std::vector<float> Grid2D[3], Grid3D[3];
+        for (int32_t Run = 0; Run < 3; ++Run)
+        {
+            FJobSystem::Get().Init(NumWorkers[Run]);
+            Grid2D[Run].assign((size_t)SizeX * SizeY * 4, -2.0f);
+            Grid3D[Run].assign((size_t)SizeX * SizeY * SizeZ, -2.0f);
+            FMath::NoiseGrid2D(Grid2D[Run].data(), SizeX, SizeY * 4, MVector2D(-3.5f, 10.25f), MVector2D(0.173f, 0.091f), Settings);
+            FMath::NoiseGrid3D(Grid3D[Run].data(), SizeX, SizeY, SizeZ, MVector(2.0f, -1.0f, 0.5f), MVector(0.21f, 0.13f, 0.37f));
+        }
+
+        bool bSame2D = true;
+        bool bSame3D = true;
+        for (int32_t Run = 1; Run < 3; ++Run)
+        {
+            bSame2D &= std::memcmp(Grid2D[Run].data(), Grid2D[0].data(), Grid2D[0].size() * sizeof(float)) == 0;
+            bSame3D &= std::memcmp(Grid3D[Run].data(), Grid3D[0].data(), Grid3D[0].size() * sizeof(float)) == 0;
+        }
+        Report("NoiseGrid2D identical for 1, 2 and 4 threads", bSame2D);
+        Report("NoiseGrid3D identical for 1, 2 and 4 threads", bSame3D);
+
+        // Every cell written, with the value of its lattice point
+        bool bWritten = true;
+        for (const float Value : Grid3D[0])
+        {
+            bWritten &= Value >= -1.0f && Value <= 1.0f;
+        }
+        const int32_t X = 66, Y = 40, Z = 12;
+        const float Expected = FMath::PerlinNoise3D(MVector(2.0f + X * 0.21f, -1.0f + Y * 0.13f, 0.5f + Z * 0.37f));
+        Report("NoiseGrid3D fills every cell at its lattice point", bWritten && std::fabs(Grid3D[0][((size_t)Z * SizeY + Y) * SizeX + X] - Expected) <= ScalarTolerance);
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0x9E21);
+
+    TestWideMatchesScalar(Stream);
+    TestFractalRanges(Stream);
+    TestGridThreads();
+
+    FJobSystem::Get().Shutdown();
+
+    std::printf("%s\n", NumFailures == 0 ? "All noise checks passed" : "Noise checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
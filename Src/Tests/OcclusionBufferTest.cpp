@@ -0,0 +1,201 @@
+#include "CoreMinimal.h"
+#include "Async/JobSystem.h"
+#include "Base/RandomStream.h"
+#include "Render/OcclusionBuffer.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <cstdio>
+#include <vector>
+
+/**
+ * FOcclusionBuffer behind a single wall: boxes in the wall's shadow are culled, and no box that can
+ * be seen around or in front of the wall is, nor any box crossing the near plane. Random boxes
+ * check the second part against the exact shadow of the wall.
+ */
+
+namespace
+{
+    constexpr int32_t Width = 256;
+    constexpr int32_t Height = 128;
+
+    // The wall spans [-WallSize, WallSize] in x and y, WallDistance in front of the camera
+    constexpr float WallSize = 5.0f;
+    constexpr float WallDistance = 10.0f;
+
+    // Boxes closer than this to the edge of the wall's shadow, in pixels, may go either way
+    constexpr float EdgePixels = 2.0f;
+
+    constexpr int32_t NumRandomBoxes = 20000;
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    /** Camera at the origin looking down -z, y up. */
+    glm::mat4 MakeViewProjection()
+    {
+        const glm::mat4 View = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        return glm::perspective(glm::radians(90.0f), (float)Width / Height, 0.1f, 100.0f) * View;
+    }
+
+    void AddWall(FOcclusionBuffer& Buffer, float Z)
+    {
+        const MVector Vertices[4] = { MVector(-WallSize, -WallSize, Z), MVector(WallSize, -WallSize, Z), MVector(WallSize, WallSize, Z), MVector(-WallSize, WallSize, Z) };
+        const int32_t Indices[6] = { 0, 1, 2, 0, 2, 3 };
+        Buffer.AddOccluder(Vertices, 4, Indices, 6);
+    }
+
+    bool IsVisible(const FOcclusionBuffer& Buffer, const MVector& Center, const MVector& Extent)
+    {
+        return Buffer.IsBoxVisible(FBox::BuildAABB(Center, Extent));
+    }
+
+    /**
+     * True when part of the box is certainly not hidden by the wall: a corner on or in front of the
+     * wall's plane, or a corner whose projection is off the wall by more than EdgePixels.
+     */
+    bool IsCertainlyVisible(const glm::mat4& ViewProjection, const MVector& Center, const MVector& Extent)
+    {
+        const glm::vec4 WallCorner = ViewProjection * glm::vec4(WallSize, WallSize, -WallDistance, 1.0f);
+        const float WallX = WallCorner.x / WallCorner.w + EdgePixels * 2.0f / Width;
+        const float WallY = WallCorner.y / WallCorner.w + EdgePixels * 2.0f / Height;
+        for (int32_t Corner = 0; Corner < 8; ++Corner)
+        {
+            const MVector Sign((Corner & 1) ? 1.0f : -1.0f, (Corner & 2) ? 1.0f : -1.0f, (Corner & 4) ? 1.0f : -1.0f);
+            const MVector Point = Center + Extent * Sign;
+            if (Point.z >= -WallDistance)
+            {
+                return true;
+            }
+
+            const glm::vec4 Clip = ViewProjection * glm::vec4(Point.x, Point.y, Point.z, 1.0f);
+            if (FMath::Abs(Clip.x / Clip.w) > WallX || FMath::Abs(Clip.y / Clip.w) > WallY)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TestWall(FOcclusionBuffer& Buffer, const glm::mat4& ViewProjection)
+    {
+        Buffer.BeginFrame(ViewProjection);
+        AddWall(Buffer, -WallDistance);
+        Buffer.Rasterize();
+
+        Report("Wall, behind it culled", !IsVisible(Buffer, MVector(0.0f, 0.0f, -20.0f), MVector(1.0f)));
+        Report("Wall, far behind it culled", !IsVisible(Buffer, MVector(2.0f, -3.0f, -60.0f), MVector(4.0f, 4.0f, 10.0f)));
+        Report("Wall, in front of it kept", IsVisible(Buffer, MVector(0.0f, 0.0f, -5.0f), MVector(1.0f)));
+        Report("Wall, through it kept", IsVisible(Buffer, MVector(0.0f, 0.0f, -10.0f), MVector(1.0f)));
+        Report("Wall, beside it kept", IsVisible(Buffer, MVector(14.0f, 0.0f, -20.0f), MVector(1.0f)));
+        Report("Wall, partially behind it kept", IsVisible(Buffer, MVector(9.0f, 0.0f, -20.0f), MVector(2.0f)));
+        Report("Wall, peeking over it kept", IsVisible(Buffer, MVector(0.0f, 9.0f, -20.0f), MVector(1.0f, 2.0f, 1.0f)));
+
+        // Within the wall's shadow apart from the part reaching the camera
+        Report("Near plane, straddling box kept", IsVisible(Buffer, MVector(0.0f, 0.0f, -15.0f), MVector(0.5f, 0.5f, 15.0f)));
+        Report("Near plane, box around the camera kept", IsVisible(Buffer, MVector(0.0f, 0.0f, 0.0f), MVector(1.0f)));
+    }
+
+    void TestRandomBoxes(FOcclusionBuffer& Buffer, const glm::mat4& ViewProjection)
+    {
+        Buffer.BeginFrame(ViewProjection);
+        AddWall(Buffer, -WallDistance);
+        Buffer.Rasterize();
+
+        FRandomStream Stream(0x0CC1);
+        std::vector<float> CenterX, CenterY, CenterZ, ExtentX, ExtentY, ExtentZ;
+        for (int32_t Index = 0; Index < NumRandomBoxes; ++Index)
+        {
+            // Mostly behind the wall, some reaching through the near plane
+            CenterX.push_back(Stream.FRandRange(-20.0f, 20.0f));
+            CenterY.push_back(Stream.FRandRange(-20.0f, 20.0f));
+            CenterZ.push_back(Stream.FRandRange(-60.0f, 2.0f));
+            ExtentX.push_back(Stream.FRandRange(0.1f, 3.0f));
+            ExtentY.push_back(Stream.FRandRange(0.1f, 3.0f));
+            ExtentZ.push_back(Stream.FRandRange(0.1f, 3.0f));
+        }
+        const FBoxBoundsSoA Bounds = { CenterX.data(), CenterY.data(), CenterZ.data(), ExtentX.data(), ExtentY.data(), ExtentZ.data(), NumRandomBoxes };
+
+        std::vector<int32_t> VisibleIndices(NumRandomBoxes);
+        const FOcclusionStats Stats = Buffer.TestBoxes(Bounds, nullptr, NumRandomBoxes, VisibleIndices.data());
+        const int32_t NumVisible = Stats.NumTested - Stats.NumOccluded;
+
+        std::vector<bool> bReported(NumRandomBoxes, false);
+        bool bAscending = true;
+        for (int32_t Visible = 0; Visible < NumVisible; ++Visible)
+        {
+            bReported[VisibleIndices[Visible]] = true;
+            bAscending &= Visible == 0 || VisibleIndices[Visible] > VisibleIndices[Visible - 1];
+        }
+
+        int32_t NumWronglyCulled = 0;
+        int32_t NumMismatches = 0;
+        for (int32_t Index = 0; Index < NumRandomBoxes; ++Index)
+        {
+            const MVector Center(CenterX[Index], CenterY[Index], CenterZ[Index]);
+            const MVector Extent(ExtentX[Index], ExtentY[Index], ExtentZ[Index]);
+            NumWronglyCulled += !bReported[Index] && IsCertainlyVisible(ViewProjection, Center, Extent) ? 1 : 0;
+            NumMismatches += bReported[Index] != IsVisible(Buffer, Center, Extent) ? 1 : 0;
+        }
+        std::printf("%d of %d random boxes occluded\n", Stats.NumOccluded, NumRandomBoxes);
+        Report("Random boxes, none that can be seen culled", NumWronglyCulled == 0);
+        Report("Random boxes, some culled", Stats.NumOccluded > 0);
+        Report("Random boxes, visible list ascending", bAscending && Stats.NumTested == NumRandomBoxes);
+        Report("Random boxes, IsBoxVisible agrees with TestBoxes", NumMismatches == 0);
+
+        // Every other box as candidates, compacted in place
+        std::vector<int32_t> Candidates;
+        for (int32_t Index = 0; Index < NumRandomBoxes; Index += 2)
+        {
+            Candidates.push_back(Index);
+        }
+        const FOcclusionStats CandidateStats = Buffer.TestBoxes(Bounds, Candidates.data(), (int32_t)Candidates.size(), Candidates.data());
+        int32_t NumExpected = 0;
+        bool bMatches = true;
+        for (int32_t Index = 0; Index < NumRandomBoxes; Index += 2)
+        {
+            if (bReported[Index])
+            {
+                bMatches &= NumExpected < CandidateStats.NumTested - CandidateStats.NumOccluded && Candidates[NumExpected] == Index;
+                ++NumExpected;
+            }
+        }
+        Report("Random boxes, in place candidate list", bMatches && NumExpected == CandidateStats.NumTested - CandidateStats.NumOccluded);
+    }
+
+    void TestNearOccluder(FOcclusionBuffer& Buffer, const glm::mat4& ViewProjection)
+    {
+        Buffer.BeginFrame(ViewProjection);
+        Buffer.Rasterize();
+        Report("No occluders, nothing culled", IsVisible(Buffer, MVector(0.0f, 0.0f, -20.0f), MVector(1.0f)));
+
+        // A wall leaning through the near plane is dropped rather than clipped
+        Buffer.BeginFrame(ViewProjection);
+        const MVector Vertices[4] = { MVector(-WallSize, -WallSize, 1.0f), MVector(WallSize, -WallSize, 1.0f), MVector(WallSize, WallSize, -WallDistance), MVector(-WallSize, WallSize, -WallDistance) };
+        const int32_t Indices[6] = { 0, 1, 2, 0, 2, 3 };
+        Buffer.AddOccluder(Vertices, 4, Indices, 6);
+        Buffer.Rasterize();
+        Report("Occluder crossing the near plane, nothing culled", IsVisible(Buffer, MVector(0.0f, 0.0f, -40.0f), MVector(1.0f)));
+    }
+}
+
+int main()
+{
+    FOcclusionBuffer Buffer;
+    Buffer.Initialize(Width, Height);
+    const glm::mat4 ViewProjection = MakeViewProjection();
+
+    TestWall(Buffer, ViewProjection);
+    TestRandomBoxes(Buffer, ViewProjection);
+    TestNearOccluder(Buffer, ViewProjection);
+
+    FJobSystem::Get().Shutdown();
+
+    std::printf("%s\n", NumFailures == 0 ? "All occlusion buffer checks passed" : "Occlusion buffer checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
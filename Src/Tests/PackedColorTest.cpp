@@ -0,0 +1,180 @@
+#include "CoreMinimal.h"
+#include "Base/PackedColor.h"
+#include "Base/RandomStream.h"
+#include "Util/CpuInfo.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+/**
+ * The HDR packed color formats at their edges: the RGB9E5 exponent clamp and the shared exponent of
+ * tiny colors, R11G11B10F specials, saturation and denormals, and RGBA16F round trips of every half,
+ * also through the array converters at every SIMD tier.
+ */
+
+namespace
+{
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+
+    constexpr int32_t NumRandomColors = 100000;
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    bool IsColor(const FColor& Color, float R, float G, float B, float A = 1.0f)
+    {
+        return Color.R == R && Color.G == G && Color.B == B && Color.A == A;
+    }
+
+    uint32_t GetBits(float Value)
+    {
+        uint32_t Bits;
+        std::memcpy(&Bits, &Value, sizeof(float));
+        return Bits;
+    }
+
+    /** Value of an 11 or 10 bit unsigned float, 5 exponent bits, bias 15. */
+    float DecodeSmallFloat(uint32_t Bits, int32_t MantissaBits)
+    {
+        const int32_t Exponent = (int32_t)(Bits >> MantissaBits);
+        const float Mantissa = (float)(Bits & ((1u << MantissaBits) - 1)) / (float)(1 << MantissaBits);
+        if (Exponent == 31)
+        {
+            return Mantissa == 0.0f ? Infinity : NaN;
+        }
+        return Exponent == 0 ? std::ldexp(Mantissa, -14) : std::ldexp(1.0f + Mantissa, Exponent - 15);
+    }
+
+    void TestRGB9E5(FRandomStream& Stream)
+    {
+        // Exponent 31 and mantissa 511 is the largest value, anything above clamps to it
+        const FColorRGB9E5 Max(FColor(1.e9f, Infinity, FColorRGB9E5::MaxValue, 0.5f));
+        Report("RGB9E5, large values clamp to the largest exponent", Max.Packed == 0xFFFFFFFFu && IsColor(Max.ToColor(), 65408.0f, 65408.0f, 65408.0f));
+        Report("RGB9E5, just above the range clamps", FColorRGB9E5(FColor(65500.0f, 0.0f, 0.0f)).Packed == FColorRGB9E5(511, 0, 0, 31).Packed);
+        Report("RGB9E5, negative and NaN channels are 0", IsColor(FColorRGB9E5(FColor(-1.0f, NaN, -Infinity)).ToColor(), 0.0f, 0.0f, 0.0f));
+
+        // Below 2^-15 the shared exponent stays 0 and the channels are multiples of 2^-24
+        bool bDenormalsExact = true;
+        for (uint32_t Mantissa = 0; Mantissa < 512; ++Mantissa)
+        {
+            const float Value = std::ldexp((float)Mantissa, -24);
+            const FColorRGB9E5 Packed(FColor(Value, Value * 0.5f, 0.0f));
+            bDenormalsExact &= Packed.Packed >> 27 == 0 && Packed.ToColor().R == Value && (Packed.Packed & 0x1FF) == Mantissa;
+        }
+        Report("RGB9E5, tiny colors share exponent 0 and round trip", bDenormalsExact);
+        Report("RGB9E5, below half the smallest step is 0", FColorRGB9E5(FColor(std::ldexp(0.49f, -24), 1.e-40f, 0.0f)).Packed == 0);
+
+        // Rounding the largest channel up to 512 moves to the next exponent
+        const FColorRGB9E5 Carry(FColor(1.0f - std::ldexp(1.0f, -11), 0.25f, 0.0f));
+        Report("RGB9E5, rounding carry bumps the exponent", Carry.Packed >> 27 == 16 && IsColor(Carry.ToColor(), 1.0f, 0.25f, 0.0f));
+
+        // Every channel within half a step of the shared exponent
+        bool bWithinHalfStep = true;
+        for (int32_t Index = 0; Index < NumRandomColors; ++Index)
+        {
+            const float Scale = std::ldexp(1.0f, Stream.RandRange(-20, 15));
+            const FColor Color(Stream.GetFraction() * Scale, Stream.GetFraction() * Scale, Stream.GetFraction() * Scale);
+            const FColorRGB9E5 Packed(Color);
+            const FColor Decoded = Packed.ToColor();
+            const float HalfStep = std::ldexp(0.5f, (int32_t)(Packed.Packed >> 27) - 24);
+            bWithinHalfStep &= std::fabs(Decoded.R - Color.R) <= HalfStep && std::fabs(Decoded.G - Color.G) <= HalfStep && std::fabs(Decoded.B - Color.B) <= HalfStep;
+        }
+        Report("RGB9E5, random colors within half a step", bWithinHalfStep);
+    }
+
+    void TestR11G11B10F()
+    {
+        const FColor Specials = FColorR11G11B10F(FColor(NaN, Infinity, -Infinity)).ToColor();
+        Report("R11G11B10F, NaN and infinity kept", std::isnan(Specials.R) && Specials.G == Infinity && Specials.B == 0.0f && Specials.A == 1.0f);
+        Report("R11G11B10F, negative values are 0", FColorR11G11B10F(FColor(-1.0f, -0.0f, -1.e-30f)).Packed == 0);
+
+        // Largest finite values, (2 - 2^-6) * 2^15 and (2 - 2^-5) * 2^15
+        Report("R11G11B10F, large finite values saturate", IsColor(FColorR11G11B10F(FColor(1.e9f, 65536.0f, 1.e9f)).ToColor(), 65024.0f, 65024.0f, 64512.0f));
+
+        // Denormal steps are 2^-20 for 6 mantissa bits and 2^-19 for 5, halfway values round to even
+        Report("R11G11B10F, smallest denormals", IsColor(FColorR11G11B10F(FColor(std::ldexp(1.0f, -20), std::ldexp(1.0f, -20), std::ldexp(1.0f, -19))).ToColor(), std::ldexp(1.0f, -20), std::ldexp(1.0f, -20), std::ldexp(1.0f, -19)));
+        Report("R11G11B10F, small values round to nearest even", IsColor(FColorR11G11B10F(FColor(std::ldexp(1.0f, -21), std::ldexp(3.0f, -21), std::ldexp(1.0f, -21))).ToColor(), 0.0f, std::ldexp(1.0f, -19), 0.0f));
+        Report("R11G11B10F, float denormals are 0", FColorR11G11B10F(FColor(1.e-40f, 1.e-40f, 1.e-40f)).Packed == 0);
+
+        // Every finite code decodes to its value and encodes back to itself
+        bool bRoundTrips = true;
+        for (uint32_t Bits = 0; Bits < (31u << 6); ++Bits)
+        {
+            const uint32_t BlueBits = Bits >> 1;
+            const FColor Color(DecodeSmallFloat(Bits, 6), DecodeSmallFloat(Bits, 6), DecodeSmallFloat(BlueBits, 5));
+            const FColorR11G11B10F Packed(Color);
+            bRoundTrips &= Packed.Packed == (Bits | (Bits << 11) | (BlueBits << 22)) && IsColor(Packed.ToColor(), Color.R, Color.G, Color.B);
+        }
+        Report("R11G11B10F, every finite value round trips", bRoundTrips);
+    }
+
+    void TestRGBA16F(FRandomStream& Stream)
+    {
+        // Every half through a color and back, NaNs stay NaNs
+        bool bRoundTrips = true;
+        for (uint32_t Bits = 0; Bits < 0x10000; Bits += 4)
+        {
+            const FColorRGBA16F Half(FFloat16::FromBits((uint16_t)Bits), FFloat16::FromBits((uint16_t)(Bits + 1)), FFloat16::FromBits((uint16_t)(Bits + 2)), FFloat16::FromBits((uint16_t)(Bits + 3)));
+            const FColorRGBA16F RoundTrip(Half.ToColor());
+            const FFloat16 Channels[4] = { Half.R, Half.G, Half.B, Half.A };
+            const FFloat16 RoundTripChannels[4] = { RoundTrip.R, RoundTrip.G, RoundTrip.B, RoundTrip.A };
+            for (int32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                bRoundTrips &= Channels[Channel].IsNaN() ? RoundTripChannels[Channel].IsNaN() : Channels[Channel].Encoded == RoundTripChannels[Channel].Encoded;
+            }
+        }
+        Report("RGBA16F, every half round trips", bRoundTrips);
+        Report("RGBA16F, overflow becomes infinity", FColorRGBA16F(FColor(70000.0f, -70000.0f, 65504.0f, 1.0f)) == FColorRGBA16F(FFloat16::FromBits(0x7C00), FFloat16::FromBits(0xFC00), FFloat16::FromBits(0x7BFF), FFloat16::FromBits(0x3C00)));
+
+        // The array converters agree with the single color ones, whatever the tier
+        std::vector<FColor> Colors(NumRandomColors + 3, FColor(0.0f, 0.0f, 0.0f, 0.0f));
+        for (FColor& Color : Colors)
+        {
+            const float Scale = std::ldexp(1.0f, Stream.RandRange(-26, 17));
+            Color = FColor(Stream.FRandRange(-Scale, Scale), Stream.FRandRange(-Scale, Scale), Stream.FRandRange(-Scale, Scale), Stream.GetFraction());
+        }
+        Colors[0] = FColor(NaN, Infinity, -Infinity, -0.0f);
+
+        std::vector<FColorRGBA16F> Packed(Colors.size());
+        std::vector<FColor> Decoded(Colors.size(), FColor(0.0f, 0.0f, 0.0f, 0.0f));
+        for (const ESimdTier Tier : { ESimdTier::Scalar, FCpuInfo::GetFeatures().GetBestTier() })
+        {
+            FCpuInfo::ForceSimdTier(Tier);
+            FColorRGBA16F::FromColors(Colors.data(), (int32_t)Colors.size(), Packed.data());
+            FColorRGBA16F::ToColors(Packed.data(), (int32_t)Packed.size(), Decoded.data());
+
+            bool bMatches = true;
+            for (size_t Index = 0; Index < Colors.size(); ++Index)
+            {
+                const FColor Expected = FColorRGBA16F(Colors[Index]).ToColor();
+                bMatches &= Packed[Index] == FColorRGBA16F(Colors[Index]);
+                bMatches &= GetBits(Decoded[Index].G) == GetBits(Expected.G) && GetBits(Decoded[Index].B) == GetBits(Expected.B) && GetBits(Decoded[Index].A) == GetBits(Expected.A);
+                bMatches &= std::isnan(Expected.R) ? std::isnan(Decoded[Index].R) : GetBits(Decoded[Index].R) == GetBits(Expected.R);
+            }
+            const std::string Check = std::string("RGBA16F, array converters at ") + FCpuInfo::GetSimdTierName(Tier);
+            Report(Check.c_str(), bMatches);
+        }
+        FCpuInfo::ResetSimdTier();
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0x9E5);
+
+    TestRGB9E5(Stream);
+    TestR11G11B10F();
+    TestRGBA16F(Stream);
+
+    std::printf("%s\n", NumFailures == 0 ? "All packed color checks passed" : "Packed color checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,242 @@
+#include "CoreMinimal.h"
+#include "Base/MathUtil.h"
+#include "Base/Sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * FSampling sequences and warps: power of two prefixes of Sobol and Owen scrambled Sobol are
+ * stratified, every sequence stays in [0, 1) and fills ranges independently of how they are split,
+ * the blue noise tile holds every rank once, and the warps land on their shapes.
+ */
+
+namespace
+{
+    // Largest prefix checked for stratification, 2^MaxLog2Count points
+    constexpr int32_t MaxLog2Count = 12;
+
+    constexpr int32_t NumSamples = 1 << 16;
+
+    constexpr float UnitTolerance = 1.e-5f;
+
+    const uint32_t Seeds[3] = { 0, 1, 0xDEADBEEF };
+
+    const ESampleSequence Sequences[5] = { ESampleSequence::Random, ESampleSequence::Halton, ESampleSequence::Sobol, ESampleSequence::OwenSobol, ESampleSequence::R2 };
+    const char* const SequenceNames[5] = { "Random", "Halton", "Sobol", "OwenSobol", "R2" };
+
+    int32_t NumFailures = 0;
+
+    void Report(const std::string& Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check.c_str(), bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    /**
+     * Whether the 2^Log2Count points have exactly one in each cell of every 2^A x 2^(Log2Count - A)
+     * grid, the elementary intervals of a (0, m, 2)-net.
+     */
+    bool IsStratified(const float* X, const float* Y, int32_t Log2Count)
+    {
+        const int32_t Count = 1 << Log2Count;
+        std::vector<int32_t> Cells(Count);
+        for (int32_t Log2Columns = 0; Log2Columns <= Log2Count; ++Log2Columns)
+        {
+            std::fill(Cells.begin(), Cells.end(), 0);
+            for (int32_t Index = 0; Index < Count; ++Index)
+            {
+                const int32_t Column = (int32_t)(X[Index] * (float)(1 << Log2Columns));
+                const int32_t Row = (int32_t)(Y[Index] * (float)(1 << (Log2Count - Log2Columns)));
+                ++Cells[(Row << Log2Columns) + Column];
+            }
+            for (const int32_t NumInCell : Cells)
+            {
+                if (NumInCell != 1)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void TestStratification()
+    {
+        std::vector<float> X(1 << MaxLog2Count), Y(1 << MaxLog2Count);
+        for (const ESampleSequence Sequence : { ESampleSequence::Sobol, ESampleSequence::OwenSobol })
+        {
+            bool bStratified = true;
+            for (const uint32_t Seed : Seeds)
+            {
+                for (int32_t Log2Count = 0; Log2Count <= MaxLog2Count; ++Log2Count)
+                {
+                    // The prefix, and the next block of as many points
+                    for (const uint32_t FirstIndex : { 0u, 1u << Log2Count })
+                    {
+                        FSampling::Generate2D(Sequence, FirstIndex, 1 << Log2Count, Seed, X.data(), Y.data());
+                        bStratified &= IsStratified(X.data(), Y.data(), Log2Count);
+                    }
+                }
+            }
+            Report(std::string(Sequence == ESampleSequence::Sobol ? "Sobol" : "OwenSobol") + ", power of two prefixes stratified", bStratified);
+        }
+
+        // Random points are not, which shows the check can fail
+        FSampling::Generate2D(ESampleSequence::Random, 0, 256, 1, X.data(), Y.data());
+        Report("Random, 256 points not stratified", !IsStratified(X.data(), Y.data(), 8));
+    }
+
+    void TestSequences()
+    {
+        std::vector<float> X(NumSamples), Y(NumSamples), SplitX(NumSamples), SplitY(NumSamples);
+        for (int32_t SequenceIndex = 0; SequenceIndex < 5; ++SequenceIndex)
+        {
+            const ESampleSequence Sequence = Sequences[SequenceIndex];
+            bool bInUnitSquare = true;
+            bool bSplitMatches = true;
+            for (const uint32_t Seed : Seeds)
+            {
+                // Also where the index wraps around 2^32
+                for (const uint32_t FirstIndex : { 0u, 12345u, 0xFFFFFFFFu - NumSamples / 2 })
+                {
+                    FSampling::Generate2D(Sequence, FirstIndex, NumSamples, Seed, X.data(), Y.data());
+                    for (int32_t Index = 0; Index < NumSamples; ++Index)
+                    {
+                        bInUnitSquare &= X[Index] >= 0.0f && X[Index] < 1.0f && Y[Index] >= 0.0f && Y[Index] < 1.0f;
+                    }
+
+                    // The same range in uneven pieces
+                    for (int32_t First = 0, Piece = 1; First < NumSamples; First += Piece, Piece = Piece * 3 + 1)
+                    {
+                        Piece = FMath::Min(Piece, NumSamples - First);
+                        FSampling::Generate2D(Sequence, FirstIndex + (uint32_t)First, Piece, Seed, SplitX.data() + First, SplitY.data() + First);
+                    }
+                    bSplitMatches &= X == SplitX && Y == SplitY;
+                }
+            }
+            Report(std::string(SequenceNames[SequenceIndex]) + ", values in [0, 1)", bInUnitSquare);
+            Report(std::string(SequenceNames[SequenceIndex]) + ", a range split in pieces matches one fill", bSplitMatches);
+        }
+
+        // The scalar generators, every Halton base and R2 from any offset
+        bool bHaltonInRange = true;
+        bool bR2InRange = true;
+        for (uint32_t Index = 0; Index < (uint32_t)NumSamples; ++Index)
+        {
+            const uint32_t SampleIndex = Index * 65537u;
+            for (int32_t Dimension = 0; Dimension < FSampling::MaxHaltonDimensions; ++Dimension)
+            {
+                const float Value = FSampling::Halton(SampleIndex, Dimension);
+                bHaltonInRange &= Value >= 0.0f && Value < 1.0f;
+            }
+            const MVector2D R2 = FSampling::R2(SampleIndex, MVector2D(0.999999f, 0.0f));
+            bR2InRange &= R2.x >= 0.0f && R2.x < 1.0f && R2.y >= 0.0f && R2.y < 1.0f;
+        }
+        Report("Halton, every base in [0, 1)", bHaltonInRange);
+        Report("R2, values in [0, 1)", bR2InRange);
+    }
+
+    void TestBlueNoise()
+    {
+        constexpr int32_t NumPixels = FSampling::BlueNoiseTileSize * FSampling::BlueNoiseTileSize;
+        const float* Tile = FSampling::GetBlueNoiseTile();
+        std::vector<int32_t> RankCounts(NumPixels, 0);
+        bool bValid = true;
+        for (int32_t Pixel = 0; Pixel < NumPixels; ++Pixel)
+        {
+            // Values are (Rank + 0.5) / NumPixels
+            const float Rank = Tile[Pixel] * NumPixels - 0.5f;
+            const int32_t RoundedRank = (int32_t)std::lround(Rank);
+            bValid &= std::fabs(Rank - (float)RoundedRank) < 1.e-2f && RoundedRank >= 0 && RoundedRank < NumPixels;
+            if (bValid)
+            {
+                ++RankCounts[RoundedRank];
+            }
+        }
+        for (const int32_t Count : RankCounts)
+        {
+            bValid &= Count == 1;
+        }
+        Report("Blue noise, ranks form a permutation", bValid);
+        Report("Blue noise, lookups wrap around the tile", FSampling::BlueNoise(-1, 64) == Tile[FSampling::BlueNoiseTileSize - 1] && FSampling::BlueNoise(70, 3) == Tile[3 * FSampling::BlueNoiseTileSize + 6]);
+    }
+
+    void TestWarps()
+    {
+        std::vector<float> U(NumSamples), V(NumSamples);
+        FSampling::Generate2D(ESampleSequence::Random, 0, NumSamples, 7, U.data(), V.data());
+
+        // The corners and edges of the square
+        const float Edges[3] = { 0.0f, 0.5f, 0.99999994f };
+        for (int32_t Corner = 0; Corner < 9; ++Corner)
+        {
+            U[Corner] = Edges[Corner % 3];
+            V[Corner] = Edges[Corner / 3];
+        }
+
+        const float CosHalfAngle = 0.8f;
+        bool bScalarUnit = true;
+        bool bScalarOnShape = true;
+        for (int32_t Index = 0; Index < NumSamples; ++Index)
+        {
+            const MVector2D Sample(U[Index], V[Index]);
+            const MVector Directions[4] = { FSampling::UniformSphere(Sample), FSampling::UniformHemisphere(Sample), FSampling::CosineHemisphere(Sample), FSampling::UniformCone(Sample, CosHalfAngle) };
+            for (const MVector& Direction : Directions)
+            {
+                bScalarUnit &= std::fabs(Direction.Size() - 1.0f) < UnitTolerance;
+            }
+            bScalarOnShape &= Directions[1].z >= 0.0f && Directions[2].z >= 0.0f && Directions[3].z >= CosHalfAngle - UnitTolerance;
+            bScalarOnShape &= FSampling::ConcentricDisk(Sample).Size() <= 1.0f + UnitTolerance;
+        }
+        Report("Warps, scalar directions are unit vectors", bScalarUnit);
+        Report("Warps, scalar samples on their shapes", bScalarOnShape);
+
+        // The bulk warps around a tilted axis, over a count that leaves a partial vector
+        const MVector Axis = MVector(0.3f, -0.5f, 0.8f).GetSafeNormal();
+        const int32_t Num = NumSamples - 3;
+        std::vector<float> X(NumSamples), Y(NumSamples), Z(NumSamples);
+        const auto CheckDirections = [&](float MinCosine)
+        {
+            bool bValid = true;
+            for (int32_t Index = 0; Index < Num; ++Index)
+            {
+                const MVector Direction(X[Index], Y[Index], Z[Index]);
+                bValid &= std::fabs(Direction.Size() - 1.0f) < UnitTolerance && (Direction | Axis) >= MinCosine - UnitTolerance;
+            }
+            return bValid;
+        };
+
+        FSampling::WarpToSphere(U.data(), V.data(), Num, X.data(), Y.data(), Z.data());
+        bool bBulkValid = CheckDirections(-1.0f);
+        FSampling::WarpToHemisphere(U.data(), V.data(), Num, Axis, X.data(), Y.data(), Z.data());
+        bBulkValid &= CheckDirections(0.0f);
+        FSampling::WarpToCosineHemisphere(U.data(), V.data(), Num, Axis, X.data(), Y.data(), Z.data());
+        bBulkValid &= CheckDirections(0.0f);
+        FSampling::WarpToCone(U.data(), V.data(), Num, Axis, CosHalfAngle, X.data(), Y.data(), Z.data());
+        bBulkValid &= CheckDirections(CosHalfAngle);
+        Report("Warps, bulk directions are unit vectors around the axis", bBulkValid);
+
+        FSampling::WarpToDisk(U.data(), V.data(), Num, X.data(), Y.data());
+        bool bInDisk = true;
+        for (int32_t Index = 0; Index < Num; ++Index)
+        {
+            bInDisk &= X[Index] * X[Index] + Y[Index] * Y[Index] <= 1.0f + UnitTolerance;
+        }
+        Report("Warps, bulk disk samples in the unit disk", bInDisk);
+    }
+}
+
+int main()
+{
+    TestStratification();
+    TestSequences();
+    TestBlueNoise();
+    TestWarps();
+
+    std::printf("%s\n", NumFailures == 0 ? "All sampling checks passed" : "Sampling checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+#include "CoreMinimal.h"
+#include "Async/JobSystem.h"
+#include "Base/MathUtil.h"
+#include "Software/SoftwareRasterizer.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+/**
+ * Deterministic coverage and shading checks of FSoftwareRasterizer: the top-left rule on edges that
+ * pass exactly through pixel centers, near plane clipping and perspective correct interpolation.
+ * The framebuffer spans several tiles so shapes cross tile boundaries.
+ */
+
+namespace
+{
+    constexpr int32_t Size = 192;
+    constexpr uint32_t ClearColor = 0;
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    /** Clip space position of a pixel space point, for an identity view projection. */
+    MVector PixelToClip(float X, float Y)
+    {
+        return MVector(X * (2.0f / Size) - 1.0f, 1.0f - Y * (2.0f / Size), 0.0f);
+    }
+
+    uint32_t GetPixel(const FSoftwareRasterizer& Rasterizer, int32_t X, int32_t Y)
+    {
+        return Rasterizer.GetPixels()[(size_t)Y * Rasterizer.GetPitch() + X];
+    }
+
+    /** Adds one to Coverage for every pixel the triangle list writes. */
+    void AccumulateCoverage(FSoftwareRasterizer& Rasterizer, const std::vector<MVector>& Positions, const std::vector<int32_t>& Indices, std::vector<int32_t>& Coverage)
+    {
+        const glm::mat4 Identity(1.0f);
+        const std::vector<uint32_t> Colors(Positions.size(), 0xFFFFFFFF);
+        for (size_t Triangle = 0; Triangle < Indices.size(); Triangle += 3)
+        {
+            Rasterizer.BeginFrame(ClearColor);
+            Rasterizer.DrawTriangles(Identity, Positions.data(), Colors.data(), (int32_t)Positions.size(), &Indices[Triangle], 3);
+            Rasterizer.Render();
+            for (int32_t Y = 0; Y < Size; ++Y)
+            {
+                for (int32_t X = 0; X < Size; ++X)
+                {
+                    Coverage[(size_t)Y * Size + X] += GetPixel(Rasterizer, X, Y) != ClearColor ? 1 : 0;
+                }
+            }
+        }
+    }
+
+    void TestTopLeftRule(FSoftwareRasterizer& Rasterizer)
+    {
+        // Square with its edges on pixel centers, split along a diagonal that also passes through centers
+        const float Min = 40.5f;
+        const float Max = 130.5f;
+        const std::vector<MVector> SquarePositions = { PixelToClip(Min, Min), PixelToClip(Max, Min), PixelToClip(Max, Max), PixelToClip(Min, Max) };
+        const std::vector<int32_t> SquareIndices = { 0, 1, 2, 0, 2, 3 };
+
+        std::vector<int32_t> Coverage((size_t)Size * Size, 0);
+        AccumulateCoverage(Rasterizer, SquarePositions, SquareIndices, Coverage);
+
+        // Top and left edges are in, bottom and right edges are out, the diagonal is drawn once
+        int32_t NumWrong = 0;
+        for (int32_t Y = 0; Y < Size; ++Y)
+        {
+            for (int32_t X = 0; X < Size; ++X)
+            {
+                const bool bInside = X >= 40 && X < 130 && Y >= 40 && Y < 130;
+                NumWrong += Coverage[(size_t)Y * Size + X] == (bInside ? 1 : 0) ? 0 : 1;
+            }
+        }
+        Report("Top-left rule, split square covered exactly once", NumWrong == 0);
+
+        // Fan around an off-grid center, every shared edge at its own slope, both windings
+        std::vector<MVector> FanPositions = { PixelToClip(97.3f, 91.7f) };
+        std::vector<int32_t> FanIndices;
+        constexpr int32_t NumFanTriangles = 13;
+        for (int32_t Vertex = 0; Vertex < NumFanTriangles; ++Vertex)
+        {
+            const float Angle = 2.0f * PI * Vertex / NumFanTriangles;
+            const float Radius = 60.0f + 15.0f * (Vertex % 3);
+            FanPositions.push_back(PixelToClip(97.3f + Radius * std::cos(Angle), 91.7f + Radius * std::sin(Angle)));
+        }
+        for (int32_t Vertex = 0; Vertex < NumFanTriangles; ++Vertex)
+        {
+            const int32_t Next = (Vertex + 1) % NumFanTriangles;
+            FanIndices.insert(FanIndices.end(), { 0, Vertex % 2 == 0 ? Vertex + 1 : Next + 1, Vertex % 2 == 0 ? Next + 1 : Vertex + 1 });
+        }
+
+        std::fill(Coverage.begin(), Coverage.end(), 0);
+        AccumulateCoverage(Rasterizer, FanPositions, FanIndices, Coverage);
+
+        // No pixel twice, and no hole within the radius every triangle of the fan reaches
+        int32_t NumOverlaps = 0;
+        int32_t NumHoles = 0;
+        for (int32_t Y = 0; Y < Size; ++Y)
+        {
+            for (int32_t X = 0; X < Size; ++X)
+            {
+                const int32_t Count = Coverage[(size_t)Y * Size + X];
+                const float DistanceX = X + 0.5f - 97.3f;
+                const float DistanceY = Y + 0.5f - 91.7f;
+                NumOverlaps += Count > 1 ? 1 : 0;
+                NumHoles += Count == 0 && DistanceX * DistanceX + DistanceY * DistanceY < 50.0f * 50.0f ? 1 : 0;
+            }
+        }
+        Report("Top-left rule, fan has no overlaps", NumOverlaps == 0);
+        Report("Top-left rule, fan has no holes", NumHoles == 0);
+    }
+
+    void TestNearClip(FSoftwareRasterizer& Rasterizer)
+    {
+        // Camera at the origin looking down -z, near plane at 1
+        const glm::mat4 Projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+        const std::vector<uint32_t> Colors(4, 0xFFFFFFFF);
+        const int32_t Indices[3] = { 0, 1, 2 };
+
+        const auto CountClipped = [&](const MVector& V0, const MVector& V1, const MVector& V2)
+        {
+            const MVector Positions[3] = { V0, V1, V2 };
+            Rasterizer.BeginFrame(ClearColor);
+            Rasterizer.DrawTriangles(Projection, Positions, Colors.data(), 3, Indices, 3);
+            return Rasterizer.GetNumTriangles();
+        };
+
+        Report("Near clip, all in front kept as one triangle", CountClipped(MVector(-1.0f, -1.0f, -5.0f), MVector(1.0f, -1.0f, -5.0f), MVector(0.0f, 1.0f, -5.0f)) == 1);
+        Report("Near clip, one vertex behind splits into two", CountClipped(MVector(-1.0f, -1.0f, -5.0f), MVector(1.0f, -1.0f, -5.0f), MVector(0.0f, -1.0f, 5.0f)) == 2);
+        Report("Near clip, two vertices behind stays one", CountClipped(MVector(-1.0f, -1.0f, -5.0f), MVector(1.0f, -1.0f, 5.0f), MVector(0.0f, -1.0f, 5.0f)) == 1);
+        Report("Near clip, all behind dropped", CountClipped(MVector(-1.0f, -1.0f, 5.0f), MVector(1.0f, -1.0f, 5.0f), MVector(0.0f, 1.0f, 5.0f)) == 0);
+
+        // Ground plane under the camera reaching far behind it: the bottom row is covered, nothing above the horizon
+        const MVector Ground[4] = { MVector(-50.0f, -1.0f, 50.0f), MVector(50.0f, -1.0f, 50.0f), MVector(-50.0f, -1.0f, -50.0f), MVector(50.0f, -1.0f, -50.0f) };
+        const int32_t GroundIndices[6] = { 0, 1, 2, 1, 3, 2 };
+        Rasterizer.BeginFrame(ClearColor);
+        Rasterizer.DrawTriangles(Projection, Ground, Colors.data(), 4, GroundIndices, 6);
+        Rasterizer.Render();
+
+        int32_t NumWrong = 0;
+        for (int32_t X = 0; X < Size; ++X)
+        {
+            NumWrong += GetPixel(Rasterizer, X, Size - 1) != ClearColor ? 0 : 1;
+            for (int32_t Y = 0; Y <= Size / 2; ++Y)
+            {
+                NumWrong += GetPixel(Rasterizer, X, Y) == ClearColor ? 0 : 1;
+            }
+        }
+        Report("Near clip, ground plane through the camera plane", NumWrong == 0);
+    }
+
+    void TestPerspectiveInterpolation(FSoftwareRasterizer& Rasterizer)
+    {
+        // Floor strip one unit below the camera from 2 to 10 units away, red rising from 0 near to 255 far
+        const glm::mat4 Projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+        const MVector Positions[4] = { MVector(-1.0f, -1.0f, -2.0f), MVector(1.0f, -1.0f, -2.0f), MVector(-1.0f, -1.0f, -10.0f), MVector(1.0f, -1.0f, -10.0f) };
+        const uint32_t Colors[4] = { 0xFF000000, 0xFF000000, 0xFF0000FF, 0xFF0000FF };
+        const int32_t Indices[6] = { 0, 1, 2, 1, 3, 2 };
+        Rasterizer.BeginFrame(ClearColor);
+        Rasterizer.DrawTriangles(Projection, Positions, Colors, 4, Indices, 6);
+        Rasterizer.Render();
+
+        // With a 90 degree field of view a pixel row at NDC height -Y sees the floor at distance 1 / Y
+        double MaxError = 0.0;
+        double MaxAffineError = 0.0;
+        for (int32_t Y = Size / 2; Y < Size; ++Y)
+        {
+            const double NdcY = (Y + 0.5) * 2.0 / Size - 1.0;
+            const double Distance = 1.0 / NdcY;
+            if (Distance < 2.1 || Distance > 9.9)
+            {
+                continue;
+            }
+
+            const double Expected = (Distance - 2.0) / 8.0 * 255.0;
+            const double Affine = (0.5 - 1.0 / Distance) / (0.5 - 0.1) * 255.0;
+            const double Red = (double)(GetPixel(Rasterizer, Size / 2, Y) & 0xFF);
+            MaxError = std::fmax(MaxError, std::fabs(Red - Expected));
+            MaxAffineError = std::fmax(MaxAffineError, std::fabs(Affine - Expected));
+        }
+        std::printf("Perspective interpolation max error %.2f / 255, screen space interpolation would be off by %.1f\n", MaxError, MaxAffineError);
+        Report("Perspective correct colors within 1 / 255", MaxError <= 1.0 && MaxAffineError > 10.0);
+    }
+}
+
+int main()
+{
+    FSoftwareRasterizer Rasterizer;
+    Rasterizer.Resize(Size, Size);
+
+    TestTopLeftRule(Rasterizer);
+    TestNearClip(Rasterizer);
+    TestPerspectiveInterpolation(Rasterizer);
+
+    FJobSystem::Get().Shutdown();
+
+    std::printf("%s\n", NumFailures == 0 ? "All rasterizer checks passed" : "Rasterizer checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+#include "CoreMinimal.h"
+#include "Async/JobSystem.h"
+#include "Base/MathUtil.h"
+#include "Base/RandomStream.h"
+#include "Render/SwizzledTexture.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+/**
+ * FSwizzledTexture: the swizzled storage reads back the row-major texels, bilinear sampling matches a
+ * scalar row-major reference with wrap and clamp addressing, and coordinates or levels of detail that
+ * are NaN, infinite or huge still land inside the texture.
+ */
+
+namespace
+{
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+
+    // Not multiples of the tile size, so the last tiles are partly used
+    constexpr int32_t Width = 77;
+    constexpr int32_t Height = 45;
+
+    constexpr int32_t NumSamples = 1 << 14;
+
+    constexpr float SampleTolerance = 1.e-4f;
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    /** Bilinear sample of one channel of row-major texels, one lookup at a time. */
+    float SampleReference(const std::vector<uint32_t>& Texels, float U, float V, int32_t Channel, ETextureAddress Address)
+    {
+        const float X = U * Width - 0.5f;
+        const float Y = V * Height - 0.5f;
+        const float FloorX = FMath::FloorToFloat(X);
+        const float FloorY = FMath::FloorToFloat(Y);
+
+        const auto ApplyAddress = [Address](int32_t Coordinate, int32_t Size)
+        {
+            if (Address == ETextureAddress::Clamp)
+            {
+                return FMath::Clamp(Coordinate, 0, Size - 1);
+            }
+            const int32_t Wrapped = Coordinate % Size;
+            return Wrapped < 0 ? Wrapped + Size : Wrapped;
+        };
+        const auto GetTexelChannel = [&](int32_t OffsetX, int32_t OffsetY)
+        {
+            const int32_t TexelX = ApplyAddress((int32_t)FloorX + OffsetX, Width);
+            const int32_t TexelY = ApplyAddress((int32_t)FloorY + OffsetY, Height);
+            return (float)((Texels[(size_t)TexelY * Width + TexelX] >> (Channel * 8)) & 0xFF);
+        };
+        const float Top = FMath::Lerp(GetTexelChannel(0, 0), GetTexelChannel(1, 0), X - FloorX);
+        const float Bottom = FMath::Lerp(GetTexelChannel(0, 1), GetTexelChannel(1, 1), X - FloorX);
+        return FMath::Lerp(Top, Bottom, Y - FloorY) * (1.0f / 255.0f);
+    }
+
+    bool IsColorInRange(const FColorWide& Color)
+    {
+        bool bInRange = true;
+        for (int32_t Lane = 0; Lane < FFloatWide::Lanes; ++Lane)
+        {
+            for (const FFloatWide* Channel : { &Color.R, &Color.G, &Color.B, &Color.A })
+            {
+                const float Value = Channel->GetLane(Lane);
+                bInRange &= Value >= 0.0f && Value <= 1.0f;
+            }
+        }
+        return bInRange;
+    }
+
+    bool IsSameColor(const FColorWide& A, const FColorWide& B)
+    {
+        bool bSame = true;
+        for (int32_t Lane = 0; Lane < FFloatWide::Lanes; ++Lane)
+        {
+            bSame &= A.R.GetLane(Lane) == B.R.GetLane(Lane) && A.G.GetLane(Lane) == B.G.GetLane(Lane);
+            bSame &= A.B.GetLane(Lane) == B.B.GetLane(Lane) && A.A.GetLane(Lane) == B.A.GetLane(Lane);
+        }
+        return bSame;
+    }
+
+    void TestLayout(const FSwizzledTexture& Texture, const std::vector<uint32_t>& Texels)
+    {
+        std::vector<uint32_t> Level((size_t)Width * Height);
+        Texture.ReadLevel(0, Level.data());
+        Report("Level 0 reads back the row-major texels", Level == Texels);
+        // Odd sizes round up, 77x45 then 39x23 and so on
+        Report("Mip chain goes down to 1x1", Texture.GetNumLevels() == 8 && Texture.GetWidth(7) == 1 && Texture.GetHeight(7) == 1);
+    }
+
+    void TestBilinear(FRandomStream& Stream, const FSwizzledTexture& Texture, const std::vector<uint32_t>& Texels)
+    {
+        constexpr int32_t Lanes = FFloatWide::Lanes;
+        for (const ETextureAddress Address : { ETextureAddress::Wrap, ETextureAddress::Clamp })
+        {
+            float MaxError = 0.0f;
+            for (int32_t Sample = 0; Sample < NumSamples; Sample += Lanes)
+            {
+                // A few texture repeats either side of the unit square
+                float U[Lanes], V[Lanes];
+                for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+                {
+                    U[Lane] = Stream.FRandRange(-3.0f, 4.0f);
+                    V[Lane] = Stream.FRandRange(-3.0f, 4.0f);
+                }
+
+                const FColorWide Color = Texture.SampleBilinear(FFloatWide::Load(U), FFloatWide::Load(V), 0, Address);
+                const FFloatWide* Channels[4] = { &Color.R, &Color.G, &Color.B, &Color.A };
+                for (int32_t Lane = 0; Lane < Lanes; ++Lane)
+                {
+                    for (int32_t Channel = 0; Channel < 4; ++Channel)
+                    {
+                        MaxError = FMath::Max(MaxError, std::fabs(Channels[Channel]->GetLane(Lane) - SampleReference(Texels, U[Lane], V[Lane], Channel, Address)));
+                    }
+                }
+            }
+            std::printf("%s bilinear against the row-major reference, max error %g\n", Address == ETextureAddress::Wrap ? "Wrap" : "Clamp", MaxError);
+            Report(Address == ETextureAddress::Wrap ? "Bilinear with wrap matches the reference" : "Bilinear with clamp matches the reference", MaxError <= SampleTolerance);
+        }
+    }
+
+    void TestNonFinite(const FSwizzledTexture& Texture)
+    {
+        // Non-finite coordinates sample at texel center 0, huge ones at a valid texel
+        const FFloatWide Center(0.5f / Width);
+        const FFloatWide CenterV(0.5f / Height);
+        const FFloatWide Valid(0.3f);
+        bool bNonFiniteAtCenter = true;
+        bool bInRange = true;
+        for (const ETextureAddress Address : { ETextureAddress::Wrap, ETextureAddress::Clamp })
+        {
+            for (const float Value : { NaN, Infinity, -Infinity })
+            {
+                bNonFiniteAtCenter &= IsSameColor(Texture.SampleBilinear(FFloatWide(Value), Valid, 0, Address), Texture.SampleBilinear(Center, Valid, 0, Address));
+                bNonFiniteAtCenter &= IsSameColor(Texture.SampleBilinear(Valid, FFloatWide(Value), 0, Address), Texture.SampleBilinear(Valid, CenterV, 0, Address));
+                bNonFiniteAtCenter &= IsSameColor(Texture.SampleBilinear(FFloatWide(Value), FFloatWide(Value), 2, Address), Texture.SampleBilinear(FFloatWide(0.5f / 20), FFloatWide(0.5f / 12), 2, Address));
+            }
+            for (const float Value : { 1.e7f, -3.e9f, 1.e30f, -FLT_MAX, FLT_MAX })
+            {
+                bInRange &= IsColorInRange(Texture.SampleBilinear(FFloatWide(Value), FFloatWide(-Value * 0.5f), 0, Address));
+                bInRange &= IsColorInRange(Texture.SampleTrilinear(FFloatWide(Value), Valid, FFloatWide(1.5f), Address));
+            }
+        }
+        Report("NaN and infinite coordinates sample texel center 0", bNonFiniteAtCenter);
+        Report("Huge coordinates stay inside the texture", bInRange);
+
+        // NaN levels of detail take level 0, infinite ones clamp to the chain
+        const FFloatWide U(0.37f), V(0.81f);
+        const FColorWide Level0 = Texture.SampleBilinear(U, V, 0);
+        const FColorWide LastLevel = Texture.SampleBilinear(U, V, Texture.GetNumLevels() - 1);
+        Report("NaN and infinite levels of detail are clamped", IsSameColor(Texture.SampleTrilinear(U, V, FFloatWide(NaN)), Level0)
+            && IsSameColor(Texture.SampleTrilinear(U, V, FFloatWide(-Infinity)), Level0) && IsSameColor(Texture.SampleTrilinear(U, V, FFloatWide(Infinity)), LastLevel));
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0x7E16);
+
+    std::vector<uint32_t> Texels((size_t)Width * Height);
+    for (uint32_t& Texel : Texels)
+    {
+        Texel = Stream.GetUnsignedInt();
+    }
+
+    FSwizzledTexture Texture;
+    Texture.Initialize(Texels.data(), Width, Height);
+
+    TestLayout(Texture, Texels);
+    TestBilinear(Stream, Texture, Texels);
+    TestNonFinite(Texture);
+
+    FJobSystem::Get().Shutdown();
+
+    std::printf("%s\n", NumFailures == 0 ? "All swizzled texture checks passed" : "Swizzled texture checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+#include "CoreMinimal.h"
+#include "Async/JobSystem.h"
+#include "Base/RandomStream.h"
+#include "Render/ViewCulling.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+/**
+ * FViewCulling against the scalar FFrustum tests it vectorizes, over enough bounds to span several
+ * chunks and a count that leaves a partial block at the end. More views than MaxViewsPerPass are
+ * culled at once so the second pass is covered too.
+ */
+
+namespace
+{
+    constexpr int32_t NumBounds = 100003;
+    constexpr int32_t NumViews = FViewCulling::MaxViewsPerPass + 3;
+
+    // The wide tests sum the plane distance in another order, bounds this close to a plane may go either way
+    constexpr float Tolerance = 1.e-3f;
+
+    int32_t NumFailures = 0;
+
+    void Report(const char* Check, bool bPassed)
+    {
+        std::printf("%-56s %s\n", Check, bPassed ? "ok" : "FAILED");
+        NumFailures += bPassed ? 0 : 1;
+    }
+
+    struct FBoxArrays
+    {
+        std::vector<float> CenterX, CenterY, CenterZ, ExtentX, ExtentY, ExtentZ;
+
+        FBoxBoundsSoA GetBounds() const
+        {
+            return { CenterX.data(), CenterY.data(), CenterZ.data(), ExtentX.data(), ExtentY.data(), ExtentZ.data(), (int32_t)CenterX.size() };
+        }
+    };
+
+    struct FSphereArrays
+    {
+        std::vector<float> CenterX, CenterY, CenterZ, Radius;
+
+        FSphereBoundsSoA GetBounds() const
+        {
+            return { CenterX.data(), CenterY.data(), CenterZ.data(), Radius.data(), (int32_t)CenterX.size() };
+        }
+    };
+
+    MVector GetRandomPoint(FRandomStream& Stream, float Range)
+    {
+        return MVector(Stream.FRandRange(-Range, Range), Stream.FRandRange(-Range, Range), Stream.FRandRange(-Range, Range));
+    }
+
+    std::vector<FFrustum> MakeViews(FRandomStream& Stream)
+    {
+        std::vector<FFrustum> Views;
+        for (int32_t View = 0; View < NumViews; ++View)
+        {
+            // Every other view is open at the far end
+            const float FarDistance = View % 2 == 0 ? Stream.FRandRange(50.0f, 200.0f) : 0.0f;
+            Views.push_back(FFrustum::MakePerspective(GetRandomPoint(Stream, 50.0f), Stream.GetUnitVector(), MVector(0.0f, 0.0f, 1.0f), Stream.FRandRange(0.3f, 1.2f), Stream.FRandRange(0.5f, 2.0f), Stream.FRandRange(0.1f, 5.0f), FarDistance));
+        }
+        return Views;
+    }
+
+    /**
+     * Compares one view's visible list with the scalar test of every bound. IsVisible(Index, Grow) tests
+     * bound Index grown by Grow, a disagreement only counts when growing and shrinking by Tolerance agree.
+     */
+    template<typename TIsVisible>
+    bool MatchesScalar(const int32_t* VisibleIndices, const FViewCullingStats& Stats, int32_t Num, TIsVisible IsVisible)
+    {
+        if (Stats.NumTested != Num || Stats.NumVisible < 0 || Stats.NumVisible > Num)
+        {
+            return false;
+        }
+
+        int32_t Cursor = 0;
+        for (int32_t Index = 0; Index < Num; ++Index)
+        {
+            const bool bReported = Cursor < Stats.NumVisible && VisibleIndices[Cursor] == Index;
+            Cursor += bReported ? 1 : 0;
+            const bool bAmbiguous = IsVisible(Index, Tolerance) != IsVisible(Index, -Tolerance);
+            if (bReported != IsVisible(Index, 0.0f) && !bAmbiguous)
+            {
+                return false;
+            }
+        }
+
+        // Every reported index was consumed, so the list is ascending and free of duplicates
+        return Cursor == Stats.NumVisible;
+    }
+
+    void TestBoxes(FRandomStream& Stream, const std::vector<FFrustum>& Views)
+    {
+        FBoxArrays Boxes;
+        for (int32_t Index = 0; Index < NumBounds; ++Index)
+        {
+            const MVector Center = GetRandomPoint(Stream, 150.0f);
+            Boxes.CenterX.push_back(Center.x);
+            Boxes.CenterY.push_back(Center.y);
+            Boxes.CenterZ.push_back(Center.z);
+            Boxes.ExtentX.push_back(Stream.FRandRange(0.0f, 5.0f));
+            Boxes.ExtentY.push_back(Stream.FRandRange(0.0f, 5.0f));
+            Boxes.ExtentZ.push_back(Stream.FRandRange(0.0f, 5.0f));
+        }
+        const FBoxBoundsSoA Bounds = Boxes.GetBounds();
+
+        std::vector<std::vector<int32_t>> VisibleIndices(NumViews, std::vector<int32_t>(NumBounds));
+        std::vector<int32_t*> Outputs;
+        for (std::vector<int32_t>& Indices : VisibleIndices)
+        {
+            Outputs.push_back(Indices.data());
+        }
+        std::vector<FViewCullingStats> Stats(NumViews);
+        FViewCulling::CullBoxes(Views.data(), NumViews, Bounds, Outputs.data(), Stats.data());
+
+        bool bAllMatch = true;
+        bool bSingleViewMatches = true;
+        std::vector<int32_t> SingleViewIndices(NumBounds);
+        for (int32_t View = 0; View < NumViews; ++View)
+        {
+            const FFrustum& Frustum = Views[View];
+            bAllMatch &= MatchesScalar(VisibleIndices[View].data(), Stats[View], NumBounds, [&](int32_t Index, float Grow)
+            {
+                const MVector Extent(Boxes.ExtentX[Index] + Grow, Boxes.ExtentY[Index] + Grow, Boxes.ExtentZ[Index] + Grow);
+                return Frustum.IntersectBox(MVector(Boxes.CenterX[Index], Boxes.CenterY[Index], Boxes.CenterZ[Index]), Extent);
+            });
+
+            const FViewCullingStats SingleStats = FViewCulling::CullBoxes(Frustum, Bounds, SingleViewIndices.data());
+            bSingleViewMatches &= SingleStats.NumVisible == Stats[View].NumVisible && std::equal(SingleViewIndices.begin(), SingleViewIndices.begin() + SingleStats.NumVisible, VisibleIndices[View].begin());
+        }
+        Report("Boxes, every view matches FFrustum::IntersectBox", bAllMatch);
+        Report("Boxes, one view at a time matches the multi view pass", bSingleViewMatches);
+
+        int32_t NumVisible = 0;
+        for (const FViewCullingStats& ViewStats : Stats)
+        {
+            NumVisible += ViewStats.NumVisible;
+        }
+        std::printf("%d of %d boxes visible over %d views\n", NumVisible, NumBounds * NumViews, NumViews);
+        Report("Boxes, views see some but not all boxes", NumVisible > 0 && NumVisible < NumBounds * NumViews);
+    }
+
+    void TestSpheres(FRandomStream& Stream, const std::vector<FFrustum>& Views)
+    {
+        FSphereArrays Spheres;
+        for (int32_t Index = 0; Index < NumBounds; ++Index)
+        {
+            const MVector Center = GetRandomPoint(Stream, 150.0f);
+            Spheres.CenterX.push_back(Center.x);
+            Spheres.CenterY.push_back(Center.y);
+            Spheres.CenterZ.push_back(Center.z);
+            Spheres.Radius.push_back(Stream.FRandRange(0.0f, 5.0f));
+        }
+
+        std::vector<std::vector<int32_t>> VisibleIndices(NumViews, std::vector<int32_t>(NumBounds));
+        std::vector<int32_t*> Outputs;
+        for (std::vector<int32_t>& Indices : VisibleIndices)
+        {
+            Outputs.push_back(Indices.data());
+        }
+        std::vector<FViewCullingStats> Stats(NumViews);
+        FViewCulling::CullSpheres(Views.data(), NumViews, Spheres.GetBounds(), Outputs.data(), Stats.data());
+
+        bool bAllMatch = true;
+        for (int32_t View = 0; View < NumViews; ++View)
+        {
+            const FFrustum& Frustum = Views[View];
+            bAllMatch &= MatchesScalar(VisibleIndices[View].data(), Stats[View], NumBounds, [&](int32_t Index, float Grow)
+            {
+                return Frustum.IntersectSphere(MVector(Spheres.CenterX[Index], Spheres.CenterY[Index], Spheres.CenterZ[Index]), Spheres.Radius[Index] + Grow);
+            });
+        }
+        Report("Spheres, every view matches FFrustum::IntersectSphere", bAllMatch);
+    }
+
+    void TestEdgeCases()
+    {
+        const float Zero[5] = {};
+        const float One[5] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        int32_t VisibleIndices[5] = {};
+
+        // A frustum without planes bounds nothing
+        const FViewCullingStats AllStats = FViewCulling::CullSpheres(FFrustum(), { Zero, Zero, Zero, One, 5 }, VisibleIndices);
+        Report("No planes, every bound visible", AllStats.NumTested == 5 && AllStats.NumVisible == 5 && VisibleIndices[4] == 4);
+
+        const FFrustum View = FFrustum::MakePerspective(MVector(0.0f), MVector(1.0f, 0.0f, 0.0f), MVector(0.0f, 0.0f, 1.0f), 0.5f, 1.0f, 0.1f, 10.0f);
+        const FViewCullingStats EmptyStats = FViewCulling::CullBoxes(View, { Zero, Zero, Zero, One, One, One, 0 }, VisibleIndices);
+        Report("No bounds, nothing tested", EmptyStats.NumTested == 0 && EmptyStats.NumVisible == 0);
+    }
+}
+
+int main()
+{
+    FRandomStream Stream(0xC011);
+    const std::vector<FFrustum> Views = MakeViews(Stream);
+
+    TestBoxes(Stream, Views);
+    TestSpheres(Stream, Views);
+    TestEdgeCases();
+
+    FJobSystem::Get().Shutdown();
+
+    std::printf("%s\n", NumFailures == 0 ? "All view culling checks passed" : "View culling checks FAILED");
+    return NumFailures == 0 ? 0 : 1;
+}